@@ -5,18 +5,26 @@
 */
 
 #include "CSWAutoSaveAndLoadSystem.h"
+#include "SaveSystem/CSWSaveJobScheduler.h"
+#include "SaveSystem/CSWDecodedSlotCache.h"
 
 #define LOCTEXT_NAMESPACE "FCSWAutoSaveAndLoadSystemModule"
 
 void FCSWAutoSaveAndLoadSystemModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
+	///Completions of the background save jobs are dispatched on the game thread once per frame
+	FCSWSaveJobScheduler::Get().Startup();
 }
 
 void FCSWAutoSaveAndLoadSystemModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+	///Write the saves still queued and stop the writer thread
+	FCSWSaveJobScheduler::Get().Shutdown();
+	///Release the decoded slots before the names and objects they reference go away
+	FCSWDecodedSlotCache::Get().Empty();
 }
 
 #undef LOCTEXT_NAMESPACE
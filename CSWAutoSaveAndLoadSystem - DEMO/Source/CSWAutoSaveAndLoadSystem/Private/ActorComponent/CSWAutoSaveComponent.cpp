@@ -1,48 +1,139 @@
-/**
-* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
-*
-* Developed by Kevin Yabar Garces
-*/
-
-#include "ActorComponent/CSWAutoSaveComponent.h"
-
-// Sets default values for this component's properties
-UCSWAutoSaveComponent::UCSWAutoSaveComponent()
-{
-	// Set this component to be initialized when the game starts, and to be ticked every frame.  You can turn these features
-	// off to improve performance if you don't need them.
-	PrimaryComponentTick.bCanEverTick = false;
-
-	// ...
-}
-
-void UCSWAutoSaveComponent::OnSaveStart(const UCSWAutoSaveObject* CSWAutoSaveObject)
-{
-	SetWasSaved(true);
-	EventOnSaveStart.Broadcast(CSWAutoSaveObject);
-}
-
-void UCSWAutoSaveComponent::OnSaveEnd(const UCSWAutoSaveObject* CSWAutoSaveObject)
-{
-	EventOnSaveEnd.Broadcast(CSWAutoSaveObject);
-}
-
-void UCSWAutoSaveComponent::OnLoadStart(const UCSWAutoSaveObject* CSWAutoSaveObject)
-{
-	EventOnLoadStart.Broadcast(CSWAutoSaveObject);
-}
-
-void UCSWAutoSaveComponent::OnLoadEnd(const UCSWAutoSaveObject* CSWAutoSaveObject)
-{
-	EventOnLoadEnd.Broadcast(CSWAutoSaveObject);
-}
-
-void UCSWAutoSaveComponent::OnBeginDestroyUnsavedActor(const UCSWAutoSaveObject* CSWAutoSaveObject)
-{
-	EventBeginDestroyOnLoad.Broadcast(CSWAutoSaveObject);
-}
-
-void UCSWAutoSaveComponent::OnUnchangedActor(const UCSWAutoSaveObject* CSWAutoSaveObject)
-{
-	EventUnchangedOnLoad.Broadcast(CSWAutoSaveObject);
-}
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+#include "ActorComponent/CSWAutoSaveComponent.h"
+#include "ActorComponent/CSWStorerComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "GameFramework/Actor.h"
+#include "SaveGame/CSWAutoSaveObject.h"
+#include "Serialization/CSWSavePlan.h"
+#include "Serialization/CSWChecksum.h"
+
+static bool bUseDirtyTracking = true;
+
+// Sets default values for this component's properties
+UCSWAutoSaveComponent::UCSWAutoSaveComponent()
+{
+	// Set this component to be initialized when the game starts, and to be ticked every frame.  You can turn these features
+	// off to improve performance if you don't need them.
+	PrimaryComponentTick.bCanEverTick = false;
+
+	// ...
+}
+
+void UCSWAutoSaveComponent::OnSaveStart(const UCSWAutoSaveObject* CSWAutoSaveObject)
+{
+	SetWasSaved(true);
+	EventOnSaveStart.Broadcast(CSWAutoSaveObject);
+}
+
+void UCSWAutoSaveComponent::OnSaveEnd(const UCSWAutoSaveObject* CSWAutoSaveObject)
+{
+	EventOnSaveEnd.Broadcast(CSWAutoSaveObject);
+}
+
+void UCSWAutoSaveComponent::OnLoadStart(const UCSWAutoSaveObject* CSWAutoSaveObject)
+{
+	EventOnLoadStart.Broadcast(CSWAutoSaveObject);
+}
+
+void UCSWAutoSaveComponent::OnLoadEnd(const UCSWAutoSaveObject* CSWAutoSaveObject)
+{
+	EventOnLoadEnd.Broadcast(CSWAutoSaveObject);
+}
+
+void UCSWAutoSaveComponent::OnBeginDestroyUnsavedActor(const UCSWAutoSaveObject* CSWAutoSaveObject)
+{
+	EventBeginDestroyOnLoad.Broadcast(CSWAutoSaveObject);
+}
+
+void UCSWAutoSaveComponent::OnUnchangedActor(const UCSWAutoSaveObject* CSWAutoSaveObject)
+{
+	EventUnchangedOnLoad.Broadcast(CSWAutoSaveObject);
+}
+
+void UCSWAutoSaveComponent::SetUseDirtyTracking(const bool bEnable)
+{
+	bUseDirtyTracking = bEnable;
+}
+
+bool UCSWAutoSaveComponent::GetUseDirtyTracking()
+{
+	return bUseDirtyTracking;
+}
+
+/** Add a vector to a checksum */
+static uint32 HashVector(const FVector& Vector, const uint32 Crc)
+{
+	return FCSWChecksum::Crc32C(&Vector.X, sizeof(float) * 3, Crc);
+}
+
+/** Checksum of what a record has */
+static uint32 GetActorRecordCrc(const FCSWActorRecord& ActorRecord)
+{
+	uint32 Crc = FCSWChecksum::Crc32C(ActorRecord.Data.GetData(), ActorRecord.Data.Num(), GetTypeHash(ActorRecord.Name));
+	Crc = HashVector(ActorRecord.XForm.GetLocation(), Crc);
+	Crc = HashVector(ActorRecord.XForm.GetScale3D(), Crc);
+	const FQuat Rotation = ActorRecord.XForm.GetRotation();
+	Crc = FCSWChecksum::Crc32C(&Rotation.X, sizeof(float) * 4, Crc);
+	for (const FCSWActorComponentRecord& ComponentRecord : ActorRecord.ComponentsRecord)
+	{
+		Crc = FCSWChecksum::Crc32C(ComponentRecord.Data.GetData(), ComponentRecord.Data.Num(), HashCombine(Crc, GetTypeHash(ComponentRecord.Name)));
+	}
+	return HashCombine(Crc, ActorRecord.ComponentsRecord.Num());
+}
+
+bool UCSWAutoSaveComponent::ComputeSaveStateHash(uint32& OutStateHash) const
+{
+	AActor* Owner = GetOwner();
+	if (!Owner) return false;
+
+	FCSWSavePlanCache& PlanCache = FCSWSavePlanCache::Get();
+	TArray<uint8> Scratch;
+	uint32 Crc = PlanCache.HashObject(Owner, Scratch);
+
+	TInlineComponentArray<UActorComponent*> ActorComponentsArray;
+	Owner->GetComponents(ActorComponentsArray);
+	for (UActorComponent* ActorComponent : ActorComponentsArray)
+	{
+		if (!ActorComponent) continue;
+		///Storer components save all their variables, not only the ones that are hashed
+		if (ActorComponent->IsA<UCSWStorerComponent>()) return false;
+		Crc = PlanCache.HashObject(ActorComponent, Scratch, Crc);
+		if (USceneComponent* SceneComponent = Cast<USceneComponent>(ActorComponent))
+		{
+			Crc = HashVector(SceneComponent->RelativeLocation, Crc);
+			Crc = FCSWChecksum::Crc32C(&SceneComponent->RelativeRotation.Pitch, sizeof(float) * 3, Crc);
+			Crc = HashVector(SceneComponent->RelativeScale3D, Crc);
+		}
+		UPrimitiveComponent* PrimitiveComponent = Cast<UPrimitiveComponent>(ActorComponent);
+		if (PrimitiveComponent && PrimitiveComponent->IsSimulatingPhysics())
+		{
+			Crc = HashVector(PrimitiveComponent->GetPhysicsLinearVelocity(), Crc);
+			Crc = HashVector(PrimitiveComponent->GetPhysicsAngularVelocityInDegrees(), Crc);
+		}
+	}
+	OutStateHash = HashCombine(Crc, ActorComponentsArray.Num());
+	return true;
+}
+
+bool UCSWAutoSaveComponent::IsRecordClean(const UCSWAutoSaveObject* AutoSaveObject, const FCSWActorRecord& ActorRecord, const uint32 StateHash) const
+{
+	///Cheapest checks first
+	if (bDirty || !AutoSaveObject || CleanSaveObject.Get() != AutoSaveObject || CleanStateHash != StateHash) return false;
+	const AActor* Owner = GetOwner();
+	if (!Owner || !Owner->GetActorTransform().Equals(CleanTransform, 0.f)) return false;
+	return CleanRecordCrc == GetActorRecordCrc(ActorRecord);
+}
+
+void UCSWAutoSaveComponent::MarkClean(const UCSWAutoSaveObject* AutoSaveObject, const FCSWActorRecord& ActorRecord, const uint32 StateHash)
+{
+	bDirty = false;
+	CleanSaveObject = AutoSaveObject;
+	CleanTransform = ActorRecord.XForm;
+	CleanStateHash = StateHash;
+	CleanRecordCrc = GetActorRecordCrc(ActorRecord);
+}
@@ -1,1345 +1,2890 @@
-/**
-* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
-*
-* Developed by Kevin Yabar Garces
-*/
-
-#include "BlueprintFunctionLibrary/CSWAutoSaveBlueprintLibrary.h"
-#include "EngineUtils.h"	///actoriterator
-#include "Serialization/BufferArchive.h"	///MemoryWriter
-#include "Serialization/MemoryReader.h"
-#include "Serialization/ArchiveSaveCompressedProxy.h"
-#include "Serialization/ArchiveLoadCompressedProxy.h"
-#include "Kismet/KismetStringLibrary.h"
-#include "HAL/PlatformFilemanager.h"
-#include "SaveGame/CSWAutoSaveObject.h"
-#include "ActorComponent/CSWAutoSaveComponent.h"
-#include "Async/CSWAutoSaveAsyncTasks.h"
-#include "SaveSystem/CSWSaveGameSystem.h"
-#include "ActorComponent/CSWStorerComponent.h"
-#include "Serialization/CustomVersion.h"
-#include "Components/PrimitiveComponent.h"
-#include "UObject/Package.h"
-#include "Engine/Engine.h"
-#include "Misc/EngineVersion.h"
-
-
-#define OUT
-
-static const int UE4_SAVEGAME_FILE_TYPE_TAG = 0x53415647;		// "sAvG"
-
-struct FSaveGameFileVersion
-{
-	enum Type
-	{
-		InitialVersion = 1,
-		// serializing custom versions into the savegame data to handle that type of versioning
-		AddedCustomVersions = 2,
-
-		// -----<new versions can be added above this line>-------------------------------------------------
-		VersionPlusOne,
-		LatestVersion = VersionPlusOne - 1
-	};
-};
-
-
-#pragma region AUTO SAVE AND LOAD MAIN FUNCTIONS
-
-bool UCSWAutoSaveBlueprintLibrary::CSWSaveGameToSlot(USaveGame* SaveGameObject, const FString& SlotName, const int32 UserIndex, const bool bCompressFile /*= true*/, const bool bUseCustomPath /*= false*/, const FString& Path /*= ""*/)
-{
-	ICSWSaveGameSystem* CSWSaveSystem = ICSWPlatformFeaturesModule::Get().GetSaveGameSystem();
-	// If we have a system and an object to save and a save name...
-	if (CSWSaveSystem && SaveGameObject && (SlotName.Len() > 0))
-	{
-		TArray<uint8> ObjectBytes;
-		FMemoryWriter MemoryWriter(ObjectBytes, true);
-
-		// write file type tag. identifies this file type and indicates it's using proper versioning
-		// since older UE4 versions did not version this data.
-		int32 FileTypeTag = UE4_SAVEGAME_FILE_TYPE_TAG;
-		MemoryWriter << FileTypeTag;
-
-		// Write version for this file format
-		int32 SavegameFileVersion = FSaveGameFileVersion::LatestVersion;
-		MemoryWriter << SavegameFileVersion;
-
-		// Write out engine and UE4 version information
-		int32 PackageFileUE4Version = GPackageFileUE4Version;
-		MemoryWriter << PackageFileUE4Version;
-		FEngineVersion SavedEngineVersion = FEngineVersion::Current();
-		MemoryWriter << SavedEngineVersion;
-
-		// Write out custom version data
-		ECustomVersionSerializationFormat::Type const CustomVersionFormat = ECustomVersionSerializationFormat::Latest;
-		int32 CustomVersionFormatInt = static_cast<int32>(CustomVersionFormat);
-		MemoryWriter << CustomVersionFormatInt;
-		FCustomVersionContainer CustomVersions = FCustomVersionContainer::GetRegistered();
-		CustomVersions.Serialize(MemoryWriter, CustomVersionFormat);
-
-		// Write the class name so we know what class to load to
-		FString SaveGameClassName = SaveGameObject->GetClass()->GetName();
-		MemoryWriter << SaveGameClassName;
-
-		// Then save the object state, replacing object refs and names with strings
-		FObjectAndNameAsStringProxyArchive Ar(MemoryWriter, false);
-		SaveGameObject->Serialize(Ar);
-
-		/// Compress ObjectBytes
-		if (bCompressFile)
-		{
-			TArray<uint8> CompressedObjectBytes;
-			CompressArrayOfBytes(ObjectBytes, OUT CompressedObjectBytes);
-			// Stuff that data into the save system with the desired file name
-			return CSWSaveSystem->SaveGame(false, bUseCustomPath, bCompressFile, *Path, *SlotName, UserIndex, CompressedObjectBytes);
-		}
-		else
-		{
-			// Stuff that data into the save system with the desired file name
-			return CSWSaveSystem->SaveGame(false, bUseCustomPath, bCompressFile, *Path, *SlotName, UserIndex, ObjectBytes);
-		}
-	}
-	return false;
-}
-
-void UCSWAutoSaveBlueprintLibrary::CSWSaveGameToSlot_Async(USaveGame* SaveGameObject, const FString& SlotName, const int32 UserIndex, const bool bCompressFile, const bool bUseCustomPath, const FString& Path, const FCSWOnSaveGameResponse& OnCompleted)
-{
-	(new FAutoDeleteAsyncTask<FCSWAsyncSaveGameToSlot>(SaveGameObject, SlotName, UserIndex, bCompressFile, bUseCustomPath, Path, OnCompleted))->StartBackgroundTask();
-}
-
-USaveGame* UCSWAutoSaveBlueprintLibrary::CSWLoadGameFromSlot(USaveGame* SaveGameObject, const FString& SlotName, const int32 UserIndex, const bool bFileIsCompressed /*= true*/, const bool bUseCustomPath /*= false*/, const FString& Path /*= ""*/)
-{
-	ICSWSaveGameSystem* SaveSystem = ICSWPlatformFeaturesModule::Get().GetSaveGameSystem();
-	// If we have a save system and a valid name..
-	if (SaveSystem && (SlotName.Len() > 0) && SaveGameObject)
-	{
-		// Load raw data from slot
-		TArray<uint8> ObjectBytes;
-		bool bSuccess = SaveSystem->LoadGame(false, bUseCustomPath, bFileIsCompressed, *Path, *SlotName, UserIndex, OUT ObjectBytes);
-		if (bSuccess == false) return nullptr;
-		///Try to decompress data
-		TArray<uint8> DecompressedObjectBytes;
-		if (bFileIsCompressed)
-		{
-			DecompressArrayOfBytes(ObjectBytes, OUT DecompressedObjectBytes);
-		}
-		TArray<uint8>& ObjectBytesToUse = bFileIsCompressed ? DecompressedObjectBytes : ObjectBytes;
-		///
-		if (bSuccess)
-		{
-			FMemoryReader MemoryReader(ObjectBytesToUse, true);
-			int32 FileTypeTag;
-			MemoryReader << FileTypeTag;
-
-			int32 SavegameFileVersion;
-			if (FileTypeTag != UE4_SAVEGAME_FILE_TYPE_TAG)
-			{
-				// this is an old saved game, back up the file pointer to the beginning and assume version 1
-				MemoryReader.Seek(0);
-				SavegameFileVersion = FSaveGameFileVersion::InitialVersion;
-			}
-			else
-			{
-				// Read version for this file format
-				MemoryReader << SavegameFileVersion;
-
-				// Read engine and UE4 version information
-				int32 SavedUE4Version;
-				MemoryReader << SavedUE4Version;
-
-				FEngineVersion SavedEngineVersion;
-				MemoryReader << SavedEngineVersion;
-
-				MemoryReader.SetUE4Ver(SavedUE4Version);
-				MemoryReader.SetEngineVer(SavedEngineVersion);
-
-				if (SavegameFileVersion >= FSaveGameFileVersion::AddedCustomVersions)
-				{
-					int32 CustomVersionFormat;
-					MemoryReader << CustomVersionFormat;
-
-					FCustomVersionContainer CustomVersions;
-					CustomVersions.Serialize(MemoryReader, static_cast<ECustomVersionSerializationFormat::Type>(CustomVersionFormat));
-					MemoryReader.SetCustomVersions(CustomVersions);
-				}
-			}
-
-			// Get the class name
-			FString SaveGameClassName;
-			MemoryReader << SaveGameClassName;
-
-			// Try and find it, and failing that, load it
-			UClass* SaveGameClass = FindObject<UClass>(ANY_PACKAGE, *SaveGameClassName);
-			if (SaveGameClass == NULL)
-			{
-				SaveGameClass = LoadObject<UClass>(NULL, *SaveGameClassName);
-			}
-
-			// If we have a class, try and load it.
-			if (SaveGameClass != NULL)
-			{
-				/// Class is obtained from SaveGameObject input. SaveGameObject is already created.
-				//SaveGameObject = NewObject<USaveGame>(GetTransientPackage(), SaveGameClass); 
-
-				FObjectAndNameAsStringProxyArchive Ar(MemoryReader, true);
-				SaveGameObject->Serialize(Ar);
-			}
-		}
-		return SaveGameObject;
-	}
-	else
-	{
-		return nullptr;
-	}
-}
-
-void UCSWAutoSaveBlueprintLibrary::CSWLoadGameFromSlot_Async(USaveGame* SaveGameObject, const FString& SlotName, const int32 UserIndex, const bool bFileIsCompressed, const bool bUseCustomPath, const FString& Path, const FCSWOnLoadGameResponse& OnCompleted)
-{
-	(new FAutoDeleteAsyncTask<FCSWAsyncLoadGameFromSlot>(SaveGameObject, SlotName, UserIndex, bFileIsCompressed, bUseCustomPath, Path, OnCompleted))->StartBackgroundTask();
-}
-
-bool UCSWAutoSaveBlueprintLibrary::CSWDoesSaveGameExist(const FString& SlotName, const int32 UserIndex, const bool bFileIsCompressed /*= true*/, const bool bUseCustomPath /*= false*/, const FString& Path /*= ""*/)
-{
-	if (ICSWSaveGameSystem* SaveSystem = ICSWPlatformFeaturesModule::Get().GetSaveGameSystem())
-	{
-		return SaveSystem->DoesSaveGameExist(bUseCustomPath, bFileIsCompressed, *Path, *SlotName, UserIndex);
-	}
-	return false;
-}
-
-bool UCSWAutoSaveBlueprintLibrary::CSWDeleteSaveGameInSlot(const FString& SlotName, const int32 UserIndex, const bool bFileIsCompressed /*= true*/, const bool bUseCustomPath /*= false*/, const FString& Path /*= ""*/)
-{
-	if (ICSWSaveGameSystem* SaveSystem = ICSWPlatformFeaturesModule::Get().GetSaveGameSystem())
-	{
-		return SaveSystem->DeleteGame(false, bUseCustomPath, bFileIsCompressed, *Path, *SlotName, UserIndex);
-	}
-	return false;
-}
-
-void UCSWAutoSaveBlueprintLibrary::CSWGetSaveGames(TArray<FString>& SlotNames, const bool bFilesAreCompressed /*= true*/, const bool bUseCustomPath /*= false*/, const FString& Path /*= ""*/)
-{
-	/// Validation
-	if (bUseCustomPath && Path.Len() <= 1) return;
-	/// Init
-	const FString Extension = bFilesAreCompressed ? ".csav" : ".sav";
-	const FString LookForExt = TEXT("*") + Extension;
-	const FString FinalPath = bUseCustomPath ? Path : GetPathSaveGames();
-	/// Find files in folder with ext .csav or .sav
-	IFileManager& FileManager = IFileManager::Get();
-	FileManager.FindFiles(OUT SlotNames, *FinalPath, *LookForExt);
-	/// remove .sav or .csav extensions (so the names can be used to load save games directly
-	for (FString& SlotName : SlotNames)
-	{
-		SlotName.RemoveFromEnd(*Extension);
-	}
-}
-
-UCSWAutoSaveObject* UCSWAutoSaveBlueprintLibrary::AutoFillSaveGameObject(UCSWAutoSaveObject* AutoSaveGameObject, const TArray<FCSWLevelWithAutosaveActors>& LevelsWithAutosaveActors)
-{
-	/// Validation
-	if (!AutoSaveGameObject || LevelsWithAutosaveActors.Num() <= 0) return AutoSaveGameObject;
-	///Remove save data in AutoSaveGameObject and fill it with empty data
-	TryRemoveSavedDataFromLevels(AutoSaveGameObject, LevelsWithAutosaveActors);
-	///Save all the actors for all the LevelNameArray into an array in LevelsWithAutosaveActors
-	SaveActorsToArrayOfMaps(AutoSaveGameObject, LevelsWithAutosaveActors);
-	///Return the AutoSaveGameObject
-	return AutoSaveGameObject;
-}
-
-bool UCSWAutoSaveBlueprintLibrary::AutoLoadActorsDataFromSave(const UObject* WorldContextObject, UCSWAutoSaveObject* AutoSaveGameObject, UPARAM(ref) TArray<FCSWLevelWithAutosaveActors>& LevelsWithAutosaveActors)
-{
-	if (!WorldContextObject || !AutoSaveGameObject || LevelsWithAutosaveActors.Num() <= 0) return false;
-	///Force Garbage Collection
-	GEngine->ForceGarbageCollection(true);
-	/// Load the data into each actor
-	LoadActorDataFromArrayOfMapRecords(WorldContextObject, AutoSaveGameObject, LevelsWithAutosaveActors);
-	/// return boolean
-	return true;
-}
-
-void UCSWAutoSaveBlueprintLibrary::GetLevelsWithAutosaveActors(const UObject* WorldContextObject, const TArray<FName>& LevelNameArray, TArray<FCSWLevelWithAutosaveActors>& LevelsWithAutosaveActors)
-{
-	/// Validation
-	if (LevelNameArray.Num() <= 0 || !WorldContextObject) return;
-	/// Get World
-	UWorld* World = GEngine->GetWorldFromContextObjectChecked(WorldContextObject);
-	if (!World) return;
-	/// Before starting we initialize an array of FCSWAutosaveActorsInLevel. This array will only contain level names for now
-	for (const FName& levelName : LevelNameArray)
-	{
-		FCSWLevelWithAutosaveActors temp;
-		temp.Name = levelName;
-		LevelsWithAutosaveActors.Add(temp);
-	}
-	///For each actor in the world, if the actor has the component fill the array for both the OutActors and OutActorComponents references
-	for (FActorIterator It(World); It; ++It)
-	{
-		AActor* Actor = *It;
-		///Continue to the next Actor if this one is invalid
-		if (!Actor || Actor->IsPendingKill()) continue;
-		///Continue to the next Actor if its AutosaveComponent is invalid
-		UCSWAutoSaveComponent* AutosaveComponent = Cast<UCSWAutoSaveComponent>(Actor->GetComponentByClass(UCSWAutoSaveComponent::StaticClass()));
-		if (!AutosaveComponent) continue;
-		/// Get the LevelName the current Actor belongs
-		FName ActorLevelName = CSWGetLevelName(GetActorLevel(Actor));
-		for (FCSWLevelWithAutosaveActors& levelWithAutosaveActors : LevelsWithAutosaveActors)
-		{
-			/// If Actor belongs to a level in LevelNameArray, add the Actor to LevelsWithAutosaveActors
-			if (ActorLevelName == levelWithAutosaveActors.Name)
-			{
-				FCSWAutosaveActor temp;
-				temp.Actor = Actor;
-				temp.AutosaveComponent = AutosaveComponent;
-				/// Now this level is holding a new AutosaveActor struct.
-				levelWithAutosaveActors.AutosaveActors.Add(temp);
-				break;
-			}
-		}
-	}
-}
-#pragma endregion
-
-
-#pragma region FUNCTIONS FOR CUSTOMIZING THE AUTO SAVE AND LOAD SYSTEM
-
-void UCSWAutoSaveBlueprintLibrary::TryRemoveSavedDataFromLevels(UCSWAutoSaveObject* AutoSaveGameObject, const TArray<FCSWLevelWithAutosaveActors>& LevelsWithAutosaveActors)
-{
-	if (!AutoSaveGameObject || LevelsWithAutosaveActors.Num() <= 0) return;
-
-	for (const FCSWLevelWithAutosaveActors& level : LevelsWithAutosaveActors)
-	{
-		///Remove data from this Level first
-		UCSWAutoSaveBlueprintLibrary::TryRemoveSavedDataFromLevel(AutoSaveGameObject, level.Name);
-		///Create an empty newMapRecord with only the name of the level for now
-		FCSWMapRecord NewMapRecord;
-		NewMapRecord.Name = level.Name;
-		AutoSaveGameObject->LevelsRecord.Add(NewMapRecord);
-	}
-}
-
-bool UCSWAutoSaveBlueprintLibrary::TryRemoveSavedDataFromLevel(UCSWAutoSaveObject* AutoSaveGameObject, const FName& LevelName)
-{
-	if (!AutoSaveGameObject || AutoSaveGameObject->LevelsRecord.Num() <= 0) return false;
-
-	///Search in AutoSaveGameObject->LevelsRecord if theres a LevelRecord with the name of LevelName
-	///If it's remove the LevelRecord
-	uint32 MapIndex = 0;
-	bool bLevelDataWasRemoved = false;
-	for (const FCSWMapRecord& MapRecord : AutoSaveGameObject->LevelsRecord)
-	{
-		if (MapRecord.Name == LevelName && AutoSaveGameObject->LevelsRecord.IsValidIndex(MapIndex))
-		{
-			AutoSaveGameObject->LevelsRecord.RemoveAt(MapIndex);
-			bLevelDataWasRemoved = true;
-			break;
-		}
-		MapIndex++;
-	}
-	///Return true or false wether if at least one level was removed or not
-	return bLevelDataWasRemoved;
-}
-
-void UCSWAutoSaveBlueprintLibrary::SaveActorsToArrayOfMaps(UCSWAutoSaveObject* AutoSaveGameObject, const TArray<FCSWLevelWithAutosaveActors>& LevelsWithAutosaveActors)
-{
-	///Validation
-	if (LevelsWithAutosaveActors.Num() <= 0  || !AutoSaveGameObject) return;
-
-	///Foreach Level that contains Actors with AutosaveComponent
-	for (const FCSWLevelWithAutosaveActors& levelWithAutoSaveActor : LevelsWithAutosaveActors)
-	{
-		int32 TotalActorsInCurrentLevel = levelWithAutoSaveActor.AutosaveActors.Num();
-		///Since we already know the level name, we can use it to always know in which AutoSaveGameObject->LevelsRecord index save an Actor
-		bool bMatchFound = false; // Not needed since always will match, but we're going to use it just in case (Because, AutosaveGame has at least an empty record with the name of the level)
-		uint32 LevelRecordIndex = GetLevelRecordIndexSave(AutoSaveGameObject, levelWithAutoSaveActor, OUT bMatchFound);
-		///Save all Actors from the current loaded level (levelWithAutoSaveActor) into AutoSaveGameObject->LevelRecords[LevelRecordIndex]
-		//Don't save this level if the Level doesn't have any Actors to save
-		if (bMatchFound && TotalActorsInCurrentLevel > 0)
-		{
-			SaveAllActorsInLevel(AutoSaveGameObject, levelWithAutoSaveActor, LevelRecordIndex);
-		}
-	}
-}
-
-void UCSWAutoSaveBlueprintLibrary::LoadActorDataFromArrayOfMapRecords(const UObject* WorldContextObject, const UCSWAutoSaveObject* AutoSaveGameObject, UPARAM(ref) TArray<FCSWLevelWithAutosaveActors>& LevelsWithAutosaveActors)
-{
-	LoadActorDataFromArrayOfMapRecords_Internal(WorldContextObject, AutoSaveGameObject, LevelsWithAutosaveActors, false);
-}
-
-void UCSWAutoSaveBlueprintLibrary::LoadActorDataFromArrayOfMapRecords_Internal(const UObject* WorldContextObject, const UCSWAutoSaveObject* AutoSaveGameObject, UPARAM(ref) TArray<FCSWLevelWithAutosaveActors>& LevelsWithAutosaveActors, const bool bLoadInEditorTime)
-{
-	if (!WorldContextObject || !AutoSaveGameObject || LevelsWithAutosaveActors.Num() <= 0) return;
-	///In this case we use level data from AutoSaveGameObject to start the loading
-	for (const FCSWMapRecord& levelRecord : AutoSaveGameObject->LevelsRecord)
-	{
-		///Since we already know the level name, we can use it to always know in which level to Load these Actors
-		bool bMatchFound = false; // We use this so we know that we load data from AutoSaveGameObject->LevelRecords into a Level that exist and is loaded.
-		uint32 LevelRecordIndex = GetLevelRecordIndexLoad(levelRecord, LevelsWithAutosaveActors, bMatchFound);
-		///Load all Actors from the current levelRecord into its Level
-		if (bMatchFound)
-		{
-			///Since we already know the level we want to load, we can iterate trough only the Actors from this Level
-			if (LevelsWithAutosaveActors.IsValidIndex(LevelRecordIndex))
-			{
-				TArray<FCSWAutosaveActor> AutosaveActorsInLevel;
-				AutosaveActorsInLevel = LevelsWithAutosaveActors[LevelRecordIndex].AutosaveActors;
-				///Counters
-				int32 TotalActorsInCurrentLevel = AutosaveActorsInLevel.Num();
-				int32 TotalActorsInLevelRecord = levelRecord.ActorsRecord.Num();
-				//Load Actors in Level if there are ActorsRecords to load or if there Actors in the Level
-				//In case there are only Actors in the Level and no ActorRecords to Load, we still try to load so the Actors can be destroyed in case they weren't saved before
-				if (TotalActorsInCurrentLevel > 0 || TotalActorsInLevelRecord > 0)
-				{
-					///Load All Actors in Level
-					LoadAllActorsInLevel(WorldContextObject, AutoSaveGameObject, levelRecord, AutosaveActorsInLevel, bLoadInEditorTime);
-					///Try to destroy actors in case they weren't updated
-					CSWTryDestroyActors(AutoSaveGameObject, AutosaveActorsInLevel);
-				}
-			}
-		}
-	}
-	GEngine->ForceGarbageCollection(true);
-}
-
-int32 UCSWAutoSaveBlueprintLibrary::GetTotalAutosaveActors(const TArray<FCSWLevelWithAutosaveActors>& LevelsWithAutosaveActors)
-{
-	///Validation
-	if (LevelsWithAutosaveActors.Num() <= 0) return 0;
-	///Count Num of Total Actors
-	int32 TotalActors = 0;
-	for (const FCSWLevelWithAutosaveActors& level : LevelsWithAutosaveActors)
-	{
-		TotalActors = TotalActors + level.AutosaveActors.Num();
-	}
-	return TotalActors;
-}
-
-#pragma endregion
-
-
-#pragma region COMPRESSION UTILITIES
-
-void UCSWAutoSaveBlueprintLibrary::CompressArrayOfBytes(TArray<uint8>& DataArray, TArray<uint8>& CompressedDataArray)
-{
-	if (DataArray.Num() <= 0) return;
-
-	CompressedDataArray.Empty();
-	///Init Compressor
-	FArchiveSaveCompressedProxy Compressor = FArchiveSaveCompressedProxy(CompressedDataArray, ECompressionFlags::COMPRESS_ZLIB);
-
-	if (Compressor.GetError())
-	{
-		UE_LOG(LogTemp, Error, TEXT("CompressArrayOfBytes Error compressing data"));
-		return;
-	}
-	///Compress the data array
-	Compressor << DataArray;
-	///Send compressed data to CompressedDataArray
-	Compressor.Flush();
-	///Clean
-	Compressor.FlushCache();
-	Compressor.Close();
-}
-
-void UCSWAutoSaveBlueprintLibrary::DecompressArrayOfBytes(TArray<uint8>& DataArray, TArray<uint8>& DecompressedDataArray)
-{
-	if (DataArray.Num() <= 0) return;
-	///DECOMPRESS FILE
-	FArchiveLoadCompressedProxy Decompressor = FArchiveLoadCompressedProxy(DataArray, ECompressionFlags::COMPRESS_ZLIB);
-
-	if (Decompressor.GetError())
-	{
-		UE_LOG(LogTemp, Error, TEXT("DecompressArrayOfBytes Error decompressing data"));
-		return;
-	}
-	/// Decompress data array
-	Decompressor << DecompressedDataArray;
-	///Clean
-	Decompressor.FlushCache();
-	Decompressor.Close();
-}
-
-TArray<uint8> UCSWAutoSaveBlueprintLibrary::CSWStringToBytes(const FString& InString, const bool bUseUtf8 /*= true*/)
-{
-	TArray<uint8> OutBytes;
-	if (InString.Len() <= 0) return OutBytes;
-
-	if (bUseUtf8)
-	{
-		///Convert String to UTF8 String
-		FTCHARToUTF8 ToUtf8Converter(InString.GetCharArray().GetData());
-		FString InStringUtf = ToUtf8Converter.Get();
-		///Convert String to Bytes
-		int32 MaxBufferSize = InStringUtf.Len();
-		OutBytes.AddUninitialized(MaxBufferSize);
-		StringToBytes(InStringUtf, OUT OutBytes.GetData(), MaxBufferSize);
-	}
-	else
-	{
-		///Convert String to Bytes
-		int32 MaxBufferSize = InString.Len();
-		OutBytes.AddUninitialized(MaxBufferSize);
-		StringToBytes(InString, OUT OutBytes.GetData(), MaxBufferSize);
-	}
-
-	return OutBytes;
-}
-
-FString UCSWAutoSaveBlueprintLibrary::CSWBytesToString(const TArray<uint8>& DataArray)
-{
-	FString OutString;
-	if (DataArray.Num() <= 0) return OutString;
-
-	///Convert BytesToString
-	OutString = BytesToString(DataArray.GetData(), DataArray.Num());
-
-	return OutString;
-}
-
-void UCSWAutoSaveBlueprintLibrary::ConvertObjectToString(UObject* Object, FString& ObjectAsString)
-{
-	///Check if Object reference is valid
-	if (!Object) return;
-	///Serialize the Object into DataArray
-	TArray<uint8> DataArray;
-	FMemoryWriter MemoryWriter(DataArray, true);
-	FObjectAndNameAsStringProxyArchive Ar(MemoryWriter, false);
-	Object->Serialize(Ar);
-	///Now we have an array of bytes inside DataArray representing the object
-	TArray<uint8> CompressedDataArray;
-	///We use the CompressedDataArray where we're going to store the Compression result of DataArray
-	CompressArrayOfBytes(DataArray, OUT CompressedDataArray);
-	///Now we have a CompressedDataArray representing the Object
-	///Let's convert this CompressedDataArray into a String
-	ObjectAsString = BytesToString(CompressedDataArray.GetData(), CompressedDataArray.Num());
-	///Clean
-	DataArray.Empty();
-	CompressedDataArray.Empty();
-	MemoryWriter.FlushCache();
-	MemoryWriter.Close();
-}
-
-void UCSWAutoSaveBlueprintLibrary::ConvertObjectToString_Async(UObject* Object, const FOnConvertObject& OnConvertObject)
-{
-	(new FAutoDeleteAsyncTask<FCSWAsyncConvertObjectToString>(Object, OnConvertObject))->StartBackgroundTask();
-}
-
-void UCSWAutoSaveBlueprintLibrary::ConvertObjectToBytes(UObject* Object, TArray<uint8>& ObjectAsBytes)
-{
-	///Check if Object reference is valid
-	if (!Object) return;
-	///Serialize the Object into DataArray
-	FMemoryWriter MemoryWriter(ObjectAsBytes, true);
-	FObjectAndNameAsStringProxyArchive Ar(MemoryWriter, false);
-	Object->Serialize(Ar);
-	MemoryWriter.FlushCache();
-	MemoryWriter.Close();
-}
-
-UObject* UCSWAutoSaveBlueprintLibrary::RestoreObjectFromString(UObject* Object, const FString& ObjectAsString)
-{
-	///We check both if the Object and the ObjectAsString are valid
-	if (!Object || ObjectAsString.Len() < 1)return nullptr;
-	///Convert String to Bytes
-	TArray<uint8> CompressedDataArray;
-	int32 MaxBufferSize = ObjectAsString.Len();
-	CompressedDataArray.AddUninitialized(MaxBufferSize);
-	StringToBytes(ObjectAsString, OUT CompressedDataArray.GetData(), MaxBufferSize);
-	///Now, the String was converted to CompressedDataArray, but the data is compressed so we need to decompress it before serializing it to the object
-	///We create a DecompressedDataArray, where the Decompressed Data will be stored
-	TArray<uint8> DecompressedDataArray;
-	DecompressArrayOfBytes(CompressedDataArray, OUT DecompressedDataArray);
-	///Now we have a DecompressedDataArray, let's serialize this data into the Object
-	FMemoryReader MemoryReader(DecompressedDataArray, true);
-	MemoryReader.Seek(0);
-	FObjectAndNameAsStringProxyArchive Ar(MemoryReader, true);
-	Object->Serialize(Ar);
-	///Ok, now the object is restored. We don't need the DataArrays now so let's clean it
-	///NOTE: ObjectAsString is not removed in this function
-	MemoryReader.FlushCache();
-	MemoryReader.Close();
-	CompressedDataArray.Empty();
-	DecompressedDataArray.Empty();
-	///Also, return the Object (which will be casted to the same type as the input object)
-	return Object;
-}
-
-void UCSWAutoSaveBlueprintLibrary::RestoreObjectFromString_Async(UObject* Object, const FString& ObjectAsString, const FOnRestoreObject& OnRestoreObject)
-{
-	(new FAutoDeleteAsyncTask<FCSWAsyncRestoreObjectFromString>(Object, ObjectAsString, OnRestoreObject))->StartBackgroundTask();
-}
-
-UObject* UCSWAutoSaveBlueprintLibrary::RestoreObjectFromBytes(UObject* Object, const TArray<uint8>& ObjectAsBytes)
-{
-	///Now we have a DecompressedDataArray, let's serialize this data into the Object
-	FMemoryReader MemoryReader(ObjectAsBytes, true);
-	MemoryReader.Seek(0);
-	FObjectAndNameAsStringProxyArchive Ar(MemoryReader, true);
-	Object->Serialize(Ar);
-	///Clean
-	MemoryReader.FlushCache();
-	MemoryReader.Close();
-	///Return object
-	return Object;
-}
-
-#pragma endregion
-
-
-#pragma region GENERAL UTILITIES
-
-void UCSWAutoSaveBlueprintLibrary::GetSubstringBetween(const FString& SearchIn, const FString& FirstString, const FString& EndString, FString& SubstringResult, const bool bFirstUseCase /*= false*/, const bool bEndUseCase /*= false*/, const bool bFirstSearchFromEnd /*= false*/, const bool bEndSearchFromEnd /*= false*/, const int32 FirstStartPos /*= -1*/, const int32 EndStartPos /*= -1*/, const bool bIncludeFirstString /*= false*/, const bool bIncludeEndString /*= false*/)
-{
-	/// Get the Index where the First String and the End String Was Found
-	/// Example if the SourceString is "/Game/File.asdas", The FirstString is "/" starting from end, and the EndString is "."
-	/// The index result for "/Game/File.asdas" will be, BeginIndex: 5 and EndInxes: 10
-	int32 BeginIndex = UKismetStringLibrary::FindSubstring(SearchIn, FirstString, bFirstUseCase, bFirstSearchFromEnd, FirstStartPos);
-	int32 EndIndex = UKismetStringLibrary::FindSubstring(SearchIn, EndString, bEndUseCase, bEndSearchFromEnd, EndStartPos);
-	/// Include First and EndString in the result, IF the booleans are true
-	if (bIncludeFirstString == false)
-	{
-		BeginIndex = BeginIndex + FirstString.Len();
-	}
-	if (bIncludeEndString == true)
-	{
-		EndIndex = EndIndex + EndString.Len();
-	}
-
-	/// Get the substring between those subindex, in the previous example, the result for index 5 and 10, in the SourceString "/Game/File.asdas" is "File"
-	SubstringResult = UKismetStringLibrary::GetSubstring(SearchIn, BeginIndex, EndIndex - BeginIndex /*Length*/);
-}
-
-void UCSWAutoSaveBlueprintLibrary::GetAllActorsWithComponent(const UObject* WorldContextObject, const TSubclassOf<UActorComponent> Component, TArray<AActor*>& OutActors, TArray<UActorComponent*>& OutActorComponents)
-{
-	if (!Component || !WorldContextObject) return;
-
-	OutActors.Empty();
-	OutActorComponents.Empty();
-
-	UWorld* World = GEngine->GetWorldFromContextObjectChecked(WorldContextObject);
-	/// We do nothing if no component class is provided, rather than giving ALL actors!
-	///For each actor in the world, if the actor has the component fill the array for both the OutActors and OutActorComponents references
-	if (Component && World)
-	{
-		for (FActorIterator It(World); It; ++It)
-		{
-			AActor* Actor = *It;
-			UActorComponent* ActorComponent = Actor->GetComponentByClass(Component);
-			if (Actor && !Actor->IsPendingKill() && ActorComponent)
-			{
-				OutActors.Add(Actor);
-				OutActorComponents.Add(ActorComponent);
-			}
-		}
-	}
-}
-
-void UCSWAutoSaveBlueprintLibrary::GetActorsWithComponentInLevels(const UObject* WorldContextObject, const TSubclassOf<UActorComponent> Component, const TArray<FName>& LevelNameArray, TArray<AActor*>& OutActors, TArray<UActorComponent*>& OutActorComponents)
-{
-	if (!Component || !WorldContextObject) return;
-
-	OutActors.Empty();
-	OutActorComponents.Empty();
-
-	UWorld* World = GEngine->GetWorldFromContextObjectChecked(WorldContextObject);
-	/// We do nothing if no component class is provided, rather than giving ALL actors!
-	///For each actor in the world, if the actor has the component fill the array for both the OutActors and OutActorComponents references
-	if (Component && World)
-	{
-		for (FActorIterator It(World); It; ++It)
-		{
-			AActor* Actor = *It;
-			UActorComponent* ActorComponent = Actor->GetComponentByClass(Component);
-			if (Actor && !Actor->IsPendingKill() && ActorComponent)
-			{
-				FName ActorLevelName = CSWGetLevelName(GetActorLevel(Actor));
-				for (const FName& LevelName : LevelNameArray)
-				{
-					if (LevelName == ActorLevelName)
-					{
-						OutActors.Add(Actor);
-						OutActorComponents.Add(ActorComponent);
-						break;
-					}
-				}
-				
-			}
-		}
-	}
-}
-
-AActor* UCSWAutoSaveBlueprintLibrary::GetActorByIDNameAndClass(const UObject* WorldContextObject, const FName IDName, const TSubclassOf<AActor> ActorClass)
-{
-	if (!WorldContextObject || !ActorClass) return nullptr;
-
-	UWorld* World = GEngine->GetWorldFromContextObjectChecked(WorldContextObject);
-	/// We do nothing if not class provided, rather than giving ALL actors!
-	///For each Actor in the world that inherits from the ActorClass, if the Name of the actors matches the IDName, then return the Actor.
-	if (ActorClass && World)
-	{
-		for (TActorIterator<AActor> It(World, ActorClass); It; ++It)
-		{
-			AActor* Actor = *It;
-			if (!Actor->IsPendingKill() && Actor->GetFName() == IDName)
-			{
-				return Actor;
-			}
-		}
-	}
-	return nullptr;
-}
-
-int32 UCSWAutoSaveBlueprintLibrary::GetActorByIDNameFromAnArrayOfActors(const FName IDName, const TArray<AActor*>& ArrayOfActors, AActor*& Actor)
-{
-	if (ArrayOfActors.Num() <= 0) return -1;
-
-	int32 Index = 0;
-	///For each Actor in the ArrayOfActors, if the Name of the actors matches the IDName, then return the Actor and the Index where the Actor was found
-	for (AActor* actor : ArrayOfActors)
-	{
-		if (!actor->IsPendingKill() && actor->GetFName() == IDName)
-		{
-			Actor = actor;
-			return Index;
-		}
-		Index++;
-	}
-	///Return Index -1 if no Actor was found
-	return -1;
-}
-
-void UCSWAutoSaveBlueprintLibrary::GetLevelsNames(const UObject* WorldContextObject, TArray<FName>& CurrentLevelNameArray)
-{
-	if (!WorldContextObject) return;
-
-	UWorld* World = GEngine->GetWorldFromContextObjectChecked(WorldContextObject);
-	TArray<ULevel*> Levels = World->GetLevels();
-
-	///For each level in the Levels array, fill the CurrentMapNameArray with the level name
-	for (ULevel* level : Levels)
-	{
-		CurrentLevelNameArray.Add(CSWGetLevelName(level));
-	}
-}
-
-FName UCSWAutoSaveBlueprintLibrary::CSWGetLevelName(ULevel* Level)
-{
-	///We get the full name for the level, which will come in a similar format like this: /Game/UEDPIE_0_level1.level1:PersistentLevel
-	///We need to obtain a more readable name, one that can be used in level streaming, like this: /Game/level1
-	FString FullName = Level->GetPathName();
-	/// First, we create a PathName where the path will be stored, i.e: /Game/
-	/// And a FileName where the name of the level will be stores, i.e: level1
-	FString PathName, FileName;
-	/// Get the Path of the Level
-	GetSubstringBetween(FullName, TEXT("/"), TEXT("/"), PathName, /*UseCase*/ false, false, /*SearchFromEnd*/ false, true, -1, -1, /*IncludeString*/ true, true);
-	/// Get the name of the level
-	GetSubstringBetween(FullName, TEXT("."), TEXT(":"), FileName, /*UseCase*/ false, false, /*SearchFromEnd*/ false, true, -1, -1, /*IncludeString*/ false, false);
-
-	/// In case of the PathName and the FileName doesn't return a value. Use the FullName
-	if (PathName.Len() > 0 && FileName.Len() > 0)
-	{
-		FString NewFullName = PathName + FileName;
-		return FName(*NewFullName);
-	}
-	else
-	{
-		return FName(*FullName);
-	}
-}
-
-ULevel* UCSWAutoSaveBlueprintLibrary::GetActorLevel(AActor* Actor)
-{
-	if (!Actor) return nullptr;
-
-	return Actor->GetLevel();
-}
-
-class AActor* UCSWAutoSaveBlueprintLibrary::GetUniqueActorOfClass(const UObject* WorldContextObject, const TSubclassOf<AActor> ActorClass)
-{
-	if (!WorldContextObject || !ActorClass) return nullptr;
-	///GetWorld
-	UWorld* World = GEngine->GetWorldFromContextObjectChecked(WorldContextObject);
-	///Iterate Actors of Class
-	AActor* Actor = nullptr;
-	uint8 ActorCounter = 0;
-	if (ActorClass && World)
-	{
-		for (TActorIterator<AActor> It(World, ActorClass); It; ++It)
-		{
-			if (ActorCounter <= 1)
-			{
-				Actor = *It;
-				if (!Actor->IsPendingKill())
-				{
-					ActorCounter++;
-				}
-			}
-			else
-			{
-				break;
-			}
-		}
-	}
-	///If there's only one actor in the world
-	if (ActorCounter == 1)
-	{
-		return Actor;
-	}
-	else
-	{
-		if (ActorCounter == 0)
-		{
-			UE_LOG(LogTemp, Log, TEXT("CSW: GetUniqueActorOfClass() No Actor Found"));
-		}
-		else
-		{
-			UE_LOG(LogTemp, Log, TEXT("CSW: GetUniqueActorOfClass() There are more than 1 actor of this class in the world"));
-		}
-		return nullptr;
-	}
-}
-
-AActor* UCSWAutoSaveBlueprintLibrary::SpawnActorWithIDNameFromClass(const UObject* WorldContextObject, const TSubclassOf<AActor> Class, const FTransform& SpawnTransform, FName NameID, ULevel* OwnerLevel)
-{
-	return SpawnActorWithIDNameFromClass_Internal(WorldContextObject, Class, SpawnTransform, NameID, OwnerLevel, false);
-}
-
-AActor* UCSWAutoSaveBlueprintLibrary::SpawnActorWithIDNameFromClass_Internal(const UObject* WorldContextObject, const TSubclassOf<AActor> Class, const FTransform& SpawnTransform, FName NameID, ULevel* OwnerLevel, bool bLoadInEditorTime /*= false*/)
-{
-	if (!WorldContextObject || !Class || !GEngine) return nullptr;
-	///GetWorld
-	UWorld* World = GEngine->GetWorldFromContextObjectChecked(WorldContextObject);
-	if (!World) return nullptr;
-	/// Create Spawn Parameters
-	FActorSpawnParameters SpawnInfo;
-	if (OwnerLevel) SpawnInfo.OverrideLevel = OwnerLevel;
-	SpawnInfo.bAllowDuringConstructionScript = bLoadInEditorTime;
-	///If the name is not empty
-	if (NameID.ToString().Len() > 0 && NameID.ToString() != "None")
-	{
-		///Give a name to the SpawnInfo
-		SpawnInfo.Name = NameID;
-	}
-	///And spawn an Actor with the given name (if no name was provided, the name will be random as usual)
-	AActor* SpawnedActor = World->SpawnActor<AActor>(Class, SpawnTransform, SpawnInfo);
-	return SpawnedActor;
-}
-
-bool UCSWAutoSaveBlueprintLibrary::CSWDoesDirectoryExists(const FString& Path)
-{
-	IPlatformFile& PlatformFileManager = FPlatformFileManager::Get().GetPlatformFile();
-	return PlatformFileManager.DirectoryExists(*Path);
-}
-
-bool UCSWAutoSaveBlueprintLibrary::CSWMakeDirectory(const FString& Path)
-{
-	IPlatformFile& PlatformFileManager = FPlatformFileManager::Get().GetPlatformFile();
-	if (!PlatformFileManager.DirectoryExists(*Path))
-	{
-		return PlatformFileManager.CreateDirectory(*FPaths::GetPath(Path));
-	}
-	return false;
-}
-
-FString UCSWAutoSaveBlueprintLibrary::GetPathProject()
-{
-	return FPaths::ConvertRelativePathToFull(FPaths::ProjectDir());
-}
-
-FString UCSWAutoSaveBlueprintLibrary::GetPathSaved()
-{
-	return FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir());
-}
-
-FString UCSWAutoSaveBlueprintLibrary::GetPathSaveGames()
-{
-	return FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir() + TEXT("SaveGames/"));
-}
-
-
-
-#pragma endregion
-
-
-#pragma region PRIVATE::AUTO SAVE AND LOAD FUNCTIONS
-
-void UCSWAutoSaveBlueprintLibrary::SaveActor(FCSWActorRecord& ActorRecord, AActor* Actor, const UCSWAutoSaveComponent* AutoSaveAndLoadComponent)
-{
-	///Save actor
-	ActorRecord.Name = Actor->GetFName();
-	ActorRecord.Class = Actor->GetClass();
-	ActorRecord.XForm = Actor->GetTransform();
-	ActorRecord.bLoadRandomID = AutoSaveAndLoadComponent->GetLoadActorWithRandomIDName();
-
-	FMemoryWriter MemoryWriter(ActorRecord.Data, true);
-	/// Use a wrapper archive that converts FNames and UObject*'s to strings that can be read back in
-	FCSWSaveGameArchive Ar(MemoryWriter, false);
-	/// Serialize the object
-	Actor->Serialize(Ar);
-	///Clean
-	MemoryWriter.FlushCache();
-	MemoryWriter.Close();
-}
-
-void UCSWAutoSaveBlueprintLibrary::SaveActorComponents(FCSWActorRecord& ActorRecord, AActor* Actor, const UCSWAutoSaveComponent* AutoSaveAndLoadComponent)
-{
-	UActorComponent* input = nullptr;
-	UCSWAutoSaveComponent* test = Cast<UCSWAutoSaveComponent>(input);
-	auto test2 = input->GetClass()->StaticClass();
-	///Return if there are no components to save 
-	if (AutoSaveAndLoadComponent->GetSaveComponents() == false && AutoSaveAndLoadComponent->GetComponentOptions().Num() < 1) return;
-
-	TArray<UActorComponent*> ActorComponentsArray;
-	Actor->GetComponents(ActorComponentsArray);
-
-	for (UActorComponent* actorcomponent : ActorComponentsArray)
-	{
-		///Find if there are custom options for this component
-		FCSWAutoSaveComponentOption componentOptions;
-		bool bSaveThisComponent = GetComponentSaveAndLoadConditions(AutoSaveAndLoadComponent, actorcomponent, OUT componentOptions);
-		///If this component can be saved
-		if (bSaveThisComponent)
-		{
-			SaveActorComponent(ActorRecord, actorcomponent, AutoSaveAndLoadComponent, componentOptions);
-		}
-	}
-}
-
-void UCSWAutoSaveBlueprintLibrary::SaveActorComponent(FCSWActorRecord& ActorRecord, UActorComponent* ActorComponent, const UCSWAutoSaveComponent* AutoSaveAndLoadComponent, FCSWAutoSaveComponentOption& ComponentOptions)
-{
-	FCSWActorComponentRecord ActorComponentRecord;
-	///Save ActorComponent Name, Class and Transform (if it's a scene component)
-	ActorComponentRecord.Name = ActorComponent->GetFName();
-
-	/// IF COMPONENT IS CHILD OF CSWStorerComponent, save its state completely
-	if (ActorComponent->GetClass()->IsChildOf(UCSWStorerComponent::StaticClass()))
-	{
-		ConvertObjectToBytes(ActorComponent, ActorComponentRecord.Data);
-		/// Add the ActorComponentRecord to the ActorRecord
-		ActorRecord.ComponentsRecord.Add(ActorComponentRecord);
-	}
-	/// Else, save SAVEGAME flagged variables and custom data only
-	else
-	{
-		///Save relative transform if the components is a scene component
-		/// NOTE: componentOptions.Name == "None" means that this component doesn't have custom options so it will use the default options. 
-		/// If it's different than "None" the component has custom options like componentOptions.bSaveLocation
-		if (ActorComponent->GetClass()->IsChildOf(USceneComponent::StaticClass()))
-		{
-			USceneComponent* sceneComponent = Cast<USceneComponent>(ActorComponent);
-			///Save Relative Location
-			if ((AutoSaveAndLoadComponent->GetSaveComponentsLocation() && ComponentOptions.Name == "None") || (ComponentOptions.Name != "None" && ComponentOptions.bSaveLoc))
-			{
-				ActorComponentRecord.Loc = sceneComponent->RelativeLocation;
-			}
-			///Save Relative Rotation
-			if ((AutoSaveAndLoadComponent->GetSaveComponentsRotation() && ComponentOptions.Name == "None") || (ComponentOptions.Name != "None" && ComponentOptions.bSaveRot))
-			{
-				ActorComponentRecord.Rot = sceneComponent->RelativeRotation;
-			}
-			///SetRelative Scale
-			if ((AutoSaveAndLoadComponent->GetSaveComponentsScale() && ComponentOptions.Name == "None") || (ComponentOptions.Name != "None" && ComponentOptions.bSaveScale))
-			{
-				ActorComponentRecord.Scale = sceneComponent->RelativeScale3D;
-			}
-			else
-			{
-				ActorComponentRecord.Scale = FVector(1.0, 1.0, 1.0);
-			}
-		}
-		///Save Physics Simulation if it's a Primitive Component
-		if (ActorComponent->GetClass()->IsChildOf(UPrimitiveComponent::StaticClass()))
-		{
-			UPrimitiveComponent* primitiveComponent = Cast<UPrimitiveComponent>(ActorComponent);
-			if ((AutoSaveAndLoadComponent->GetSaveComponentsLinearVelocity() && ComponentOptions.Name == "None") || (ComponentOptions.Name != "None" && ComponentOptions.bSaveLVel))
-			{
-				ActorComponentRecord.LinearVel = primitiveComponent->GetPhysicsLinearVelocity();
-			}
-			if ((AutoSaveAndLoadComponent->GetSaveComponentsAngularVelocity() && ComponentOptions.Name == "None") || (ComponentOptions.Name != "None" && ComponentOptions.bSaveAVel))
-			{
-				ActorComponentRecord.AngularVel = primitiveComponent->GetPhysicsAngularVelocityInDegrees();
-			}
-		}
-		///Save Actor Component Data
-		FMemoryWriter MemoryWriter(ActorComponentRecord.Data, true);
-		/// Use a wrapper archive that converts FNames and UObject*'s to strings that can be read back in
-		FCSWSaveGameArchive Ar(MemoryWriter, false);
-		ActorComponent->Serialize(Ar);
-		/// Add the ActorComponentRecord to the ActorRecord
-		ActorRecord.ComponentsRecord.Add(ActorComponentRecord);
-		///Clean
-		MemoryWriter.FlushCache();
-		MemoryWriter.Close();
-	}
-}
-
-void UCSWAutoSaveBlueprintLibrary::LoadAllActorsInLevel(const UObject* WorldContextObject, const UCSWAutoSaveObject* AutoSaveGameObject, const FCSWMapRecord& levelRecord, TArray<FCSWAutosaveActor>& AutosaveActorsInLevel, const bool bLoadInEditorTime)
-{
-	if (!WorldContextObject) return;
-
-	for (const FCSWActorRecord& ActorRecord : levelRecord.ActorsRecord)
-	{
-		LoadActorInLevel(ActorRecord, AutosaveActorsInLevel, AutoSaveGameObject, WorldContextObject, levelRecord, bLoadInEditorTime);
-	}
-}
-
-void UCSWAutoSaveBlueprintLibrary::LoadActorInLevel(const FCSWActorRecord &ActorRecord, TArray<FCSWAutosaveActor> &AutosaveActorsInLevel, const UCSWAutoSaveObject* AutoSaveGameObject, const UObject* WorldContextObject, const FCSWMapRecord &levelRecord, const bool bLoadInEditorTime)
-{
-	AActor* LoadedActor = nullptr;
-	UCSWAutoSaveComponent* AutosaveComponent = nullptr;
-	///Try to get a Loaded Actor in case the Actor already exists in the level (so we update it instead of creating a new one)
-	int32 ActorIndex = GetActorByIDFromAutosaveActors(ActorRecord.Name, AutosaveActorsInLevel, OUT LoadedActor);
-	///If Actor was found, we remove the data in the index so the iteration will be faster next time
-	if (ActorIndex != -1 && AutosaveActorsInLevel.IsValidIndex(ActorIndex))
-	{
-		AutosaveActorsInLevel.RemoveAt(ActorIndex);
-	}
-	//Route if Actor exists in the Level and needs to be updated
-	if (LoadedActor)
-	{
-		LoadActor_Internal(ActorRecord, AutoSaveGameObject, AutosaveComponent, LoadedActor, false);
-	}
-	//Route if Actor doesn't exist in the Level and needs to be created
-	else
-	{
-		///Spawn in this level
-		ULevel* LevelOwner = GetLevelReferenceFromName(WorldContextObject, levelRecord.Name);
-		//Route if Load With Random Name is Enabled, then create the actor with a random name (spawn it normally)
-		if (ActorRecord.bLoadRandomID)
-		{
-			LoadedActor = SpawnActorWithIDNameFromClass_Internal(WorldContextObject, ActorRecord.Class, ActorRecord.XForm, FName(""), LevelOwner, bLoadInEditorTime);
-		}
-		//Route if the Actor will be loaded with a given ID
-		else
-		{
-			LoadedActor = SpawnActorWithIDNameFromClass_Internal(WorldContextObject, ActorRecord.Class, ActorRecord.XForm, ActorRecord.Name, LevelOwner, bLoadInEditorTime);
-		}
-		//Load data for LoadedActor
-		if (LoadedActor)
-		{
-			LoadActor_Internal(ActorRecord, AutoSaveGameObject, AutosaveComponent, LoadedActor, true);
-		}
-	}
-}
-
-void UCSWAutoSaveBlueprintLibrary::FullLoadActorFromRecord(const FCSWActorRecord& ActorRecord, AActor* Actor, UCSWAutoSaveComponent* AutoSaveAndLoadComponent, const bool bLoadActorComponents /*= true*/)
-{
-	if (!Actor || !AutoSaveAndLoadComponent) return;
-	///Load the data from the AutoSaveAndLoadComponent first, so the options will match the options from the savefile
-	for (const FCSWActorComponentRecord& actorComponentRecord : ActorRecord.ComponentsRecord)
-	{
-		///For each component that this actors has, verifies if the name is the same an then loads the data that corresponds
-		if (actorComponentRecord.Name == AutoSaveAndLoadComponent->GetFName())
-		{
-			FCSWAutoSaveComponentOption componentOptions;
-			LoadActorComponent(actorComponentRecord, OUT AutoSaveAndLoadComponent, componentOptions, AutoSaveAndLoadComponent);
-			break;
-		}
-	}
-	///Load the Actor and the components only if the component is enabled on this actor
-	if (AutoSaveAndLoadComponent->GetEnableComponent())
-	{
-		LoadActor(ActorRecord, Actor);
-		if (bLoadActorComponents)
-		{
-			LoadActorComponents(ActorRecord, Actor, AutoSaveAndLoadComponent);
-		}
-	}
-}
-
-void UCSWAutoSaveBlueprintLibrary::LoadActor(const FCSWActorRecord& ActorRecord, AActor* DynamicActor)
-{
-	FMemoryReader MemoryReader(ActorRecord.Data, true);
-	FCSWSaveGameArchive Ar(MemoryReader, true);
-	DynamicActor->Serialize(Ar);
-	///Clean
-	MemoryReader.FlushCache();
-	MemoryReader.Close();
-}
-
-void UCSWAutoSaveBlueprintLibrary::LoadActorComponents(const FCSWActorRecord& ActorRecord, AActor* DynamicActor, const UCSWAutoSaveComponent* AutoSaveAndLoadComponent)
-{
-	///Return if there are no components to load or if the AutoSaveAndLoadComponent is nullptr
-	if (AutoSaveAndLoadComponent->GetSaveComponents() == false && AutoSaveAndLoadComponent->GetComponentOptions().Num() < 1) return;
-
-	TArray<UActorComponent*> ActorComponentsArray;
-	DynamicActor->GetComponents(ActorComponentsArray);
-	///This method is faster than above, Serializes the data of all the components of an actor
-	int i = 0;
-	for (UActorComponent* actorcomponent : ActorComponentsArray)
-	{
-		if (actorcomponent != AutoSaveAndLoadComponent)
-		{
-			///Find if there are custom options for this component and determine if this component can be loaded
-			FCSWAutoSaveComponentOption componentOptions;
-			bool bLoadThisComponent = GetComponentSaveAndLoadConditions(AutoSaveAndLoadComponent, actorcomponent, OUT componentOptions);
-			///IF THIS COMPONENT CAN BE LOADED
-			if (bLoadThisComponent)
-			{
-				///Try to load the actor in order first (when it works, it loads the actor components faster)
-				if (ActorRecord.ComponentsRecord.IsValidIndex(i))
-				{
-					const FCSWActorComponentRecord& actorComponentRecordOut = ActorRecord.ComponentsRecord[i];
-					if (actorComponentRecordOut.Name == actorcomponent->GetFName())
-					{
-						LoadActorComponent(actorComponentRecordOut, actorcomponent, componentOptions, AutoSaveAndLoadComponent);
-						i++;
-						continue;
-					}
-				}
-				///If the actors components weren't loaded at this point, try to search an actor components that matches the name and load it!
-				for (const FCSWActorComponentRecord& actorComponentRecord : ActorRecord.ComponentsRecord)
-				{
-					///For each component that this actors has, verifies if the name is the same an then loads the data that corresponds
-					if (actorComponentRecord.Name == actorcomponent->GetFName())
-					{
-						LoadActorComponent(actorComponentRecord, actorcomponent, componentOptions, AutoSaveAndLoadComponent);
-						i++;
-						break;
-					}
-				}
-			}
-		}
-		i++;
-	}
-}
-
-void UCSWAutoSaveBlueprintLibrary::LoadActorComponent(const FCSWActorComponentRecord &actorComponentRecord, UActorComponent* actorcomponent, const FCSWAutoSaveComponentOption &componentOptions, const UCSWAutoSaveComponent* AutoSaveAndLoadComponent)
-{
-	/// IF COMPONENT IS CHILD OF CSWStorerComponent, restore its state completely
-	if (actorcomponent->GetClass()->IsChildOf(UCSWStorerComponent::StaticClass()))
-	{
-		RestoreObjectFromBytes(actorcomponent, actorComponentRecord.Data);
-	}
-	/// Load an Actor Component, using the FCSWSaveGameArchive that will load the SaveGame flagged variables
-	else
-	{
-		FMemoryReader MemoryReader(actorComponentRecord.Data, true);
-		FCSWSaveGameArchive Ar(MemoryReader, true);
-		actorcomponent->Serialize(Ar);
-		///Load Transform if it's an scene component
-		if (actorcomponent->GetClass()->IsChildOf(USceneComponent::StaticClass()))
-		{
-			USceneComponent* sceneComponent = Cast<USceneComponent>(actorcomponent);
-			///Load Relative Location, Rotation and Scale
-			/// NOTE: componentOptions.Name == "None" means that this component doesn't have custom options so it will use the default options. 
-			/// If it's different than "None" the component has custom options like componentOptions.bSaveLocation
-			if ((AutoSaveAndLoadComponent->GetSaveComponentsLocation() && componentOptions.Name == "None") || (componentOptions.Name != "None" && componentOptions.bSaveLoc))
-			{
-				sceneComponent->SetRelativeLocation(actorComponentRecord.Loc, false, nullptr, ETeleportType::TeleportPhysics);
-			}
-			if ((AutoSaveAndLoadComponent->GetSaveComponentsRotation() && componentOptions.Name == "None") || (componentOptions.Name != "None" && componentOptions.bSaveRot))
-			{
-				sceneComponent->SetRelativeRotation(actorComponentRecord.Rot, false, nullptr, ETeleportType::TeleportPhysics);
-			}
-			if ((AutoSaveAndLoadComponent->GetSaveComponentsScale() && componentOptions.Name == "None") || (componentOptions.Name != "None" && componentOptions.bSaveScale))
-			{
-				sceneComponent->SetRelativeScale3D(actorComponentRecord.Scale);
-			}
-		}
-		///Load Physics Simulation if it's a Primitive Component
-		if (actorcomponent->GetClass()->IsChildOf(UPrimitiveComponent::StaticClass()))
-		{
-			UPrimitiveComponent* primitiveComponent = Cast<UPrimitiveComponent>(actorcomponent);
-			if ((AutoSaveAndLoadComponent->GetSaveComponentsLinearVelocity() && componentOptions.Name == "None") || (componentOptions.Name != "None" && componentOptions.bSaveLVel))
-			{
-				primitiveComponent->SetPhysicsLinearVelocity(actorComponentRecord.LinearVel);
-			}
-			if ((AutoSaveAndLoadComponent->GetSaveComponentsAngularVelocity() && componentOptions.Name == "None") || (componentOptions.Name != "None" && componentOptions.bSaveAVel))
-			{
-				primitiveComponent->SetPhysicsAngularVelocityInDegrees(actorComponentRecord.AngularVel);
-			}
-		}
-		///Clean
-		MemoryReader.FlushCache();
-		MemoryReader.Close();
-	}
-}
-
-bool UCSWAutoSaveBlueprintLibrary::GetComponentSaveAndLoadConditions(const UCSWAutoSaveComponent* AutoSaveAndLoadComponent, const  UActorComponent* actorcomponent, FCSWAutoSaveComponentOption &componentOptions)
-{
-	bool bComponentOptionsFound = false;
-	for (FCSWAutoSaveComponentOption& options : AutoSaveAndLoadComponent->GetComponentOptions())
-	{
-		if (options.Name == actorcomponent->GetFName())
-		{
-			bComponentOptionsFound = true;
-			componentOptions = options;
-			break;
-		}
-	}
-	///Determine if this component can be saved/loaded
-	bool bSaveLoadThisComponent = false;
-	/// When save components is enabled by default, save only if no ComponentOptions where found OR if a component option was found and save component is checked in the options
-	if (AutoSaveAndLoadComponent->GetSaveComponents())
-	{
-		bSaveLoadThisComponent = (bComponentOptionsFound == false) || (bComponentOptionsFound && componentOptions.bSave);
-	}
-	/// When save components is not enabled by default, save only if a component option was found and save component is checked in the options
-	else
-	{
-		bSaveLoadThisComponent = bComponentOptionsFound && componentOptions.bSave;
-	}
-	return bSaveLoadThisComponent;
-}
-
-void UCSWAutoSaveBlueprintLibrary::CSWTryDestroyActors(const UCSWAutoSaveObject* AutoSaveGameObject, TArray<FCSWAutosaveActor>& AutosaveActorsInLevel)
-{
-	if (!AutoSaveGameObject || AutosaveActorsInLevel.Num() <= 0) return;
-	
-	for (FCSWAutosaveActor& autosaveActor : AutosaveActorsInLevel)
-	{
-		TryDestroyActor(autosaveActor, AutoSaveGameObject);
-	}
-}
-
-void UCSWAutoSaveBlueprintLibrary::TryDestroyActor(FCSWAutosaveActor &autosaveActor, const UCSWAutoSaveObject* AutoSaveGameObject)
-{
-	if (autosaveActor.Actor && autosaveActor.AutosaveComponent && !autosaveActor.Actor->IsPendingKill())
-	{
-		if (autosaveActor.AutosaveComponent && autosaveActor.AutosaveComponent->GetDestroyActorOnLoadGameIfWasNotSaved() && autosaveActor.AutosaveComponent->GetWasSaved() == false)
-		{
-			///#Call the Event OnBeginDestroyUnsavedActor() so we give a chance to abort destruction 
-			autosaveActor.AutosaveComponent->OnBeginDestroyUnsavedActor(AutoSaveGameObject);
-			///Destroy the actor
-			autosaveActor.Actor->Destroy();
-			autosaveActor.Actor->ConditionalBeginDestroy();
-			autosaveActor.Actor = nullptr;
-		}
-		else
-		{
-			///#Call the Event OnUnchangedActor() so we tell that this actor wasn't changed at all when the game was loaded
-			autosaveActor.AutosaveComponent->OnUnchangedActor(AutoSaveGameObject);
-		}
-	}
-}
-
-uint32 UCSWAutoSaveBlueprintLibrary::GetLevelRecordIndexSave(UCSWAutoSaveObject* AutoSaveGameObject, const FCSWLevelWithAutosaveActors& LevelWithAutosaveActors, bool& bMatchFound)
-{
-	bMatchFound = false;
-	uint32 LevelRecordIndex = 0;
-	for (const FCSWMapRecord& mapRecord : AutoSaveGameObject->LevelsRecord)
-	{
-		if (LevelWithAutosaveActors.Name == mapRecord.Name)
-		{
-			bMatchFound = true;
-			break;
-		}
-		LevelRecordIndex++;
-	}
-	return LevelRecordIndex;
-}
-
-uint32 UCSWAutoSaveBlueprintLibrary::GetLevelRecordIndexLoad(const FCSWMapRecord& LevelRecord, const TArray<FCSWLevelWithAutosaveActors>& LevelSWithAutosaveActors, bool& bMatchFound)
-{
-	bMatchFound = false;
-	uint32 LevelRecordIndex = 0;
-	for (const FCSWLevelWithAutosaveActors& levelWithAutoSaveActors : LevelSWithAutosaveActors)
-	{
-		if (levelWithAutoSaveActors.Name == LevelRecord.Name)
-		{
-			bMatchFound = true;
-			break;
-		}
-		LevelRecordIndex++;
-	}
-	return LevelRecordIndex;
-}
-
-void UCSWAutoSaveBlueprintLibrary::SaveAllActorsInLevel(UCSWAutoSaveObject* AutoSaveGameObject, const FCSWLevelWithAutosaveActors& LevelWithAutosaveActors, uint32 LevelRecordIndex)
-{
-	for (const FCSWAutosaveActor& AutosaveActor : LevelWithAutosaveActors.AutosaveActors)
-	{
-		SaveActorInLevel(AutosaveActor, AutoSaveGameObject, LevelRecordIndex);
-	}
-}
-
-void UCSWAutoSaveBlueprintLibrary::SaveActorInLevel(const FCSWAutosaveActor &AutosaveActor, UCSWAutoSaveObject* AutoSaveGameObject, uint32 LevelRecordIndex)
-{
-	AActor* Actor = AutosaveActor.Actor;
-	UCSWAutoSaveComponent* AutosaveComponent = AutosaveActor.AutosaveComponent;
-
-	if (Actor && AutosaveComponent && !Actor->IsPendingKill() && AutosaveComponent->GetEnableComponent())
-	{
-		///#CALL The event OnSaveStart (Before the actor is saved)
-		AutosaveComponent->OnSaveStart(AutoSaveGameObject);
-		///Create an ActorRecord for Store ActorName, ActorClass, ActorTransform and ActorData (SaveGame flagged Variables)
-		///#CronofearNiceStuffHere Breakpoint here to see how much data an actor is saving (components included).
-		FCSWActorRecord NewActorRecord;
-		FullSaveActorIntoRecord(NewActorRecord, Actor, AutosaveComponent);
-		///Save NewActorRecord into the AutoSaveGameObject
-		if (AutoSaveGameObject->LevelsRecord.IsValidIndex(LevelRecordIndex))
-		{
-			AutoSaveGameObject->LevelsRecord[LevelRecordIndex].ActorsRecord.Add(NewActorRecord);
-			///#CALL the Event OnSaveEnd (After the actor is saved)
-			AutosaveComponent->OnSaveEnd(AutoSaveGameObject);
-		}
-	}
-}
-
-
-
-void UCSWAutoSaveBlueprintLibrary::FullSaveActorIntoRecord(FCSWActorRecord& ActorRecord, AActor* Actor, const UCSWAutoSaveComponent* AutosaveComponent)
-{
-	SaveActor(ActorRecord, Actor, AutosaveComponent);
-	SaveActorComponents(ActorRecord, Actor, AutosaveComponent);
-}
-
-int32 UCSWAutoSaveBlueprintLibrary::GetActorByIDFromAutosaveActors(const FName IDName, const TArray<FCSWAutosaveActor>& AutosaveActorsInLevel, AActor*& Actor)
-{
-	if (AutosaveActorsInLevel.Num() <= 0) return -1;
-
-	int32 Index = 0;
-	///For each Actor in the ArrayOfActors, if the Name of the actors matches the IDName, then return the Actor and the Index where the Actor was found
-	for (const FCSWAutosaveActor& autosaveActor : AutosaveActorsInLevel)
-	{
-		if (autosaveActor.Actor && !autosaveActor.Actor->IsPendingKill() && autosaveActor.Actor->GetFName() == IDName)
-		{
-			Actor = autosaveActor.Actor;
-			return Index;
-		}
-		Index++;
-	}
-	///Return Index -1 if no Actor was found
-	return -1;
-}
-
-void UCSWAutoSaveBlueprintLibrary::LoadActor_Internal(const FCSWActorRecord& ActorRecord, const UCSWAutoSaveObject* AutoSaveGameObject,  UCSWAutoSaveComponent* AutosaveComponent , AActor* LoadedActor, bool bDestroyActorIfAutosaveComponentDisabled)
-{
-	AutosaveComponent = Cast<UCSWAutoSaveComponent>(LoadedActor->GetComponentByClass(UCSWAutoSaveComponent::StaticClass()));
-	if (AutosaveComponent && AutosaveComponent->GetEnableComponent())
-	{
-		///#CALL OnLoadStart Event
-		AutosaveComponent->OnLoadStart(AutoSaveGameObject);
-		///Load Actor and ActorComponent Data
-		FullLoadActorFromRecord(ActorRecord, LoadedActor, AutosaveComponent, true);
-		///#CALL OnLoadEnd Event
-		AutosaveComponent->OnLoadEnd(AutoSaveGameObject);
-	}
-	else if (bDestroyActorIfAutosaveComponentDisabled)
-	{
-		///Destroy a recreated actor if it doesn't have a SaveAndLoadComponent or if it's component is disabled
-		LoadedActor->Destroy();
-		LoadedActor->ConditionalBeginDestroy();
-		LoadedActor = nullptr;
-	}
-}
-
-ULevel* UCSWAutoSaveBlueprintLibrary::GetLevelReferenceFromName(const UObject* WorldContextObject, const FName& NameOfTheLevel)
-{
-	if (!WorldContextObject) return nullptr;
-	UWorld* World = GEngine->GetWorldFromContextObjectChecked(WorldContextObject);
-	if (!World) return nullptr;
-
-	TArray<ULevel*> Levels = World->GetLevels();
-
-	///For each level in the Levels array, fill the CurrentMapNameArray with the level name
-	for (ULevel* level : Levels)
-	{
-		if (CSWGetLevelName(level) == NameOfTheLevel)
-		{
-			return level;
-		}
-	}
-	return nullptr;
-}
-
-#pragma endregion
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+#include "BlueprintFunctionLibrary/CSWAutoSaveBlueprintLibrary.h"
+#include "EngineUtils.h"	///actoriterator
+#include "Serialization/BufferArchive.h"	///MemoryWriter
+#include "Serialization/MemoryReader.h"
+#include "Serialization/ArchiveProxy.h"
+#include "Serialization/ArchiveSaveCompressedProxy.h"
+#include "Serialization/ArchiveLoadCompressedProxy.h"
+#include "Kismet/KismetStringLibrary.h"
+#include "HAL/PlatformFilemanager.h"
+#include "SaveGame/CSWAutoSaveObject.h"
+#include "ActorComponent/CSWAutoSaveComponent.h"
+#include "Async/CSWAutoSaveAsyncTasks.h"
+#include "SaveSystem/CSWSaveGameSystem.h"
+#include "ActorComponent/CSWStorerComponent.h"
+#include "Serialization/CustomVersion.h"
+#include "Components/PrimitiveComponent.h"
+#include "UObject/Package.h"
+#include "Engine/Engine.h"
+#include "Misc/EngineVersion.h"
+#include "SaveSystem/CSWSaveGameFormat.h"
+#include "Serialization/CSWCompressedArchive.h"
+#include "SaveSystem/CSWSaveGameContainer.h"
+#include "Serialization/CSWCompressionDictionary.h"
+#include "SaveSystem/CSWSlotCatalog.h"
+#include "SaveSystem/CSWSaveGameJournal.h"
+#include "SaveSystem/CSWAutoSaveRing.h"
+#include "SaveSystem/CSWSaveJobScheduler.h"
+#include "SaveSystem/CSWDecodedSlotCache.h"
+#include "SaveSystem/CSWPackSaveGameSystem.h"
+#include "Serialization/CSWCipher.h"
+#include "Serialization/CSWSavePlan.h"
+#include "Serialization/CSWTransformCodec.h"
+#include "SaveSystem/CSWPoseBatch.h"
+#include "SaveSystem/CSWVersionStore.h"
+#include "Serialization/CSWChecksum.h"
+#include "Misc/Base64.h"
+#include "Misc/ScopeLock.h"
+#include "Templates/UnrealTemplate.h"	///TGuardValue
+
+
+#define OUT
+
+static const int UE4_SAVEGAME_FILE_TYPE_TAG = 0x53415647;		// "sAvG"
+
+struct FSaveGameFileVersion
+{
+	enum Type
+	{
+		InitialVersion = 1,
+		// serializing custom versions into the savegame data to handle that type of versioning
+		AddedCustomVersions = 2,
+		// hash of the versions instead of the versions, stored once per build (see FCSWVersionStore). Written with compact versions only
+		AddedCompactVersions = 3,
+
+		// -----<new versions can be added above this line>-------------------------------------------------
+		VersionPlusOne,
+		LatestVersion = VersionPlusOne - 1
+	};
+};
+
+
+#pragma region SAVE GAME STREAMING HELPERS
+
+/**
+* Write the UE4 save game preamble: file type tag, versions and the class name of the SaveGameObject.
+* With compact versions the versions are replaced by { uint32 Hash, uint8 bHasVersions, [versions] }, they are only written if the versions file of the build
+* couldn't be stored next to the slots of VersionsLocation, or if it's null (see FCSWVersionStore).
+*/
+static void WriteSaveGamePreamble(FArchive& Ar, USaveGame* SaveGameObject, const FCSWVersionsLocation* VersionsLocation)
+{
+	FCSWVersionStore& VersionStore = FCSWVersionStore::Get();
+	const bool bCompactVersions = VersionStore.GetUseCompactVersions();
+
+	// write file type tag. identifies this file type and indicates it's using proper versioning
+	// since older UE4 versions did not version this data.
+	int32 FileTypeTag = UE4_SAVEGAME_FILE_TYPE_TAG;
+	Ar << FileTypeTag;
+
+	// Write version for this file format
+	int32 SavegameFileVersion = bCompactVersions ? FSaveGameFileVersion::AddedCompactVersions : FSaveGameFileVersion::AddedCustomVersions;
+	Ar << SavegameFileVersion;
+
+	// Write out engine, UE4 and custom version information (or their hash)
+	uint8 bHasVersions = 1;
+	if (bCompactVersions)
+	{
+		uint32 VersionsHash = VersionStore.GetBuildHash();
+		bHasVersions = VersionsLocation && VersionStore.StoreBuildVersions(*VersionsLocation) ? 0 : 1;
+		Ar << VersionsHash << bHasVersions;
+	}
+	if (bHasVersions)
+	{
+		FCSWSaveGameVersions BuildVersions;
+		BuildVersions.Serialize(Ar);
+	}
+
+	// Write the class name so we know what class to load to
+	FString SaveGameClassName = SaveGameObject->GetClass()->GetName();
+	Ar << SaveGameClassName;
+}
+
+/** Read the UE4 save game preamble. Compact versions of other builds are read next to the slots of VersionsLocation. Returns false if the class of the save game can't be found */
+static bool ReadSaveGamePreamble(FArchive& Ar, FCSWSaveGameVersions& OutVersions, const FCSWVersionsLocation* VersionsLocation)
+{
+	const int64 PreamblePos = Ar.Tell();
+	int32 FileTypeTag;
+	Ar << FileTypeTag;
+
+	int32 SavegameFileVersion;
+	if (FileTypeTag != UE4_SAVEGAME_FILE_TYPE_TAG)
+	{
+		// this is an old saved game, back up the file pointer to the beginning and assume version 1
+		Ar.Seek(PreamblePos);
+		SavegameFileVersion = FSaveGameFileVersion::InitialVersion;
+	}
+	else
+	{
+		// Read version for this file format
+		Ar << SavegameFileVersion;
+		if (SavegameFileVersion > FSaveGameFileVersion::LatestVersion)
+		{
+			UE_LOG(LogTemp, Error, TEXT("CSWError: The save game was written by a newer version of the plugin (file version %d)."), SavegameFileVersion);
+			return false;
+		}
+
+		if (SavegameFileVersion >= FSaveGameFileVersion::AddedCompactVersions)
+		{
+			// The versions of the build that wrote it, the ones of the running build aren't read at all
+			uint32 VersionsHash = 0;
+			uint8 bHasVersions = 0;
+			Ar << VersionsHash << bHasVersions;
+			if (bHasVersions)
+			{
+				OutVersions.Serialize(Ar);
+			}
+			else if (!FCSWVersionStore::Get().FindVersions(VersionsHash, VersionsLocation, OutVersions))
+			{
+				return false;
+			}
+		}
+		else
+		{
+			// Read engine and UE4 version information
+			Ar << OutVersions.UE4Version;
+			Ar << OutVersions.EngineVersion;
+
+			if (SavegameFileVersion >= FSaveGameFileVersion::AddedCustomVersions)
+			{
+				int32 CustomVersionFormat;
+				Ar << CustomVersionFormat;
+
+				OutVersions.CustomVersions.Empty();
+				OutVersions.CustomVersions.Serialize(Ar, static_cast<ECustomVersionSerializationFormat::Type>(CustomVersionFormat));
+			}
+		}
+	}
+	OutVersions.ApplyTo(Ar);
+
+	// Get the class name
+	FString SaveGameClassName;
+	Ar << SaveGameClassName;
+
+	// Try and find it, and failing that, load it
+	UClass* SaveGameClass = FindObject<UClass>(ANY_PACKAGE, *SaveGameClassName);
+	if (SaveGameClass == NULL)
+	{
+		SaveGameClass = LoadObject<UClass>(NULL, *SaveGameClassName);
+	}
+	return SaveGameClass != NULL && !Ar.IsError();
+}
+
+/** Serialize an object (or struct) into the Scratch buffer, replacing object refs and names with strings */
+static void SerializeIntoScratch(TArray<uint8>& Scratch, TFunctionRef<void(FArchive&)> SerializeFunction)
+{
+	Scratch.Reset();
+	FMemoryWriter ScratchWriter(Scratch, true);
+	FObjectAndNameAsStringProxyArchive Ar(ScratchWriter, false);
+	SerializeFunction(Ar);
+}
+
+/** Deserialize an object (or struct) from the Scratch buffer using the versions of the save game */
+static void DeserializeFromScratch(const TArray<uint8>& Scratch, const FCSWSaveGameVersions& Versions, TFunctionRef<void(FArchive&)> SerializeFunction)
+{
+	FMemoryReader ScratchReader(Scratch, true);
+	Versions.ApplyTo(ScratchReader);
+	FObjectAndNameAsStringProxyArchive Ar(ScratchReader, true);
+	SerializeFunction(Ar);
+}
+
+/** Archive that forwards everything serialized through it to (or from) an inner archive and appends a copy of the bytes to Copy. The data must be serialized sequentially */
+class FCSWArchiveCopyProxy : public FArchiveProxy
+{
+public:
+	FCSWArchiveCopyProxy(FArchive& InInnerArchive, TArray<uint8>& InCopy)
+		: FArchiveProxy(InInnerArchive)
+		, Copy(InCopy)
+	{}
+
+	virtual void Serialize(void* Data, int64 Num) override
+	{
+		InnerArchive.Serialize(Data, Num);
+		if (InnerArchive.IsError())
+		{
+			SetError();
+			return;
+		}
+		Copy.Append(static_cast<const uint8*>(Data), static_cast<int32>(Num));
+	}
+
+private:
+	TArray<uint8>& Copy;
+};
+
+/** Serialize the object without its levels record into the Scratch buffer */
+static void SerializeObjectIntoScratch(TArray<uint8>& Scratch, USaveGame* SaveGameObject)
+{
+	UCSWAutoSaveObject* AutoSaveObject = Cast<UCSWAutoSaveObject>(SaveGameObject);
+	TArray<FCSWMapRecord> LevelsRecord;
+	if (AutoSaveObject)
+	{
+		AutoSaveObject->RebuildReferenceTable();
+		AutoSaveObject->UpdateClassLayouts();
+		LevelsRecord = MoveTemp(AutoSaveObject->LevelsRecord);
+	}
+	SerializeIntoScratch(Scratch, [SaveGameObject](FArchive& ProxyAr) { SaveGameObject->Serialize(ProxyAr); });
+	if (AutoSaveObject)
+	{
+		AutoSaveObject->LevelsRecord = MoveTemp(LevelsRecord);
+	}
+}
+
+/**
+* Write the preamble and the object. The levels record of an UCSWAutoSaveObject is left out, its levels are written one by one with WriteLevelRecord().
+* NOTE: Tagged properties seek back to patch their size, that's why each part is serialized into a scratch buffer before being streamed.
+*/
+static bool WriteSaveGameObject(FArchive& Ar, USaveGame* SaveGameObject, TArray<uint8>& Scratch, const FCSWVersionsLocation* VersionsLocation)
+{
+	WriteSaveGamePreamble(Ar, SaveGameObject, VersionsLocation);
+	SerializeObjectIntoScratch(Scratch, SaveGameObject);
+	Ar << Scratch;
+	return !Ar.IsError();
+}
+
+/** Serialize an actor record into the Scratch buffer as a compact record. Records with a transform precision other than Full have their locations quantized inside the Bounds of the level */
+static void SerializeActorIntoScratch(TArray<uint8>& Scratch, FCSWActorRecord& ActorRecord, const FBox& Bounds)
+{
+	SerializeIntoScratch(Scratch, [&ActorRecord, &Bounds](FArchive& ProxyAr) { FCSWTransformCodec::SaveCompactRecord(ProxyAr, ActorRecord, Bounds); });
+}
+
+/** Deserialize an actor record written by SerializeActorIntoScratch(), or a whole record (tagged in older saves) */
+static void DeserializeActorFromScratch(const TArray<uint8>& Scratch, const FCSWSaveGameVersions& Versions, FCSWActorRecord& ActorRecord, const FBox& Bounds)
+{
+	if (FCSWTransformCodec::IsCompactData(Scratch))
+	{
+		DeserializeFromScratch(Scratch, Versions, [&ActorRecord, &Bounds](FArchive& ProxyAr) { FCSWTransformCodec::LoadCompactRecord(ProxyAr, ActorRecord, Bounds); });
+		return;
+	}
+	DeserializeFromScratch(Scratch, Versions, [&ActorRecord](FArchive& ProxyAr) { FCSWActorRecord::StaticStruct()->SerializeItem(ProxyAr, &ActorRecord, nullptr); });
+}
+
+/**
+* Write the actor records of a level one at a time, so only the scratch buffer of a single record is in memory at any moment.
+* The CRC of every record is added to OutActorCrcs if it isn't null (see FCSWSaveGameJournalState).
+*/
+static bool WriteLevelRecord(FArchive& Ar, FCSWMapRecord& MapRecord, TArray<uint8>& Scratch, TMap<FName, uint32>* OutActorCrcs = nullptr)
+{
+	MapRecord.Bounds = FCSWTransformCodec::ComputeBounds(MapRecord);
+	Ar << MapRecord.Bounds;
+	int32 NumActors = MapRecord.ActorsRecord.Num();
+	Ar << NumActors;
+	for (FCSWActorRecord& ActorRecord : MapRecord.ActorsRecord)
+	{
+		SerializeActorIntoScratch(Scratch, ActorRecord, MapRecord.Bounds);
+		Ar << Scratch;
+		if (OutActorCrcs)
+		{
+			OutActorCrcs->Add(ActorRecord.Name, FCSWChecksum::Crc32C(Scratch.GetData(), Scratch.Num()));
+		}
+	}
+	return !Ar.IsError();
+}
+
+/** Read the preamble and the object written by WriteSaveGameObject() into the SaveGameObject */
+static bool ReadSaveGameObject(FArchive& Ar, USaveGame* SaveGameObject, FCSWSaveGameVersions& OutVersions, TArray<uint8>& Scratch, const FCSWVersionsLocation* VersionsLocation)
+{
+	if (!ReadSaveGamePreamble(Ar, OutVersions, VersionsLocation)) return false;
+	Ar << Scratch;
+	if (Ar.IsError()) return false;
+	DeserializeFromScratch(Scratch, OutVersions, [SaveGameObject](FArchive& ProxyAr) { SaveGameObject->Serialize(ProxyAr); });
+	return true;
+}
+
+/** Read the bounds and the actor records written by WriteLevelRecord() into the MapRecord */
+static bool ReadLevelRecord(FArchive& Ar, FCSWMapRecord& MapRecord, const FCSWSaveGameVersions& Versions, TArray<uint8>& Scratch)
+{
+	Ar << MapRecord.Bounds;
+	int32 NumActors = 0;
+	Ar << NumActors;
+	if (Ar.IsError() || NumActors < 0) return false;
+	MapRecord.ActorsRecord.Reset(NumActors);
+	for (int32 ActorIndex = 0; ActorIndex < NumActors; ActorIndex++)
+	{
+		Ar << Scratch;
+		if (Ar.IsError()) return false;
+		FCSWActorRecord& ActorRecord = MapRecord.ActorsRecord[MapRecord.ActorsRecord.AddDefaulted()];
+		DeserializeActorFromScratch(Scratch, Versions, ActorRecord, MapRecord.Bounds);
+	}
+	return !Ar.IsError();
+}
+
+/**
+* Write a container from its parts: WriteObject writes the object chunk, then one chunk per level of LevelsRecord.
+* If OutState isn't null, the SaveId and size of the slot and the CRC of every actor record are recorded in it, so the slot can be the base of a journal.
+* If OutSaveId isn't null, it receives the SaveId of the slot.
+* If OutChunks isn't null, it receives the plain bytes of the chunks written (see FCSWSaveGameSnapshot::bFromChunks).
+* SaveId is the generation of the slot, a new one if it isn't valid.
+*/
+static bool WriteSaveGameContainerFromParts(FArchive& FileAr, TFunctionRef<bool(FArchive&)> WriteObject, TArray<FCSWMapRecord>& LevelsRecord, const ECSWCompressionCodec Codec, FCSWSaveGameJournalState* OutState, FGuid* OutSaveId = nullptr, FCSWSaveGameSnapshot* OutChunks = nullptr, const FGuid& SaveId = FGuid())
+{
+	FCSWSaveGameContainerWriter Writer(FileAr, Codec, SaveId);
+	if (!Writer.WriteHeader()) return false;
+	if (OutChunks)
+	{
+		OutChunks->bFromChunks = true;
+		OutChunks->ObjectChunk.Reset();
+		OutChunks->LevelChunks.Reset(LevelsRecord.Num());
+	}
+	if (!Writer.WriteObjectChunk([&WriteObject, OutChunks](FArchive& Ar)
+	{
+		if (!OutChunks) return WriteObject(Ar);
+		FCSWArchiveCopyProxy CopyAr(Ar, OutChunks->ObjectChunk);
+		return WriteObject(CopyAr) && !CopyAr.IsError();
+	})) return false;
+
+	TArray<uint8> Scratch;
+	for (FCSWMapRecord& MapRecord : LevelsRecord)
+	{
+		TMap<FName, uint32>* ActorCrcs = OutState ? &OutState->ActorCrcs.Add(MapRecord.Name) : nullptr;
+		FCSWSaveGameLevelChunk* LevelChunk = nullptr;
+		if (OutChunks)
+		{
+			LevelChunk = &OutChunks->LevelChunks[OutChunks->LevelChunks.AddDefaulted()];
+			LevelChunk->Name = MapRecord.Name;
+		}
+		if (!Writer.WriteLevelChunk(MapRecord.Name.ToString(), MapRecord.ActorsRecord.Num(), [&MapRecord, &Scratch, ActorCrcs, LevelChunk](FArchive& Ar)
+		{
+			if (!LevelChunk) return WriteLevelRecord(Ar, MapRecord, Scratch, ActorCrcs);
+			FCSWArchiveCopyProxy CopyAr(Ar, LevelChunk->Data);
+			return WriteLevelRecord(CopyAr, MapRecord, Scratch, ActorCrcs) && !CopyAr.IsError();
+		})) return false;
+		if (OutState)
+		{
+			OutState->LevelBounds.Add(MapRecord.Name, MapRecord.Bounds);
+		}
+	}
+	if (!Writer.Finish()) return false;
+	if (OutSaveId)
+	{
+		*OutSaveId = Writer.GetHeader().Metadata.SaveId;
+	}
+	if (OutState)
+	{
+		OutState->BaseSaveId = Writer.GetHeader().Metadata.SaveId;
+		OutState->BaseSize = FileAr.Tell();
+		OutState->JournalSize = 0;
+	}
+	return true;
+}
+
+/** Write the SaveGameObject as a container. OutState, OutSaveId and OutChunks are filled like WriteSaveGameContainerFromParts() does */
+static bool WriteSaveGameContainer(FArchive& FileAr, USaveGame* SaveGameObject, const ECSWCompressionCodec Codec, const FCSWVersionsLocation& VersionsLocation, FCSWSaveGameJournalState* OutState = nullptr, FGuid* OutSaveId = nullptr, FCSWSaveGameSnapshot* OutChunks = nullptr)
+{
+	TArray<uint8> Scratch;
+	auto WriteObject = [SaveGameObject, &Scratch, &VersionsLocation, OutState](FArchive& Ar)
+	{
+		const bool bWritten = WriteSaveGameObject(Ar, SaveGameObject, Scratch, &VersionsLocation);
+		if (OutState)
+		{
+			OutState->ObjectCrc = FCSWChecksum::Crc32C(Scratch.GetData(), Scratch.Num());
+		}
+		return bWritten;
+	};
+	TArray<FCSWMapRecord> NoLevels;
+	UCSWAutoSaveObject* AutoSaveObject = Cast<UCSWAutoSaveObject>(SaveGameObject);
+	if (!WriteSaveGameContainerFromParts(FileAr, WriteObject, AutoSaveObject ? AutoSaveObject->LevelsRecord : NoLevels, Codec, OutState, OutSaveId, OutChunks)) return false;
+	if (OutChunks)
+	{
+		OutChunks->VersionsLocation = VersionsLocation;
+	}
+	if (OutState)
+	{
+		OutState->SaveGameObject = SaveGameObject;
+		OutState->RecordStamp = FCSWActorRecord::GetLastChangeStamp();
+	}
+	return true;
+}
+
+/**
+* Read a container written by WriteSaveGameContainer(). If LevelNames isn't null, only the chunks of those levels are read and decoded.
+* If OutChunks isn't null, it receives the plain bytes of the chunks read (see FCSWSaveGameSnapshot::bFromChunks).
+*/
+static bool ReadSaveGameContainer(FArchive& FileAr, const FCSWSaveGameHeader& Header, USaveGame* SaveGameObject, const TArray<FName>* LevelNames, const FCSWVersionsLocation& VersionsLocation, FCSWSaveGameSnapshot* OutChunks)
+{
+	FCSWSaveGameContainerReader Reader(FileAr, Header);
+	if (!Reader.ReadToc()) return false;
+
+	///The object chunk is always read, the versions in its preamble are needed to read the levels
+	FCSWSaveGameVersions Versions;
+	TArray<uint8> Scratch;
+	if (OutChunks)
+	{
+		OutChunks->bFromChunks = true;
+		OutChunks->VersionsLocation = VersionsLocation;
+		OutChunks->ObjectChunk.Reset();
+		OutChunks->LevelChunks.Reset(Reader.GetToc().LevelChunks.Num());
+	}
+	if (!Reader.ReadChunk(Reader.GetToc().ObjectChunk, [SaveGameObject, &Versions, &Scratch, &VersionsLocation, OutChunks](FArchive& Ar)
+	{
+		if (!OutChunks) return ReadSaveGameObject(Ar, SaveGameObject, Versions, Scratch, &VersionsLocation);
+		FCSWArchiveCopyProxy CopyAr(Ar, OutChunks->ObjectChunk);
+		return ReadSaveGameObject(CopyAr, SaveGameObject, Versions, Scratch, &VersionsLocation) && !CopyAr.IsError();
+	})) return false;
+
+	UCSWAutoSaveObject* AutoSaveObject = Cast<UCSWAutoSaveObject>(SaveGameObject);
+	if (!AutoSaveObject) return true;
+	AutoSaveObject->LevelsRecord.Reset(Reader.GetToc().LevelChunks.Num());
+	for (const FCSWSaveGameChunkEntry& Entry : Reader.GetToc().LevelChunks)
+	{
+		const FName LevelName(*Entry.Name);
+		if (LevelNames && !LevelNames->Contains(LevelName)) continue;
+
+		FCSWMapRecord& MapRecord = AutoSaveObject->LevelsRecord[AutoSaveObject->LevelsRecord.AddDefaulted()];
+		MapRecord.Name = LevelName;
+		FCSWSaveGameLevelChunk* LevelChunk = nullptr;
+		if (OutChunks)
+		{
+			LevelChunk = &OutChunks->LevelChunks[OutChunks->LevelChunks.AddDefaulted()];
+			LevelChunk->Name = LevelName;
+		}
+		if (!Reader.ReadChunk(Entry, [&MapRecord, &Versions, &Scratch, &Header, LevelChunk](FArchive& Ar)
+		{
+			if (!LevelChunk) return ReadLevelRecord(Ar, MapRecord, Versions, Scratch);
+			FCSWArchiveCopyProxy CopyAr(Ar, LevelChunk->Data);
+			return ReadLevelRecord(CopyAr, MapRecord, Versions, Scratch) && !CopyAr.IsError();
+		})) return false;
+	}
+	return true;
+}
+
+/** Load a slot written before FCSWSaveGameHeader existed: the whole file is the (optionally zlib compressed) preamble + object */
+static bool ReadLegacySaveGame(FArchive& FileAr, USaveGame* SaveGameObject, const bool bFileIsCompressed, const FCSWVersionsLocation& VersionsLocation)
+{
+	TArray<uint8> ObjectBytes;
+	ObjectBytes.SetNumUninitialized(FileAr.TotalSize() - FileAr.Tell());
+	FileAr.Serialize(ObjectBytes.GetData(), ObjectBytes.Num());
+	if (FileAr.IsError()) return false;
+	///Try to decompress data
+	TArray<uint8> DecompressedObjectBytes;
+	if (bFileIsCompressed)
+	{
+		UCSWAutoSaveBlueprintLibrary::DecompressArrayOfBytes(ObjectBytes, OUT DecompressedObjectBytes);
+	}
+	TArray<uint8>& ObjectBytesToUse = bFileIsCompressed ? DecompressedObjectBytes : ObjectBytes;
+	///
+	FMemoryReader MemoryReader(ObjectBytesToUse, true);
+	FCSWSaveGameVersions Versions;
+	if (ReadSaveGamePreamble(MemoryReader, Versions, &VersionsLocation))
+	{
+		/// Class is obtained from SaveGameObject input. SaveGameObject is already created.
+		FObjectAndNameAsStringProxyArchive Ar(MemoryReader, true);
+		SaveGameObject->Serialize(Ar);
+	}
+	return true;
+}
+
+/**
+* Put the levels an UCSWAutoSaveObject had before a partial load (KeptLevels) back into its levels record,
+* replaced by the levels of LevelNames it has now. Its other levels are dropped.
+* KeptTable is the reference table the object had, the data of the levels kept is moved to the table loaded.
+*/
+static void MergeLoadedLevels(UCSWAutoSaveObject* AutoSaveObject, TArray<FCSWMapRecord>&& KeptLevels, const FCSWReferenceTable& KeptTable, const TArray<FName>& LevelNames)
+{
+	TArray<FCSWMapRecord> LoadedLevels = MoveTemp(AutoSaveObject->LevelsRecord);
+	LoadedLevels.RemoveAll([&LevelNames](const FCSWMapRecord& LoadedLevel) { return !LevelNames.Contains(LoadedLevel.Name); });
+	AutoSaveObject->LevelsRecord = MoveTemp(KeptLevels);
+	for (FCSWMapRecord& KeptLevel : AutoSaveObject->LevelsRecord)
+	{
+		if (LoadedLevels.ContainsByPredicate([&KeptLevel](const FCSWMapRecord& LoadedLevel) { return LoadedLevel.Name == KeptLevel.Name; })) continue;
+		FCSWSavePlanCache::RemapReferences(KeptLevel, KeptTable, AutoSaveObject->ReferenceTable);
+	}
+	for (FCSWMapRecord& LoadedLevel : LoadedLevels)
+	{
+		FCSWMapRecord* ExistingLevel = AutoSaveObject->LevelsRecord.FindByPredicate([&LoadedLevel](const FCSWMapRecord& MapRecord) { return MapRecord.Name == LoadedLevel.Name; });
+		if (ExistingLevel)
+		{
+			*ExistingLevel = MoveTemp(LoadedLevel);
+		}
+		else
+		{
+			AutoSaveObject->LevelsRecord.Add(MoveTemp(LoadedLevel));
+		}
+	}
+}
+
+/**
+* Read a slot (container or written before the header existed) into the SaveGameObject.
+* If LevelNames isn't null, only those levels are loaded into the levels record of an UCSWAutoSaveObject and the other levels it already had are kept.
+* VersionsLocation is the directory of the slot. OutSaveId receives the SaveId of the slot (invalid for slots without a header), its journal is replayed with it.
+* If OutChunks isn't null and the slot is a container, it receives the plain bytes of its chunks (see FCSWSaveGameSnapshot::bFromChunks).
+*/
+static bool ReadSaveGameSlot(FArchive& FileAr, USaveGame* SaveGameObject, const bool bFileIsCompressed, const TArray<FName>* LevelNames, const FCSWVersionsLocation& VersionsLocation, FGuid& OutSaveId, FCSWSaveGameSnapshot* OutChunks)
+{
+	UCSWAutoSaveObject* AutoSaveObject = Cast<UCSWAutoSaveObject>(SaveGameObject);
+	TArray<FCSWMapRecord> KeptLevels;
+	FCSWReferenceTable KeptTable;
+	if (LevelNames && AutoSaveObject)
+	{
+		KeptLevels = MoveTemp(AutoSaveObject->LevelsRecord);
+		KeptTable = AutoSaveObject->ReferenceTable;
+	}
+
+	bool bSuccess;
+	const int64 StartPos = FileAr.Tell();
+	FCSWSaveGameHeader Header;
+	FileAr << Header;
+	///Slot saved before the header existed
+	if (Header.Magic != CSW_SAVEGAME_HEADER_MAGIC)
+	{
+		FileAr.Seek(StartPos);
+		bSuccess = ReadLegacySaveGame(FileAr, SaveGameObject, bFileIsCompressed, VersionsLocation);
+	}
+	else if (!Header.IsValid())
+	{
+		bSuccess = false;
+	}
+	else
+	{
+		///A header that doesn't match its checksum can point anywhere
+		bSuccess = FCSWSaveGameContainerReader::VerifyHeader(FileAr, StartPos, Header);
+		if (!bSuccess)
+		{
+			UE_LOG(LogTemp, Error, TEXT("CSWError: Corrupt header in save game (checksum mismatch)."));
+		}
+		bSuccess = bSuccess && ReadSaveGameContainer(FileAr, Header, SaveGameObject, LevelNames, VersionsLocation, OutChunks);
+		OutSaveId = Header.Metadata.SaveId;
+	}
+
+	///Put the kept levels back and replace them with the requested levels found in the slot.
+	///Slots written before the header existed were read completely, the levels that weren't requested are dropped here.
+	if (LevelNames && AutoSaveObject)
+	{
+		MergeLoadedLevels(AutoSaveObject, MoveTemp(KeptLevels), KeptTable, *LevelNames);
+	}
+	return bSuccess;
+}
+
+#pragma endregion
+
+
+#pragma region SAVE GAME JOURNAL HELPERS
+
+/**
+* Build the payload of a journal entry with what changed in the SaveGameObject since the State was recorded, and update the State.
+* The actor records that weren't filled again since then (see FCSWActorRecord::ChangeStamp) aren't serialized to be compared.
+* Payload: preamble, uint8 bHasObject, [object], int32 NumRecords, then { uint8 Op, FString Level, [FString Actor], [actor record or level bounds] } per record.
+* Returns false if nothing changed.
+*/
+static bool BuildJournalEntry(USaveGame* SaveGameObject, FCSWSaveGameJournalState& State, const FCSWVersionsLocation& VersionsLocation, TArray<uint8>& OutPayload)
+{
+	OutPayload.Reset();
+	FMemoryWriter Ar(OutPayload);
+	WriteSaveGamePreamble(Ar, SaveGameObject, &VersionsLocation);
+
+	///The object itself, only if it changed
+	TArray<uint8> Scratch;
+	SerializeObjectIntoScratch(Scratch, SaveGameObject);
+	const uint32 ObjectCrc = FCSWChecksum::Crc32C(Scratch.GetData(), Scratch.Num());
+	uint8 bHasObject = ObjectCrc != State.ObjectCrc ? 1 : 0;
+	Ar << bHasObject;
+	if (bHasObject)
+	{
+		Ar << Scratch;
+		State.ObjectCrc = ObjectCrc;
+	}
+
+	///The actor records that changed, were added or were removed. The number of records is patched at the end
+	const int64 NumRecordsPos = Ar.Tell();
+	int32 NumRecords = 0;
+	Ar << NumRecords;
+	UCSWAutoSaveObject* AutoSaveObject = Cast<UCSWAutoSaveObject>(SaveGameObject);
+	TArray<FCSWMapRecord> NoLevels;
+	TArray<FCSWMapRecord>& LevelsRecord = AutoSaveObject ? AutoSaveObject->LevelsRecord : NoLevels;
+	const bool bSameObject = State.SaveGameObject.Get() == SaveGameObject;
+	TSet<FName> SavedLevels;
+	TSet<FName> SavedActors;
+	for (FCSWMapRecord& MapRecord : LevelsRecord)
+	{
+		SavedLevels.Add(MapRecord.Name);
+		FString LevelName = MapRecord.Name.ToString();
+		TMap<FName, uint32>& ActorCrcs = State.ActorCrcs.FindOrAdd(MapRecord.Name);
+		///The bounds go before the compact records decoded with them. Records quantized with other bounds have another CRC and are written again
+		MapRecord.Bounds = FCSWTransformCodec::ComputeBounds(MapRecord);
+		const FBox* PreviousBounds = State.LevelBounds.Find(MapRecord.Name);
+		const bool bBoundsChanged = !PreviousBounds || !(*PreviousBounds == MapRecord.Bounds) || PreviousBounds->IsValid != MapRecord.Bounds.IsValid;
+		if (bBoundsChanged)
+		{
+			uint8 Op = ECSWJournalRecordOp::SetLevelBounds;
+			Ar << Op << LevelName << MapRecord.Bounds;
+			State.LevelBounds.Add(MapRecord.Name, MapRecord.Bounds);
+			NumRecords++;
+		}
+		SavedActors.Reset();
+		for (FCSWActorRecord& ActorRecord : MapRecord.ActorsRecord)
+		{
+			SavedActors.Add(ActorRecord.Name);
+			///Kept by the dirty tracking since the previous entry: it's the record the CRC was taken from
+			const bool bUnchanged = bSameObject && !bBoundsChanged && ActorRecord.ChangeStamp != 0 && ActorRecord.ChangeStamp <= State.RecordStamp;
+			if (bUnchanged && ActorCrcs.Contains(ActorRecord.Name)) continue;
+			SerializeActorIntoScratch(Scratch, ActorRecord, MapRecord.Bounds);
+			const uint32 ActorCrc = FCSWChecksum::Crc32C(Scratch.GetData(), Scratch.Num());
+			const uint32* PreviousCrc = ActorCrcs.Find(ActorRecord.Name);
+			if (PreviousCrc && *PreviousCrc == ActorCrc) continue;
+			uint8 Op = ECSWJournalRecordOp::SetActor;
+			FString ActorName = ActorRecord.Name.ToString();
+			Ar << Op << LevelName << ActorName << Scratch;
+			ActorCrcs.Add(ActorRecord.Name, ActorCrc);
+			NumRecords++;
+		}
+		for (auto It = ActorCrcs.CreateIterator(); It; ++It)
+		{
+			if (SavedActors.Contains(It.Key())) continue;
+			uint8 Op = ECSWJournalRecordOp::RemoveActor;
+			FString ActorName = It.Key().ToString();
+			Ar << Op << LevelName << ActorName;
+			It.RemoveCurrent();
+			NumRecords++;
+		}
+	}
+	for (auto It = State.ActorCrcs.CreateIterator(); It; ++It)
+	{
+		if (SavedLevels.Contains(It.Key())) continue;
+		uint8 Op = ECSWJournalRecordOp::RemoveLevel;
+		FString LevelName = It.Key().ToString();
+		Ar << Op << LevelName;
+		State.LevelBounds.Remove(It.Key());
+		It.RemoveCurrent();
+		NumRecords++;
+	}
+	const int64 EndPos = Ar.Tell();
+	Ar.Seek(NumRecordsPos);
+	Ar << NumRecords;
+	Ar.Seek(EndPos);
+	State.SaveGameObject = SaveGameObject;
+	State.RecordStamp = FCSWActorRecord::GetLastChangeStamp();
+	return bHasObject || NumRecords > 0;
+}
+
+/**
+* Index of the levels record of an UCSWAutoSaveObject by level and actor name, built once per journal replay.
+* The actors of a level are indexed the first time the journal changes the level. A removed record is swapped with the last one of its array.
+*/
+class FCSWJournalReplayIndex
+{
+public:
+	explicit FCSWJournalReplayIndex(TArray<FCSWMapRecord>& InLevelsRecord)
+		: LevelsRecord(InLevelsRecord)
+	{
+		LevelIndices.Reserve(LevelsRecord.Num());
+		for (int32 LevelIndex = 0; LevelIndex < LevelsRecord.Num(); LevelIndex++)
+		{
+			if (!LevelIndices.Contains(LevelsRecord[LevelIndex].Name))
+			{
+				LevelIndices.Add(LevelsRecord[LevelIndex].Name, LevelIndex);
+			}
+		}
+	}
+
+	FCSWMapRecord* FindLevel(const FName LevelName)
+	{
+		const int32* LevelIndex = LevelIndices.Find(LevelName);
+		return LevelIndex ? &LevelsRecord[*LevelIndex] : nullptr;
+	}
+
+	FCSWMapRecord& FindOrAddLevel(const FName LevelName)
+	{
+		if (FCSWMapRecord* MapRecord = FindLevel(LevelName)) return *MapRecord;
+		const int32 LevelIndex = LevelsRecord.AddDefaulted();
+		LevelsRecord[LevelIndex].Name = LevelName;
+		LevelIndices.Add(LevelName, LevelIndex);
+		return LevelsRecord[LevelIndex];
+	}
+
+	void RemoveLevel(const FName LevelName)
+	{
+		int32 LevelIndex;
+		if (!LevelIndices.RemoveAndCopyValue(LevelName, LevelIndex)) return;
+		ActorIndices.Remove(LevelName);
+		LevelsRecord.RemoveAtSwap(LevelIndex);
+		if (LevelsRecord.IsValidIndex(LevelIndex))
+		{
+			LevelIndices.Add(LevelsRecord[LevelIndex].Name, LevelIndex);
+		}
+	}
+
+	/** The record of the actor, cleared, or a new one */
+	FCSWActorRecord& ResetOrAddActor(FCSWMapRecord& MapRecord, const FName ActorName)
+	{
+		TMap<FName, int32>& Indices = GetActorIndices(MapRecord);
+		if (const int32* ActorIndex = Indices.Find(ActorName))
+		{
+			MapRecord.ActorsRecord[*ActorIndex] = FCSWActorRecord();
+			return MapRecord.ActorsRecord[*ActorIndex];
+		}
+		const int32 ActorIndex = MapRecord.ActorsRecord.AddDefaulted();
+		Indices.Add(ActorName, ActorIndex);
+		return MapRecord.ActorsRecord[ActorIndex];
+	}
+
+	void RemoveActor(FCSWMapRecord& MapRecord, const FName ActorName)
+	{
+		TMap<FName, int32>& Indices = GetActorIndices(MapRecord);
+		int32 ActorIndex;
+		if (!Indices.RemoveAndCopyValue(ActorName, ActorIndex)) return;
+		MapRecord.ActorsRecord.RemoveAtSwap(ActorIndex);
+		if (MapRecord.ActorsRecord.IsValidIndex(ActorIndex))
+		{
+			Indices.Add(MapRecord.ActorsRecord[ActorIndex].Name, ActorIndex);
+		}
+	}
+
+private:
+	TMap<FName, int32>& GetActorIndices(FCSWMapRecord& MapRecord)
+	{
+		if (TMap<FName, int32>* Indices = ActorIndices.Find(MapRecord.Name)) return *Indices;
+		TMap<FName, int32>& Indices = ActorIndices.Add(MapRecord.Name);
+		Indices.Reserve(MapRecord.ActorsRecord.Num());
+		for (int32 ActorIndex = 0; ActorIndex < MapRecord.ActorsRecord.Num(); ActorIndex++)
+		{
+			if (!Indices.Contains(MapRecord.ActorsRecord[ActorIndex].Name))
+			{
+				Indices.Add(MapRecord.ActorsRecord[ActorIndex].Name, ActorIndex);
+			}
+		}
+		return Indices;
+	}
+
+public:
+	/**
+	* Partial loads keep the reference table of the object, the table of the last object of the journal is kept here.
+	* The records of the journal written after it are moved to the table of the object.
+	*/
+	FCSWReferenceTable JournalReferenceTable;
+	bool bHasJournalReferenceTable = false;
+
+private:
+	TArray<FCSWMapRecord>& LevelsRecord;
+	TMap<FName, int32> LevelIndices;
+	/** Actor record indices of the levels changed so far, by level name */
+	TMap<FName, TMap<FName, int32>> ActorIndices;
+};
+
+/**
+* Apply a journal entry built by BuildJournalEntry() to the SaveGameObject. If LevelNames isn't null, only the records of those levels are applied.
+* ReplayIndex indexes the levels record of the SaveGameObject, null if it isn't an UCSWAutoSaveObject. VersionsLocation is the directory of the slot (see ReadSaveGamePreamble()).
+*/
+static bool ApplyJournalEntry(const TArray<uint8>& Payload, USaveGame* SaveGameObject, const TArray<FName>* LevelNames, const FCSWVersionsLocation* VersionsLocation, FCSWJournalReplayIndex* ReplayIndex)
+{
+	FMemoryReader Ar(Payload, true);
+	FCSWSaveGameVersions Versions;
+	if (!ReadSaveGamePreamble(Ar, Versions, VersionsLocation)) return false;
+
+	UCSWAutoSaveObject* AutoSaveObject = Cast<UCSWAutoSaveObject>(SaveGameObject);
+	TArray<uint8> Scratch;
+	uint8 bHasObject = 0;
+	Ar << bHasObject;
+	if (bHasObject)
+	{
+		Ar << Scratch;
+		if (Ar.IsError()) return false;
+		///The levels record isn't part of the object data
+		TArray<FCSWMapRecord> LevelsRecord;
+		FCSWReferenceTable ReferenceTable;
+		if (AutoSaveObject)
+		{
+			LevelsRecord = MoveTemp(AutoSaveObject->LevelsRecord);
+		}
+		if (AutoSaveObject && LevelNames && ReplayIndex)
+		{
+			ReferenceTable = AutoSaveObject->ReferenceTable;
+		}
+		DeserializeFromScratch(Scratch, Versions, [SaveGameObject](FArchive& ProxyAr) { SaveGameObject->Serialize(ProxyAr); });
+		if (AutoSaveObject)
+		{
+			AutoSaveObject->LevelsRecord = MoveTemp(LevelsRecord);
+			///The levels that aren't loaded are kept with the table of the object
+			if (LevelNames && ReplayIndex)
+			{
+				ReplayIndex->JournalReferenceTable = MoveTemp(AutoSaveObject->ReferenceTable);
+				ReplayIndex->bHasJournalReferenceTable = true;
+				AutoSaveObject->ReferenceTable = MoveTemp(ReferenceTable);
+			}
+		}
+	}
+
+	int32 NumRecords = 0;
+	Ar << NumRecords;
+	if (Ar.IsError() || NumRecords < 0) return false;
+	if (!AutoSaveObject || !ReplayIndex) return NumRecords == 0;
+	for (int32 RecordIndex = 0; RecordIndex < NumRecords; RecordIndex++)
+	{
+		uint8 Op = 0;
+		FString LevelString;
+		FString ActorString;
+		FBox Bounds(ForceInit);
+		Ar << Op << LevelString;
+		if (Op == ECSWJournalRecordOp::SetActor || Op == ECSWJournalRecordOp::RemoveActor)
+		{
+			Ar << ActorString;
+		}
+		if (Op == ECSWJournalRecordOp::SetActor)
+		{
+			Ar << Scratch;
+		}
+		if (Op == ECSWJournalRecordOp::SetLevelBounds)
+		{
+			Ar << Bounds;
+		}
+		if (Ar.IsError() || Op > ECSWJournalRecordOp::SetLevelBounds) return false;
+
+		const FName LevelName(*LevelString);
+		if (LevelNames && !LevelNames->Contains(LevelName)) continue;
+		if (Op == ECSWJournalRecordOp::RemoveLevel)
+		{
+			ReplayIndex->RemoveLevel(LevelName);
+			continue;
+		}
+		const FName ActorName(*ActorString);
+		if (Op == ECSWJournalRecordOp::RemoveActor)
+		{
+			if (FCSWMapRecord* MapRecord = ReplayIndex->FindLevel(LevelName))
+			{
+				ReplayIndex->RemoveActor(*MapRecord, ActorName);
+			}
+			continue;
+		}
+		FCSWMapRecord& MapRecord = ReplayIndex->FindOrAddLevel(LevelName);
+		if (Op == ECSWJournalRecordOp::SetLevelBounds)
+		{
+			MapRecord.Bounds = Bounds;
+			continue;
+		}
+		FCSWActorRecord& ActorRecord = ReplayIndex->ResetOrAddActor(MapRecord, ActorName);
+		DeserializeActorFromScratch(Scratch, Versions, ActorRecord, MapRecord.Bounds);
+		if (ReplayIndex->bHasJournalReferenceTable)
+		{
+			FCSWSavePlanCache::RemapReferences(ActorRecord.Data, ReplayIndex->JournalReferenceTable, AutoSaveObject->ReferenceTable);
+			for (FCSWActorComponentRecord& ComponentRecord : ActorRecord.ComponentsRecord)
+			{
+				FCSWSavePlanCache::RemapReferences(ComponentRecord.Data, ReplayIndex->JournalReferenceTable, AutoSaveObject->ReferenceTable);
+			}
+		}
+	}
+	return true;
+}
+
+/**
+* Replay the journal of a slot on top of the SaveGameObject loaded from it. Slots without a journal (or with the journal of another generation) are left as they are.
+* If OutEntries isn't null, it receives the payloads of the entries replayed.
+*/
+static void ReplaySaveGameJournal(ICSWSaveGameSystem* SaveSystem, USaveGame* SaveGameObject, const FGuid& BaseSaveId, const FString& SlotName, const int32 UserIndex, const bool bFileIsCompressed, const bool bUseCustomPath, const FString& Path, const TArray<FName>* LevelNames, TArray<TArray<uint8>>* OutEntries = nullptr)
+{
+	if (!BaseSaveId.IsValid()) return;
+	bool bFailedEntry = false;
+	const FCSWVersionsLocation VersionsLocation(SaveSystem, bUseCustomPath, Path, UserIndex);
+	/// Built on the first entry, slots without a journal don't index their records
+	TUniquePtr<FCSWJournalReplayIndex> ReplayIndex;
+	UCSWAutoSaveObject* AutoSaveObject = Cast<UCSWAutoSaveObject>(SaveGameObject);
+	SaveSystem->LoadSaveGameJournal(bUseCustomPath, bFileIsCompressed, *Path, *SlotName, UserIndex, [&](FArchive& JournalAr)
+	{
+		return FCSWSaveGameJournal::ReadEntries(JournalAr, BaseSaveId, [&](const TArray<uint8>& Payload)
+		{
+			if (AutoSaveObject && !ReplayIndex.IsValid())
+			{
+				ReplayIndex = MakeUnique<FCSWJournalReplayIndex>(AutoSaveObject->LevelsRecord);
+			}
+			bFailedEntry = !ApplyJournalEntry(Payload, SaveGameObject, LevelNames, &VersionsLocation, ReplayIndex.Get());
+			if (OutEntries && !bFailedEntry)
+			{
+				OutEntries->Add(Payload);
+			}
+			return !bFailedEntry;
+		});
+	});
+	if (bFailedEntry)
+	{
+		UE_LOG(LogTemp, Error, TEXT("CSWError: Couldn't replay the journal of the save game %s, the most recent changes weren't loaded."), *SlotName);
+	}
+}
+
+/**
+* Forget the journal state of a slot before the slot is written or deleted by other means than its journal.
+* A pending compaction of the slot is cancelled and a running one is waited for, so its older snapshot never replaces the slot.
+*/
+static void DiscardSaveGameJournalState(const FString& SlotKey)
+{
+	FCSWSaveJobScheduler::Get().CancelByKey(TEXT("Compact:") + SlotKey);
+	FCSWSaveGameJournal& Journal = FCSWSaveGameJournal::Get();
+	const FCSWSaveGameJournalStatePtr State = Journal.FindState(SlotKey);
+	if (!State.IsValid()) return;
+	FScopeLock Lock(&State->Lock);
+	Journal.RemoveState(SlotKey);
+}
+
+/**
+* Read a slot and replay its journal. If LevelNames isn't null, only those levels are loaded (see ReadSaveGameSlot()). OutSaveId receives the SaveId of the slot.
+* If OutChunks isn't null and the slot is a container, it receives the plain bytes of its chunks and the entries of its journal (see FCSWSaveGameSnapshot::bFromChunks).
+*/
+static bool LoadSaveGameSlot(ICSWSaveGameSystem* SaveSystem, USaveGame* SaveGameObject, const FString& SlotName, const int32 UserIndex, const bool bFileIsCompressed, const bool bUseCustomPath, const FString& Path, const TArray<FName>* LevelNames, FGuid& OutSaveId, FCSWSaveGameSnapshot* OutChunks = nullptr)
+{
+	// Stream the slot, decompressing it one block at a time
+	const FCSWVersionsLocation VersionsLocation(SaveSystem, bUseCustomPath, Path, UserIndex);
+	const bool bSuccess = SaveSystem->LoadGameStreamed(false, bUseCustomPath, bFileIsCompressed, *Path, *SlotName, UserIndex, [SaveGameObject, bFileIsCompressed, LevelNames, &VersionsLocation, &OutSaveId, OutChunks](FArchive& FileAr)
+	{
+		return ReadSaveGameSlot(FileAr, SaveGameObject, bFileIsCompressed, LevelNames, VersionsLocation, OutSaveId, OutChunks);
+	});
+	if (bSuccess == false) return false;
+	// Changes saved by CSWSaveGameToSlotJournaled() since the slot was written
+	ReplaySaveGameJournal(SaveSystem, SaveGameObject, OutSaveId, SlotName, UserIndex, bFileIsCompressed, bUseCustomPath, Path, LevelNames, OutChunks ? &OutChunks->JournalEntries : nullptr);
+	return true;
+}
+
+/**
+* Restore the SaveGameObject from a snapshot of it, like LoadSaveGameSlot() does from the slot the snapshot was written into.
+* If LevelNames isn't null, only those levels replace the ones of the levels record of an UCSWAutoSaveObject, the other levels it already had are kept.
+*/
+static bool ApplySaveGameSnapshot(const FCSWSaveGameSnapshot& Snapshot, USaveGame* SaveGameObject, const TArray<FName>* LevelNames)
+{
+	FMemoryReader ObjectChunkReader(Snapshot.ObjectChunk, true);
+	FCSWSaveGameVersions Versions;
+	TArray<uint8> Scratch;
+	UCSWAutoSaveObject* AutoSaveObject = Cast<UCSWAutoSaveObject>(SaveGameObject);
+	TArray<FCSWMapRecord> KeptLevels;
+	FCSWReferenceTable KeptTable;
+	if (LevelNames && AutoSaveObject)
+	{
+		KeptLevels = MoveTemp(AutoSaveObject->LevelsRecord);
+		KeptTable = AutoSaveObject->ReferenceTable;
+	}
+	///Preambles with only the hash of the versions find them next to the slots the snapshot belongs to
+	const FCSWVersionsLocation* VersionsLocation = Snapshot.VersionsLocation.SaveSystem ? &Snapshot.VersionsLocation : nullptr;
+	if (!ReadSaveGameObject(ObjectChunkReader, SaveGameObject, Versions, Scratch, VersionsLocation)) return false;
+
+	///Decoded like the slot it was built from: the level chunks, then the journal
+	if (Snapshot.bFromChunks)
+	{
+		if (AutoSaveObject)
+		{
+			AutoSaveObject->LevelsRecord.Reset(Snapshot.LevelChunks.Num());
+			for (const FCSWSaveGameLevelChunk& LevelChunk : Snapshot.LevelChunks)
+			{
+				if (LevelNames && !LevelNames->Contains(LevelChunk.Name)) continue;
+				FCSWMapRecord& MapRecord = AutoSaveObject->LevelsRecord[AutoSaveObject->LevelsRecord.AddDefaulted()];
+				MapRecord.Name = LevelChunk.Name;
+				FMemoryReader LevelChunkReader(LevelChunk.Data, true);
+				if (!ReadLevelRecord(LevelChunkReader, MapRecord, Versions, Scratch)) return false;
+			}
+			if (LevelNames)
+			{
+				MergeLoadedLevels(AutoSaveObject, MoveTemp(KeptLevels), KeptTable, *LevelNames);
+			}
+		}
+		TUniquePtr<FCSWJournalReplayIndex> ReplayIndex;
+		if (AutoSaveObject && Snapshot.JournalEntries.Num() > 0)
+		{
+			ReplayIndex = MakeUnique<FCSWJournalReplayIndex>(AutoSaveObject->LevelsRecord);
+		}
+		for (const TArray<uint8>& Payload : Snapshot.JournalEntries)
+		{
+			if (!ApplyJournalEntry(Payload, SaveGameObject, LevelNames, VersionsLocation, ReplayIndex.Get())) return false;
+		}
+		return true;
+	}
+
+	if (!AutoSaveObject) return true;
+	if (!LevelNames)
+	{
+		AutoSaveObject->LevelsRecord = Snapshot.LevelsRecord;
+		return true;
+	}
+	AutoSaveObject->LevelsRecord.Reset();
+	for (const FCSWMapRecord& SnapshotLevel : Snapshot.LevelsRecord)
+	{
+		if (LevelNames->Contains(SnapshotLevel.Name))
+		{
+			AutoSaveObject->LevelsRecord.Add(SnapshotLevel);
+		}
+	}
+	MergeLoadedLevels(AutoSaveObject, MoveTemp(KeptLevels), KeptTable, *LevelNames);
+	return true;
+}
+
+#pragma endregion
+
+
+#pragma region AUTO SAVE AND LOAD MAIN FUNCTIONS
+
+bool UCSWAutoSaveBlueprintLibrary::CSWSaveGameToSlot(USaveGame* SaveGameObject, const FString& SlotName, const int32 UserIndex, const bool bCompressFile /*= true*/, const bool bUseCustomPath /*= false*/, const FString& Path /*= ""*/, const ECSWCompressionCodec Codec /*= ECSWCompressionCodec::Zlib*/)
+{
+	ICSWSaveGameSystem* CSWSaveSystem = ICSWPlatformFeaturesModule::Get().GetActiveSaveGameSystem();
+	// If we have a system and an object to save and a save name...
+	if (CSWSaveSystem && SaveGameObject && (SlotName.Len() > 0))
+	{
+		const FCSWVersionsLocation VersionsLocation(CSWSaveSystem, bUseCustomPath, Path, UserIndex);
+		const FString SlotKey = FCSWSaveGameJournal::GetSlotKey(SlotName, bCompressFile, bUseCustomPath, Path);
+		// The decoded slot cache keeps the plain chunks written, for the next load of the slot
+		FCSWDecodedSlotCache& SlotCache = FCSWDecodedSlotCache::Get();
+		TSharedPtr<FCSWSaveGameSnapshot, ESPMode::ThreadSafe> WrittenChunks;
+		if (SlotCache.IsEnabled())
+		{
+			WrittenChunks = MakeShared<FCSWSaveGameSnapshot, ESPMode::ThreadSafe>();
+		}
+		// The journal of the slot belongs to the generation being replaced
+		DiscardSaveGameJournalState(SlotKey);
+		// Stream the slot chunk by chunk, compressing each chunk in bounded-size blocks
+		const ECSWCompressionCodec ChunksCodec = bCompressFile ? Codec : ECSWCompressionCodec::None;
+		FGuid SaveId;
+		const bool bSaved = CSWSaveSystem->SaveGameStreamed(false, bUseCustomPath, bCompressFile, *Path, *SlotName, UserIndex, [SaveGameObject, ChunksCodec, &VersionsLocation, &SaveId, &WrittenChunks](FArchive& FileAr)
+		{
+			return WriteSaveGameContainer(FileAr, SaveGameObject, ChunksCodec, VersionsLocation, nullptr, &SaveId, WrittenChunks.Get());
+		});
+		// The file time may not change if the slot is saved twice within its resolution
+		FCSWSlotCatalog::Get().InvalidateSlot(SlotName);
+		if (bSaved && WrittenChunks.IsValid())
+		{
+			SlotCache.Add(SlotKey, SaveId, WrittenChunks);
+		}
+		else
+		{
+			SlotCache.Invalidate(SlotKey);
+		}
+		if (bSaved)
+		{
+			CSWSaveSystem->DeleteSaveGameJournal(bUseCustomPath, bCompressFile, *Path, *SlotName, UserIndex);
+		}
+		return bSaved;
+	}
+	return false;
+}
+
+bool UCSWAutoSaveBlueprintLibrary::CSWSaveGameToSlotJournaled(USaveGame* SaveGameObject, const FString& SlotName, const int32 UserIndex, const bool bCompressFile /*= true*/, const bool bUseCustomPath /*= false*/, const FString& Path /*= ""*/, const ECSWCompressionCodec Codec /*= ECSWCompressionCodec::ZlibFast*/)
+{
+	ICSWSaveGameSystem* SaveSystem = ICSWPlatformFeaturesModule::Get().GetActiveSaveGameSystem();
+	/// Validation
+	if (!SaveSystem || !SaveGameObject || SlotName.Len() <= 0) return false;
+	const ECSWCompressionCodec ChunksCodec = bCompressFile ? Codec : ECSWCompressionCodec::None;
+	FCSWSaveGameJournal& Journal = FCSWSaveGameJournal::Get();
+	const FString SlotKey = FCSWSaveGameJournal::GetSlotKey(SlotName, bCompressFile, bUseCustomPath, Path);
+	const FCSWVersionsLocation VersionsLocation(SaveSystem, bUseCustomPath, Path, UserIndex);
+
+	/// First journaled save of the slot (or the previous one failed): write the whole slot, it's the base of the journal from now on
+	FCSWSaveGameJournalStatePtr State = Journal.FindState(SlotKey);
+	if (!State.IsValid())
+	{
+		State = MakeShared<FCSWSaveGameJournalState, ESPMode::ThreadSafe>();
+		const bool bSaved = SaveSystem->SaveGameStreamed(false, bUseCustomPath, bCompressFile, *Path, *SlotName, UserIndex, [SaveGameObject, ChunksCodec, &VersionsLocation, &State](FArchive& FileAr)
+		{
+			return WriteSaveGameContainer(FileAr, SaveGameObject, ChunksCodec, VersionsLocation, State.Get());
+		});
+		FCSWSlotCatalog::Get().InvalidateSlot(SlotName);
+		FCSWDecodedSlotCache::Get().Invalidate(SlotKey);
+		if (!bSaved) return false;
+		SaveSystem->DeleteSaveGameJournal(bUseCustomPath, bCompressFile, *Path, *SlotName, UserIndex);
+		Journal.SetState(SlotKey, State);
+		return true;
+	}
+
+	bool bWritten;
+	{
+		FScopeLock Lock(&State->Lock);
+		/// Only what changed since the previous journaled save is written
+		TArray<uint8> Payload;
+		if (!BuildJournalEntry(SaveGameObject, *State, VersionsLocation, Payload)) return true;
+		const bool bNewJournal = State->JournalSize == 0;
+		const FGuid BaseSaveId = State->BaseSaveId;
+		int64 JournalSize = 0;
+		bWritten = SaveSystem->WriteSaveGameJournal(!bNewJournal, bUseCustomPath, bCompressFile, *Path, *SlotName, UserIndex, [&](FArchive& JournalAr)
+		{
+			if (bNewJournal && !FCSWSaveGameJournal::WriteHeader(JournalAr, BaseSaveId)) return false;
+			const bool bEntryWritten = FCSWSaveGameJournal::WriteEntry(JournalAr, Payload, ChunksCodec);
+			JournalSize = JournalAr.Tell();
+			return bEntryWritten;
+		});
+		/// The cached slot doesn't have this entry
+		FCSWDecodedSlotCache::Get().Invalidate(SlotKey);
+		if (bWritten)
+		{
+			State->JournalSize = JournalSize;
+			/// Fold the journal into a new base in the background once replaying it costs more than rewriting the slot
+			if (!State->bCompacting && State->JournalSize > FMath::Max<int64>(CSW_JOURNAL_COMPACTION_MIN_SIZE, State->BaseSize / 2))
+			{
+				State->bCompacting = true;
+				FCSWSaveGameJournalSnapshot Snapshot;
+				Snapshot.SlotName = SlotName;
+				Snapshot.UserIndex = UserIndex;
+				Snapshot.bCompressFile = bCompressFile;
+				Snapshot.bUseCustomPath = bUseCustomPath;
+				Snapshot.Path = Path;
+				Snapshot.Codec = ChunksCodec;
+				Snapshot.JournalSize = State->JournalSize;
+				Snapshot.State = State;
+				TakeSaveGameSnapshot(SaveGameObject, VersionsLocation, Snapshot.Data);
+				const FString JobKey = TEXT("Compact:") + SlotKey;
+				const int32 JobId = FCSWSaveJobScheduler::Get().Enqueue(JobKey, ECSWSaveJobPriority::Low, [Snapshot = MoveTemp(Snapshot)]() mutable { return CompactSaveGameJournal(Snapshot); });
+				State->bCompacting = JobId != INDEX_NONE;
+			}
+		}
+	}
+	if (!bWritten)
+	{
+		/// The platform can't append or the journal couldn't be written: forget it and write the whole slot
+		DiscardSaveGameJournalState(SlotKey);
+		return CSWSaveGameToSlotJournaled(SaveGameObject, SlotName, UserIndex, bCompressFile, bUseCustomPath, Path, Codec);
+	}
+	return true;
+}
+
+bool UCSWAutoSaveBlueprintLibrary::CompactSaveGameJournal(FCSWSaveGameJournalSnapshot& Snapshot)
+{
+	ICSWSaveGameSystem* SaveSystem = ICSWPlatformFeaturesModule::Get().GetActiveSaveGameSystem();
+	if (!SaveSystem || !Snapshot.State.IsValid()) return false;
+	const FString SlotKey = FCSWSaveGameJournal::GetSlotKey(Snapshot.SlotName, Snapshot.bCompressFile, Snapshot.bUseCustomPath, Snapshot.Path);
+	/// The slot and its journal change together: journaled saves of the slot wait until the new base and its journal are both written
+	FCSWSaveGameJournalState& State = *Snapshot.State;
+	FScopeLock Lock(&State.Lock);
+	State.bCompacting = false;
+	/// The slot was written or deleted since the snapshot
+	if (FCSWSaveGameJournal::Get().FindState(SlotKey) != Snapshot.State) return false;
+	FCSWSaveGameJournalState NewState;
+	NewState.BaseSaveId = FGuid::NewGuid();
+
+	/// The entries journaled since the snapshot aren't in it: they are moved to a journal of the new base before the base is written,
+	/// so the slot never is the new base without them
+	int64 NewJournalSize = 0;
+	if (State.JournalSize > Snapshot.JournalSize)
+	{
+		const int64 LaterEntriesSize = State.JournalSize - Snapshot.JournalSize;
+		TArray<uint8> LaterEntries;
+		const bool bRead = SaveSystem->LoadSaveGameJournal(Snapshot.bUseCustomPath, Snapshot.bCompressFile, *Snapshot.Path, *Snapshot.SlotName, Snapshot.UserIndex, [&](FArchive& JournalAr)
+		{
+			if (JournalAr.TotalSize() < State.JournalSize) return false;
+			LaterEntries.SetNumUninitialized(static_cast<int32>(LaterEntriesSize));
+			JournalAr.Seek(Snapshot.JournalSize);
+			JournalAr.Serialize(LaterEntries.GetData(), LaterEntries.Num());
+			return !JournalAr.IsError();
+		});
+		const bool bMoved = bRead && SaveSystem->WriteSaveGameJournal(false, Snapshot.bUseCustomPath, Snapshot.bCompressFile, *Snapshot.Path, *Snapshot.SlotName, Snapshot.UserIndex, [&](FArchive& JournalAr)
+		{
+			if (!FCSWSaveGameJournal::WriteHeader(JournalAr, NewState.BaseSaveId)) return false;
+			JournalAr.Serialize(LaterEntries.GetData(), LaterEntries.Num());
+			NewJournalSize = JournalAr.Tell();
+			return !JournalAr.IsError();
+		});
+		if (!bMoved)
+		{
+			/// The base wasn't touched. The journal may be cut, the next journaled save writes the whole slot
+			UE_LOG(LogTemp, Warning, TEXT("CSWError: Couldn't move the journal entries of the save game %s saved during its compaction, the compaction is cancelled."), *Snapshot.SlotName);
+			FCSWSaveGameJournal::Get().RemoveState(SlotKey);
+			FCSWDecodedSlotCache::Get().Invalidate(SlotKey);
+			return false;
+		}
+	}
+
+	const bool bSaved = SaveSnapshotToSlot(MoveTemp(Snapshot.Data), Snapshot.SlotName, Snapshot.UserIndex, Snapshot.bCompressFile, Snapshot.bUseCustomPath, Snapshot.Path, Snapshot.Codec, &NewState, NewState.BaseSaveId);
+	if (!bSaved)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("CSWError: Couldn't compact the journal of the save game %s."), *Snapshot.SlotName);
+		if (NewJournalSize > 0)
+		{
+			/// The moved entries belong to the base that couldn't be written, the next journaled save writes the whole slot
+			FCSWSaveGameJournal::Get().RemoveState(SlotKey);
+			FCSWDecodedSlotCache::Get().Invalidate(SlotKey);
+		}
+		return false;
+	}
+	State.BaseSaveId = NewState.BaseSaveId;
+	State.BaseSize = NewState.BaseSize;
+	if (NewJournalSize > 0)
+	{
+		/// The CRCs of the state already count the moved entries. The cached slot doesn't have them
+		State.JournalSize = NewJournalSize;
+		FCSWDecodedSlotCache::Get().Invalidate(SlotKey);
+		return true;
+	}
+	/// Nothing was journaled during the compaction, the journal belonged to the previous generation of the slot
+	SaveSystem->DeleteSaveGameJournal(Snapshot.bUseCustomPath, Snapshot.bCompressFile, *Snapshot.Path, *Snapshot.SlotName, Snapshot.UserIndex);
+	State.JournalSize = 0;
+	State.ObjectCrc = NewState.ObjectCrc;
+	State.ActorCrcs = MoveTemp(NewState.ActorCrcs);
+	State.LevelBounds = MoveTemp(NewState.LevelBounds);
+	return true;
+}
+
+void UCSWAutoSaveBlueprintLibrary::TakeSaveGameSnapshot(USaveGame* SaveGameObject, const FCSWVersionsLocation& VersionsLocation, FCSWSaveGameSnapshot& OutSnapshot)
+{
+	OutSnapshot.ObjectChunk.Reset();
+	OutSnapshot.VersionsLocation = VersionsLocation;
+	OutSnapshot.bFromChunks = false;
+	OutSnapshot.LevelChunks.Reset();
+	OutSnapshot.JournalEntries.Reset();
+	TArray<uint8> Scratch;
+	FMemoryWriter ObjectChunkWriter(OutSnapshot.ObjectChunk);
+	WriteSaveGameObject(ObjectChunkWriter, SaveGameObject, Scratch, &VersionsLocation);
+	OutSnapshot.ObjectCrc = FCSWChecksum::Crc32C(Scratch.GetData(), Scratch.Num());
+	UCSWAutoSaveObject* AutoSaveObject = Cast<UCSWAutoSaveObject>(SaveGameObject);
+	OutSnapshot.LevelsRecord = AutoSaveObject ? AutoSaveObject->LevelsRecord : TArray<FCSWMapRecord>();
+	///The records restored from the snapshot aren't the ones filled from the Actors anymore
+	for (FCSWMapRecord& MapRecord : OutSnapshot.LevelsRecord)
+	{
+		for (FCSWActorRecord& ActorRecord : MapRecord.ActorsRecord)
+		{
+			ActorRecord.ChangeStamp = 0;
+		}
+	}
+}
+
+bool UCSWAutoSaveBlueprintLibrary::SaveSnapshotToSlot(FCSWSaveGameSnapshot&& Snapshot, const FString& SlotName, const int32 UserIndex, const bool bCompressFile, const bool bUseCustomPath, const FString& Path, const ECSWCompressionCodec Codec, FCSWSaveGameJournalState* OutState /*= nullptr*/, const FGuid& NewSaveId /*= FGuid()*/)
+{
+	ICSWSaveGameSystem* SaveSystem = ICSWPlatformFeaturesModule::Get().GetActiveSaveGameSystem();
+	if (!SaveSystem || SlotName.Len() <= 0) return false;
+	const ECSWCompressionCodec ChunksCodec = bCompressFile ? Codec : ECSWCompressionCodec::None;
+	const FString SlotKey = FCSWSaveGameJournal::GetSlotKey(SlotName, bCompressFile, bUseCustomPath, Path);
+	if (!OutState)
+	{
+		///The journal of the slot belongs to the generation being replaced
+		DiscardSaveGameJournalState(SlotKey);
+	}
+	FGuid SaveId;
+	const bool bSaved = SaveSystem->SaveGameStreamed(false, bUseCustomPath, bCompressFile, *Path, *SlotName, UserIndex, [&Snapshot, ChunksCodec, OutState, &SaveId, &NewSaveId](FArchive& FileAr)
+	{
+		auto WriteObject = [&Snapshot](FArchive& Ar)
+		{
+			Ar.Serialize(Snapshot.ObjectChunk.GetData(), Snapshot.ObjectChunk.Num());
+			return !Ar.IsError();
+		};
+		return WriteSaveGameContainerFromParts(FileAr, WriteObject, Snapshot.LevelsRecord, ChunksCodec, OutState, &SaveId, nullptr, NewSaveId);
+	});
+	if (bSaved && OutState)
+	{
+		OutState->ObjectCrc = Snapshot.ObjectCrc;
+	}
+	else if (bSaved)
+	{
+		SaveSystem->DeleteSaveGameJournal(bUseCustomPath, bCompressFile, *Path, *SlotName, UserIndex);
+	}
+	FCSWSlotCatalog::Get().InvalidateSlot(SlotName);
+	///The slot is now exactly the snapshot, the next load of the slot doesn't need to read it
+	FCSWDecodedSlotCache& SlotCache = FCSWDecodedSlotCache::Get();
+	if (bSaved && SlotCache.IsEnabled())
+	{
+		SlotCache.Add(SlotKey, SaveId, MakeShared<FCSWSaveGameSnapshot, ESPMode::ThreadSafe>(MoveTemp(Snapshot)));
+	}
+	else
+	{
+		SlotCache.Invalidate(SlotKey);
+	}
+	return bSaved;
+}
+
+void UCSWAutoSaveBlueprintLibrary::CSWSaveGameToSlot_Async(USaveGame* SaveGameObject, const FString& SlotName, const int32 UserIndex, const bool bCompressFile, const bool bUseCustomPath, const FString& Path, const FCSWOnSaveGameResponse& OnCompleted, const ECSWCompressionCodec Codec /*= ECSWCompressionCodec::Zlib*/)
+{
+	CSWScheduleSaveGameToSlot(SaveGameObject, SlotName, UserIndex, ECSWSaveJobPriority::Normal, bCompressFile, bUseCustomPath, Path, Codec, OnCompleted);
+}
+
+int32 UCSWAutoSaveBlueprintLibrary::CSWScheduleSaveGameToSlot(USaveGame* SaveGameObject, const FString& SlotName, const int32 UserIndex, const ECSWSaveJobPriority Priority, const bool bCompressFile, const bool bUseCustomPath, const FString& Path, const ECSWCompressionCodec Codec, const FCSWOnSaveGameResponse& OnCompleted)
+{
+	/// Validation
+	if (!SaveGameObject || SlotName.Len() <= 0)
+	{
+		FCSWSaveJobScheduler::Get().DispatchToGameThread([OnCompleted]() { OnCompleted.ExecuteIfBound(false); });
+		return INDEX_NONE;
+	}
+	///The writer gets a copy, the game can keep changing the object while it's written
+	TUniquePtr<FCSWSaveGameSnapshot> Snapshot = MakeUnique<FCSWSaveGameSnapshot>();
+	TakeSaveGameSnapshot(SaveGameObject, FCSWVersionsLocation(ICSWPlatformFeaturesModule::Get().GetActiveSaveGameSystem(), bUseCustomPath, Path, UserIndex), *Snapshot);
+	///A pending save of the same slot is replaced by this one
+	const FString JobKey = TEXT("Slot:") + FCSWSaveGameJournal::GetSlotKey(SlotName, bCompressFile, bUseCustomPath, Path);
+	return FCSWSaveJobScheduler::Get().Enqueue(JobKey, Priority,
+		[Snapshot = MoveTemp(Snapshot), SlotName, UserIndex, bCompressFile, bUseCustomPath, Path, Codec]() mutable
+		{
+			return SaveSnapshotToSlot(MoveTemp(*Snapshot), SlotName, UserIndex, bCompressFile, bUseCustomPath, Path, Codec);
+		},
+		[OnCompleted](bool bSuccess) { OnCompleted.ExecuteIfBound(bSuccess); });
+}
+
+bool UCSWAutoSaveBlueprintLibrary::CSWCancelSaveJob(const int32 JobId)
+{
+	return FCSWSaveJobScheduler::Get().Cancel(JobId);
+}
+
+USaveGame* UCSWAutoSaveBlueprintLibrary::CSWLoadGameFromSlot(USaveGame* SaveGameObject, const FString& SlotName, const int32 UserIndex, const bool bFileIsCompressed /*= true*/, const bool bUseCustomPath /*= false*/, const FString& Path /*= ""*/)
+{
+	ICSWSaveGameSystem* SaveSystem = ICSWPlatformFeaturesModule::Get().GetActiveSaveGameSystem();
+	// If we have a save system and a valid name..
+	if (SaveSystem && (SlotName.Len() > 0) && SaveGameObject)
+	{
+		// A slot saved or loaded recently is restored from its decoded copy, the slot is only read if it changed since
+		FCSWDecodedSlotCache& SlotCache = FCSWDecodedSlotCache::Get();
+		FCSWSlotInfo SlotInfo;
+		if (SlotCache.IsEnabled() && FCSWSlotCatalog::Get().GetSlot(OUT SlotInfo, SlotName, UserIndex, bFileIsCompressed, bUseCustomPath, Path) && SlotInfo.SaveId.IsValid())
+		{
+			bool bDecodedHere = false;
+			const FString SlotKey = FCSWSaveGameJournal::GetSlotKey(SlotName, bFileIsCompressed, bUseCustomPath, Path);
+			FCSWSaveGameSnapshotPtr Snapshot = SlotCache.FindOrDecode(SlotKey, SlotInfo.SaveId, [&](FGuid& OutSaveId) -> FCSWSaveGameSnapshotPtr
+			{
+				bDecodedHere = true;
+				///The chunks are kept as they are decoded
+				TSharedRef<FCSWSaveGameSnapshot, ESPMode::ThreadSafe> NewSnapshot = MakeShared<FCSWSaveGameSnapshot, ESPMode::ThreadSafe>();
+				if (!LoadSaveGameSlot(SaveSystem, SaveGameObject, SlotName, UserIndex, bFileIsCompressed, bUseCustomPath, Path, nullptr, OutSaveId, &NewSnapshot.Get())) return nullptr;
+				///Slots without chunks are copied from the object
+				if (!NewSnapshot->bFromChunks)
+				{
+					TakeSaveGameSnapshot(SaveGameObject, FCSWVersionsLocation(SaveSystem, bUseCustomPath, Path, UserIndex), *NewSnapshot);
+				}
+				return NewSnapshot;
+			});
+			if (bDecodedHere) return Snapshot.IsValid() ? SaveGameObject : nullptr;
+			if (Snapshot.IsValid() && ApplySaveGameSnapshot(*Snapshot, SaveGameObject, nullptr)) return SaveGameObject;
+		}
+		FGuid SaveId;
+		if (!LoadSaveGameSlot(SaveSystem, SaveGameObject, SlotName, UserIndex, bFileIsCompressed, bUseCustomPath, Path, nullptr, SaveId)) return nullptr;
+		return SaveGameObject;
+	}
+	else
+	{
+		return nullptr;
+	}
+}
+
+void UCSWAutoSaveBlueprintLibrary::CSWLoadGameFromSlot_Async(USaveGame* SaveGameObject, const FString& SlotName, const int32 UserIndex, const bool bFileIsCompressed, const bool bUseCustomPath, const FString& Path, const FCSWOnLoadGameResponse& OnCompleted)
+{
+	///Read by the save writer after the pending save of the slot, if there's one, so it never reads the slot while it's replaced
+	const FString SlotKey = FCSWSaveGameJournal::GetSlotKey(SlotName, bFileIsCompressed, bUseCustomPath, Path);
+	TSharedRef<USaveGame*, ESPMode::ThreadSafe> LoadedObject = MakeShared<USaveGame*, ESPMode::ThreadSafe>(nullptr);
+	FCSWSaveJobScheduler::Get().EnqueueAfter(TEXT("Slot:") + SlotKey, FString(), ECSWSaveJobPriority::Normal,
+		[LoadedObject, SaveGameObject, SlotName, UserIndex, bFileIsCompressed, bUseCustomPath, Path]()
+		{
+			*LoadedObject = CSWLoadGameFromSlot(SaveGameObject, SlotName, UserIndex, bFileIsCompressed, bUseCustomPath, Path);
+			return *LoadedObject != nullptr;
+		},
+		[LoadedObject, OnCompleted](bool bSuccess) { OnCompleted.ExecuteIfBound(bSuccess ? *LoadedObject : nullptr); });
+}
+
+UCSWAutoSaveObject* UCSWAutoSaveBlueprintLibrary::CSWLoadLevelsFromSlot(UCSWAutoSaveObject* AutoSaveGameObject, const TArray<FName>& LevelNames, const FString& SlotName, const int32 UserIndex, const bool bFileIsCompressed /*= true*/, const bool bUseCustomPath /*= false*/, const FString& Path /*= ""*/)
+{
+	ICSWSaveGameSystem* SaveSystem = ICSWPlatformFeaturesModule::Get().GetActiveSaveGameSystem();
+	/// Validation
+	if (!SaveSystem || SlotName.Len() <= 0 || !AutoSaveGameObject || LevelNames.Num() <= 0) return nullptr;
+	// The levels come from the decoded copy of the slot if it's cached, partial loads don't fill the cache
+	FCSWDecodedSlotCache& SlotCache = FCSWDecodedSlotCache::Get();
+	FCSWSlotInfo SlotInfo;
+	if (SlotCache.IsEnabled() && FCSWSlotCatalog::Get().GetSlot(OUT SlotInfo, SlotName, UserIndex, bFileIsCompressed, bUseCustomPath, Path) && SlotInfo.SaveId.IsValid())
+	{
+		FCSWSaveGameSnapshotPtr Snapshot = SlotCache.Find(FCSWSaveGameJournal::GetSlotKey(SlotName, bFileIsCompressed, bUseCustomPath, Path), SlotInfo.SaveId);
+		if (Snapshot.IsValid() && ApplySaveGameSnapshot(*Snapshot, AutoSaveGameObject, &LevelNames)) return AutoSaveGameObject;
+	}
+	// Only the chunks of the requested levels are read and decompressed
+	FGuid SaveId;
+	if (!LoadSaveGameSlot(SaveSystem, AutoSaveGameObject, SlotName, UserIndex, bFileIsCompressed, bUseCustomPath, Path, &LevelNames, SaveId)) return nullptr;
+	return AutoSaveGameObject;
+}
+
+bool UCSWAutoSaveBlueprintLibrary::CSWSaveGameToRing(USaveGame* SaveGameObject, const FString& RingName, const int32 RingSize, const int32 UserIndex, const bool bCompressFile, const bool bUseCustomPath, const FString& Path, const ECSWCompressionCodec Codec, const FCSWOnSaveGameResponse& OnCompleted)
+{
+	/// Validation
+	if (!SaveGameObject || RingName.Len() <= 0 || RingSize <= 0 || (bUseCustomPath && Path.Len() <= 1))
+	{
+		FCSWSaveJobScheduler::Get().DispatchToGameThread([OnCompleted]() { OnCompleted.ExecuteIfBound(false); });
+		return false;
+	}
+	if (RingSize > CSW_AUTOSAVE_RING_MAX_SIZE)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("CSWError: Autosave rings can't have more than %d slots."), CSW_AUTOSAVE_RING_MAX_SIZE);
+	}
+	///The writer gets a copy, the game can keep changing the object while it's written
+	TUniquePtr<FCSWAutoSaveRingRequest> Request = MakeUnique<FCSWAutoSaveRingRequest>();
+	Request->RingName = RingName;
+	Request->RingSize = FMath::Min(RingSize, CSW_AUTOSAVE_RING_MAX_SIZE);
+	Request->UserIndex = UserIndex;
+	Request->bCompressFile = bCompressFile;
+	Request->bUseCustomPath = bUseCustomPath;
+	Request->Path = Path;
+	Request->Codec = Codec;
+	TakeSaveGameSnapshot(SaveGameObject, FCSWVersionsLocation(ICSWPlatformFeaturesModule::Get().GetActiveSaveGameSystem(), bUseCustomPath, Path, UserIndex), Request->Snapshot);
+	///OnCompleted gets false if the save is refused
+	return FCSWAutoSaveRing::Enqueue(MoveTemp(Request), OnCompleted) != INDEX_NONE;
+}
+
+USaveGame* UCSWAutoSaveBlueprintLibrary::CSWLoadGameFromRing(USaveGame* SaveGameObject, const FString& RingName, const int32 RingSize, const int32 UserIndex, FString& SlotName, const bool bFileIsCompressed /*= true*/, const bool bUseCustomPath /*= false*/, const FString& Path /*= ""*/)
+{
+	SlotName.Reset();
+	if (!SaveGameObject || RingName.Len() <= 0) return nullptr;
+	TArray<FCSWSlotInfo> Slots;
+	FCSWAutoSaveRing::GetRingSlots(OUT Slots, RingName, RingSize, UserIndex, bFileIsCompressed, bUseCustomPath, Path);
+	///A generation cut by a crash falls back to the previous one
+	for (const FCSWSlotInfo& Slot : Slots)
+	{
+		if (CSWLoadGameFromSlot(SaveGameObject, Slot.SlotName, UserIndex, bFileIsCompressed, bUseCustomPath, Path))
+		{
+			SlotName = Slot.SlotName;
+			return SaveGameObject;
+		}
+		UE_LOG(LogTemp, Warning, TEXT("CSWError: Couldn't load the autosave ring slot %s, trying an older one."), *Slot.SlotName);
+	}
+	return nullptr;
+}
+
+bool UCSWAutoSaveBlueprintLibrary::CSWGetLatestRingSlot(const FString& RingName, const int32 RingSize, const int32 UserIndex, FCSWSlotInfo& SlotInfo, const bool bFileIsCompressed /*= true*/, const bool bUseCustomPath /*= false*/, const FString& Path /*= ""*/)
+{
+	TArray<FCSWSlotInfo> Slots;
+	FCSWAutoSaveRing::GetRingSlots(OUT Slots, RingName, RingSize, UserIndex, bFileIsCompressed, bUseCustomPath, Path);
+	if (Slots.Num() <= 0) return false;
+	SlotInfo = Slots[0];
+	return true;
+}
+
+bool UCSWAutoSaveBlueprintLibrary::CSWDoesSaveGameExist(const FString& SlotName, const int32 UserIndex, const bool bFileIsCompressed /*= true*/, const bool bUseCustomPath /*= false*/, const FString& Path /*= ""*/)
+{
+	if (ICSWSaveGameSystem* SaveSystem = ICSWPlatformFeaturesModule::Get().GetActiveSaveGameSystem())
+	{
+		return SaveSystem->DoesSaveGameExist(bUseCustomPath, bFileIsCompressed, *Path, *SlotName, UserIndex);
+	}
+	return false;
+}
+
+ECSWSlotValidationResult UCSWAutoSaveBlueprintLibrary::CSWValidateSaveGame(const FString& SlotName, const int32 UserIndex, const bool bFileIsCompressed /*= true*/, const bool bUseCustomPath /*= false*/, const FString& Path /*= ""*/)
+{
+	ICSWSaveGameSystem* SaveSystem = ICSWPlatformFeaturesModule::Get().GetActiveSaveGameSystem();
+	ECSWSlotValidationResult Result = ECSWSlotValidationResult::DoesNotExist;
+	if (!SaveSystem || SlotName.Len() <= 0) return Result;
+	///Only the checksums are checked, nothing is decompressed or deserialized
+	SaveSystem->LoadGameStreamed(false, bUseCustomPath, bFileIsCompressed, *Path, *SlotName, UserIndex, [&Result](FArchive& FileAr)
+	{
+		Result = FCSWSaveGameContainerReader::ValidateSlot(FileAr);
+		return Result != ECSWSlotValidationResult::Corrupt;
+	});
+	return Result;
+}
+
+bool UCSWAutoSaveBlueprintLibrary::CSWDeleteSaveGameInSlot(const FString& SlotName, const int32 UserIndex, const bool bFileIsCompressed /*= true*/, const bool bUseCustomPath /*= false*/, const FString& Path /*= ""*/)
+{
+	if (ICSWSaveGameSystem* SaveSystem = ICSWPlatformFeaturesModule::Get().GetActiveSaveGameSystem())
+	{
+		const FString SlotKey = FCSWSaveGameJournal::GetSlotKey(SlotName, bFileIsCompressed, bUseCustomPath, Path);
+		FCSWSlotCatalog::Get().InvalidateSlot(SlotName);
+		DiscardSaveGameJournalState(SlotKey);
+		FCSWDecodedSlotCache::Get().Invalidate(SlotKey);
+		return SaveSystem->DeleteGame(false, bUseCustomPath, bFileIsCompressed, *Path, *SlotName, UserIndex);
+	}
+	return false;
+}
+
+void UCSWAutoSaveBlueprintLibrary::CSWGetSaveGames(TArray<FString>& SlotNames, const bool bFilesAreCompressed /*= true*/, const bool bUseCustomPath /*= false*/, const FString& Path /*= ""*/)
+{
+	/// Validation
+	if (bUseCustomPath && Path.Len() <= 1) return;
+	/// Save systems with an index of their slots list them from memory
+	ICSWSaveGameSystem* SaveSystem = ICSWPlatformFeaturesModule::Get().GetActiveSaveGameSystem();
+	TArray<FFileStatData> StatData;
+	if (SaveSystem && SaveSystem->GetSaveGames(bUseCustomPath, bFilesAreCompressed, *Path, OUT SlotNames, StatData)) return;
+	/// Init
+	const FString Extension = bFilesAreCompressed ? ".csav" : ".sav";
+	const FString LookForExt = TEXT("*") + Extension;
+	const FString FinalPath = bUseCustomPath ? Path : GetPathSaveGames();
+	/// Find files in folder with ext .csav or .sav
+	IFileManager& FileManager = IFileManager::Get();
+	FileManager.FindFiles(OUT SlotNames, *FinalPath, *LookForExt);
+	/// remove .sav or .csav extensions (so the names can be used to load save games directly
+	for (FString& SlotName : SlotNames)
+	{
+		SlotName.RemoveFromEnd(*Extension);
+	}
+}
+
+void UCSWAutoSaveBlueprintLibrary::CSWGetSaveGamesInfo(TArray<FCSWSlotInfo>& SlotsInfo, const int32 UserIndex, const bool bFilesAreCompressed /*= true*/, const bool bUseCustomPath /*= false*/, const FString& Path /*= ""*/)
+{
+	FCSWSlotCatalog::Get().GetSlots(OUT SlotsInfo, UserIndex, bFilesAreCompressed, bUseCustomPath, Path);
+}
+
+void UCSWAutoSaveBlueprintLibrary::CSWGetSaveGamesInfo_Async(const int32 UserIndex, const bool bFilesAreCompressed, const bool bUseCustomPath, const FString& Path, const FCSWOnGetSaveGamesInfoResponse& OnCompleted)
+{
+	(new FAutoDeleteAsyncTask<FCSWAsyncGetSaveGamesInfo>(UserIndex, bFilesAreCompressed, bUseCustomPath, Path, OnCompleted))->StartBackgroundTask();
+}
+
+bool UCSWAutoSaveBlueprintLibrary::CSWGetSaveGameInfo(const FString& SlotName, FCSWSlotInfo& SlotInfo, const int32 UserIndex, const bool bFileIsCompressed /*= true*/, const bool bUseCustomPath /*= false*/, const FString& Path /*= ""*/)
+{
+	return FCSWSlotCatalog::Get().GetSlot(OUT SlotInfo, SlotName, UserIndex, bFileIsCompressed, bUseCustomPath, Path);
+}
+
+UCSWAutoSaveObject* UCSWAutoSaveBlueprintLibrary::AutoFillSaveGameObject(UCSWAutoSaveObject* AutoSaveGameObject, const TArray<FCSWLevelWithAutosaveActors>& LevelsWithAutosaveActors)
+{
+	/// Validation
+	if (!AutoSaveGameObject || LevelsWithAutosaveActors.Num() <= 0) return AutoSaveGameObject;
+	///Update the records of the levels in place: each Actor overwrites its previous record, the records of the Actors that are gone are trimmed at the end.
+	///With dirty tracking, the records of the Actors that didn't change since they were saved are kept as they are (see UCSWAutoSaveComponent::MarkDirty())
+	if (UCSWAutoSaveObject::GetUseInPlaceUpdates())
+	{
+		for (const FCSWLevelWithAutosaveActors& level : LevelsWithAutosaveActors)
+		{
+			AutoSaveGameObject->BeginRecordUpdate(level.Name);
+		}
+		SaveActorsToArrayOfMaps(AutoSaveGameObject, LevelsWithAutosaveActors);
+		AutoSaveGameObject->EndRecordUpdates();
+		return AutoSaveGameObject;
+	}
+	///Remove save data in AutoSaveGameObject and fill it with empty data
+	TryRemoveSavedDataFromLevels(AutoSaveGameObject, LevelsWithAutosaveActors);
+	///Save all the actors for all the LevelNameArray into an array in LevelsWithAutosaveActors
+	SaveActorsToArrayOfMaps(AutoSaveGameObject, LevelsWithAutosaveActors);
+	///Return the AutoSaveGameObject
+	return AutoSaveGameObject;
+}
+
+bool UCSWAutoSaveBlueprintLibrary::AutoLoadActorsDataFromSave(const UObject* WorldContextObject, UCSWAutoSaveObject* AutoSaveGameObject, UPARAM(ref) TArray<FCSWLevelWithAutosaveActors>& LevelsWithAutosaveActors)
+{
+	if (!WorldContextObject || !AutoSaveGameObject || LevelsWithAutosaveActors.Num() <= 0) return false;
+	///Force Garbage Collection
+	GEngine->ForceGarbageCollection(true);
+	/// Load the data into each actor
+	LoadActorDataFromArrayOfMapRecords(WorldContextObject, AutoSaveGameObject, LevelsWithAutosaveActors);
+	/// return boolean
+	return true;
+}
+
+void UCSWAutoSaveBlueprintLibrary::GetLevelsWithAutosaveActors(const UObject* WorldContextObject, const TArray<FName>& LevelNameArray, TArray<FCSWLevelWithAutosaveActors>& LevelsWithAutosaveActors)
+{
+	/// Validation
+	if (LevelNameArray.Num() <= 0 || !WorldContextObject) return;
+	/// Get World
+	UWorld* World = GEngine->GetWorldFromContextObjectChecked(WorldContextObject);
+	if (!World) return;
+	/// Before starting we initialize an array of FCSWAutosaveActorsInLevel. This array will only contain level names for now
+	for (const FName& levelName : LevelNameArray)
+	{
+		FCSWLevelWithAutosaveActors temp;
+		temp.Name = levelName;
+		LevelsWithAutosaveActors.Add(temp);
+	}
+	///For each actor in the world, if the actor has the component fill the array for both the OutActors and OutActorComponents references
+	for (FActorIterator It(World); It; ++It)
+	{
+		AActor* Actor = *It;
+		///Continue to the next Actor if this one is invalid
+		if (!Actor || Actor->IsPendingKill()) continue;
+		///Continue to the next Actor if its AutosaveComponent is invalid
+		UCSWAutoSaveComponent* AutosaveComponent = Cast<UCSWAutoSaveComponent>(Actor->GetComponentByClass(UCSWAutoSaveComponent::StaticClass()));
+		if (!AutosaveComponent) continue;
+		/// Get the LevelName the current Actor belongs
+		FName ActorLevelName = CSWGetLevelName(GetActorLevel(Actor));
+		for (FCSWLevelWithAutosaveActors& levelWithAutosaveActors : LevelsWithAutosaveActors)
+		{
+			/// If Actor belongs to a level in LevelNameArray, add the Actor to LevelsWithAutosaveActors
+			if (ActorLevelName == levelWithAutosaveActors.Name)
+			{
+				FCSWAutosaveActor temp;
+				temp.Actor = Actor;
+				temp.AutosaveComponent = AutosaveComponent;
+				/// Now this level is holding a new AutosaveActor struct.
+				levelWithAutosaveActors.AutosaveActors.Add(temp);
+				break;
+			}
+		}
+	}
+}
+#pragma endregion
+
+
+#pragma region FUNCTIONS FOR CUSTOMIZING THE AUTO SAVE AND LOAD SYSTEM
+
+void UCSWAutoSaveBlueprintLibrary::TryRemoveSavedDataFromLevels(UCSWAutoSaveObject* AutoSaveGameObject, const TArray<FCSWLevelWithAutosaveActors>& LevelsWithAutosaveActors)
+{
+	if (!AutoSaveGameObject || LevelsWithAutosaveActors.Num() <= 0) return;
+
+	for (const FCSWLevelWithAutosaveActors& level : LevelsWithAutosaveActors)
+	{
+		///Remove data from this Level first
+		UCSWAutoSaveBlueprintLibrary::TryRemoveSavedDataFromLevel(AutoSaveGameObject, level.Name);
+		///Create an empty newMapRecord with only the name of the level for now
+		FCSWMapRecord NewMapRecord;
+		NewMapRecord.Name = level.Name;
+		AutoSaveGameObject->LevelsRecord.Add(NewMapRecord);
+	}
+}
+
+bool UCSWAutoSaveBlueprintLibrary::TryRemoveSavedDataFromLevel(UCSWAutoSaveObject* AutoSaveGameObject, const FName& LevelName)
+{
+	if (!AutoSaveGameObject || AutoSaveGameObject->LevelsRecord.Num() <= 0) return false;
+
+	///Search in AutoSaveGameObject->LevelsRecord if theres a LevelRecord with the name of LevelName
+	///If it's remove the LevelRecord
+	uint32 MapIndex = 0;
+	bool bLevelDataWasRemoved = false;
+	for (const FCSWMapRecord& MapRecord : AutoSaveGameObject->LevelsRecord)
+	{
+		if (MapRecord.Name == LevelName && AutoSaveGameObject->LevelsRecord.IsValidIndex(MapIndex))
+		{
+			AutoSaveGameObject->LevelsRecord.RemoveAt(MapIndex);
+			bLevelDataWasRemoved = true;
+			break;
+		}
+		MapIndex++;
+	}
+	///Return true or false wether if at least one level was removed or not
+	return bLevelDataWasRemoved;
+}
+
+void UCSWAutoSaveBlueprintLibrary::SaveActorsToArrayOfMaps(UCSWAutoSaveObject* AutoSaveGameObject, const TArray<FCSWLevelWithAutosaveActors>& LevelsWithAutosaveActors)
+{
+	///Validation
+	if (LevelsWithAutosaveActors.Num() <= 0  || !AutoSaveGameObject) return;
+
+	///Foreach Level that contains Actors with AutosaveComponent
+	for (const FCSWLevelWithAutosaveActors& levelWithAutoSaveActor : LevelsWithAutosaveActors)
+	{
+		int32 TotalActorsInCurrentLevel = levelWithAutoSaveActor.AutosaveActors.Num();
+		///Since we already know the level name, we can use it to always know in which AutoSaveGameObject->LevelsRecord index save an Actor
+		bool bMatchFound = false; // Not needed since always will match, but we're going to use it just in case (Because, AutosaveGame has at least an empty record with the name of the level)
+		uint32 LevelRecordIndex = GetLevelRecordIndexSave(AutoSaveGameObject, levelWithAutoSaveActor, OUT bMatchFound);
+		///Save all Actors from the current loaded level (levelWithAutoSaveActor) into AutoSaveGameObject->LevelRecords[LevelRecordIndex]
+		//Don't save this level if the Level doesn't have any Actors to save
+		if (bMatchFound && TotalActorsInCurrentLevel > 0)
+		{
+			SaveAllActorsInLevel(AutoSaveGameObject, levelWithAutoSaveActor, LevelRecordIndex);
+		}
+	}
+}
+
+void UCSWAutoSaveBlueprintLibrary::LoadActorDataFromArrayOfMapRecords(const UObject* WorldContextObject, const UCSWAutoSaveObject* AutoSaveGameObject, UPARAM(ref) TArray<FCSWLevelWithAutosaveActors>& LevelsWithAutosaveActors)
+{
+	LoadActorDataFromArrayOfMapRecords_Internal(WorldContextObject, AutoSaveGameObject, LevelsWithAutosaveActors, false);
+}
+
+void UCSWAutoSaveBlueprintLibrary::LoadActorDataFromArrayOfMapRecords_Internal(const UObject* WorldContextObject, const UCSWAutoSaveObject* AutoSaveGameObject, UPARAM(ref) TArray<FCSWLevelWithAutosaveActors>& LevelsWithAutosaveActors, const bool bLoadInEditorTime)
+{
+	if (!WorldContextObject || !AutoSaveGameObject || LevelsWithAutosaveActors.Num() <= 0) return;
+	///Every object referenced by the data is resolved once during this load
+	AutoSaveGameObject->ReferenceTable.ResetResolvedObjects();
+	///In this case we use level data from AutoSaveGameObject to start the loading
+	for (const FCSWMapRecord& levelRecord : AutoSaveGameObject->LevelsRecord)
+	{
+		///Since we already know the level name, we can use it to always know in which level to Load these Actors
+		bool bMatchFound = false; // We use this so we know that we load data from AutoSaveGameObject->LevelRecords into a Level that exist and is loaded.
+		uint32 LevelRecordIndex = GetLevelRecordIndexLoad(levelRecord, LevelsWithAutosaveActors, bMatchFound);
+		///Load all Actors from the current levelRecord into its Level
+		if (bMatchFound)
+		{
+			///Since we already know the level we want to load, we can iterate trough only the Actors from this Level
+			if (LevelsWithAutosaveActors.IsValidIndex(LevelRecordIndex))
+			{
+				TArray<FCSWAutosaveActor> AutosaveActorsInLevel;
+				AutosaveActorsInLevel = LevelsWithAutosaveActors[LevelRecordIndex].AutosaveActors;
+				///Counters
+				int32 TotalActorsInCurrentLevel = AutosaveActorsInLevel.Num();
+				int32 TotalActorsInLevelRecord = levelRecord.ActorsRecord.Num();
+				//Load Actors in Level if there are ActorsRecords to load or if there Actors in the Level
+				//In case there are only Actors in the Level and no ActorRecords to Load, we still try to load so the Actors can be destroyed in case they weren't saved before
+				if (TotalActorsInCurrentLevel > 0 || TotalActorsInLevelRecord > 0)
+				{
+					///Load All Actors in Level
+					LoadAllActorsInLevel(WorldContextObject, AutoSaveGameObject, levelRecord, AutosaveActorsInLevel, bLoadInEditorTime);
+					///Try to destroy actors in case they weren't updated
+					CSWTryDestroyActors(AutoSaveGameObject, AutosaveActorsInLevel);
+				}
+			}
+		}
+	}
+	GEngine->ForceGarbageCollection(true);
+}
+
+int32 UCSWAutoSaveBlueprintLibrary::GetTotalAutosaveActors(const TArray<FCSWLevelWithAutosaveActors>& LevelsWithAutosaveActors)
+{
+	///Validation
+	if (LevelsWithAutosaveActors.Num() <= 0) return 0;
+	///Count Num of Total Actors
+	int32 TotalActors = 0;
+	for (const FCSWLevelWithAutosaveActors& level : LevelsWithAutosaveActors)
+	{
+		TotalActors = TotalActors + level.AutosaveActors.Num();
+	}
+	return TotalActors;
+}
+
+void UCSWAutoSaveBlueprintLibrary::CSWSetUseAtomicSaveWrites(const bool bEnable /*= true*/)
+{
+	if (ICSWSaveGameSystem* SaveSystem = ICSWPlatformFeaturesModule::Get().GetActiveSaveGameSystem())
+	{
+		SaveSystem->SetUseAtomicWrites(bEnable);
+	}
+}
+
+void UCSWAutoSaveBlueprintLibrary::CSWSetUsePackFileSaveSystem(const bool bEnable /*= true*/)
+{
+	static FCSWPackSaveGameSystem PackSaveGameSystem;
+	ICSWPlatformFeaturesModule::SetSaveGameSystemOverride(bEnable ? &PackSaveGameSystem : nullptr);
+	if (!bEnable)
+	{
+		PackSaveGameSystem.ClosePacks();
+	}
+	/// What is cached about the slots came from the other save system
+	FCSWSlotCatalog::Get().Empty();
+	FCSWDecodedSlotCache::Get().Empty();
+	FCSWSaveGameJournal::Get().RemoveAllStates();
+}
+
+void UCSWAutoSaveBlueprintLibrary::CSWSetDecodedSlotCacheBudget(const int32 BudgetMegaBytes /*= 0*/)
+{
+	FCSWDecodedSlotCache::Get().SetBudget(static_cast<int64>(FMath::Max(BudgetMegaBytes, 0)) * 1024 * 1024);
+}
+
+void UCSWAutoSaveBlueprintLibrary::CSWSetUseCompiledSavePlans(const bool bEnable /*= true*/)
+{
+	FCSWSavePlanCache::Get().SetEnabled(bEnable);
+}
+
+void UCSWAutoSaveBlueprintLibrary::CSWSetUseReferenceTables(const bool bEnable /*= true*/)
+{
+	FCSWSavePlanCache::Get().SetUseReferenceTables(bEnable);
+}
+
+void UCSWAutoSaveBlueprintLibrary::CSWSetUseDeltaFromDefaults(const bool bEnable /*= true*/)
+{
+	FCSWSavePlanCache::Get().SetUseDeltaFromDefaults(bEnable);
+}
+
+void UCSWAutoSaveBlueprintLibrary::CSWSetUseDirtyTracking(const bool bEnable /*= true*/)
+{
+	UCSWAutoSaveComponent::SetUseDirtyTracking(bEnable);
+}
+
+void UCSWAutoSaveBlueprintLibrary::CSWSetUseInPlaceRecordUpdates(const bool bEnable /*= true*/)
+{
+	UCSWAutoSaveObject::SetUseInPlaceUpdates(bEnable);
+}
+
+void UCSWAutoSaveBlueprintLibrary::CSWSetUseCompactVersions(const bool bEnable /*= true*/)
+{
+	FCSWVersionStore::Get().SetUseCompactVersions(bEnable);
+}
+
+bool UCSWAutoSaveBlueprintLibrary::CSWRegisterEncryptionKey(const int32 KeyId, const FString& Key, const bool bUseForSaving /*= true*/)
+{
+	TArray<uint8> KeyBytes;
+	if (!FBase64::Decode(Key, KeyBytes))
+	{
+		UE_LOG(LogTemp, Error, TEXT("CSWError: The encryption key %d isn't valid Base64."), KeyId);
+		return false;
+	}
+	const bool bRegistered = FCSWCipherKeyRegistry::Get().RegisterKey(static_cast<uint32>(KeyId), KeyBytes, bUseForSaving);
+	FMemory::Memzero(KeyBytes.GetData(), KeyBytes.Num());
+	return bRegistered;
+}
+
+bool UCSWAutoSaveBlueprintLibrary::CSWSetSaveGameEncryptionKey(const int32 KeyId /*= 0*/)
+{
+	if (!FCSWCipherKeyRegistry::Get().SetSavingKey(static_cast<uint32>(KeyId)))
+	{
+		UE_LOG(LogTemp, Error, TEXT("CSWError: The encryption key %d isn't registered."), KeyId);
+		return false;
+	}
+	return true;
+}
+
+#pragma endregion
+
+
+#pragma region COMPRESSION UTILITIES
+
+void UCSWAutoSaveBlueprintLibrary::CompressArrayOfBytes(TArray<uint8>& DataArray, TArray<uint8>& CompressedDataArray, const bool bUseParallelBlocks /*= false*/, const ECSWCompressionCodec Codec /*= ECSWCompressionCodec::Zlib*/)
+{
+	if (DataArray.Num() <= 0) return;
+
+	///Compress the blocks in parallel on the task graph
+	if (bUseParallelBlocks)
+	{
+		if (!FCSWBlockCompression::CompressBlocks(DataArray.GetData(), DataArray.Num(), CompressedDataArray, Codec))
+		{
+			UE_LOG(LogTemp, Error, TEXT("CompressArrayOfBytes Error compressing data"));
+		}
+		return;
+	}
+
+	CompressedDataArray.Empty();
+	///Init Compressor
+	FArchiveSaveCompressedProxy Compressor = FArchiveSaveCompressedProxy(CompressedDataArray, ECompressionFlags::COMPRESS_ZLIB);
+
+	if (Compressor.GetError())
+	{
+		UE_LOG(LogTemp, Error, TEXT("CompressArrayOfBytes Error compressing data"));
+		return;
+	}
+	///Compress the data array
+	Compressor << DataArray;
+	///Send compressed data to CompressedDataArray
+	Compressor.Flush();
+	///Clean
+	Compressor.FlushCache();
+	Compressor.Close();
+}
+
+void UCSWAutoSaveBlueprintLibrary::DecompressArrayOfBytes(TArray<uint8>& DataArray, TArray<uint8>& DecompressedDataArray)
+{
+	if (DataArray.Num() <= 0) return;
+	///Decompress the blocks in parallel on the task graph
+	if (FCSWBlockCompression::IsBlockBuffer(DataArray))
+	{
+		if (!FCSWBlockCompression::UncompressBlocks(DataArray, DecompressedDataArray))
+		{
+			UE_LOG(LogTemp, Error, TEXT("DecompressArrayOfBytes Error decompressing data"));
+		}
+		return;
+	}
+	///DECOMPRESS FILE
+	FArchiveLoadCompressedProxy Decompressor = FArchiveLoadCompressedProxy(DataArray, ECompressionFlags::COMPRESS_ZLIB);
+
+	if (Decompressor.GetError())
+	{
+		UE_LOG(LogTemp, Error, TEXT("DecompressArrayOfBytes Error decompressing data"));
+		return;
+	}
+	/// Decompress data array
+	Decompressor << DecompressedDataArray;
+	///Clean
+	Decompressor.FlushCache();
+	Decompressor.Close();
+}
+
+int32 UCSWAutoSaveBlueprintLibrary::CSWTrainCompressionDictionary(UCSWAutoSaveObject* AutoSaveGameObject, const TArray<FString>& SlotNames, const FString& DictionaryFilePath, const int32 UserIndex, const bool bFilesAreCompressed /*= true*/, const bool bUseCustomPath /*= false*/, const FString& Path /*= ""*/)
+{
+	/// Validation
+	if (!AutoSaveGameObject || SlotNames.Num() <= 0 || DictionaryFilePath.Len() <= 0) return 0;
+	///The slots are loaded into a transient object of the same class, the one of the caller keeps its content
+	UCSWAutoSaveObject* SampleObject = NewObject<UCSWAutoSaveObject>(GetTransientPackage(), AutoSaveGameObject->GetClass());
+	///Samples: the actor records as they are written into the level chunks
+	TArray<TArray<uint8>> Samples;
+	for (const FString& SlotName : SlotNames)
+	{
+		if (!CSWLoadGameFromSlot(SampleObject, SlotName, UserIndex, bFilesAreCompressed, bUseCustomPath, Path)) continue;
+		for (FCSWMapRecord& MapRecord : SampleObject->LevelsRecord)
+		{
+			const FBox Bounds = FCSWTransformCodec::ComputeBounds(MapRecord);
+			for (FCSWActorRecord& ActorRecord : MapRecord.ActorsRecord)
+			{
+				SerializeActorIntoScratch(Samples[Samples.AddDefaulted()], ActorRecord, Bounds);
+			}
+		}
+	}
+	///Train and save
+	const TArray<uint8> Dictionary = FCSWCompressionDictionary::Train(Samples);
+	if (Dictionary.Num() <= 0 || !FCSWCompressionDictionary::SaveToFile(Dictionary, DictionaryFilePath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("CSWError: Couldn't train a compression dictionary from %d actor records."), Samples.Num());
+		return 0;
+	}
+	return static_cast<int32>(FCSWCompressionDictionary::GetDictionaryId(Dictionary));
+}
+
+int32 UCSWAutoSaveBlueprintLibrary::CSWRegisterCompressionDictionary(const FString& DictionaryFilePath, const bool bUseForSaving /*= true*/)
+{
+	TArray<uint8> Dictionary;
+	if (!FCSWCompressionDictionary::LoadFromFile(DictionaryFilePath, Dictionary)) return 0;
+	return static_cast<int32>(FCSWCompressionCodecRegistry::Get().RegisterDictionary(Dictionary, bUseForSaving));
+}
+
+TArray<uint8> UCSWAutoSaveBlueprintLibrary::CSWStringToBytes(const FString& InString, const bool bUseUtf8 /*= true*/)
+{
+	TArray<uint8> OutBytes;
+	if (InString.Len() <= 0) return OutBytes;
+
+	if (bUseUtf8)
+	{
+		///Convert String to UTF8 String
+		FTCHARToUTF8 ToUtf8Converter(InString.GetCharArray().GetData());
+		FString InStringUtf = ToUtf8Converter.Get();
+		///Convert String to Bytes
+		int32 MaxBufferSize = InStringUtf.Len();
+		OutBytes.AddUninitialized(MaxBufferSize);
+		StringToBytes(InStringUtf, OUT OutBytes.GetData(), MaxBufferSize);
+	}
+	else
+	{
+		///Convert String to Bytes
+		int32 MaxBufferSize = InString.Len();
+		OutBytes.AddUninitialized(MaxBufferSize);
+		StringToBytes(InString, OUT OutBytes.GetData(), MaxBufferSize);
+	}
+
+	return OutBytes;
+}
+
+FString UCSWAutoSaveBlueprintLibrary::CSWBytesToString(const TArray<uint8>& DataArray)
+{
+	FString OutString;
+	if (DataArray.Num() <= 0) return OutString;
+
+	///Convert BytesToString
+	OutString = BytesToString(DataArray.GetData(), DataArray.Num());
+
+	return OutString;
+}
+
+void UCSWAutoSaveBlueprintLibrary::ConvertObjectToString(UObject* Object, FString& ObjectAsString)
+{
+	///Check if Object reference is valid
+	if (!Object) return;
+	///Serialize the Object into DataArray
+	TArray<uint8> DataArray;
+	FMemoryWriter MemoryWriter(DataArray, true);
+	FObjectAndNameAsStringProxyArchive Ar(MemoryWriter, false);
+	Object->Serialize(Ar);
+	///Now we have an array of bytes inside DataArray representing the object
+	TArray<uint8> CompressedDataArray;
+	///We use the CompressedDataArray where we're going to store the Compression result of DataArray
+	CompressArrayOfBytes(DataArray, OUT CompressedDataArray);
+	///Now we have a CompressedDataArray representing the Object
+	///Let's convert this CompressedDataArray into a String
+	ObjectAsString = BytesToString(CompressedDataArray.GetData(), CompressedDataArray.Num());
+	///Clean
+	DataArray.Empty();
+	CompressedDataArray.Empty();
+	MemoryWriter.FlushCache();
+	MemoryWriter.Close();
+}
+
+void UCSWAutoSaveBlueprintLibrary::ConvertObjectToString_Async(UObject* Object, const FOnConvertObject& OnConvertObject)
+{
+	(new FAutoDeleteAsyncTask<FCSWAsyncConvertObjectToString>(Object, OnConvertObject))->StartBackgroundTask();
+}
+
+void UCSWAutoSaveBlueprintLibrary::ConvertObjectToBytes(UObject* Object, TArray<uint8>& ObjectAsBytes)
+{
+	///Check if Object reference is valid
+	if (!Object) return;
+	///Serialize the Object into DataArray
+	FMemoryWriter MemoryWriter(ObjectAsBytes, true);
+	FObjectAndNameAsStringProxyArchive Ar(MemoryWriter, false);
+	Object->Serialize(Ar);
+	MemoryWriter.FlushCache();
+	MemoryWriter.Close();
+}
+
+UObject* UCSWAutoSaveBlueprintLibrary::RestoreObjectFromString(UObject* Object, const FString& ObjectAsString)
+{
+	///We check both if the Object and the ObjectAsString are valid
+	if (!Object || ObjectAsString.Len() < 1)return nullptr;
+	///Convert String to Bytes
+	TArray<uint8> CompressedDataArray;
+	int32 MaxBufferSize = ObjectAsString.Len();
+	CompressedDataArray.AddUninitialized(MaxBufferSize);
+	StringToBytes(ObjectAsString, OUT CompressedDataArray.GetData(), MaxBufferSize);
+	///Now, the String was converted to CompressedDataArray, but the data is compressed so we need to decompress it before serializing it to the object
+	///We create a DecompressedDataArray, where the Decompressed Data will be stored
+	TArray<uint8> DecompressedDataArray;
+	DecompressArrayOfBytes(CompressedDataArray, OUT DecompressedDataArray);
+	///Now we have a DecompressedDataArray, let's serialize this data into the Object
+	FMemoryReader MemoryReader(DecompressedDataArray, true);
+	MemoryReader.Seek(0);
+	FObjectAndNameAsStringProxyArchive Ar(MemoryReader, true);
+	Object->Serialize(Ar);
+	///Ok, now the object is restored. We don't need the DataArrays now so let's clean it
+	///NOTE: ObjectAsString is not removed in this function
+	MemoryReader.FlushCache();
+	MemoryReader.Close();
+	CompressedDataArray.Empty();
+	DecompressedDataArray.Empty();
+	///Also, return the Object (which will be casted to the same type as the input object)
+	return Object;
+}
+
+void UCSWAutoSaveBlueprintLibrary::RestoreObjectFromString_Async(UObject* Object, const FString& ObjectAsString, const FOnRestoreObject& OnRestoreObject)
+{
+	(new FAutoDeleteAsyncTask<FCSWAsyncRestoreObjectFromString>(Object, ObjectAsString, OnRestoreObject))->StartBackgroundTask();
+}
+
+UObject* UCSWAutoSaveBlueprintLibrary::RestoreObjectFromBytes(UObject* Object, const TArray<uint8>& ObjectAsBytes)
+{
+	///Now we have a DecompressedDataArray, let's serialize this data into the Object
+	FMemoryReader MemoryReader(ObjectAsBytes, true);
+	MemoryReader.Seek(0);
+	FObjectAndNameAsStringProxyArchive Ar(MemoryReader, true);
+	Object->Serialize(Ar);
+	///Clean
+	MemoryReader.FlushCache();
+	MemoryReader.Close();
+	///Return object
+	return Object;
+}
+
+#pragma endregion
+
+
+#pragma region GENERAL UTILITIES
+
+void UCSWAutoSaveBlueprintLibrary::GetSubstringBetween(const FString& SearchIn, const FString& FirstString, const FString& EndString, FString& SubstringResult, const bool bFirstUseCase /*= false*/, const bool bEndUseCase /*= false*/, const bool bFirstSearchFromEnd /*= false*/, const bool bEndSearchFromEnd /*= false*/, const int32 FirstStartPos /*= -1*/, const int32 EndStartPos /*= -1*/, const bool bIncludeFirstString /*= false*/, const bool bIncludeEndString /*= false*/)
+{
+	/// Get the Index where the First String and the End String Was Found
+	/// Example if the SourceString is "/Game/File.asdas", The FirstString is "/" starting from end, and the EndString is "."
+	/// The index result for "/Game/File.asdas" will be, BeginIndex: 5 and EndInxes: 10
+	int32 BeginIndex = UKismetStringLibrary::FindSubstring(SearchIn, FirstString, bFirstUseCase, bFirstSearchFromEnd, FirstStartPos);
+	int32 EndIndex = UKismetStringLibrary::FindSubstring(SearchIn, EndString, bEndUseCase, bEndSearchFromEnd, EndStartPos);
+	/// Include First and EndString in the result, IF the booleans are true
+	if (bIncludeFirstString == false)
+	{
+		BeginIndex = BeginIndex + FirstString.Len();
+	}
+	if (bIncludeEndString == true)
+	{
+		EndIndex = EndIndex + EndString.Len();
+	}
+
+	/// Get the substring between those subindex, in the previous example, the result for index 5 and 10, in the SourceString "/Game/File.asdas" is "File"
+	SubstringResult = UKismetStringLibrary::GetSubstring(SearchIn, BeginIndex, EndIndex - BeginIndex /*Length*/);
+}
+
+void UCSWAutoSaveBlueprintLibrary::GetAllActorsWithComponent(const UObject* WorldContextObject, const TSubclassOf<UActorComponent> Component, TArray<AActor*>& OutActors, TArray<UActorComponent*>& OutActorComponents)
+{
+	if (!Component || !WorldContextObject) return;
+
+	OutActors.Empty();
+	OutActorComponents.Empty();
+
+	UWorld* World = GEngine->GetWorldFromContextObjectChecked(WorldContextObject);
+	/// We do nothing if no component class is provided, rather than giving ALL actors!
+	///For each actor in the world, if the actor has the component fill the array for both the OutActors and OutActorComponents references
+	if (Component && World)
+	{
+		for (FActorIterator It(World); It; ++It)
+		{
+			AActor* Actor = *It;
+			UActorComponent* ActorComponent = Actor->GetComponentByClass(Component);
+			if (Actor && !Actor->IsPendingKill() && ActorComponent)
+			{
+				OutActors.Add(Actor);
+				OutActorComponents.Add(ActorComponent);
+			}
+		}
+	}
+}
+
+void UCSWAutoSaveBlueprintLibrary::GetActorsWithComponentInLevels(const UObject* WorldContextObject, const TSubclassOf<UActorComponent> Component, const TArray<FName>& LevelNameArray, TArray<AActor*>& OutActors, TArray<UActorComponent*>& OutActorComponents)
+{
+	if (!Component || !WorldContextObject) return;
+
+	OutActors.Empty();
+	OutActorComponents.Empty();
+
+	UWorld* World = GEngine->GetWorldFromContextObjectChecked(WorldContextObject);
+	/// We do nothing if no component class is provided, rather than giving ALL actors!
+	///For each actor in the world, if the actor has the component fill the array for both the OutActors and OutActorComponents references
+	if (Component && World)
+	{
+		for (FActorIterator It(World); It; ++It)
+		{
+			AActor* Actor = *It;
+			UActorComponent* ActorComponent = Actor->GetComponentByClass(Component);
+			if (Actor && !Actor->IsPendingKill() && ActorComponent)
+			{
+				FName ActorLevelName = CSWGetLevelName(GetActorLevel(Actor));
+				for (const FName& LevelName : LevelNameArray)
+				{
+					if (LevelName == ActorLevelName)
+					{
+						OutActors.Add(Actor);
+						OutActorComponents.Add(ActorComponent);
+						break;
+					}
+				}
+				
+			}
+		}
+	}
+}
+
+AActor* UCSWAutoSaveBlueprintLibrary::GetActorByIDNameAndClass(const UObject* WorldContextObject, const FName IDName, const TSubclassOf<AActor> ActorClass)
+{
+	if (!WorldContextObject || !ActorClass) return nullptr;
+
+	UWorld* World = GEngine->GetWorldFromContextObjectChecked(WorldContextObject);
+	/// We do nothing if not class provided, rather than giving ALL actors!
+	///For each Actor in the world that inherits from the ActorClass, if the Name of the actors matches the IDName, then return the Actor.
+	if (ActorClass && World)
+	{
+		for (TActorIterator<AActor> It(World, ActorClass); It; ++It)
+		{
+			AActor* Actor = *It;
+			if (!Actor->IsPendingKill() && Actor->GetFName() == IDName)
+			{
+				return Actor;
+			}
+		}
+	}
+	return nullptr;
+}
+
+int32 UCSWAutoSaveBlueprintLibrary::GetActorByIDNameFromAnArrayOfActors(const FName IDName, const TArray<AActor*>& ArrayOfActors, AActor*& Actor)
+{
+	if (ArrayOfActors.Num() <= 0) return -1;
+
+	int32 Index = 0;
+	///For each Actor in the ArrayOfActors, if the Name of the actors matches the IDName, then return the Actor and the Index where the Actor was found
+	for (AActor* actor : ArrayOfActors)
+	{
+		if (!actor->IsPendingKill() && actor->GetFName() == IDName)
+		{
+			Actor = actor;
+			return Index;
+		}
+		Index++;
+	}
+	///Return Index -1 if no Actor was found
+	return -1;
+}
+
+void UCSWAutoSaveBlueprintLibrary::GetLevelsNames(const UObject* WorldContextObject, TArray<FName>& CurrentLevelNameArray)
+{
+	if (!WorldContextObject) return;
+
+	UWorld* World = GEngine->GetWorldFromContextObjectChecked(WorldContextObject);
+	TArray<ULevel*> Levels = World->GetLevels();
+
+	///For each level in the Levels array, fill the CurrentMapNameArray with the level name
+	for (ULevel* level : Levels)
+	{
+		CurrentLevelNameArray.Add(CSWGetLevelName(level));
+	}
+}
+
+FName UCSWAutoSaveBlueprintLibrary::CSWGetLevelName(ULevel* Level)
+{
+	///We get the full name for the level, which will come in a similar format like this: /Game/UEDPIE_0_level1.level1:PersistentLevel
+	///We need to obtain a more readable name, one that can be used in level streaming, like this: /Game/level1
+	FString FullName = Level->GetPathName();
+	/// First, we create a PathName where the path will be stored, i.e: /Game/
+	/// And a FileName where the name of the level will be stores, i.e: level1
+	FString PathName, FileName;
+	/// Get the Path of the Level
+	GetSubstringBetween(FullName, TEXT("/"), TEXT("/"), PathName, /*UseCase*/ false, false, /*SearchFromEnd*/ false, true, -1, -1, /*IncludeString*/ true, true);
+	/// Get the name of the level
+	GetSubstringBetween(FullName, TEXT("."), TEXT(":"), FileName, /*UseCase*/ false, false, /*SearchFromEnd*/ false, true, -1, -1, /*IncludeString*/ false, false);
+
+	/// In case of the PathName and the FileName doesn't return a value. Use the FullName
+	if (PathName.Len() > 0 && FileName.Len() > 0)
+	{
+		FString NewFullName = PathName + FileName;
+		return FName(*NewFullName);
+	}
+	else
+	{
+		return FName(*FullName);
+	}
+}
+
+ULevel* UCSWAutoSaveBlueprintLibrary::GetActorLevel(AActor* Actor)
+{
+	if (!Actor) return nullptr;
+
+	return Actor->GetLevel();
+}
+
+class AActor* UCSWAutoSaveBlueprintLibrary::GetUniqueActorOfClass(const UObject* WorldContextObject, const TSubclassOf<AActor> ActorClass)
+{
+	if (!WorldContextObject || !ActorClass) return nullptr;
+	///GetWorld
+	UWorld* World = GEngine->GetWorldFromContextObjectChecked(WorldContextObject);
+	///Iterate Actors of Class
+	AActor* Actor = nullptr;
+	uint8 ActorCounter = 0;
+	if (ActorClass && World)
+	{
+		for (TActorIterator<AActor> It(World, ActorClass); It; ++It)
+		{
+			if (ActorCounter <= 1)
+			{
+				Actor = *It;
+				if (!Actor->IsPendingKill())
+				{
+					ActorCounter++;
+				}
+			}
+			else
+			{
+				break;
+			}
+		}
+	}
+	///If there's only one actor in the world
+	if (ActorCounter == 1)
+	{
+		return Actor;
+	}
+	else
+	{
+		if (ActorCounter == 0)
+		{
+			UE_LOG(LogTemp, Log, TEXT("CSW: GetUniqueActorOfClass() No Actor Found"));
+		}
+		else
+		{
+			UE_LOG(LogTemp, Log, TEXT("CSW: GetUniqueActorOfClass() There are more than 1 actor of this class in the world"));
+		}
+		return nullptr;
+	}
+}
+
+AActor* UCSWAutoSaveBlueprintLibrary::SpawnActorWithIDNameFromClass(const UObject* WorldContextObject, const TSubclassOf<AActor> Class, const FTransform& SpawnTransform, FName NameID, ULevel* OwnerLevel)
+{
+	return SpawnActorWithIDNameFromClass_Internal(WorldContextObject, Class, SpawnTransform, NameID, OwnerLevel, false);
+}
+
+AActor* UCSWAutoSaveBlueprintLibrary::SpawnActorWithIDNameFromClass_Internal(const UObject* WorldContextObject, const TSubclassOf<AActor> Class, const FTransform& SpawnTransform, FName NameID, ULevel* OwnerLevel, bool bLoadInEditorTime /*= false*/)
+{
+	if (!WorldContextObject || !Class || !GEngine) return nullptr;
+	///GetWorld
+	UWorld* World = GEngine->GetWorldFromContextObjectChecked(WorldContextObject);
+	if (!World) return nullptr;
+	/// Create Spawn Parameters
+	FActorSpawnParameters SpawnInfo;
+	if (OwnerLevel) SpawnInfo.OverrideLevel = OwnerLevel;
+	SpawnInfo.bAllowDuringConstructionScript = bLoadInEditorTime;
+	///If the name is not empty
+	if (NameID.ToString().Len() > 0 && NameID.ToString() != "None")
+	{
+		///Give a name to the SpawnInfo
+		SpawnInfo.Name = NameID;
+	}
+	///And spawn an Actor with the given name (if no name was provided, the name will be random as usual)
+	AActor* SpawnedActor = World->SpawnActor<AActor>(Class, SpawnTransform, SpawnInfo);
+	return SpawnedActor;
+}
+
+bool UCSWAutoSaveBlueprintLibrary::CSWDoesDirectoryExists(const FString& Path)
+{
+	IPlatformFile& PlatformFileManager = FPlatformFileManager::Get().GetPlatformFile();
+	return PlatformFileManager.DirectoryExists(*Path);
+}
+
+bool UCSWAutoSaveBlueprintLibrary::CSWMakeDirectory(const FString& Path)
+{
+	IPlatformFile& PlatformFileManager = FPlatformFileManager::Get().GetPlatformFile();
+	if (!PlatformFileManager.DirectoryExists(*Path))
+	{
+		return PlatformFileManager.CreateDirectory(*FPaths::GetPath(Path));
+	}
+	return false;
+}
+
+FString UCSWAutoSaveBlueprintLibrary::GetPathProject()
+{
+	return FPaths::ConvertRelativePathToFull(FPaths::ProjectDir());
+}
+
+FString UCSWAutoSaveBlueprintLibrary::GetPathSaved()
+{
+	return FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir());
+}
+
+FString UCSWAutoSaveBlueprintLibrary::GetPathSaveGames()
+{
+	return FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir() + TEXT("SaveGames/"));
+}
+
+
+
+#pragma endregion
+
+
+#pragma region PRIVATE::AUTO SAVE AND LOAD FUNCTIONS
+
+void UCSWAutoSaveBlueprintLibrary::SaveActor(FCSWActorRecord& ActorRecord, AActor* Actor, const UCSWAutoSaveComponent* AutoSaveAndLoadComponent, UCSWAutoSaveObject* AutoSaveGameObject /*= nullptr*/)
+{
+	SaveActor_Internal(ActorRecord, Actor, AutoSaveAndLoadComponent, AutoSaveGameObject, nullptr);
+}
+
+void UCSWAutoSaveBlueprintLibrary::SaveActor_Internal(FCSWActorRecord& ActorRecord, AActor* Actor, const UCSWAutoSaveComponent* AutoSaveAndLoadComponent, UCSWAutoSaveObject* AutoSaveGameObject, FCSWPoseBatch* PoseBatch)
+{
+	///Save actor
+	ActorRecord.Name = Actor->GetFName();
+	ActorRecord.Class = Actor->GetClass();
+	if (!PoseBatch || !PoseBatch->AddActor(Actor, &ActorRecord.XForm))
+	{
+		ActorRecord.XForm = Actor->GetTransform();
+	}
+	ActorRecord.bLoadRandomID = AutoSaveAndLoadComponent->GetLoadActorWithRandomIDName();
+	ActorRecord.Precision = AutoSaveAndLoadComponent->GetTransformPrecision();
+
+	/// Serialize the SaveGame flagged variables with the save plan of the actor class
+	FCSWSavePlanCache::Get().SaveObject(Actor, ActorRecord.Data, AutoSaveGameObject ? &AutoSaveGameObject->ReferenceTable : nullptr);
+}
+
+void UCSWAutoSaveBlueprintLibrary::SaveActorComponents(FCSWActorRecord& ActorRecord, AActor* Actor, const UCSWAutoSaveComponent* AutoSaveAndLoadComponent, UCSWAutoSaveObject* AutoSaveGameObject /*= nullptr*/)
+{
+	SaveActorComponents_Internal(ActorRecord, Actor, AutoSaveAndLoadComponent, AutoSaveGameObject, nullptr);
+}
+
+void UCSWAutoSaveBlueprintLibrary::SaveActorComponents_Internal(FCSWActorRecord& ActorRecord, AActor* Actor, const UCSWAutoSaveComponent* AutoSaveAndLoadComponent, UCSWAutoSaveObject* AutoSaveGameObject, FCSWPoseBatch* PoseBatch)
+{
+	///Return if there are no components to save (dropping the ones of a record updated in place)
+	if (AutoSaveAndLoadComponent->GetSaveComponents() == false && AutoSaveAndLoadComponent->GetComponentOptions().Num() < 1)
+	{
+		ActorRecord.ComponentsRecord.Reset();
+		return;
+	}
+
+	TInlineComponentArray<UActorComponent*> ActorComponentsArray;
+	Actor->GetComponents(ActorComponentsArray);
+	ActorRecord.ComponentsRecord.Reserve(ActorComponentsArray.Num());
+	///The saved components, in the order of their records
+	TInlineComponentArray<UActorComponent*> SavedComponents;
+	///The component records of a record updated in place are overwritten in order, the ones left over are trimmed below
+	int32 NumComponentRecords = 0;
+
+	for (UActorComponent* actorcomponent : ActorComponentsArray)
+	{
+		///Find if there are custom options for this component
+		FCSWAutoSaveComponentOption componentOptions;
+		bool bSaveThisComponent = GetComponentSaveAndLoadConditions(AutoSaveAndLoadComponent, actorcomponent, OUT componentOptions);
+		///If this component can be saved
+		if (bSaveThisComponent)
+		{
+			SaveActorComponent_Internal(ActorRecord, actorcomponent, AutoSaveAndLoadComponent, componentOptions, AutoSaveGameObject, NumComponentRecords++, PoseBatch);
+			SavedComponents.Add(actorcomponent);
+		}
+	}
+	ActorRecord.ComponentsRecord.SetNum(NumComponentRecords, false);
+
+	///Gather the poses once the records stopped moving
+	if (PoseBatch)
+	{
+		for (int32 Index = 0; Index < SavedComponents.Num(); Index++)
+		{
+			FCSWActorComponentRecord& ComponentRecord = ActorRecord.ComponentsRecord[Index];
+			if (ComponentRecord.Fields != static_cast<uint8>(ECSWComponentRecordField::None))
+			{
+				PoseBatch->AddComponent(SavedComponents[Index], &ComponentRecord);
+			}
+		}
+	}
+}
+
+void UCSWAutoSaveBlueprintLibrary::SaveActorComponent(FCSWActorRecord& ActorRecord, UActorComponent* ActorComponent, const UCSWAutoSaveComponent* AutoSaveAndLoadComponent, FCSWAutoSaveComponentOption& ComponentOptions, UCSWAutoSaveObject* AutoSaveGameObject /*= nullptr*/)
+{
+	SaveActorComponent_Internal(ActorRecord, ActorComponent, AutoSaveAndLoadComponent, ComponentOptions, AutoSaveGameObject, INDEX_NONE, nullptr);
+}
+
+void UCSWAutoSaveBlueprintLibrary::SaveActorComponent_Internal(FCSWActorRecord& ActorRecord, UActorComponent* ActorComponent, const UCSWAutoSaveComponent* AutoSaveAndLoadComponent, FCSWAutoSaveComponentOption& ComponentOptions, UCSWAutoSaveObject* AutoSaveGameObject, const int32 RecordIndex, FCSWPoseBatch* PoseBatch)
+{
+	///The record is built in place in the ActorRecord, over a previous one if there's one at RecordIndex (its Data keeps its memory)
+	const bool bOverwrite = ActorRecord.ComponentsRecord.IsValidIndex(RecordIndex);
+	FCSWActorComponentRecord& ActorComponentRecord = bOverwrite ? ActorRecord.ComponentsRecord[RecordIndex] : ActorRecord.ComponentsRecord[ActorRecord.ComponentsRecord.AddDefaulted()];
+	if (bOverwrite)
+	{
+		ActorComponentRecord.Loc = FVector::ZeroVector;
+		ActorComponentRecord.Rot = FRotator::ZeroRotator;
+		ActorComponentRecord.Scale = FVector::OneVector;
+		ActorComponentRecord.LinearVel = FVector::ZeroVector;
+		ActorComponentRecord.AngularVel = FVector::ZeroVector;
+		ActorComponentRecord.Data.Reset();
+	}
+	///Save ActorComponent Name, Class and Transform (if it's a scene component). Only the fields chosen below are stored
+	ActorComponentRecord.Name = ActorComponent->GetFName();
+	ActorComponentRecord.Fields = static_cast<uint8>(ECSWComponentRecordField::None);
+
+	/// IF COMPONENT IS CHILD OF CSWStorerComponent, save its state completely
+	if (ActorComponent->GetClass()->IsChildOf(UCSWStorerComponent::StaticClass()))
+	{
+		ConvertObjectToBytes(ActorComponent, ActorComponentRecord.Data);
+	}
+	/// Else, save SAVEGAME flagged variables and custom data only
+	else
+	{
+		///With a pose batch only the fields are chosen here, their values are scattered into the record by the batch
+		USceneComponent* sceneComponent = Cast<USceneComponent>(ActorComponent);
+		UPrimitiveComponent* primitiveComponent = Cast<UPrimitiveComponent>(ActorComponent);
+		const bool bReadPose = PoseBatch == nullptr;
+		///Save relative transform if the components is a scene component
+		/// NOTE: componentOptions.Name == "None" means that this component doesn't have custom options so it will use the default options. 
+		/// If it's different than "None" the component has custom options like componentOptions.bSaveLocation
+		if (sceneComponent)
+		{
+			///Save Relative Location
+			if ((AutoSaveAndLoadComponent->GetSaveComponentsLocation() && ComponentOptions.Name == "None") || (ComponentOptions.Name != "None" && ComponentOptions.bSaveLoc))
+			{
+				ActorComponentRecord.AddField(ECSWComponentRecordField::Location);
+				if (bReadPose)
+				{
+					ActorComponentRecord.Loc = sceneComponent->RelativeLocation;
+				}
+			}
+			///Save Relative Rotation
+			if ((AutoSaveAndLoadComponent->GetSaveComponentsRotation() && ComponentOptions.Name == "None") || (ComponentOptions.Name != "None" && ComponentOptions.bSaveRot))
+			{
+				ActorComponentRecord.AddField(ECSWComponentRecordField::Rotation);
+				if (bReadPose)
+				{
+					ActorComponentRecord.Rot = sceneComponent->RelativeRotation;
+				}
+			}
+			///SetRelative Scale
+			if ((AutoSaveAndLoadComponent->GetSaveComponentsScale() && ComponentOptions.Name == "None") || (ComponentOptions.Name != "None" && ComponentOptions.bSaveScale))
+			{
+				ActorComponentRecord.AddField(ECSWComponentRecordField::Scale);
+				if (bReadPose)
+				{
+					ActorComponentRecord.Scale = sceneComponent->RelativeScale3D;
+				}
+			}
+		}
+		///Save Physics Simulation if it's a Primitive Component
+		if (primitiveComponent)
+		{
+			if ((AutoSaveAndLoadComponent->GetSaveComponentsLinearVelocity() && ComponentOptions.Name == "None") || (ComponentOptions.Name != "None" && ComponentOptions.bSaveLVel))
+			{
+				ActorComponentRecord.AddField(ECSWComponentRecordField::LinearVelocity);
+				if (bReadPose)
+				{
+					ActorComponentRecord.LinearVel = primitiveComponent->GetPhysicsLinearVelocity();
+				}
+			}
+			if ((AutoSaveAndLoadComponent->GetSaveComponentsAngularVelocity() && ComponentOptions.Name == "None") || (ComponentOptions.Name != "None" && ComponentOptions.bSaveAVel))
+			{
+				ActorComponentRecord.AddField(ECSWComponentRecordField::AngularVelocity);
+				if (bReadPose)
+				{
+					ActorComponentRecord.AngularVel = primitiveComponent->GetPhysicsAngularVelocityInDegrees();
+				}
+			}
+		}
+		///Save Actor Component Data
+		FCSWSavePlanCache::Get().SaveObject(ActorComponent, ActorComponentRecord.Data, AutoSaveGameObject ? &AutoSaveGameObject->ReferenceTable : nullptr);
+	}
+}
+
+void UCSWAutoSaveBlueprintLibrary::LoadAllActorsInLevel(const UObject* WorldContextObject, const UCSWAutoSaveObject* AutoSaveGameObject, const FCSWMapRecord& levelRecord, TArray<FCSWAutosaveActor>& AutosaveActorsInLevel, const bool bLoadInEditorTime)
+{
+	if (!WorldContextObject) return;
+
+	for (const FCSWActorRecord& ActorRecord : levelRecord.ActorsRecord)
+	{
+		LoadActorInLevel(ActorRecord, AutosaveActorsInLevel, AutoSaveGameObject, WorldContextObject, levelRecord, bLoadInEditorTime);
+	}
+}
+
+void UCSWAutoSaveBlueprintLibrary::LoadActorInLevel(const FCSWActorRecord &ActorRecord, TArray<FCSWAutosaveActor> &AutosaveActorsInLevel, const UCSWAutoSaveObject* AutoSaveGameObject, const UObject* WorldContextObject, const FCSWMapRecord &levelRecord, const bool bLoadInEditorTime)
+{
+	AActor* LoadedActor = nullptr;
+	UCSWAutoSaveComponent* AutosaveComponent = nullptr;
+	///Try to get a Loaded Actor in case the Actor already exists in the level (so we update it instead of creating a new one)
+	int32 ActorIndex = GetActorByIDFromAutosaveActors(ActorRecord.Name, AutosaveActorsInLevel, OUT LoadedActor);
+	///If Actor was found, we remove the data in the index so the iteration will be faster next time
+	if (ActorIndex != -1 && AutosaveActorsInLevel.IsValidIndex(ActorIndex))
+	{
+		AutosaveActorsInLevel.RemoveAt(ActorIndex);
+	}
+	//Route if Actor exists in the Level and needs to be updated
+	if (LoadedActor)
+	{
+		LoadActor_Internal(ActorRecord, AutoSaveGameObject, AutosaveComponent, LoadedActor, false);
+	}
+	//Route if Actor doesn't exist in the Level and needs to be created
+	else
+	{
+		///Spawn in this level
+		ULevel* LevelOwner = GetLevelReferenceFromName(WorldContextObject, levelRecord.Name);
+		//Route if Load With Random Name is Enabled, then create the actor with a random name (spawn it normally)
+		if (ActorRecord.bLoadRandomID)
+		{
+			LoadedActor = SpawnActorWithIDNameFromClass_Internal(WorldContextObject, ActorRecord.Class, ActorRecord.XForm, FName(""), LevelOwner, bLoadInEditorTime);
+		}
+		//Route if the Actor will be loaded with a given ID
+		else
+		{
+			LoadedActor = SpawnActorWithIDNameFromClass_Internal(WorldContextObject, ActorRecord.Class, ActorRecord.XForm, ActorRecord.Name, LevelOwner, bLoadInEditorTime);
+		}
+		//Load data for LoadedActor
+		if (LoadedActor)
+		{
+			LoadActor_Internal(ActorRecord, AutoSaveGameObject, AutosaveComponent, LoadedActor, true);
+		}
+	}
+}
+
+void UCSWAutoSaveBlueprintLibrary::FullLoadActorFromRecord(const FCSWActorRecord& ActorRecord, AActor* Actor, UCSWAutoSaveComponent* AutoSaveAndLoadComponent, const bool bLoadActorComponents /*= true*/, const UCSWAutoSaveObject* AutoSaveGameObject /*= nullptr*/)
+{
+	if (!Actor || !AutoSaveAndLoadComponent) return;
+	///Load the data from the AutoSaveAndLoadComponent first, so the options will match the options from the savefile
+	for (const FCSWActorComponentRecord& actorComponentRecord : ActorRecord.ComponentsRecord)
+	{
+		///For each component that this actors has, verifies if the name is the same an then loads the data that corresponds
+		if (actorComponentRecord.Name == AutoSaveAndLoadComponent->GetFName())
+		{
+			FCSWAutoSaveComponentOption componentOptions;
+			LoadActorComponent(actorComponentRecord, OUT AutoSaveAndLoadComponent, componentOptions, AutoSaveAndLoadComponent, AutoSaveGameObject);
+			break;
+		}
+	}
+	///Load the Actor and the components only if the component is enabled on this actor
+	if (AutoSaveAndLoadComponent->GetEnableComponent())
+	{
+		LoadActor(ActorRecord, Actor, AutoSaveGameObject);
+		if (bLoadActorComponents)
+		{
+			LoadActorComponents(ActorRecord, Actor, AutoSaveAndLoadComponent, AutoSaveGameObject);
+		}
+	}
+}
+
+void UCSWAutoSaveBlueprintLibrary::LoadActor(const FCSWActorRecord& ActorRecord, AActor* DynamicActor, const UCSWAutoSaveObject* AutoSaveGameObject /*= nullptr*/)
+{
+	/// Planned data (or tagged data of older saves)
+	FCSWSavePlanCache::Get().LoadObject(DynamicActor, ActorRecord.Data, AutoSaveGameObject ? &AutoSaveGameObject->ReferenceTable : nullptr);
+}
+
+void UCSWAutoSaveBlueprintLibrary::LoadActorComponents(const FCSWActorRecord& ActorRecord, AActor* DynamicActor, const UCSWAutoSaveComponent* AutoSaveAndLoadComponent, const UCSWAutoSaveObject* AutoSaveGameObject /*= nullptr*/)
+{
+	///Return if there are no components to load or if the AutoSaveAndLoadComponent is nullptr
+	if (AutoSaveAndLoadComponent->GetSaveComponents() == false && AutoSaveAndLoadComponent->GetComponentOptions().Num() < 1) return;
+
+	TInlineComponentArray<UActorComponent*> ActorComponentsArray;
+	DynamicActor->GetComponents(ActorComponentsArray);
+	///This method is faster than above, Serializes the data of all the components of an actor
+	int i = 0;
+	for (UActorComponent* actorcomponent : ActorComponentsArray)
+	{
+		if (actorcomponent != AutoSaveAndLoadComponent)
+		{
+			///Find if there are custom options for this component and determine if this component can be loaded
+			FCSWAutoSaveComponentOption componentOptions;
+			bool bLoadThisComponent = GetComponentSaveAndLoadConditions(AutoSaveAndLoadComponent, actorcomponent, OUT componentOptions);
+			///IF THIS COMPONENT CAN BE LOADED
+			if (bLoadThisComponent)
+			{
+				///Try to load the actor in order first (when it works, it loads the actor components faster)
+				if (ActorRecord.ComponentsRecord.IsValidIndex(i))
+				{
+					const FCSWActorComponentRecord& actorComponentRecordOut = ActorRecord.ComponentsRecord[i];
+					if (actorComponentRecordOut.Name == actorcomponent->GetFName())
+					{
+						LoadActorComponent(actorComponentRecordOut, actorcomponent, componentOptions, AutoSaveAndLoadComponent, AutoSaveGameObject);
+						i++;
+						continue;
+					}
+				}
+				///If the actors components weren't loaded at this point, try to search an actor components that matches the name and load it!
+				for (const FCSWActorComponentRecord& actorComponentRecord : ActorRecord.ComponentsRecord)
+				{
+					///For each component that this actors has, verifies if the name is the same an then loads the data that corresponds
+					if (actorComponentRecord.Name == actorcomponent->GetFName())
+					{
+						LoadActorComponent(actorComponentRecord, actorcomponent, componentOptions, AutoSaveAndLoadComponent, AutoSaveGameObject);
+						i++;
+						break;
+					}
+				}
+			}
+		}
+		i++;
+	}
+}
+
+void UCSWAutoSaveBlueprintLibrary::LoadActorComponent(const FCSWActorComponentRecord &actorComponentRecord, UActorComponent* actorcomponent, const FCSWAutoSaveComponentOption &componentOptions, const UCSWAutoSaveComponent* AutoSaveAndLoadComponent, const UCSWAutoSaveObject* AutoSaveGameObject /*= nullptr*/)
+{
+	/// IF COMPONENT IS CHILD OF CSWStorerComponent, restore its state completely
+	if (actorcomponent->GetClass()->IsChildOf(UCSWStorerComponent::StaticClass()))
+	{
+		RestoreObjectFromBytes(actorcomponent, actorComponentRecord.Data);
+	}
+	/// Load an Actor Component, using the save plan of its class (or FCSWSaveGameArchive for tagged data) that will load the SaveGame flagged variables
+	else
+	{
+		FCSWSavePlanCache::Get().LoadObject(actorcomponent, actorComponentRecord.Data, AutoSaveGameObject ? &AutoSaveGameObject->ReferenceTable : nullptr);
+		///Load Transform if it's an scene component
+		if (actorcomponent->GetClass()->IsChildOf(USceneComponent::StaticClass()))
+		{
+			USceneComponent* sceneComponent = Cast<USceneComponent>(actorcomponent);
+			///Load Relative Location, Rotation and Scale
+			/// NOTE: componentOptions.Name == "None" means that this component doesn't have custom options so it will use the default options. 
+			/// If it's different than "None" the component has custom options like componentOptions.bSaveLocation
+			/// Fields that weren't captured when the component was saved aren't in the record (see FCSWActorComponentRecord::Fields)
+			const bool bLoadLocation = actorComponentRecord.HasField(ECSWComponentRecordField::Location) && ((AutoSaveAndLoadComponent->GetSaveComponentsLocation() && componentOptions.Name == "None") || (componentOptions.Name != "None" && componentOptions.bSaveLoc));
+			const bool bLoadRotation = actorComponentRecord.HasField(ECSWComponentRecordField::Rotation) && ((AutoSaveAndLoadComponent->GetSaveComponentsRotation() && componentOptions.Name == "None") || (componentOptions.Name != "None" && componentOptions.bSaveRot));
+			const bool bLoadScale = actorComponentRecord.HasField(ECSWComponentRecordField::Scale) && ((AutoSaveAndLoadComponent->GetSaveComponentsScale() && componentOptions.Name == "None") || (componentOptions.Name != "None" && componentOptions.bSaveScale));
+			///A single transform update for the location, rotation and scale
+			FCSWPoseBatch::ApplyComponentPose(sceneComponent, actorComponentRecord, bLoadLocation, bLoadRotation, bLoadScale);
+		}
+		///Load Physics Simulation if it's a Primitive Component
+		if (actorcomponent->GetClass()->IsChildOf(UPrimitiveComponent::StaticClass()))
+		{
+			UPrimitiveComponent* primitiveComponent = Cast<UPrimitiveComponent>(actorcomponent);
+			if (actorComponentRecord.HasField(ECSWComponentRecordField::LinearVelocity) && ((AutoSaveAndLoadComponent->GetSaveComponentsLinearVelocity() && componentOptions.Name == "None") || (componentOptions.Name != "None" && componentOptions.bSaveLVel)))
+			{
+				primitiveComponent->SetPhysicsLinearVelocity(actorComponentRecord.LinearVel);
+			}
+			if (actorComponentRecord.HasField(ECSWComponentRecordField::AngularVelocity) && ((AutoSaveAndLoadComponent->GetSaveComponentsAngularVelocity() && componentOptions.Name == "None") || (componentOptions.Name != "None" && componentOptions.bSaveAVel)))
+			{
+				primitiveComponent->SetPhysicsAngularVelocityInDegrees(actorComponentRecord.AngularVel);
+			}
+		}
+	}
+}
+
+bool UCSWAutoSaveBlueprintLibrary::GetComponentSaveAndLoadConditions(const UCSWAutoSaveComponent* AutoSaveAndLoadComponent, const  UActorComponent* actorcomponent, FCSWAutoSaveComponentOption &componentOptions)
+{
+	bool bComponentOptionsFound = false;
+	for (FCSWAutoSaveComponentOption& options : AutoSaveAndLoadComponent->GetComponentOptions())
+	{
+		if (options.Name == actorcomponent->GetFName())
+		{
+			bComponentOptionsFound = true;
+			componentOptions = options;
+			break;
+		}
+	}
+	///Determine if this component can be saved/loaded
+	bool bSaveLoadThisComponent = false;
+	/// When save components is enabled by default, save only if no ComponentOptions where found OR if a component option was found and save component is checked in the options
+	if (AutoSaveAndLoadComponent->GetSaveComponents())
+	{
+		bSaveLoadThisComponent = (bComponentOptionsFound == false) || (bComponentOptionsFound && componentOptions.bSave);
+	}
+	/// When save components is not enabled by default, save only if a component option was found and save component is checked in the options
+	else
+	{
+		bSaveLoadThisComponent = bComponentOptionsFound && componentOptions.bSave;
+	}
+	return bSaveLoadThisComponent;
+}
+
+void UCSWAutoSaveBlueprintLibrary::CSWTryDestroyActors(const UCSWAutoSaveObject* AutoSaveGameObject, TArray<FCSWAutosaveActor>& AutosaveActorsInLevel)
+{
+	if (!AutoSaveGameObject || AutosaveActorsInLevel.Num() <= 0) return;
+	
+	for (FCSWAutosaveActor& autosaveActor : AutosaveActorsInLevel)
+	{
+		TryDestroyActor(autosaveActor, AutoSaveGameObject);
+	}
+}
+
+void UCSWAutoSaveBlueprintLibrary::TryDestroyActor(FCSWAutosaveActor &autosaveActor, const UCSWAutoSaveObject* AutoSaveGameObject)
+{
+	if (autosaveActor.Actor && autosaveActor.AutosaveComponent && !autosaveActor.Actor->IsPendingKill())
+	{
+		if (autosaveActor.AutosaveComponent && autosaveActor.AutosaveComponent->GetDestroyActorOnLoadGameIfWasNotSaved() && autosaveActor.AutosaveComponent->GetWasSaved() == false)
+		{
+			///#Call the Event OnBeginDestroyUnsavedActor() so we give a chance to abort destruction 
+			autosaveActor.AutosaveComponent->OnBeginDestroyUnsavedActor(AutoSaveGameObject);
+			///Destroy the actor
+			autosaveActor.Actor->Destroy();
+			autosaveActor.Actor->ConditionalBeginDestroy();
+			autosaveActor.Actor = nullptr;
+		}
+		else
+		{
+			///#Call the Event OnUnchangedActor() so we tell that this actor wasn't changed at all when the game was loaded
+			autosaveActor.AutosaveComponent->OnUnchangedActor(AutoSaveGameObject);
+		}
+	}
+}
+
+uint32 UCSWAutoSaveBlueprintLibrary::GetLevelRecordIndexSave(UCSWAutoSaveObject* AutoSaveGameObject, const FCSWLevelWithAutosaveActors& LevelWithAutosaveActors, bool& bMatchFound)
+{
+	bMatchFound = false;
+	uint32 LevelRecordIndex = 0;
+	for (const FCSWMapRecord& mapRecord : AutoSaveGameObject->LevelsRecord)
+	{
+		if (LevelWithAutosaveActors.Name == mapRecord.Name)
+		{
+			bMatchFound = true;
+			break;
+		}
+		LevelRecordIndex++;
+	}
+	return LevelRecordIndex;
+}
+
+uint32 UCSWAutoSaveBlueprintLibrary::GetLevelRecordIndexLoad(const FCSWMapRecord& LevelRecord, const TArray<FCSWLevelWithAutosaveActors>& LevelSWithAutosaveActors, bool& bMatchFound)
+{
+	bMatchFound = false;
+	uint32 LevelRecordIndex = 0;
+	for (const FCSWLevelWithAutosaveActors& levelWithAutoSaveActors : LevelSWithAutosaveActors)
+	{
+		if (levelWithAutoSaveActors.Name == LevelRecord.Name)
+		{
+			bMatchFound = true;
+			break;
+		}
+		LevelRecordIndex++;
+	}
+	return LevelRecordIndex;
+}
+
+/** An actor of the level being saved, from its OnSaveStart to its OnSaveEnd */
+struct FCSWActorSaveState
+{
+	AActor* Actor = nullptr;
+	UCSWAutoSaveComponent* AutosaveComponent = nullptr;
+	/** Index of its record in the level record */
+	int32 RecordIndex = INDEX_NONE;
+	uint32 StateHash = 0;
+	bool bTrackState = false;
+	/** Its record is up to date already (dirty tracking) */
+	bool bClean = false;
+};
+
+/**
+* Call OnSaveStart and find the record of the actor in the level record: its previous record if the level is updated in place (kept if it's clean),
+* otherwise a new one. False if the actor isn't saved
+*/
+static bool BeginActorSave(const FCSWAutosaveActor& AutosaveActor, UCSWAutoSaveObject* AutoSaveGameObject, const uint32 LevelRecordIndex, FCSWActorSaveState& OutState)
+{
+	AActor* Actor = AutosaveActor.Actor;
+	UCSWAutoSaveComponent* AutosaveComponent = AutosaveActor.AutosaveComponent;
+	if (!Actor || !AutosaveComponent || Actor->IsPendingKill() || !AutosaveComponent->GetEnableComponent()) return false;
+
+	///#CALL The event OnSaveStart (Before the actor is saved)
+	AutosaveComponent->OnSaveStart(AutoSaveGameObject);
+	if (!AutoSaveGameObject->LevelsRecord.IsValidIndex(LevelRecordIndex)) return false;
+
+	OutState.Actor = Actor;
+	OutState.AutosaveComponent = AutosaveComponent;
+	TArray<FCSWActorRecord>& ActorsRecord = AutoSaveGameObject->LevelsRecord[LevelRecordIndex].ActorsRecord;
+
+	///In place updates: the previous record of the actor is overwritten where it is, or added at the end of the level record (see UCSWAutoSaveObject::BeginRecordUpdate())
+	bool bRecordAdded = false;
+	OutState.RecordIndex = AutoSaveGameObject->FindOrAddUpdatedActorRecord(LevelRecordIndex, Actor->GetFName(), OUT bRecordAdded);
+	if (OutState.RecordIndex != INDEX_NONE)
+	{
+		///Dirty tracking: the previous record is kept if nothing the actor saves changed since then (see UCSWAutoSaveComponent::MarkDirty())
+		OutState.bTrackState = UCSWAutoSaveComponent::GetUseDirtyTracking() && AutosaveComponent->ComputeSaveStateHash(OUT OutState.StateHash);
+		OutState.bClean = !bRecordAdded && OutState.bTrackState && AutosaveComponent->IsRecordClean(AutoSaveGameObject, ActorsRecord[OutState.RecordIndex], OutState.StateHash);
+		return true;
+	}
+	///Create an ActorRecord for Store ActorName, ActorClass, ActorTransform and ActorData (SaveGame flagged Variables)
+	///#CronofearNiceStuffHere Breakpoint here to see how much data an actor is saving (components included).
+	OutState.RecordIndex = ActorsRecord.AddDefaulted();
+	return true;
+}
+
+/** Remember the state the record of the actor was built from and call OnSaveEnd */
+static void EndActorSave(const FCSWActorSaveState& State, UCSWAutoSaveObject* AutoSaveGameObject, const uint32 LevelRecordIndex)
+{
+	if (State.bTrackState)
+	{
+		State.AutosaveComponent->MarkClean(AutoSaveGameObject, AutoSaveGameObject->LevelsRecord[LevelRecordIndex].ActorsRecord[State.RecordIndex], State.StateHash);
+	}
+	///#CALL the Event OnSaveEnd (After the actor is saved)
+	State.AutosaveComponent->OnSaveEnd(AutoSaveGameObject);
+}
+
+void UCSWAutoSaveBlueprintLibrary::SaveAllActorsInLevel(UCSWAutoSaveObject* AutoSaveGameObject, const FCSWLevelWithAutosaveActors& LevelWithAutosaveActors, uint32 LevelRecordIndex)
+{
+	///The records are added to the level record at once, grown once. Records updated in place are already there
+	if (AutoSaveGameObject->LevelsRecord.IsValidIndex(LevelRecordIndex))
+	{
+		TArray<FCSWActorRecord>& ActorsRecord = AutoSaveGameObject->LevelsRecord[LevelRecordIndex].ActorsRecord;
+		ActorsRecord.Reserve(FMath::Max(ActorsRecord.Num(), LevelWithAutosaveActors.AutosaveActors.Num()));
+	}
+
+	///OnSaveStart of every actor goes first, so the poses are the ones they leave. Their records are found or added here, the level record doesn't grow after this
+	TArray<FCSWActorSaveState> SaveStates;
+	SaveStates.Reserve(LevelWithAutosaveActors.AutosaveActors.Num());
+	for (const FCSWAutosaveActor& AutosaveActor : LevelWithAutosaveActors.AutosaveActors)
+	{
+		FCSWActorSaveState SaveState;
+		if (BeginActorSave(AutosaveActor, AutoSaveGameObject, LevelRecordIndex, SaveState))
+		{
+			SaveStates.Add(SaveState);
+		}
+	}
+	if (SaveStates.Num() == 0) return;
+
+	///The records of the actors that changed are built without their poses, the poses are gathered with the record fields they go into.
+	///They are captured in one batch and scattered into the records (see FCSWPoseBatch)
+	TArray<FCSWActorRecord>& ActorsRecord = AutoSaveGameObject->LevelsRecord[LevelRecordIndex].ActorsRecord;
+	FCSWPoseBatch PoseBatch;
+	for (const FCSWActorSaveState& SaveState : SaveStates)
+	{
+		if (!SaveState.bClean)
+		{
+			FullSaveActorIntoRecord_Internal(ActorsRecord[SaveState.RecordIndex], SaveState.Actor, SaveState.AutosaveComponent, AutoSaveGameObject, &PoseBatch);
+		}
+	}
+	PoseBatch.Capture();
+	PoseBatch.Scatter();
+
+	///The records are complete, their state can be remembered
+	for (const FCSWActorSaveState& SaveState : SaveStates)
+	{
+		EndActorSave(SaveState, AutoSaveGameObject, LevelRecordIndex);
+	}
+}
+
+void UCSWAutoSaveBlueprintLibrary::SaveActorInLevel(const FCSWAutosaveActor &AutosaveActor, UCSWAutoSaveObject* AutoSaveGameObject, uint32 LevelRecordIndex)
+{
+	FCSWActorSaveState SaveState;
+	if (!BeginActorSave(AutosaveActor, AutoSaveGameObject, LevelRecordIndex, SaveState)) return;
+	if (!SaveState.bClean)
+	{
+		FullSaveActorIntoRecord(AutoSaveGameObject->LevelsRecord[LevelRecordIndex].ActorsRecord[SaveState.RecordIndex], SaveState.Actor, SaveState.AutosaveComponent, AutoSaveGameObject);
+	}
+	EndActorSave(SaveState, AutoSaveGameObject, LevelRecordIndex);
+}
+
+
+
+void UCSWAutoSaveBlueprintLibrary::FullSaveActorIntoRecord(FCSWActorRecord& ActorRecord, AActor* Actor, const UCSWAutoSaveComponent* AutosaveComponent, UCSWAutoSaveObject* AutoSaveGameObject /*= nullptr*/)
+{
+	FullSaveActorIntoRecord_Internal(ActorRecord, Actor, AutosaveComponent, AutoSaveGameObject, nullptr);
+}
+
+void UCSWAutoSaveBlueprintLibrary::FullSaveActorIntoRecord_Internal(FCSWActorRecord& ActorRecord, AActor* Actor, const UCSWAutoSaveComponent* AutosaveComponent, UCSWAutoSaveObject* AutoSaveGameObject, FCSWPoseBatch* PoseBatch)
+{
+	ActorRecord.ChangeStamp = FCSWActorRecord::NewChangeStamp();
+	SaveActor_Internal(ActorRecord, Actor, AutosaveComponent, AutoSaveGameObject, PoseBatch);
+	SaveActorComponents_Internal(ActorRecord, Actor, AutosaveComponent, AutoSaveGameObject, PoseBatch);
+}
+
+int32 UCSWAutoSaveBlueprintLibrary::GetActorByIDFromAutosaveActors(const FName IDName, const TArray<FCSWAutosaveActor>& AutosaveActorsInLevel, AActor*& Actor)
+{
+	if (AutosaveActorsInLevel.Num() <= 0) return -1;
+
+	int32 Index = 0;
+	///For each Actor in the ArrayOfActors, if the Name of the actors matches the IDName, then return the Actor and the Index where the Actor was found
+	for (const FCSWAutosaveActor& autosaveActor : AutosaveActorsInLevel)
+	{
+		if (autosaveActor.Actor && !autosaveActor.Actor->IsPendingKill() && autosaveActor.Actor->GetFName() == IDName)
+		{
+			Actor = autosaveActor.Actor;
+			return Index;
+		}
+		Index++;
+	}
+	///Return Index -1 if no Actor was found
+	return -1;
+}
+
+void UCSWAutoSaveBlueprintLibrary::LoadActor_Internal(const FCSWActorRecord& ActorRecord, const UCSWAutoSaveObject* AutoSaveGameObject,  UCSWAutoSaveComponent* AutosaveComponent , AActor* LoadedActor, bool bDestroyActorIfAutosaveComponentDisabled)
+{
+	AutosaveComponent = Cast<UCSWAutoSaveComponent>(LoadedActor->GetComponentByClass(UCSWAutoSaveComponent::StaticClass()));
+	if (AutosaveComponent && AutosaveComponent->GetEnableComponent())
+	{
+		///#CALL OnLoadStart Event
+		AutosaveComponent->OnLoadStart(AutoSaveGameObject);
+		///Load Actor and ActorComponent Data
+		FullLoadActorFromRecord(ActorRecord, LoadedActor, AutosaveComponent, true, AutoSaveGameObject);
+		///#CALL OnLoadEnd Event
+		AutosaveComponent->OnLoadEnd(AutoSaveGameObject);
+	}
+	else if (bDestroyActorIfAutosaveComponentDisabled)
+	{
+		///Destroy a recreated actor if it doesn't have a SaveAndLoadComponent or if it's component is disabled
+		LoadedActor->Destroy();
+		LoadedActor->ConditionalBeginDestroy();
+		LoadedActor = nullptr;
+	}
+}
+
+ULevel* UCSWAutoSaveBlueprintLibrary::GetLevelReferenceFromName(const UObject* WorldContextObject, const FName& NameOfTheLevel)
+{
+	if (!WorldContextObject) return nullptr;
+	UWorld* World = GEngine->GetWorldFromContextObjectChecked(WorldContextObject);
+	if (!World) return nullptr;
+
+	TArray<ULevel*> Levels = World->GetLevels();
+
+	///For each level in the Levels array, fill the CurrentMapNameArray with the level name
+	for (ULevel* level : Levels)
+	{
+		if (CSWGetLevelName(level) == NameOfTheLevel)
+		{
+			return level;
+		}
+	}
+	return nullptr;
+}
+
+#pragma endregion
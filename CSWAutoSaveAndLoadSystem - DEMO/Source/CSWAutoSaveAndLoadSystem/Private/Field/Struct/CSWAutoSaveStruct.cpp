@@ -0,0 +1,185 @@
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+#include "Field/Struct/CSWAutoSaveStruct.h"
+
+
+#pragma region RECORD VERSION
+
+void FCSWRecordVersion::SaveHeader(FArchive& Ar)
+{
+	uint32 Magic = CSW_NATIVE_RECORD_MAGIC;
+	int32 Version = LatestVersion;
+	Ar << Magic << Version;
+}
+
+bool FCSWRecordVersion::LoadHeader(FArchive& Ar, int32& OutVersion)
+{
+	const int64 RecordPos = Ar.Tell();
+	uint32 Magic = 0;
+	Ar << Magic;
+	if (Magic != CSW_NATIVE_RECORD_MAGIC)
+	{
+		///A tagged record, the tagged properties read it from the start
+		Ar.Seek(RecordPos);
+		return false;
+	}
+	Ar << OutVersion;
+	if (OutVersion < InitialVersion || OutVersion > LatestVersion)
+	{
+		UE_LOG(LogTemp, Error, TEXT("CSWError: The record was saved with a newer version of the plugin (record version %d)."), OutVersion);
+		Ar.SetError();
+	}
+	return true;
+}
+
+/** Read or write the header of the outermost record. False if the record is tagged, the version of the record otherwise */
+static bool SerializeRecordHeader(FArchive& Ar, int32& OutVersion)
+{
+	OutVersion = FCSWRecordVersion::LatestVersion;
+	if (Ar.IsLoading())
+	{
+		return FCSWRecordVersion::LoadHeader(Ar, OutVersion);
+	}
+	FCSWRecordVersion::SaveHeader(Ar);
+	return true;
+}
+
+#pragma endregion
+
+
+#pragma region NATIVE SERIALIZERS
+
+bool FCSWActorComponentRecord::Serialize(FArchive& Ar)
+{
+	int32 Version;
+	if (!SerializeRecordHeader(Ar, Version)) return false;
+	if (!Ar.IsError())
+	{
+		SerializeRecord(Ar, Version, true);
+	}
+	return true;
+}
+
+void FCSWActorComponentRecord::SerializeRecord(FArchive& Ar, const int32 Version, const bool bWithPose)
+{
+	Ar << Name;
+	///TArray<uint8> is read and written with a single Serialize() call
+	Ar << Data;
+	if (!bWithPose) return;
+
+	Ar << Fields;
+	if (HasField(ECSWComponentRecordField::Location))
+	{
+		Ar << Loc;
+	}
+	if (HasField(ECSWComponentRecordField::Rotation))
+	{
+		Ar << Rot;
+	}
+	if (HasField(ECSWComponentRecordField::Scale))
+	{
+		Ar << Scale;
+	}
+	if (HasField(ECSWComponentRecordField::LinearVelocity))
+	{
+		Ar << LinearVel;
+	}
+	if (HasField(ECSWComponentRecordField::AngularVelocity))
+	{
+		Ar << AngularVel;
+	}
+}
+
+static uint64 LastChangeStamp = 0;
+
+uint64 FCSWActorRecord::NewChangeStamp()
+{
+	return ++LastChangeStamp;
+}
+
+uint64 FCSWActorRecord::GetLastChangeStamp()
+{
+	return LastChangeStamp;
+}
+
+bool FCSWActorRecord::Serialize(FArchive& Ar)
+{
+	int32 Version;
+	if (!SerializeRecordHeader(Ar, Version)) return false;
+	if (!Ar.IsError())
+	{
+		SerializeRecord(Ar, Version, true);
+	}
+	return true;
+}
+
+void FCSWActorRecord::SerializeRecord(FArchive& Ar, const int32 Version, const bool bWithPose)
+{
+	if (Ar.IsLoading())
+	{
+		///What was loaded wasn't filled from the Actor
+		ChangeStamp = 0;
+	}
+	Ar << Name;
+	UObject* ClassObject = Class;
+	Ar << ClassObject;
+	Class = Cast<UClass>(ClassObject);
+	Ar << bLoadRandomID;
+	Ar << Data;
+	if (bWithPose)
+	{
+		Ar << XForm;
+		uint8 PrecisionValue = static_cast<uint8>(Precision);
+		Ar << PrecisionValue;
+		Precision = PrecisionValue <= static_cast<uint8>(ECSWTransformPrecision::Low) ? static_cast<ECSWTransformPrecision>(PrecisionValue) : ECSWTransformPrecision::Full;
+	}
+
+	int32 NumComponents = ComponentsRecord.Num();
+	Ar << NumComponents;
+	if (Ar.IsLoading())
+	{
+		if (Ar.IsError() || NumComponents < 0)
+		{
+			Ar.SetError();
+			return;
+		}
+		ComponentsRecord.SetNum(NumComponents);
+	}
+	for (FCSWActorComponentRecord& ComponentRecord : ComponentsRecord)
+	{
+		if (Ar.IsError()) return;
+		ComponentRecord.SerializeRecord(Ar, Version, bWithPose);
+	}
+}
+
+bool FCSWMapRecord::Serialize(FArchive& Ar)
+{
+	int32 Version;
+	if (!SerializeRecordHeader(Ar, Version)) return false;
+	if (Ar.IsError()) return true;
+
+	Ar << Name;
+	int32 NumActors = ActorsRecord.Num();
+	Ar << NumActors;
+	if (Ar.IsLoading())
+	{
+		if (Ar.IsError() || NumActors < 0)
+		{
+			Ar.SetError();
+			return true;
+		}
+		ActorsRecord.SetNum(NumActors);
+	}
+	for (FCSWActorRecord& ActorRecord : ActorsRecord)
+	{
+		if (Ar.IsError()) break;
+		ActorRecord.SerializeRecord(Ar, Version, true);
+	}
+	return true;
+}
+
+#pragma endregion
@@ -0,0 +1,124 @@
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+#include "SaveGame/CSWAutoSaveObject.h"
+#include "Serialization/CSWSavePlan.h"
+
+static bool bUseInPlaceUpdates = true;
+
+void UCSWAutoSaveObject::UpdateClassLayouts()
+{
+	FCSWSavePlanCache::Get().CollectLayouts(LevelsRecord, ClassLayouts);
+}
+
+void UCSWAutoSaveObject::RebuildReferenceTable()
+{
+	if (ReferenceTable.Names.Num() == 0 && ReferenceTable.ObjectPaths.Num() == 0) return;
+	FCSWReferenceTable LiveTable;
+	for (FCSWMapRecord& MapRecord : LevelsRecord)
+	{
+		FCSWSavePlanCache::RemapReferences(MapRecord, ReferenceTable, LiveTable);
+	}
+	ReferenceTable = MoveTemp(LiveTable);
+}
+
+void UCSWAutoSaveObject::Serialize(FArchive& Ar)
+{
+	///The save game streaming helpers move the levels record out and update the layouts before, keep them then
+	if (Ar.IsSaving() && Ar.IsPersistent() && LevelsRecord.Num() > 0)
+	{
+		RebuildReferenceTable();
+		UpdateClassLayouts();
+	}
+	if (Ar.IsLoading() && Ar.IsPersistent())
+	{
+		Super::Serialize(Ar);
+		ReferenceTable.OnLoaded();
+		FCSWSavePlanCache::Get().RegisterLayouts(ClassLayouts);
+		return;
+	}
+	Super::Serialize(Ar);
+}
+
+void UCSWAutoSaveObject::SetUseInPlaceUpdates(const bool bEnable)
+{
+	bUseInPlaceUpdates = bEnable;
+}
+
+bool UCSWAutoSaveObject::GetUseInPlaceUpdates()
+{
+	return bUseInPlaceUpdates;
+}
+
+void UCSWAutoSaveObject::BeginRecordUpdate(const FName& LevelName)
+{
+	FCSWMapRecord* MapRecord = LevelsRecord.FindByPredicate([&LevelName](const FCSWMapRecord& Record) { return Record.Name == LevelName; });
+	if (!MapRecord)
+	{
+		MapRecord = &LevelsRecord[LevelsRecord.AddDefaulted()];
+		MapRecord->Name = LevelName;
+	}
+	///Reset keeps the memory of the previous update of the level
+	FLevelRecordUpdate& Update = LevelRecordUpdates.FindOrAdd(LevelName);
+	const int32 NumActorRecords = MapRecord->ActorsRecord.Num();
+	Update.ActorRecordIndices.Reset();
+	Update.ActorRecordIndices.Reserve(NumActorRecords);
+	for (int32 Index = 0; Index < NumActorRecords; Index++)
+	{
+		Update.ActorRecordIndices.Add(MapRecord->ActorsRecord[Index].Name, Index);
+	}
+	Update.Updated.Reset();
+	Update.Updated.AddZeroed(NumActorRecords);
+	Update.bActive = true;
+}
+
+int32 UCSWAutoSaveObject::FindOrAddUpdatedActorRecord(const int32 LevelRecordIndex, const FName& ActorName, bool& bOutAdded)
+{
+	bOutAdded = false;
+	if (!LevelsRecord.IsValidIndex(LevelRecordIndex)) return INDEX_NONE;
+	FCSWMapRecord& MapRecord = LevelsRecord[LevelRecordIndex];
+	FLevelRecordUpdate* Update = LevelRecordUpdates.Find(MapRecord.Name);
+	if (!Update || !Update->bActive) return INDEX_NONE;
+
+	const int32* FoundIndex = Update->ActorRecordIndices.Find(ActorName);
+	///Actors with the same name as one already updated get their own record, like when the records are rebuilt
+	if (FoundIndex && !Update->Updated[*FoundIndex])
+	{
+		Update->Updated[*FoundIndex] = true;
+		return *FoundIndex;
+	}
+	const int32 Index = MapRecord.ActorsRecord.AddDefaulted();
+	Update->Updated.Add(true);
+	if (!FoundIndex)
+	{
+		Update->ActorRecordIndices.Add(ActorName, Index);
+	}
+	bOutAdded = true;
+	return Index;
+}
+
+void UCSWAutoSaveObject::EndRecordUpdates()
+{
+	for (FCSWMapRecord& MapRecord : LevelsRecord)
+	{
+		FLevelRecordUpdate* Update = LevelRecordUpdates.Find(MapRecord.Name);
+		if (!Update || !Update->bActive) continue;
+		Update->bActive = false;
+		///Compact the records updated towards the start, their arrays are moved and not reallocated
+		const int32 NumActorRecords = MapRecord.ActorsRecord.Num();
+		int32 NumKept = 0;
+		for (int32 Index = 0; Index < NumActorRecords; Index++)
+		{
+			if (!Update->Updated[Index]) continue;
+			if (NumKept != Index)
+			{
+				MapRecord.ActorsRecord[NumKept] = MoveTemp(MapRecord.ActorsRecord[Index]);
+			}
+			NumKept++;
+		}
+		MapRecord.ActorsRecord.SetNum(NumKept, false);
+	}
+}
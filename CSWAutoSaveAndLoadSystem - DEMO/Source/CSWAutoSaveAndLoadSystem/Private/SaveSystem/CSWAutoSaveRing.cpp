@@ -0,0 +1,81 @@
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+#include "SaveSystem/CSWAutoSaveRing.h"
+#include "SaveSystem/CSWSaveJobScheduler.h"
+#include "SaveSystem/CSWSlotCatalog.h"
+#include "SaveSystem/CSWSaveGameJournal.h"
+
+
+int32 FCSWAutoSaveRing::Enqueue(TUniquePtr<FCSWAutoSaveRingRequest>&& Request, const FCSWOnSaveGameResponse& OnCompleted)
+{
+	if (!Request.IsValid())
+	{
+		FCSWSaveJobScheduler::Get().DispatchToGameThread([OnCompleted]() { OnCompleted.ExecuteIfBound(false); });
+		return INDEX_NONE;
+	}
+	///A newer generation of a ring replaces the one waiting, its slot would be overwritten anyway
+	const FString JobKey = TEXT("Ring:") + FCSWSaveGameJournal::GetSlotKey(Request->RingName, Request->bCompressFile, Request->bUseCustomPath, Request->Path);
+	return FCSWSaveJobScheduler::Get().Enqueue(JobKey, ECSWSaveJobPriority::Normal,
+		[Request = MoveTemp(Request)]() mutable { return WriteRequest(*Request); },
+		[OnCompleted](bool bSuccess) { OnCompleted.ExecuteIfBound(bSuccess); });
+}
+
+
+#pragma region RING SLOTS
+
+FString FCSWAutoSaveRing::GetRingSlotName(const FString& RingName, const int32 Index)
+{
+	return FString::Printf(TEXT("%s_%d"), *RingName, Index);
+}
+
+void FCSWAutoSaveRing::GetRingSlots(TArray<FCSWSlotInfo>& OutSlots, const FString& RingName, const int32 RingSize, const int32 UserIndex, const bool bFilesAreCompressed, const bool bUseCustomPath, const FString& Path)
+{
+	OutSlots.Reset();
+	const int32 NumSlots = FMath::Clamp(RingSize, 1, CSW_AUTOSAVE_RING_MAX_SIZE);
+	for (int32 Index = 0; Index < NumSlots; Index++)
+	{
+		FCSWSlotInfo Slot;
+		if (FCSWSlotCatalog::Get().GetSlot(Slot, GetRingSlotName(RingName, Index), UserIndex, bFilesAreCompressed, bUseCustomPath, Path))
+		{
+			OutSlots.Add(MoveTemp(Slot));
+		}
+	}
+	OutSlots.Sort([](const FCSWSlotInfo& A, const FCSWSlotInfo& B) { return A.SaveTime > B.SaveTime; });
+}
+
+FString FCSWAutoSaveRing::FindOldestRingSlot(const FCSWAutoSaveRingRequest& Request)
+{
+	const int32 NumSlots = FMath::Clamp(Request.RingSize, 1, CSW_AUTOSAVE_RING_MAX_SIZE);
+	FString OldestSlotName;
+	FDateTime OldestSaveTime = FDateTime::MaxValue();
+	for (int32 Index = 0; Index < NumSlots; Index++)
+	{
+		const FString SlotName = GetRingSlotName(Request.RingName, Index);
+		FCSWSlotInfo Slot;
+		///Missing and broken slots are filled first
+		if (!FCSWSlotCatalog::Get().GetSlot(Slot, SlotName, Request.UserIndex, Request.bCompressFile, Request.bUseCustomPath, Request.Path)) return SlotName;
+		if (Slot.SaveTime < OldestSaveTime)
+		{
+			OldestSaveTime = Slot.SaveTime;
+			OldestSlotName = SlotName;
+		}
+	}
+	return OldestSlotName;
+}
+
+bool FCSWAutoSaveRing::WriteRequest(FCSWAutoSaveRingRequest& Request)
+{
+	const FString SlotName = FindOldestRingSlot(Request);
+	const bool bSaved = UCSWAutoSaveBlueprintLibrary::SaveSnapshotToSlot(MoveTemp(Request.Snapshot), SlotName, Request.UserIndex, Request.bCompressFile, Request.bUseCustomPath, Request.Path, Request.Codec);
+	if (!bSaved)
+	{
+		UE_LOG(LogTemp, Error, TEXT("CSWError: Couldn't write the autosave ring slot %s."), *SlotName);
+	}
+	return bSaved;
+}
+
+#pragma endregion
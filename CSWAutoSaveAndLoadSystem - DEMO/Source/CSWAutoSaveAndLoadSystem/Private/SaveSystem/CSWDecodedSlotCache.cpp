@@ -0,0 +1,174 @@
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+#include "SaveSystem/CSWDecodedSlotCache.h"
+#include "Misc/ScopeLock.h"
+
+
+FCSWDecodedSlotCache& FCSWDecodedSlotCache::Get()
+{
+	static FCSWDecodedSlotCache Cache;
+	return Cache;
+}
+
+void FCSWDecodedSlotCache::SetBudget(const int64 BudgetBytes)
+{
+	FScopeLock Lock(&CacheLock);
+	Budget = FMath::Max<int64>(BudgetBytes, 0);
+	EvictToBudget();
+}
+
+bool FCSWDecodedSlotCache::IsEnabled() const
+{
+	FScopeLock Lock(&CacheLock);
+	return Budget > 0;
+}
+
+
+#pragma region CACHE
+
+FCSWSaveGameSnapshotPtr FCSWDecodedSlotCache::Find(const FString& SlotKey, const FGuid& SaveId)
+{
+	FScopeLock Lock(&CacheLock);
+	const FCachedSlot* CachedSlot = Slots.Find(SlotKey);
+	if (!CachedSlot || CachedSlot->SaveId != SaveId) return nullptr;
+	FCSWSaveGameSnapshotPtr Snapshot = CachedSlot->Snapshot;
+	Touch(SlotKey);
+	return Snapshot;
+}
+
+FCSWSaveGameSnapshotPtr FCSWDecodedSlotCache::FindOrDecode(const FString& SlotKey, const FGuid& SaveId, TFunctionRef<FCSWSaveGameSnapshotPtr(FGuid&)> Decode)
+{
+	TSharedFuture<FCSWSaveGameSnapshotPtr> PendingResult;
+	TPromise<FCSWSaveGameSnapshotPtr> Promise;
+	uint32 Serial = 0;
+	{
+		FScopeLock Lock(&CacheLock);
+		FCSWSaveGameSnapshotPtr Snapshot = Find(SlotKey, SaveId);
+		if (Snapshot.IsValid()) return Snapshot;
+		///Somebody else is decoding the slot, wait for it
+		if (const FDecodingSlot* DecodingSlot = DecodingSlots.Find(SlotKey))
+		{
+			PendingResult = DecodingSlot->Result;
+		}
+		else
+		{
+			Serial = NextDecodeSerial++;
+			FDecodingSlot& NewDecodingSlot = DecodingSlots.Add(SlotKey);
+			NewDecodingSlot.Serial = Serial;
+			NewDecodingSlot.Result = Promise.GetFuture().Share();
+		}
+	}
+	if (PendingResult.IsValid()) return PendingResult.Get();
+
+	FGuid DecodedSaveId;
+	const FCSWSaveGameSnapshotPtr Snapshot = Decode(DecodedSaveId);
+	{
+		FScopeLock Lock(&CacheLock);
+		///The slot changed while it was decoded if the decode was invalidated
+		const FDecodingSlot* DecodingSlot = DecodingSlots.Find(SlotKey);
+		if (DecodingSlot && DecodingSlot->Serial == Serial)
+		{
+			DecodingSlots.Remove(SlotKey);
+			///Slots without metadata can't be told apart from a newer generation, they aren't cached
+			if (Snapshot.IsValid() && DecodedSaveId.IsValid())
+			{
+				Add(SlotKey, DecodedSaveId, Snapshot);
+			}
+		}
+	}
+	Promise.SetValue(Snapshot);
+	return Snapshot;
+}
+
+void FCSWDecodedSlotCache::Add(const FString& SlotKey, const FGuid& SaveId, const FCSWSaveGameSnapshotPtr& Snapshot)
+{
+	FScopeLock Lock(&CacheLock);
+	RemoveSlot(SlotKey);
+	if (Budget <= 0 || !Snapshot.IsValid()) return;
+	///A slot bigger than the whole budget would evict everything else and then itself
+	const int64 Size = GetAllocatedSize(*Snapshot);
+	if (Size > Budget) return;
+
+	FCachedSlot& CachedSlot = Slots.Add(SlotKey);
+	CachedSlot.SaveId = SaveId;
+	CachedSlot.Snapshot = Snapshot;
+	CachedSlot.Size = Size;
+	UsageOrder.Add(SlotKey);
+	UsedSize += Size;
+	EvictToBudget();
+}
+
+void FCSWDecodedSlotCache::Invalidate(const FString& SlotKey)
+{
+	FScopeLock Lock(&CacheLock);
+	RemoveSlot(SlotKey);
+	///The loads waiting for a running decode still get its result, it's just not cached
+	DecodingSlots.Remove(SlotKey);
+}
+
+void FCSWDecodedSlotCache::Empty()
+{
+	FScopeLock Lock(&CacheLock);
+	Slots.Empty();
+	UsageOrder.Empty();
+	DecodingSlots.Empty();
+	UsedSize = 0;
+}
+
+void FCSWDecodedSlotCache::Touch(const FString& SlotKey)
+{
+	UsageOrder.RemoveSingle(SlotKey);
+	UsageOrder.Add(SlotKey);
+}
+
+void FCSWDecodedSlotCache::EvictToBudget()
+{
+	while (UsedSize > Budget && UsageOrder.Num() > 0)
+	{
+		const FString LeastRecentlyUsed = UsageOrder[0];
+		RemoveSlot(LeastRecentlyUsed);
+	}
+}
+
+void FCSWDecodedSlotCache::RemoveSlot(const FString& SlotKey)
+{
+	const FCachedSlot* CachedSlot = Slots.Find(SlotKey);
+	if (!CachedSlot) return;
+	UsedSize -= CachedSlot->Size;
+	Slots.Remove(SlotKey);
+	UsageOrder.RemoveSingle(SlotKey);
+}
+
+#pragma endregion
+
+
+int64 FCSWDecodedSlotCache::GetAllocatedSize(const FCSWSaveGameSnapshot& Snapshot)
+{
+	int64 Size = sizeof(FCSWSaveGameSnapshot) + Snapshot.ObjectChunk.GetAllocatedSize() + Snapshot.LevelsRecord.GetAllocatedSize();
+	Size += Snapshot.LevelChunks.GetAllocatedSize() + Snapshot.JournalEntries.GetAllocatedSize();
+	for (const FCSWSaveGameLevelChunk& LevelChunk : Snapshot.LevelChunks)
+	{
+		Size += LevelChunk.Data.GetAllocatedSize();
+	}
+	for (const TArray<uint8>& JournalEntry : Snapshot.JournalEntries)
+	{
+		Size += JournalEntry.GetAllocatedSize();
+	}
+	for (const FCSWMapRecord& MapRecord : Snapshot.LevelsRecord)
+	{
+		Size += MapRecord.ActorsRecord.GetAllocatedSize();
+		for (const FCSWActorRecord& ActorRecord : MapRecord.ActorsRecord)
+		{
+			Size += ActorRecord.Data.GetAllocatedSize() + ActorRecord.ComponentsRecord.GetAllocatedSize();
+			for (const FCSWActorComponentRecord& ComponentRecord : ActorRecord.ComponentsRecord)
+			{
+				Size += ComponentRecord.Data.GetAllocatedSize();
+			}
+		}
+	}
+	return Size;
+}
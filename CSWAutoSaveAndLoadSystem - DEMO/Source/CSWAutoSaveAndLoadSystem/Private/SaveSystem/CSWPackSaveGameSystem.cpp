@@ -0,0 +1,899 @@
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+#include "SaveSystem/CSWPackSaveGameSystem.h"
+#include "HAL/PlatformFilemanager.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/CSWChecksum.h"
+#include "SaveSystem/CSWSaveJobScheduler.h"
+
+/** Size of the buffer of FCSWPackEntryReader */
+#define CSW_PACK_READ_BUFFER_SIZE (64 * 1024)
+
+namespace ECSWPackLogOp
+{
+	enum Type : uint8
+	{
+		/** Add or replace an entry */
+		Put = 0,
+		/** Remove an entry */
+		Remove = 1,
+	};
+}
+
+
+#pragma region PACK ENTRY READER
+
+/** Streams an entry of a pack through a bounded buffer. The entry is pinned, its space isn't reused while the reader exists */
+class FCSWPackEntryReader : public FArchive
+{
+public:
+	FCSWPackEntryReader(const FCSWPackFilePtr& InPack, const FCSWPackEntry& InEntry)
+		: Pack(InPack)
+		, Entry(InEntry)
+	{
+		ArIsLoading = true;
+		ArIsPersistent = true;
+	}
+
+	virtual ~FCSWPackEntryReader()
+	{
+		if (Entry.Size > 0)
+		{
+			Pack->Unpin(Entry.Offset);
+		}
+	}
+
+	virtual void Serialize(void* Data, int64 Num) override
+	{
+		if (Num <= 0 || ArIsError) return;
+		if (Pos + Num > Entry.Size)
+		{
+			ArIsError = true;
+			return;
+		}
+		uint8* Dest = static_cast<uint8*>(Data);
+		/// Whatever the buffer already has
+		if (Pos >= BufferStart && Pos < BufferStart + Buffer.Num())
+		{
+			const int64 Copied = FMath::Min<int64>(Num, BufferStart + Buffer.Num() - Pos);
+			FMemory::Memcpy(Dest, Buffer.GetData() + (Pos - BufferStart), Copied);
+			Pos += Copied;
+			Dest += Copied;
+			Num -= Copied;
+		}
+		if (Num <= 0) return;
+		/// Big reads skip the buffer
+		if (Num >= CSW_PACK_READ_BUFFER_SIZE)
+		{
+			if (!Pack->ReadAt(Entry, Pos, Dest, Num)) ArIsError = true;
+			Pos += Num;
+			return;
+		}
+		BufferStart = Pos;
+		Buffer.SetNumUninitialized(static_cast<int32>(FMath::Min<int64>(CSW_PACK_READ_BUFFER_SIZE, Entry.Size - Pos)), false);
+		if (!Pack->ReadAt(Entry, Pos, Buffer.GetData(), Buffer.Num()))
+		{
+			Buffer.Reset();
+			ArIsError = true;
+			return;
+		}
+		FMemory::Memcpy(Dest, Buffer.GetData(), Num);
+		Pos += Num;
+	}
+
+	virtual int64 Tell() override { return Pos; }
+	virtual int64 TotalSize() override { return Entry.Size; }
+	virtual void Seek(int64 InPos) override
+	{
+		if (InPos < 0 || InPos > Entry.Size)
+		{
+			ArIsError = true;
+			return;
+		}
+		Pos = InPos;
+	}
+	virtual FString GetArchiveName() const override { return TEXT("FCSWPackEntryReader"); }
+
+private:
+	FCSWPackFilePtr Pack;
+	const FCSWPackEntry Entry;
+	int64 Pos = 0;
+	TArray<uint8> Buffer;
+	int64 BufferStart = 0;
+};
+
+#pragma endregion
+
+
+#pragma region PACK FILE
+
+FCSWPackFile::FCSWPackFile(const FString& InPackPath)
+	: PackPath(InPackPath)
+{
+}
+
+FCSWPackFile::~FCSWPackFile()
+{
+	Reset();
+}
+
+void FCSWPackFile::Reset()
+{
+	FileHandle.Reset();
+	FileSize = 0;
+	Header = FCSWPackHeader();
+	HeaderCopy = 0;
+	LogSize = 0;
+	Index.Reset();
+	FreeExtents.Reset();
+	FreeSize = 0;
+	DeferredFrees.Reset();
+	CompactionFrees.Reset();
+}
+
+bool FCSWPackFile::Open()
+{
+	FScopeLock Lock(&PackLock);
+	Reset();
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	/// A crash while compacting can leave the pack as a backup
+	const FString BackupPath = PackPath + CSW_SLOT_BACKUP_SUFFIX;
+	if (!PlatformFile.FileExists(*PackPath) && PlatformFile.FileExists(*BackupPath))
+	{
+		PlatformFile.MoveFile(*PackPath, *BackupPath);
+	}
+	PlatformFile.CreateDirectoryTree(*FPaths::GetPath(PackPath));
+	FileHandle.Reset(PlatformFile.OpenWrite(*PackPath, true, true));
+	if (!FileHandle.IsValid())
+	{
+		UE_LOG(LogTemp, Error, TEXT("CSWError: Couldn't open the pack \"%s\"."), *PackPath);
+		return false;
+	}
+	FileSize = FileHandle->Size();
+
+	/// New pack: an empty index as the first generation
+	if (FileSize == 0)
+	{
+		FileSize = 2 * CSW_PACK_HEADER_COPY_SIZE;
+		HeaderCopy = 1;
+		TMap<FString, FCSWPackEntry> EmptyIndex;
+		if (WriteCheckpoint(EmptyIndex)) return true;
+		UE_LOG(LogTemp, Error, TEXT("CSWError: Couldn't create the pack \"%s\"."), *PackPath);
+		Reset();
+		return false;
+	}
+
+	/// The newest valid copy of the header, the other copy is only used if the newest index is broken
+	FCSWPackHeader Headers[2];
+	const bool bValidHeaders[2] = { ReadHeader(*FileHandle, 0, Headers[0]), ReadHeader(*FileHandle, 1, Headers[1]) };
+	const int32 NewestCopy = (bValidHeaders[1] && (!bValidHeaders[0] || Headers[1].Generation > Headers[0].Generation)) ? 1 : 0;
+	bool bLoaded = false;
+	for (const int32 Copy : { NewestCopy, 1 - NewestCopy })
+	{
+		if (!bValidHeaders[Copy]) continue;
+		const FCSWPackHeader& Candidate = Headers[Copy];
+		if (Candidate.IndexOffset < 2 * CSW_PACK_HEADER_COPY_SIZE || Candidate.IndexSize < 0 || Candidate.IndexOffset + Candidate.IndexSize > FileSize) continue;
+		if (Candidate.LogOffset < 2 * CSW_PACK_HEADER_COPY_SIZE || Candidate.LogCapacity < 0) continue;
+		TArray<uint8> IndexData;
+		IndexData.SetNumUninitialized(static_cast<int32>(Candidate.IndexSize));
+		if (!ReadAtUnlocked(Candidate.IndexOffset, IndexData.GetData(), IndexData.Num())) continue;
+		if (FCSWChecksum::Crc32C(IndexData.GetData(), IndexData.Num()) != Candidate.IndexCrc) continue;
+		FMemoryReader IndexReader(IndexData);
+		SerializeIndex(IndexReader, Index);
+		if (IndexReader.IsError())
+		{
+			Index.Reset();
+			continue;
+		}
+		Header = Candidate;
+		HeaderCopy = Copy;
+		bLoaded = true;
+		break;
+	}
+	if (!bLoaded)
+	{
+		UE_LOG(LogTemp, Error, TEXT("CSWError: The pack \"%s\" is corrupt, it won't be used."), *PackPath);
+		Reset();
+		return false;
+	}
+
+	/// Replay the changes logged since the checkpoint. The log ends at the first record that is cut or belongs to another generation
+	TArray<uint8> LogData;
+	LogData.SetNumUninitialized(static_cast<int32>(FMath::Clamp<int64>(FileSize - Header.LogOffset, 0, Header.LogCapacity)));
+	if (LogData.Num() > 0 && ReadAtUnlocked(Header.LogOffset, LogData.GetData(), LogData.Num()))
+	{
+		FMemoryReader LogReader(LogData);
+		LogReader.ArMaxSerializeSize = CSW_PACK_LOG_CAPACITY;
+		while (LogReader.Tell() < LogData.Num())
+		{
+			const int64 RecordStart = LogReader.Tell();
+			int32 Magic = 0;
+			uint64 Generation = 0;
+			LogReader << Magic << Generation;
+			if (LogReader.IsError() || Magic != CSW_PACK_LOG_RECORD_MAGIC || Generation != Header.Generation) break;
+			uint8 Op = 0;
+			FString Key;
+			FCSWPackEntry Entry;
+			LogReader << Op << Key << Entry;
+			const int64 RecordEnd = LogReader.Tell();
+			uint32 RecordCrc = 0;
+			LogReader << RecordCrc;
+			if (LogReader.IsError() || RecordCrc != FCSWChecksum::Crc32C(LogData.GetData() + RecordStart, RecordEnd - RecordStart)) break;
+			if (Op == ECSWPackLogOp::Put)
+			{
+				Index.Add(Key, Entry);
+			}
+			else
+			{
+				Index.Remove(Key);
+			}
+			LogSize = LogReader.Tell();
+		}
+	}
+	/// The log may not have been written up to its end yet
+	FileSize = FMath::Max(FileSize, Header.LogOffset + Header.LogCapacity);
+
+	/// Entries pointing outside of the pack can't be read
+	for (auto It = Index.CreateIterator(); It; ++It)
+	{
+		const FCSWPackEntry& Entry = It.Value();
+		if (Entry.Size < 0 || (Entry.Size > 0 && (Entry.Offset < 2 * CSW_PACK_HEADER_COPY_SIZE || Entry.Offset + Entry.Size > FileSize)))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("CSWError: The entry %s of the pack \"%s\" is out of bounds, it was dropped."), *It.Key(), *PackPath);
+			It.RemoveCurrent();
+		}
+	}
+	RebuildFreeExtents();
+	return true;
+}
+
+bool FCSWPackFile::FindEntry(const FString& Key, FCSWPackEntry& OutEntry) const
+{
+	FScopeLock Lock(&PackLock);
+	const FCSWPackEntry* Entry = Index.Find(Key);
+	if (!Entry) return false;
+	OutEntry = *Entry;
+	return true;
+}
+
+void FCSWPackFile::GetEntries(const FString& Suffix, TArray<FString>& OutKeys, TArray<FCSWPackEntry>& OutEntries) const
+{
+	FScopeLock Lock(&PackLock);
+	OutKeys.Reset();
+	OutEntries.Reset();
+	for (const TPair<FString, FCSWPackEntry>& Pair : Index)
+	{
+		if (!Pair.Key.EndsWith(Suffix)) continue;
+		OutKeys.Add(Pair.Key);
+		OutEntries.Add(Pair.Value);
+	}
+}
+
+bool FCSWPackFile::Read(const FString& Key, TArray<uint8>& OutData)
+{
+	FScopeLock Lock(&PackLock);
+	const FCSWPackEntry* Entry = Index.Find(Key);
+	if (!Entry || !FileHandle.IsValid()) return false;
+	OutData.SetNumUninitialized(static_cast<int32>(Entry->Size));
+	if (!ReadAtUnlocked(Entry->Offset, OutData.GetData(), OutData.Num())) return false;
+	if (FCSWChecksum::Crc32C(OutData.GetData(), OutData.Num()) != Entry->Crc)
+	{
+		UE_LOG(LogTemp, Error, TEXT("CSWError: The entry %s of the pack \"%s\" is corrupt (checksum mismatch)."), *Key, *PackPath);
+		return false;
+	}
+	return true;
+}
+
+bool FCSWPackFile::ReadAt(const FCSWPackEntry& Entry, const int64 Position, void* Data, const int64 Num)
+{
+	FScopeLock Lock(&PackLock);
+	if (!FileHandle.IsValid() || Position < 0 || Position + Num > Entry.Size) return false;
+	return ReadAtUnlocked(Entry.Offset + Position, Data, Num);
+}
+
+TUniquePtr<FArchive> FCSWPackFile::CreateEntryReader(const FString& Key)
+{
+	FScopeLock Lock(&PackLock);
+	const FCSWPackEntry* Entry = Index.Find(Key);
+	if (!Entry || !FileHandle.IsValid()) return nullptr;
+	if (Entry->Size > 0)
+	{
+		Pin(Entry->Offset);
+	}
+	return MakeUnique<FCSWPackEntryReader>(AsShared(), *Entry);
+}
+
+bool FCSWPackFile::Write(const FString& Key, const TArray<uint8>& Data)
+{
+	FScopeLock Lock(&PackLock);
+	if (!FileHandle.IsValid()) return false;
+	FCSWPackEntry NewEntry;
+	NewEntry.Size = Data.Num();
+	NewEntry.Offset = Allocate(NewEntry.Size);
+	NewEntry.Crc = FCSWChecksum::Crc32C(Data.GetData(), Data.Num());
+	NewEntry.ModificationTime = FDateTime::UtcNow();
+	/// The data is on disk before the index references it, the previous entry stays valid until then
+	const bool bWritten = WriteAt(NewEntry.Offset, Data.GetData(), Data.Num()) && FCSWFileHandleWriter::FlushToDisk(*FileHandle);
+	if (!bWritten || !CommitChange(Key, &NewEntry))
+	{
+		Free(NewEntry.Offset, NewEntry.Size);
+		UE_LOG(LogTemp, Warning, TEXT("CSWError: Couldn't write the entry %s of the pack \"%s\"."), *Key, *PackPath);
+		return false;
+	}
+	if (const FCSWPackEntry* OldEntry = Index.Find(Key))
+	{
+		Free(OldEntry->Offset, OldEntry->Size);
+	}
+	Index.Add(Key, NewEntry);
+	if (bCompacting)
+	{
+		CompactionChangedKeys.Add(Key);
+	}
+	return true;
+}
+
+bool FCSWPackFile::Remove(const FString& Key)
+{
+	FScopeLock Lock(&PackLock);
+	const FCSWPackEntry* Entry = Index.Find(Key);
+	if (!Entry || !FileHandle.IsValid()) return false;
+	const FCSWPackEntry OldEntry = *Entry;
+	if (!CommitChange(Key, nullptr)) return false;
+	Index.Remove(Key);
+	Free(OldEntry.Offset, OldEntry.Size);
+	if (bCompacting)
+	{
+		CompactionChangedKeys.Add(Key);
+	}
+	return true;
+}
+
+bool FCSWPackFile::NeedsCompaction() const
+{
+	FScopeLock Lock(&PackLock);
+	return FreeSize > FMath::Max<int64>(CSW_PACK_COMPACTION_MIN_FREE_SIZE, FileSize / 2);
+}
+
+bool FCSWPackFile::Compact()
+{
+	/// Snapshot of the live entries. Their space isn't reused until the compaction ends (see Free())
+	TMap<FString, FCSWPackEntry> NewIndex;
+	{
+		FScopeLock Lock(&PackLock);
+		if (!FileHandle.IsValid() || bCompacting || !NeedsCompaction()) return true;
+		/// Streamed entries point into the current pack, try again after the next write
+		if (PinnedOffsets.Num() > 0) return false;
+		NewIndex = Index;
+		bCompacting = true;
+		CompactionChangedKeys.Reset();
+	}
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	const FString TempPath = PackPath + CSW_SLOT_TEMP_SUFFIX;
+	const FString BackupPath = PackPath + CSW_SLOT_BACKUP_SUFFIX;
+	/// Live entries back to back after the headers, copied while the pack is still read and written
+	TUniquePtr<IFileHandle> TempHandle(PlatformFile.OpenWrite(*TempPath));
+	if (!TempHandle.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("CSWError: Couldn't open \"%s\" for writing."), *TempPath);
+	}
+	int64 Offset = 2 * CSW_PACK_HEADER_COPY_SIZE;
+	TArray<uint8> Data;
+	bool bWritten = TempHandle.IsValid();
+	for (TPair<FString, FCSWPackEntry>& Pair : NewIndex)
+	{
+		if (!bWritten) break;
+		bWritten = CopyEntry(*TempHandle, Pair.Value, Offset, Data);
+	}
+
+	FScopeLock Lock(&PackLock);
+	bCompacting = false;
+	/// Entries streamed since the snapshot point into the current pack
+	bWritten = bWritten && FileHandle.IsValid() && PinnedOffsets.Num() == 0;
+	/// The entries written or removed during the copy, then the index and an empty log
+	for (const FString& Key : CompactionChangedKeys)
+	{
+		if (!bWritten) break;
+		const FCSWPackEntry* Entry = Index.Find(Key);
+		if (!Entry)
+		{
+			NewIndex.Remove(Key);
+			continue;
+		}
+		FCSWPackEntry NewEntry = *Entry;
+		bWritten = CopyEntry(*TempHandle, NewEntry, Offset, Data);
+		NewIndex.Add(Key, NewEntry);
+	}
+	CompactionChangedKeys.Reset();
+	if (bWritten)
+	{
+		TArray<uint8> IndexData;
+		FMemoryWriter IndexWriter(IndexData);
+		SerializeIndex(IndexWriter, NewIndex);
+		FCSWPackHeader NewHeader;
+		NewHeader.Generation = Header.Generation + 1;
+		NewHeader.IndexOffset = Offset;
+		NewHeader.IndexSize = IndexData.Num();
+		NewHeader.IndexCrc = FCSWChecksum::Crc32C(IndexData.GetData(), IndexData.Num());
+		NewHeader.LogOffset = Offset + IndexData.Num();
+		NewHeader.LogCapacity = CSW_PACK_LOG_CAPACITY;
+		bWritten = TempHandle->Seek(NewHeader.IndexOffset) && TempHandle->Write(IndexData.GetData(), IndexData.Num());
+		bWritten = bWritten && WriteHeader(*TempHandle, 0, NewHeader);
+		bWritten = bWritten && FCSWFileHandleWriter::FlushToDisk(*TempHandle);
+	}
+	TempHandle.Reset();
+	if (!bWritten)
+	{
+		PlatformFile.DeleteFile(*TempPath);
+		/// The space freed meanwhile can be reused now
+		TArray<FExtent> Frees = MoveTemp(CompactionFrees);
+		for (const FExtent& Extent : Frees)
+		{
+			Free(Extent.Offset, Extent.Size);
+		}
+		UE_LOG(LogTemp, Warning, TEXT("CSWError: Couldn't compact the pack \"%s\"."), *PackPath);
+		return false;
+	}
+
+	/// Swap the packs, keeping the previous one as a backup until the new one is in place
+	FileHandle.Reset();
+	PlatformFile.DeleteFile(*BackupPath);
+	bool bSwapped = PlatformFile.MoveFile(*BackupPath, *PackPath);
+	if (bSwapped && !PlatformFile.MoveFile(*PackPath, *TempPath))
+	{
+		PlatformFile.MoveFile(*PackPath, *BackupPath);
+		bSwapped = false;
+	}
+	PlatformFile.DeleteFile(bSwapped ? *BackupPath : *TempPath);
+	if (!bSwapped)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("CSWError: Couldn't replace the pack \"%s\" with its compacted copy."), *PackPath);
+	}
+	return Open() && bSwapped;
+}
+
+#pragma endregion
+
+
+#pragma region PACK FILE SPACE
+
+int64 FCSWPackFile::Allocate(const int64 Size)
+{
+	if (Size <= 0) return 0;
+	for (int32 ExtentIndex = 0; ExtentIndex < FreeExtents.Num(); ExtentIndex++)
+	{
+		FExtent& Extent = FreeExtents[ExtentIndex];
+		if (Extent.Size < Size) continue;
+		const int64 Offset = Extent.Offset;
+		Extent.Offset += Size;
+		Extent.Size -= Size;
+		if (Extent.Size == 0)
+		{
+			FreeExtents.RemoveAt(ExtentIndex);
+		}
+		FreeSize -= Size;
+		return Offset;
+	}
+	/// Nothing big enough: grow the pack, starting from the free extent at its end if there's one
+	int64 Offset = FileSize;
+	if (FreeExtents.Num() > 0 && FreeExtents.Last().Offset + FreeExtents.Last().Size == FileSize)
+	{
+		Offset = FreeExtents.Last().Offset;
+		FreeSize -= FreeExtents.Last().Size;
+		FreeExtents.Pop(false);
+	}
+	FileSize = Offset + Size;
+	return Offset;
+}
+
+void FCSWPackFile::Free(const int64 Offset, const int64 Size)
+{
+	if (Size <= 0) return;
+	/// The compaction may still be copying an entry from this extent
+	if (bCompacting)
+	{
+		CompactionFrees.Add({ Offset, Size });
+		return;
+	}
+	if (PinnedOffsets.Contains(Offset))
+	{
+		DeferredFrees.Add({ Offset, Size });
+		return;
+	}
+	int32 InsertIndex = 0;
+	while (InsertIndex < FreeExtents.Num() && FreeExtents[InsertIndex].Offset < Offset)
+	{
+		InsertIndex++;
+	}
+	FreeExtents.Insert({ Offset, Size }, InsertIndex);
+	FreeSize += Size;
+	/// Merge with the next extent, then with the previous one
+	if (InsertIndex + 1 < FreeExtents.Num() && Offset + Size == FreeExtents[InsertIndex + 1].Offset)
+	{
+		FreeExtents[InsertIndex].Size += FreeExtents[InsertIndex + 1].Size;
+		FreeExtents.RemoveAt(InsertIndex + 1);
+	}
+	if (InsertIndex > 0 && FreeExtents[InsertIndex - 1].Offset + FreeExtents[InsertIndex - 1].Size == Offset)
+	{
+		FreeExtents[InsertIndex - 1].Size += FreeExtents[InsertIndex].Size;
+		FreeExtents.RemoveAt(InsertIndex);
+	}
+}
+
+void FCSWPackFile::Pin(const int64 Offset)
+{
+	FScopeLock Lock(&PackLock);
+	PinnedOffsets.FindOrAdd(Offset)++;
+}
+
+void FCSWPackFile::Unpin(const int64 Offset)
+{
+	FScopeLock Lock(&PackLock);
+	int32* PinCount = PinnedOffsets.Find(Offset);
+	if (!PinCount || --(*PinCount) > 0) return;
+	PinnedOffsets.Remove(Offset);
+	for (int32 FreeIndex = DeferredFrees.Num() - 1; FreeIndex >= 0; FreeIndex--)
+	{
+		if (DeferredFrees[FreeIndex].Offset != Offset) continue;
+		const FExtent Extent = DeferredFrees[FreeIndex];
+		DeferredFrees.RemoveAtSwap(FreeIndex);
+		Free(Extent.Offset, Extent.Size);
+	}
+}
+
+void FCSWPackFile::RebuildFreeExtents()
+{
+	TArray<FExtent> UsedExtents;
+	UsedExtents.Reserve(Index.Num() + 3);
+	UsedExtents.Add({ 0, 2 * CSW_PACK_HEADER_COPY_SIZE });
+	UsedExtents.Add({ Header.IndexOffset, Header.IndexSize });
+	UsedExtents.Add({ Header.LogOffset, Header.LogCapacity });
+	for (const TPair<FString, FCSWPackEntry>& Pair : Index)
+	{
+		if (Pair.Value.Size > 0)
+		{
+			UsedExtents.Add({ Pair.Value.Offset, Pair.Value.Size });
+		}
+	}
+	UsedExtents.Sort([](const FExtent& A, const FExtent& B) { return A.Offset < B.Offset; });
+
+	FreeExtents.Reset();
+	FreeSize = 0;
+	int64 Cursor = 0;
+	for (const FExtent& Extent : UsedExtents)
+	{
+		if (Extent.Offset > Cursor)
+		{
+			FreeExtents.Add({ Cursor, Extent.Offset - Cursor });
+			FreeSize += Extent.Offset - Cursor;
+		}
+		Cursor = FMath::Max(Cursor, Extent.Offset + Extent.Size);
+	}
+	if (FileSize > Cursor)
+	{
+		FreeExtents.Add({ Cursor, FileSize - Cursor });
+		FreeSize += FileSize - Cursor;
+	}
+}
+
+#pragma endregion
+
+
+#pragma region PACK FILE INDEX
+
+bool FCSWPackFile::WriteAt(const int64 Offset, const void* Data, const int64 Num)
+{
+	if (Num <= 0) return true;
+	return FileHandle->Seek(Offset) && FileHandle->Write(static_cast<const uint8*>(Data), Num);
+}
+
+bool FCSWPackFile::ReadAtUnlocked(const int64 Offset, void* Data, const int64 Num)
+{
+	if (Num <= 0) return true;
+	return FileHandle->Seek(Offset) && FileHandle->Read(static_cast<uint8*>(Data), Num);
+}
+
+bool FCSWPackFile::CopyEntry(IFileHandle& TargetHandle, FCSWPackEntry& InOutEntry, int64& InOutOffset, TArray<uint8>& Buffer)
+{
+	Buffer.SetNumUninitialized(static_cast<int32>(InOutEntry.Size), false);
+	{
+		FScopeLock Lock(&PackLock);
+		if (!FileHandle.IsValid() || !ReadAtUnlocked(InOutEntry.Offset, Buffer.GetData(), Buffer.Num())) return false;
+	}
+	InOutEntry.Offset = InOutOffset;
+	InOutOffset += InOutEntry.Size;
+	return TargetHandle.Seek(InOutEntry.Offset) && TargetHandle.Write(Buffer.GetData(), Buffer.Num());
+}
+
+bool FCSWPackFile::CommitChange(const FString& Key, const FCSWPackEntry* NewEntry)
+{
+	TArray<uint8> Record;
+	FMemoryWriter RecordWriter(Record);
+	int32 Magic = CSW_PACK_LOG_RECORD_MAGIC;
+	uint64 Generation = Header.Generation;
+	uint8 Op = NewEntry ? ECSWPackLogOp::Put : ECSWPackLogOp::Remove;
+	FString RecordKey = Key;
+	FCSWPackEntry RecordEntry = NewEntry ? *NewEntry : FCSWPackEntry();
+	RecordWriter << Magic << Generation << Op << RecordKey << RecordEntry;
+	uint32 RecordCrc = FCSWChecksum::Crc32C(Record.GetData(), Record.Num());
+	RecordWriter << RecordCrc;
+
+	if (LogSize + Record.Num() <= Header.LogCapacity)
+	{
+		/// A record cut by a crash fails its CRC, the change is lost but the index stays consistent
+		const bool bWritten = WriteAt(Header.LogOffset + LogSize, Record.GetData(), Record.Num()) && FCSWFileHandleWriter::FlushToDisk(*FileHandle);
+		if (!bWritten) return false;
+		LogSize += Record.Num();
+		return true;
+	}
+
+	///The log is full, fold it and the change into a new checkpoint
+	TMap<FString, FCSWPackEntry> NewIndex = Index;
+	if (NewEntry)
+	{
+		NewIndex.Add(Key, *NewEntry);
+	}
+	else
+	{
+		NewIndex.Remove(Key);
+	}
+	return WriteCheckpoint(NewIndex);
+}
+
+bool FCSWPackFile::WriteCheckpoint(TMap<FString, FCSWPackEntry>& NewIndex)
+{
+	TArray<uint8> IndexData;
+	FMemoryWriter IndexWriter(IndexData);
+	SerializeIndex(IndexWriter, NewIndex);
+
+	FCSWPackHeader NewHeader;
+	NewHeader.Generation = Header.Generation + 1;
+	NewHeader.IndexSize = IndexData.Num();
+	NewHeader.IndexCrc = FCSWChecksum::Crc32C(IndexData.GetData(), IndexData.Num());
+	NewHeader.IndexOffset = Allocate(NewHeader.IndexSize);
+	/// The old content of the log space is ignored, its records belong to other generations
+	NewHeader.LogCapacity = CSW_PACK_LOG_CAPACITY;
+	NewHeader.LogOffset = Allocate(NewHeader.LogCapacity);
+
+	/// The index is on disk before the header points at it. The other copy of the header keeps the previous generation until then
+	const int32 NewHeaderCopy = 1 - HeaderCopy;
+	bool bWritten = WriteAt(NewHeader.IndexOffset, IndexData.GetData(), IndexData.Num()) && FCSWFileHandleWriter::FlushToDisk(*FileHandle);
+	bWritten = bWritten && WriteHeader(*FileHandle, NewHeaderCopy, NewHeader);
+	bWritten = bWritten && FCSWFileHandleWriter::FlushToDisk(*FileHandle);
+	if (!bWritten)
+	{
+		Free(NewHeader.IndexOffset, NewHeader.IndexSize);
+		Free(NewHeader.LogOffset, NewHeader.LogCapacity);
+		return false;
+	}
+	Free(Header.IndexOffset, Header.IndexSize);
+	Free(Header.LogOffset, Header.LogCapacity);
+	Header = NewHeader;
+	HeaderCopy = NewHeaderCopy;
+	LogSize = 0;
+	Index = MoveTemp(NewIndex);
+	return true;
+}
+
+void FCSWPackFile::SerializeIndex(FArchive& Ar, TMap<FString, FCSWPackEntry>& InOutIndex)
+{
+	int32 NumEntries = InOutIndex.Num();
+	Ar << NumEntries;
+	if (Ar.IsSaving())
+	{
+		for (TPair<FString, FCSWPackEntry>& Pair : InOutIndex)
+		{
+			Ar << Pair.Key << Pair.Value;
+		}
+		return;
+	}
+	if (Ar.IsError() || NumEntries < 0) return;
+	InOutIndex.Reset();
+	InOutIndex.Reserve(NumEntries);
+	for (int32 EntryIndex = 0; EntryIndex < NumEntries && !Ar.IsError(); EntryIndex++)
+	{
+		FString Key;
+		FCSWPackEntry Entry;
+		Ar << Key << Entry;
+		InOutIndex.Add(MoveTemp(Key), Entry);
+	}
+}
+
+bool FCSWPackFile::WriteHeader(IFileHandle& Handle, const int32 Copy, FCSWPackHeader& InHeader)
+{
+	TArray<uint8> HeaderData;
+	FMemoryWriter HeaderWriter(HeaderData);
+	HeaderWriter << InHeader;
+	uint32 HeaderCrc = FCSWChecksum::Crc32C(HeaderData.GetData(), HeaderData.Num());
+	HeaderWriter << HeaderCrc;
+	check(HeaderData.Num() <= CSW_PACK_HEADER_COPY_SIZE);
+	return Handle.Seek(Copy * CSW_PACK_HEADER_COPY_SIZE) && Handle.Write(HeaderData.GetData(), HeaderData.Num());
+}
+
+bool FCSWPackFile::ReadHeader(IFileHandle& Handle, const int32 Copy, FCSWPackHeader& OutHeader)
+{
+	TArray<uint8> HeaderData;
+	HeaderData.SetNumUninitialized(CSW_PACK_HEADER_COPY_SIZE);
+	if (Handle.Size() < (Copy + 1) * CSW_PACK_HEADER_COPY_SIZE) return false;
+	if (!Handle.Seek(Copy * CSW_PACK_HEADER_COPY_SIZE) || !Handle.Read(HeaderData.GetData(), HeaderData.Num())) return false;
+	FMemoryReader HeaderReader(HeaderData);
+	HeaderReader << OutHeader;
+	const int64 HeaderSize = HeaderReader.Tell();
+	uint32 HeaderCrc = 0;
+	HeaderReader << HeaderCrc;
+	return !HeaderReader.IsError() && OutHeader.Magic == CSW_PACK_HEADER_MAGIC && HeaderCrc == FCSWChecksum::Crc32C(HeaderData.GetData(), HeaderSize);
+}
+
+#pragma endregion
+
+
+#pragma region PACK SAVE GAME SYSTEM
+
+FCSWPackFilePtr FCSWPackSaveGameSystem::GetPack(const bool bUseCustomPath, const TCHAR* FilePath)
+{
+	const FString Directory = bUseCustomPath ? FString(FilePath) : FPaths::ProjectSavedDir() + TEXT("SaveGames/");
+	FScopeLock Lock(&PacksLock);
+	if (const FCSWPackFilePtr* Pack = Packs.Find(Directory)) return *Pack;
+	/// The directory is only checked when its pack is opened
+	if (bUseCustomPath && !FPaths::DirectoryExists(Directory))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("CSWError: Directory \"%s\" doesn't exists."), *Directory);
+		return nullptr;
+	}
+	FCSWPackFilePtr Pack = MakeShared<FCSWPackFile, ESPMode::ThreadSafe>(Directory + CSW_PACK_FILE_NAME);
+	if (!Pack->Open()) return nullptr;
+	Packs.Add(Directory, Pack);
+	return Pack;
+}
+
+FString FCSWPackSaveGameSystem::GetSlotKey(const bool bCompressFile, const TCHAR* FileName)
+{
+	return FString(FileName) + (bCompressFile ? TEXT(".csav") : TEXT(".sav"));
+}
+
+void FCSWPackSaveGameSystem::ScheduleCompaction(const FCSWPackFilePtr& Pack)
+{
+	if (!Pack->NeedsCompaction()) return;
+	///A compaction already queued for the pack is reused
+	FCSWSaveJobScheduler::Get().Enqueue(TEXT("Pack:") + Pack->GetPackPath(), ECSWSaveJobPriority::Low, [Pack]() { return Pack->Compact(); });
+}
+
+void FCSWPackSaveGameSystem::ClosePacks()
+{
+	FScopeLock Lock(&PacksLock);
+	Packs.Empty();
+}
+
+bool FCSWPackSaveGameSystem::DoesSaveGameExist(const bool bUseCustomPath, const bool bCompressFile, const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex)
+{
+	return ESaveExistsResult::OK == DoesSaveGameExistWithResult(bUseCustomPath, bCompressFile, FilePath, FileName, UserIndex);
+}
+
+ICSWSaveGameSystem::ESaveExistsResult FCSWPackSaveGameSystem::DoesSaveGameExistWithResult(const bool bUseCustomPath, const bool bCompressFile, const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex)
+{
+	FCSWPackFilePtr Pack = GetPack(bUseCustomPath, FilePath);
+	FCSWPackEntry Entry;
+	if (!Pack.IsValid() || !Pack->FindEntry(GetSlotKey(bCompressFile, FileName), Entry)) return ESaveExistsResult::DoesNotExist;
+	return ESaveExistsResult::OK;
+}
+
+bool FCSWPackSaveGameSystem::SaveGame(bool bAttemptToUseUI, const bool bUseCustomPath, const bool bCompressFile, const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex, const TArray<uint8>& Data)
+{
+	FCSWPackFilePtr Pack = GetPack(bUseCustomPath, FilePath);
+	if (!Pack.IsValid()) return false;
+	const bool bSaved = Pack->Write(GetSlotKey(bCompressFile, FileName), Data);
+	ScheduleCompaction(Pack);
+	return bSaved;
+}
+
+bool FCSWPackSaveGameSystem::LoadGame(bool bAttemptToUseUI, const bool bUseCustomPath, const bool bCompressFile, const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex, TArray<uint8>& Data)
+{
+	FCSWPackFilePtr Pack = GetPack(bUseCustomPath, FilePath);
+	return Pack.IsValid() && Pack->Read(GetSlotKey(bCompressFile, FileName), Data);
+}
+
+bool FCSWPackSaveGameSystem::LoadGameStreamed(bool bAttemptToUseUI, const bool bUseCustomPath, const bool bCompressFile, const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex, TFunctionRef<bool(FArchive&)> ReadData)
+{
+	FCSWPackFilePtr Pack = GetPack(bUseCustomPath, FilePath);
+	if (!Pack.IsValid()) return false;
+	///Only what ReadData asks for is read, the catalog only reads the header and the table of contents of each slot
+	TUniquePtr<FArchive> EntryReader = Pack->CreateEntryReader(GetSlotKey(bCompressFile, FileName));
+	if (!EntryReader.IsValid()) return false;
+	return ReadData(*EntryReader) && !EntryReader->IsError();
+}
+
+bool FCSWPackSaveGameSystem::DeleteGame(bool bAttemptToUseUI, const bool bUseCustomPath, const bool bCompressFile, const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex)
+{
+	FCSWPackFilePtr Pack = GetPack(bUseCustomPath, FilePath);
+	if (!Pack.IsValid()) return false;
+	const FString SlotKey = GetSlotKey(bCompressFile, FileName);
+	const bool bDeleted = Pack->Remove(SlotKey);
+	Pack->Remove(SlotKey + CSW_SLOT_JOURNAL_SUFFIX);
+	ScheduleCompaction(Pack);
+	return bDeleted;
+}
+
+bool FCSWPackSaveGameSystem::WriteSaveGameJournal(const bool bAppend, const bool bUseCustomPath, const bool bCompressFile, const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex, TFunctionRef<bool(FArchive&)> WriteData)
+{
+	FCSWPackFilePtr Pack = GetPack(bUseCustomPath, FilePath);
+	if (!Pack.IsValid()) return false;
+	const FString JournalKey = GetSlotKey(bCompressFile, FileName) + CSW_SLOT_JOURNAL_SUFFIX;
+	///Appending rewrites the journal as a new entry, journals are folded into their slot before they get big
+	TArray<uint8> Journal;
+	FCSWPackEntry Entry;
+	if (bAppend && Pack->FindEntry(JournalKey, Entry) && !Pack->Read(JournalKey, Journal)) return false;
+	FMemoryWriter JournalWriter(Journal, true, true);
+	if (!WriteData(JournalWriter)) return false;
+	const bool bWritten = Pack->Write(JournalKey, Journal);
+	ScheduleCompaction(Pack);
+	return bWritten;
+}
+
+bool FCSWPackSaveGameSystem::LoadSaveGameJournal(const bool bUseCustomPath, const bool bCompressFile, const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex, TFunctionRef<bool(FArchive&)> ReadData)
+{
+	FCSWPackFilePtr Pack = GetPack(bUseCustomPath, FilePath);
+	if (!Pack.IsValid()) return false;
+	TUniquePtr<FArchive> EntryReader = Pack->CreateEntryReader(GetSlotKey(bCompressFile, FileName) + CSW_SLOT_JOURNAL_SUFFIX);
+	return EntryReader.IsValid() && ReadData(*EntryReader);
+}
+
+bool FCSWPackSaveGameSystem::DeleteSaveGameJournal(const bool bUseCustomPath, const bool bCompressFile, const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex)
+{
+	FCSWPackFilePtr Pack = GetPack(bUseCustomPath, FilePath);
+	return Pack.IsValid() && Pack->Remove(GetSlotKey(bCompressFile, FileName) + CSW_SLOT_JOURNAL_SUFFIX);
+}
+
+bool FCSWPackSaveGameSystem::SaveGameVersions(const bool bUseCustomPath, const TCHAR* FilePath, const int32 UserIndex, const TCHAR* FileName, const TArray<uint8>& Data)
+{
+	///The file name is the key, its extension keeps it out of the slot listings
+	FCSWPackFilePtr Pack = GetPack(bUseCustomPath, FilePath);
+	return Pack.IsValid() && Pack->Write(FileName, Data);
+}
+
+bool FCSWPackSaveGameSystem::LoadGameVersions(const bool bUseCustomPath, const TCHAR* FilePath, const int32 UserIndex, const TCHAR* FileName, TArray<uint8>& OutData)
+{
+	FCSWPackFilePtr Pack = GetPack(bUseCustomPath, FilePath);
+	FCSWPackEntry Entry;
+	return Pack.IsValid() && Pack->FindEntry(FileName, Entry) && Pack->Read(FileName, OutData);
+}
+
+bool FCSWPackSaveGameSystem::GetSaveGames(const bool bUseCustomPath, const bool bCompressFile, const TCHAR* FilePath, TArray<FString>& OutSlotNames, TArray<FFileStatData>& OutStatData)
+{
+	OutSlotNames.Reset();
+	OutStatData.Reset();
+	FCSWPackFilePtr Pack = GetPack(bUseCustomPath, FilePath);
+	///A directory without a pack has no slots
+	if (!Pack.IsValid()) return true;
+	const FString Extension = bCompressFile ? TEXT(".csav") : TEXT(".sav");
+	TArray<FCSWPackEntry> Entries;
+	Pack->GetEntries(Extension, OutSlotNames, Entries);
+	OutStatData.Reserve(Entries.Num());
+	for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); EntryIndex++)
+	{
+		OutSlotNames[EntryIndex].RemoveFromEnd(Extension);
+		const FCSWPackEntry& Entry = Entries[EntryIndex];
+		OutStatData.Add(FFileStatData(Entry.ModificationTime, Entry.ModificationTime, Entry.ModificationTime, Entry.Size, false, false));
+	}
+	return true;
+}
+
+bool FCSWPackSaveGameSystem::GetSaveGameStatData(const bool bUseCustomPath, const bool bCompressFile, const TCHAR* FilePath, const TCHAR* FileName, FFileStatData& OutStatData)
+{
+	OutStatData = FFileStatData();
+	FCSWPackFilePtr Pack = GetPack(bUseCustomPath, FilePath);
+	FCSWPackEntry Entry;
+	if (Pack.IsValid() && Pack->FindEntry(GetSlotKey(bCompressFile, FileName), Entry))
+	{
+		OutStatData = FFileStatData(Entry.ModificationTime, Entry.ModificationTime, Entry.ModificationTime, Entry.Size, false, false);
+	}
+	return true;
+}
+
+#pragma endregion
@@ -0,0 +1,217 @@
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+#include "SaveSystem/CSWPoseBatch.h"
+#include "GameFramework/Actor.h"
+#include "Components/SceneComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "Field/Struct/CSWAutoSaveStruct.h"
+
+
+#pragma region SOA VECTORS
+
+void FCSWSoAVectors::Reset()
+{
+	X.Reset();
+	Y.Reset();
+	Z.Reset();
+	W.Reset();
+}
+
+void FCSWSoAVectors::Pack(const TArray<VectorRegister>& Registers)
+{
+	///The registers are padded to a multiple of 4 by the caller
+	const int32 Num = Registers.Num();
+	check(Num % 4 == 0);
+	X.SetNumUninitialized(Num, false);
+	Y.SetNumUninitialized(Num, false);
+	Z.SetNumUninitialized(Num, false);
+	W.SetNumUninitialized(Num, false);
+	for (int32 Index = 0; Index < Num; Index += 4)
+	{
+		///4x4 transpose: from four elements (x, y, z, w) to four X, four Y, four Z and four W
+		const VectorRegister& A = Registers[Index];
+		const VectorRegister& B = Registers[Index + 1];
+		const VectorRegister& C = Registers[Index + 2];
+		const VectorRegister& D = Registers[Index + 3];
+		const VectorRegister AB_XY = VectorShuffle(A, B, 0, 1, 0, 1);
+		const VectorRegister CD_XY = VectorShuffle(C, D, 0, 1, 0, 1);
+		const VectorRegister AB_ZW = VectorShuffle(A, B, 2, 3, 2, 3);
+		const VectorRegister CD_ZW = VectorShuffle(C, D, 2, 3, 2, 3);
+		VectorStoreAligned(VectorShuffle(AB_XY, CD_XY, 0, 2, 0, 2), &X[Index]);
+		VectorStoreAligned(VectorShuffle(AB_XY, CD_XY, 1, 3, 1, 3), &Y[Index]);
+		VectorStoreAligned(VectorShuffle(AB_ZW, CD_ZW, 0, 2, 0, 2), &Z[Index]);
+		VectorStoreAligned(VectorShuffle(AB_ZW, CD_ZW, 1, 3, 1, 3), &W[Index]);
+	}
+}
+
+#pragma endregion
+
+
+#pragma region POSE BATCH
+
+/** Size of the staging buffer for Num elements */
+static int32 PaddedNum(const int32 Num)
+{
+	return Align(Num, 4);
+}
+
+bool FCSWPoseBatch::AddActor(AActor* Actor, FTransform* Target)
+{
+	USceneComponent* Root = Actor ? Actor->GetRootComponent() : nullptr;
+	if (!Root || !Target) return false;
+	ActorRoots.Add(Root);
+	ActorTargets.Add(Target);
+	return true;
+}
+
+bool FCSWPoseBatch::AddComponent(UActorComponent* Component, FCSWActorComponentRecord* Target)
+{
+	USceneComponent* SceneComponent = Cast<USceneComponent>(Component);
+	if (!SceneComponent || !Target) return false;
+	SceneComponents.Add(SceneComponent);
+	PrimitiveComponents.Add(Cast<UPrimitiveComponent>(SceneComponent));
+	ComponentTargets.Add(Target);
+	ComponentFields.Add(Target->Fields);
+	return true;
+}
+
+void FCSWPoseBatch::Capture()
+{
+	///Actors: a loop per channel, each one touching a single field of every root component
+	const int32 NumActors = ActorRoots.Num();
+	Staging.SetNumZeroed(PaddedNum(NumActors), false);
+	for (int32 Index = 0; Index < NumActors; Index++)
+	{
+		const FVector Location = ActorRoots[Index]->GetComponentLocation();
+		Staging[Index] = VectorLoadFloat3_W0(&Location);
+	}
+	ActorLocations.Pack(Staging);
+	for (int32 Index = 0; Index < NumActors; Index++)
+	{
+		const FQuat Rotation = ActorRoots[Index]->GetComponentQuat();
+		Staging[Index] = VectorLoadAligned(&Rotation);
+	}
+	ActorRotations.Pack(Staging);
+	for (int32 Index = 0; Index < NumActors; Index++)
+	{
+		const FVector Scale = ActorRoots[Index]->GetComponentScale();
+		Staging[Index] = VectorLoadFloat3_W0(&Scale);
+	}
+	ActorScales.Pack(Staging);
+
+	///Components
+	const int32 NumComponents = SceneComponents.Num();
+	Staging.SetNumZeroed(PaddedNum(NumComponents), false);
+	for (int32 Index = 0; Index < NumComponents; Index++)
+	{
+		Staging[Index] = VectorLoadFloat3_W0(&SceneComponents[Index]->RelativeLocation);
+	}
+	ComponentLocations.Pack(Staging);
+	for (int32 Index = 0; Index < NumComponents; Index++)
+	{
+		Staging[Index] = VectorLoadFloat3_W0(&SceneComponents[Index]->RelativeRotation.Pitch);
+	}
+	ComponentRotations.Pack(Staging);
+	for (int32 Index = 0; Index < NumComponents; Index++)
+	{
+		Staging[Index] = VectorLoadFloat3_W0(&SceneComponents[Index]->RelativeScale3D);
+	}
+	ComponentScales.Pack(Staging);
+	///Velocities are only asked to the physics of the components that save them
+	const uint8 LinearVelocityField = static_cast<uint8>(ECSWComponentRecordField::LinearVelocity);
+	const uint8 AngularVelocityField = static_cast<uint8>(ECSWComponentRecordField::AngularVelocity);
+	for (int32 Index = 0; Index < NumComponents; Index++)
+	{
+		const FVector Velocity = PrimitiveComponents[Index] && (ComponentFields[Index] & LinearVelocityField) ? PrimitiveComponents[Index]->GetPhysicsLinearVelocity() : FVector::ZeroVector;
+		Staging[Index] = VectorLoadFloat3_W0(&Velocity);
+	}
+	LinearVelocities.Pack(Staging);
+	for (int32 Index = 0; Index < NumComponents; Index++)
+	{
+		const FVector Velocity = PrimitiveComponents[Index] && (ComponentFields[Index] & AngularVelocityField) ? PrimitiveComponents[Index]->GetPhysicsAngularVelocityInDegrees() : FVector::ZeroVector;
+		Staging[Index] = VectorLoadFloat3_W0(&Velocity);
+	}
+	AngularVelocities.Pack(Staging);
+}
+
+void FCSWPoseBatch::Scatter() const
+{
+	const int32 NumActors = ActorTargets.Num();
+	for (int32 Index = 0; Index < NumActors; Index++)
+	{
+		ActorTargets[Index]->SetComponents(ActorRotations.GetQuat(Index), ActorLocations.GetVector(Index), ActorScales.GetVector(Index));
+	}
+	const int32 NumComponents = ComponentTargets.Num();
+	for (int32 Index = 0; Index < NumComponents; Index++)
+	{
+		FCSWActorComponentRecord& Target = *ComponentTargets[Index];
+		const uint8 Fields = ComponentFields[Index];
+		if (Fields & static_cast<uint8>(ECSWComponentRecordField::Location))
+		{
+			Target.Loc = ComponentLocations.GetVector(Index);
+		}
+		if (Fields & static_cast<uint8>(ECSWComponentRecordField::Rotation))
+		{
+			Target.Rot = ComponentRotations.GetRotator(Index);
+		}
+		if (Fields & static_cast<uint8>(ECSWComponentRecordField::Scale))
+		{
+			Target.Scale = ComponentScales.GetVector(Index);
+		}
+		if (Fields & static_cast<uint8>(ECSWComponentRecordField::LinearVelocity))
+		{
+			Target.LinearVel = LinearVelocities.GetVector(Index);
+		}
+		if (Fields & static_cast<uint8>(ECSWComponentRecordField::AngularVelocity))
+		{
+			Target.AngularVel = AngularVelocities.GetVector(Index);
+		}
+	}
+}
+
+void FCSWPoseBatch::Reset()
+{
+	ActorRoots.Reset();
+	ActorTargets.Reset();
+	SceneComponents.Reset();
+	PrimitiveComponents.Reset();
+	ComponentTargets.Reset();
+	ComponentFields.Reset();
+	ActorLocations.Reset();
+	ActorRotations.Reset();
+	ActorScales.Reset();
+	ComponentLocations.Reset();
+	ComponentRotations.Reset();
+	ComponentScales.Reset();
+	LinearVelocities.Reset();
+	AngularVelocities.Reset();
+}
+
+void FCSWPoseBatch::ApplyComponentPose(USceneComponent* SceneComponent, const FCSWActorComponentRecord& ComponentRecord, const bool bLocation, const bool bRotation, const bool bScale)
+{
+	const FVector Location = bLocation ? ComponentRecord.Loc : SceneComponent->RelativeLocation;
+	const FRotator Rotation = bRotation ? ComponentRecord.Rot : SceneComponent->RelativeRotation;
+	const bool bMove = !Location.Equals(SceneComponent->RelativeLocation, 0.f) || !Rotation.Equals(SceneComponent->RelativeRotation, 0.f);
+	if (bScale)
+	{
+		///The move below updates the transform with the new scale, otherwise it's updated on its own
+		if (bMove)
+		{
+			SceneComponent->RelativeScale3D = ComponentRecord.Scale;
+		}
+		else
+		{
+			SceneComponent->SetRelativeScale3D(ComponentRecord.Scale);
+		}
+	}
+	if (bMove)
+	{
+		SceneComponent->SetRelativeLocationAndRotation(Location, Rotation, false, nullptr, ETeleportType::TeleportPhysics);
+	}
+}
+
+#pragma endregion
@@ -0,0 +1,323 @@
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+#include "SaveSystem/CSWSaveGameContainer.h"
+#include "Serialization/CSWCompressedArchive.h"
+#include "Serialization/CSWChecksum.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "Templates/UniquePtr.h"
+
+
+#pragma region CONTAINER WRITER
+
+FCSWSaveGameContainerWriter::FCSWSaveGameContainerWriter(FArchive& InFileAr, ECSWCompressionCodec CodecID, const FGuid& SaveId /*= FGuid()*/)
+	: FileAr(InFileAr)
+	, HeaderPos(0)
+{
+	Codec = FCSWCompressionCodecRegistry::Get().FindCodecOrDefault(CodecID);
+	if (Codec.IsValid())
+	{
+		Header.Flags |= ECSWSaveGameHeaderFlags::Compressed;
+		Header.Codec = static_cast<uint8>(CodecID);
+		Header.DictionaryId = Codec->GetDictionaryId();
+	}
+	CipherKey = FCSWCipherKeyRegistry::Get().GetSavingKey();
+	if (CipherKey.IsValid())
+	{
+		Header.Flags |= ECSWSaveGameHeaderFlags::Encrypted;
+		Header.KeyId = CipherKey->GetKeyId();
+		FCSWAesGcm::GenerateNonce(Header.Nonce);
+	}
+	Header.Metadata.SaveTime = FDateTime::UtcNow();
+	Header.Metadata.SaveId = SaveId.IsValid() ? SaveId : FGuid::NewGuid();
+}
+
+bool FCSWSaveGameContainerWriter::WriteHeader()
+{
+	HeaderPos = FileAr.Tell();
+	///TocOffset, UncompressedSize, TocCrc and the counts of the metadata are still 0, Finish() patches them
+	return SerializeHeader();
+}
+
+bool FCSWSaveGameContainerWriter::SerializeHeader()
+{
+	TArray<uint8> HeaderBytes;
+	FMemoryWriter HeaderWriter(HeaderBytes);
+	Header.HeaderCrc = 0;
+	HeaderWriter << Header;
+	///The CRC is the last field, it covers everything before it
+	const int32 CoveredSize = HeaderBytes.Num() - sizeof(uint32);
+	Header.HeaderCrc = FCSWChecksum::Crc32C(HeaderBytes.GetData(), CoveredSize);
+	FMemory::Memcpy(HeaderBytes.GetData() + CoveredSize, &Header.HeaderCrc, sizeof(uint32));
+	FileAr.Serialize(HeaderBytes.GetData(), HeaderBytes.Num());
+	return !FileAr.IsError();
+}
+
+bool FCSWSaveGameContainerWriter::WriteObjectChunk(TFunctionRef<bool(FArchive&)> WriteContent)
+{
+	return WriteChunk(Toc.ObjectChunk, 0, WriteContent);
+}
+
+bool FCSWSaveGameContainerWriter::WriteLevelChunk(const FString& LevelName, const int32 NumActors, TFunctionRef<bool(FArchive&)> WriteContent)
+{
+	const int32 EntryIndex = Toc.LevelChunks.AddDefaulted();
+	Toc.LevelChunks[EntryIndex].Name = LevelName;
+	Toc.LevelChunks[EntryIndex].NumActors = NumActors;
+	return WriteChunk(Toc.LevelChunks[EntryIndex], EntryIndex + 1, WriteContent);
+}
+
+bool FCSWSaveGameContainerWriter::WriteChunk(FCSWSaveGameChunkEntry& OutEntry, const uint32 ChunkIndex, TFunctionRef<bool(FArchive&)> WriteContent)
+{
+	OutEntry.Offset = FileAr.Tell();
+	///The CRC is computed on the stored bytes while they are written
+	FCSWArchiveChecksumProxy ChecksumAr(FileAr);
+	///Compressed blocks are encrypted on their way to the file, in segments with a tag each
+	TUniquePtr<FCSWArchiveEncryptProxy> EncryptAr;
+	if (CipherKey.IsValid())
+	{
+		uint8 Nonce[CSW_CIPHER_NONCE_SIZE];
+		FCSWAesGcm::MakeChunkNonce(Header.Nonce, ChunkIndex, Nonce);
+		EncryptAr = MakeUnique<FCSWArchiveEncryptProxy>(ChecksumAr, *CipherKey, Nonce, OutEntry.Name);
+	}
+	FArchive& StoredAr = EncryptAr.IsValid() ? static_cast<FArchive&>(*EncryptAr) : static_cast<FArchive&>(ChecksumAr);
+	bool bWritten;
+	if (Codec.IsValid())
+	{
+		///Each chunk is its own block stream, so it can be decompressed without the others
+		FCSWArchiveSaveCompressedStream Compressor(StoredAr, Codec.ToSharedRef());
+		bWritten = WriteContent(Compressor);
+		bWritten = Compressor.Close() && bWritten;
+		Header.UncompressedSize += Compressor.Tell();
+	}
+	else
+	{
+		bWritten = WriteContent(StoredAr);
+	}
+	if (EncryptAr.IsValid())
+	{
+		EncryptAr->Finish(OutEntry.Tag);
+	}
+	OutEntry.Crc = ChecksumAr.GetCrc();
+	OutEntry.Size = FileAr.Tell() - OutEntry.Offset;
+	if (!Codec.IsValid())
+	{
+		Header.UncompressedSize += OutEntry.Size;
+	}
+	return bWritten && !FileAr.IsError();
+}
+
+bool FCSWSaveGameContainerWriter::Finish()
+{
+	if (FileAr.IsError()) return false;
+	///Table of contents at the end, once every chunk is known
+	Header.TocOffset = FileAr.Tell();
+	Toc.bHasTags = Header.IsEncrypted();
+	TArray<uint8> TocBytes;
+	FMemoryWriter TocWriter(TocBytes);
+	TocWriter << Toc;
+	Header.TocCrc = FCSWChecksum::Crc32C(TocBytes.GetData(), TocBytes.Num());
+	FileAr.Serialize(TocBytes.GetData(), TocBytes.Num());
+	const int64 EndPos = FileAr.Tell();
+	Header.Metadata.NumLevels = Toc.LevelChunks.Num();
+	Header.Metadata.NumActors = 0;
+	for (const FCSWSaveGameChunkEntry& Entry : Toc.LevelChunks)
+	{
+		Header.Metadata.NumActors += Entry.NumActors;
+	}
+	///Patch the header
+	FileAr.Seek(HeaderPos);
+	SerializeHeader();
+	FileAr.Seek(EndPos);
+	return !FileAr.IsError();
+}
+
+#pragma endregion
+
+
+#pragma region CONTAINER READER
+
+FCSWSaveGameContainerReader::FCSWSaveGameContainerReader(FArchive& InFileAr, const FCSWSaveGameHeader& InHeader)
+	: FileAr(InFileAr)
+	, Header(InHeader)
+{
+	Codec = FCSWCompressionCodecRegistry::Get().FindCodecForLoading(Header.GetCodec(), Header.DictionaryId);
+	if (Header.IsEncrypted())
+	{
+		CipherKey = FCSWCipherKeyRegistry::Get().FindKey(Header.KeyId);
+	}
+}
+
+bool FCSWSaveGameContainerReader::ReadToc()
+{
+	if (Header.GetCodec() != ECSWCompressionCodec::None && !Codec.IsValid())
+	{
+		UE_LOG(LogTemp, Error, TEXT("CSWError: The compression codec %d (dictionary %08X) of the save game isn't registered."), static_cast<int32>(Header.GetCodec()), Header.DictionaryId);
+		return false;
+	}
+	if (Header.IsEncrypted() && !CipherKey.IsValid())
+	{
+		UE_LOG(LogTemp, Error, TEXT("CSWError: The encryption key %u of the save game isn't registered."), Header.KeyId);
+		return false;
+	}
+	return ReadAndValidateToc();
+}
+
+bool FCSWSaveGameContainerReader::ReadAndValidateToc()
+{
+	///The header was just read, the first chunk starts here
+	const int64 ChunksStart = FileAr.Tell();
+	const int64 FileSize = FileAr.TotalSize();
+	if (Header.TocOffset < ChunksStart || Header.TocOffset >= FileSize)
+	{
+		UE_LOG(LogTemp, Error, TEXT("CSWError: Invalid table of contents offset in save game."));
+		return false;
+	}
+	if (!ReadTableOfContents(FileAr, Header, Toc))
+	{
+		UE_LOG(LogTemp, Error, TEXT("CSWError: Couldn't read the table of contents of the save game."));
+		return false;
+	}
+	///Validation: every chunk must be between the header and the table of contents
+	auto IsValidEntry = [ChunksStart, this](const FCSWSaveGameChunkEntry& Entry)
+	{
+		return Entry.Offset >= ChunksStart && Entry.Size > 0 && Entry.Offset + Entry.Size <= Header.TocOffset && Entry.NumActors >= 0;
+	};
+	if (!IsValidEntry(Toc.ObjectChunk) || Toc.LevelChunks.ContainsByPredicate([&IsValidEntry](const FCSWSaveGameChunkEntry& Entry) { return !IsValidEntry(Entry); }))
+	{
+		UE_LOG(LogTemp, Error, TEXT("CSWError: Corrupt table of contents in save game."));
+		return false;
+	}
+	return true;
+}
+
+bool FCSWSaveGameContainerReader::ReadChunk(const FCSWSaveGameChunkEntry& Entry, TFunctionRef<bool(FArchive&)> ReadContent)
+{
+	///The chunk is read as stored and checked against its CRC before anything of it is decoded, a damaged chunk never reaches the decoder or the object
+	if (Entry.Size <= 0 || Entry.Size > MAX_int32) return false;
+	TArray<uint8> StoredBytes;
+	StoredBytes.SetNumUninitialized(static_cast<int32>(Entry.Size));
+	FileAr.Seek(Entry.Offset);
+	FileAr.Serialize(StoredBytes.GetData(), StoredBytes.Num());
+	if (FileAr.IsError() || FCSWChecksum::Crc32C(StoredBytes.GetData(), StoredBytes.Num()) != Entry.Crc)
+	{
+		UE_LOG(LogTemp, Error, TEXT("CSWError: Corrupt chunk in save game (checksum mismatch)."));
+		return false;
+	}
+	FMemoryReader StoredReader(StoredBytes, true);
+	TUniquePtr<FCSWArchiveDecryptProxy> DecryptAr;
+	if (CipherKey.IsValid())
+	{
+		uint8 Nonce[CSW_CIPHER_NONCE_SIZE];
+		if (!GetChunkNonce(Entry, Nonce)) return false;
+		///Each segment is verified before any byte of it is decrypted
+		DecryptAr = MakeUnique<FCSWArchiveDecryptProxy>(StoredReader, *CipherKey, Nonce, Entry.Name, Entry.Size);
+	}
+	FArchive& StoredAr = DecryptAr.IsValid() ? static_cast<FArchive&>(*DecryptAr) : static_cast<FArchive&>(StoredReader);
+	bool bRead;
+	if (Codec.IsValid())
+	{
+		FCSWArchiveLoadCompressedStream Decompressor(StoredAr, Codec.ToSharedRef());
+		bRead = ReadContent(Decompressor) && !Decompressor.IsError();
+	}
+	else
+	{
+		bRead = ReadContent(StoredAr);
+	}
+	///A chunk can't be read past its end, the memory reader fails there
+	return bRead && !StoredAr.IsError() && !StoredReader.IsError();
+}
+
+#pragma endregion
+
+
+#pragma region CHECKSUMS
+
+bool FCSWSaveGameContainerReader::VerifyChunk(const FCSWSaveGameChunkEntry& Entry)
+{
+	FileAr.Seek(Entry.Offset);
+	if (!CipherKey.IsValid())
+	{
+		uint32 Crc = 0;
+		return FCSWChecksum::Crc32C(FileAr, Entry.Size, Crc) && Crc == Entry.Crc;
+	}
+
+	///Encrypted chunk: the tags of the segments are computed in the same read as the CRC, without decrypting anything
+	uint8 Nonce[CSW_CIPHER_NONCE_SIZE];
+	if (!GetChunkNonce(Entry, Nonce) || Entry.Size < 0 || Entry.Size > FileAr.TotalSize() - Entry.Offset) return false;
+	FCSWArchiveChecksumProxy ChecksumAr(FileAr);
+	FCSWArchiveDecryptProxy SegmentsAr(ChecksumAr, *CipherKey, Nonce, Entry.Name, Entry.Size);
+	return SegmentsAr.VerifySegments() && ChecksumAr.ChecksumTo(Entry.Offset + Entry.Size) && ChecksumAr.GetCrc() == Entry.Crc;
+}
+
+bool FCSWSaveGameContainerReader::GetChunkNonce(const FCSWSaveGameChunkEntry& Entry, uint8* OutNonce) const
+{
+	///Entries are told apart by their offset, the caller can pass a copy
+	int32 ChunkIndex = 0;
+	if (Entry.Offset != Toc.ObjectChunk.Offset)
+	{
+		const int32 LevelIndex = Toc.LevelChunks.IndexOfByPredicate([&Entry](const FCSWSaveGameChunkEntry& LevelEntry) { return LevelEntry.Offset == Entry.Offset; });
+		if (LevelIndex == INDEX_NONE) return false;
+		ChunkIndex = LevelIndex + 1;
+	}
+	FCSWAesGcm::MakeChunkNonce(Header.Nonce, static_cast<uint32>(ChunkIndex), OutNonce);
+	return true;
+}
+
+bool FCSWSaveGameContainerReader::VerifyHeader(FArchive& FileAr, const int64 HeaderStart, const FCSWSaveGameHeader& Header)
+{
+	const int64 HeaderEnd = FileAr.Tell();
+	const int64 CoveredSize = HeaderEnd - HeaderStart - sizeof(uint32);
+	if (FileAr.IsError() || CoveredSize <= 0) return false;
+	FileAr.Seek(HeaderStart);
+	uint32 Crc = 0;
+	const bool bRead = FCSWChecksum::Crc32C(FileAr, CoveredSize, Crc);
+	FileAr.Seek(HeaderEnd);
+	return bRead && Crc == Header.HeaderCrc;
+}
+
+bool FCSWSaveGameContainerReader::ReadTableOfContents(FArchive& FileAr, const FCSWSaveGameHeader& Header, FCSWSaveGameToc& OutToc)
+{
+	OutToc.bHasTags = Header.IsEncrypted();
+	FileAr.Seek(Header.TocOffset);
+	///The table of contents runs to the end of the slot and is small, it's checked in memory before being parsed
+	const int64 TocSize = FileAr.TotalSize() - Header.TocOffset;
+	if (TocSize <= 0 || TocSize > MAX_int32) return false;
+	TArray<uint8> TocBytes;
+	TocBytes.SetNumUninitialized(static_cast<int32>(TocSize));
+	FileAr.Serialize(TocBytes.GetData(), TocBytes.Num());
+	if (FileAr.IsError() || FCSWChecksum::Crc32C(TocBytes.GetData(), TocBytes.Num()) != Header.TocCrc) return false;
+	FMemoryReader TocReader(TocBytes);
+	TocReader << OutToc;
+	return !TocReader.IsError();
+}
+
+ECSWSlotValidationResult FCSWSaveGameContainerReader::ValidateSlot(FArchive& FileAr, const bool bVerifyChunks /*= true*/)
+{
+	const int64 HeaderStart = FileAr.Tell();
+	FCSWSaveGameHeader Header;
+	FileAr << Header;
+	if (FileAr.IsError()) return ECSWSlotValidationResult::Corrupt;
+	///Slots written before the header existed, or by a newer version of the plugin
+	if (Header.Magic != CSW_SAVEGAME_HEADER_MAGIC || Header.Version > FCSWSaveGameHeaderVersion::LatestVersion) return ECSWSlotValidationResult::Unverified;
+	if (!Header.IsValid()) return ECSWSlotValidationResult::Corrupt;
+
+	if (!VerifyHeader(FileAr, HeaderStart, Header)) return ECSWSlotValidationResult::Corrupt;
+	FCSWSaveGameContainerReader Reader(FileAr, Header);
+	if (!Reader.ReadAndValidateToc()) return ECSWSlotValidationResult::Corrupt;
+	if (bVerifyChunks)
+	{
+		///The chunks are sorted by offset, the file is read sequentially
+		if (!Reader.VerifyChunk(Reader.Toc.ObjectChunk)) return ECSWSlotValidationResult::Corrupt;
+		for (const FCSWSaveGameChunkEntry& Entry : Reader.Toc.LevelChunks)
+		{
+			if (!Reader.VerifyChunk(Entry)) return ECSWSlotValidationResult::Corrupt;
+		}
+	}
+	return ECSWSlotValidationResult::Valid;
+}
+
+#pragma endregion
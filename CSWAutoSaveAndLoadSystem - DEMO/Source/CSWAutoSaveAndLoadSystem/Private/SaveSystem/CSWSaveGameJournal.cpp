@@ -0,0 +1,110 @@
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+#include "SaveSystem/CSWSaveGameJournal.h"
+#include "Misc/Crc.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/CSWCompressedArchive.h"
+#include "Serialization/CSWChecksum.h"
+
+
+FCSWSaveGameJournal& FCSWSaveGameJournal::Get()
+{
+	static FCSWSaveGameJournal Journal;
+	return Journal;
+}
+
+
+#pragma region JOURNAL FILE
+
+bool FCSWSaveGameJournal::WriteHeader(FArchive& Ar, const FGuid& BaseSaveId)
+{
+	FCSWSaveGameJournalHeader Header;
+	Header.BaseSaveId = BaseSaveId;
+	Ar << Header;
+	return !Ar.IsError();
+}
+
+bool FCSWSaveGameJournal::WriteEntry(FArchive& Ar, const TArray<uint8>& Payload, const ECSWCompressionCodec CodecID)
+{
+	TArray<uint8> Compressed;
+	if (!FCSWBlockCompression::CompressBlocks(Payload.GetData(), Payload.Num(), Compressed, CodecID)) return false;
+	int32 Magic = CSW_JOURNAL_ENTRY_MAGIC;
+	int32 Size = Compressed.Num();
+	uint32 Crc = FCSWChecksum::Crc32C(Compressed.GetData(), Compressed.Num());
+	Ar << Magic << Size << Crc;
+	Ar.Serialize(Compressed.GetData(), Compressed.Num());
+	return !Ar.IsError();
+}
+
+bool FCSWSaveGameJournal::ReadEntries(FArchive& Ar, const FGuid& BaseSaveId, TFunctionRef<bool(const TArray<uint8>&)> ReadEntry)
+{
+	FCSWSaveGameJournalHeader Header;
+	Ar << Header;
+	if (Ar.IsError() || Header.Magic != CSW_JOURNAL_HEADER_MAGIC || Header.BaseSaveId != BaseSaveId) return false;
+	const bool bCrc32C = Header.Version >= 2;
+
+	TArray<uint8> Compressed;
+	TArray<uint8> Payload;
+	const int64 JournalSize = Ar.TotalSize();
+	///Entry header: magic, size and CRC
+	while (Ar.Tell() + 12 <= JournalSize)
+	{
+		int32 Magic = 0;
+		int32 Size = 0;
+		uint32 Crc = 0;
+		Ar << Magic << Size << Crc;
+		///Everything after an entry cut by a crash is garbage
+		if (Ar.IsError() || Magic != CSW_JOURNAL_ENTRY_MAGIC || Size < 0 || Size > JournalSize - Ar.Tell()) break;
+		Compressed.SetNumUninitialized(Size, false);
+		Ar.Serialize(Compressed.GetData(), Size);
+		if (Ar.IsError() || Crc != (bCrc32C ? FCSWChecksum::Crc32C(Compressed.GetData(), Size) : FCrc::MemCrc32(Compressed.GetData(), Size))) break;
+		if (!FCSWBlockCompression::UncompressBlocks(Compressed, Payload))
+		{
+			UE_LOG(LogTemp, Error, TEXT("CSWError: Couldn't decompress an entry of the save game journal."));
+			return false;
+		}
+		if (!ReadEntry(Payload)) return false;
+	}
+	return true;
+}
+
+#pragma endregion
+
+
+#pragma region JOURNAL STATES
+
+FString FCSWSaveGameJournal::GetSlotKey(const FString& SlotName, const bool bCompressFile, const bool bUseCustomPath, const FString& Path)
+{
+	return (bUseCustomPath ? Path : FString()) + SlotName + (bCompressFile ? TEXT(".csav") : TEXT(".sav"));
+}
+
+FCSWSaveGameJournalStatePtr FCSWSaveGameJournal::FindState(const FString& SlotKey) const
+{
+	FScopeLock Lock(&StatesLock);
+	const FCSWSaveGameJournalStatePtr* State = States.Find(SlotKey);
+	return State ? *State : FCSWSaveGameJournalStatePtr();
+}
+
+void FCSWSaveGameJournal::SetState(const FString& SlotKey, const FCSWSaveGameJournalStatePtr& State)
+{
+	FScopeLock Lock(&StatesLock);
+	States.Add(SlotKey, State);
+}
+
+void FCSWSaveGameJournal::RemoveState(const FString& SlotKey)
+{
+	FScopeLock Lock(&StatesLock);
+	States.Remove(SlotKey);
+}
+
+void FCSWSaveGameJournal::RemoveAllStates()
+{
+	FScopeLock Lock(&StatesLock);
+	States.Empty();
+}
+
+#pragma endregion
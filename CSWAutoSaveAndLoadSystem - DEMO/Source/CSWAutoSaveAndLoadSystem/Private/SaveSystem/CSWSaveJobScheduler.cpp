@@ -0,0 +1,226 @@
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+#include "SaveSystem/CSWSaveJobScheduler.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/ScopeLock.h"
+
+
+FCSWSaveJobScheduler& FCSWSaveJobScheduler::Get()
+{
+	static FCSWSaveJobScheduler Scheduler;
+	return Scheduler;
+}
+
+FCSWSaveJobScheduler::~FCSWSaveJobScheduler()
+{
+	Shutdown();
+}
+
+void FCSWSaveJobScheduler::Startup()
+{
+	bStopping = false;
+	if (!TickerHandle.IsValid())
+	{
+		TickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FCSWSaveJobScheduler::DispatchCompletions));
+	}
+}
+
+void FCSWSaveJobScheduler::Shutdown()
+{
+	FRunnableThread* WriterThread = nullptr;
+	{
+		FScopeLock Lock(&QueueLock);
+		bStopping = true;
+		WriterThread = Thread;
+		Thread = nullptr;
+		if (QueueEvent) QueueEvent->Trigger();
+	}
+	if (WriterThread)
+	{
+		///Run() writes what is left in the queue before returning
+		WriterThread->WaitForCompletion();
+		delete WriterThread;
+		FPlatformProcess::ReturnSynchEventToPool(QueueEvent);
+		QueueEvent = nullptr;
+	}
+	///Nothing is left to receive the completions that weren't dispatched
+	if (TickerHandle.IsValid())
+	{
+		FTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+	FScopeLock Lock(&CompletionsLock);
+	Completions.Empty();
+}
+
+
+#pragma region JOBS
+
+int32 FCSWSaveJobScheduler::Enqueue(const FString& Key, const ECSWSaveJobPriority Priority, TUniqueFunction<bool()>&& Work, TUniqueFunction<void(bool)>&& OnCompleted /*= nullptr*/)
+{
+	///A refused job still completes, the caller may be waiting for it
+	auto Refuse = [this, &OnCompleted]()
+	{
+		if (OnCompleted) DispatchToGameThread([OnCompleted = MoveTemp(OnCompleted)]() mutable { OnCompleted(false); });
+		return INDEX_NONE;
+	};
+	if (!Work) return Refuse();
+	FScopeLock Lock(&QueueLock);
+	if (bStopping) return Refuse();
+	///Only the newest job of a key is worth running
+	if (Key.Len() > 0)
+	{
+		FJob* PendingJob = Queue.FindByPredicate([&Key](const FJob& Job) { return Job.Key == Key; });
+		if (PendingJob)
+		{
+			PendingJob->Work = MoveTemp(Work);
+			PendingJob->Priority = FMath::Max(PendingJob->Priority, Priority);
+			if (OnCompleted) PendingJob->OnCompleted.Add(MoveTemp(OnCompleted));
+			return PendingJob->JobId;
+		}
+	}
+	if (Queue.Num() >= CSW_SAVE_JOB_MAX_QUEUED_JOBS)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("CSWError: The save job queue is full, the job %s was dropped."), *Key);
+		return Refuse();
+	}
+	FJob& Job = Queue[Queue.AddDefaulted()];
+	Job.JobId = NextJobId++;
+	Job.Key = Key;
+	Job.Priority = Priority;
+	Job.Work = MoveTemp(Work);
+	if (OnCompleted) Job.OnCompleted.Add(MoveTemp(OnCompleted));
+
+	///The writer thread lives until the module shuts down
+	if (!Thread)
+	{
+		QueueEvent = FPlatformProcess::GetSynchEventFromPool(false);
+		Thread = FRunnableThread::Create(this, TEXT("CSWSaveJobWriter"), 0, TPri_BelowNormal);
+	}
+	QueueEvent->Trigger();
+	return Job.JobId;
+}
+
+int32 FCSWSaveJobScheduler::EnqueueAfter(const FString& AfterKey, const FString& Key, const ECSWSaveJobPriority Priority, TUniqueFunction<bool()>&& Work, TUniqueFunction<void(bool)>&& OnCompleted /*= nullptr*/)
+{
+	///Held through Enqueue(), the pending job can't start in between
+	FScopeLock Lock(&QueueLock);
+	ECSWSaveJobPriority JobPriority = Priority;
+	const FJob* PendingJob = AfterKey.Len() > 0 ? Queue.FindByPredicate([&AfterKey](const FJob& Job) { return Job.Key == AfterKey; }) : nullptr;
+	if (PendingJob)
+	{
+		JobPriority = FMath::Min(JobPriority, PendingJob->Priority);
+	}
+	return Enqueue(Key, JobPriority, MoveTemp(Work), MoveTemp(OnCompleted));
+}
+
+bool FCSWSaveJobScheduler::Cancel(const int32 JobId)
+{
+	FJob CancelledJob;
+	{
+		FScopeLock Lock(&QueueLock);
+		const int32 JobIndex = Queue.IndexOfByPredicate([JobId](const FJob& Job) { return Job.JobId == JobId; });
+		if (JobIndex == INDEX_NONE) return false;
+		CancelledJob = MoveTemp(Queue[JobIndex]);
+		Queue.RemoveAt(JobIndex);
+	}
+	CompleteJob(CancelledJob, false);
+	return true;
+}
+
+bool FCSWSaveJobScheduler::CancelByKey(const FString& Key)
+{
+	if (Key.Len() <= 0) return false;
+	int32 JobId = INDEX_NONE;
+	{
+		FScopeLock Lock(&QueueLock);
+		const FJob* PendingJob = Queue.FindByPredicate([&Key](const FJob& Job) { return Job.Key == Key; });
+		if (!PendingJob) return false;
+		JobId = PendingJob->JobId;
+	}
+	return Cancel(JobId);
+}
+
+bool FCSWSaveJobScheduler::DequeueJob(FJob& OutJob)
+{
+	FScopeLock Lock(&QueueLock);
+	int32 BestIndex = INDEX_NONE;
+	for (int32 Index = 0; Index < Queue.Num(); Index++)
+	{
+		if (BestIndex == INDEX_NONE || Queue[Index].Priority > Queue[BestIndex].Priority)
+		{
+			BestIndex = Index;
+		}
+	}
+	if (BestIndex == INDEX_NONE) return false;
+	OutJob = MoveTemp(Queue[BestIndex]);
+	Queue.RemoveAt(BestIndex);
+	return true;
+}
+
+uint32 FCSWSaveJobScheduler::Run()
+{
+	while (true)
+	{
+		FJob Job;
+		if (DequeueJob(Job))
+		{
+			const bool bSuccess = Job.Work();
+			CompleteJob(Job, bSuccess);
+			continue;
+		}
+		if (bStopping) break;
+		QueueEvent->Wait();
+	}
+	return 0;
+}
+
+void FCSWSaveJobScheduler::Stop()
+{
+	bStopping = true;
+	if (QueueEvent) QueueEvent->Trigger();
+}
+
+#pragma endregion
+
+
+#pragma region GAME THREAD COMPLETIONS
+
+void FCSWSaveJobScheduler::CompleteJob(FJob& Job, const bool bSuccess)
+{
+	for (TUniqueFunction<void(bool)>& OnCompleted : Job.OnCompleted)
+	{
+		DispatchToGameThread([OnCompleted = MoveTemp(OnCompleted), bSuccess]() mutable { OnCompleted(bSuccess); });
+	}
+	Job.OnCompleted.Reset();
+}
+
+void FCSWSaveJobScheduler::DispatchToGameThread(TUniqueFunction<void()>&& Completion)
+{
+	FScopeLock Lock(&CompletionsLock);
+	Completions.Add(MoveTemp(Completion));
+}
+
+bool FCSWSaveJobScheduler::DispatchCompletions(float DeltaTime)
+{
+	TArray<TUniqueFunction<void()>> Batch;
+	{
+		FScopeLock Lock(&CompletionsLock);
+		if (Completions.Num() <= 0) return true;
+		Batch = MoveTemp(Completions);
+	}
+	for (TUniqueFunction<void()>& Completion : Batch)
+	{
+		Completion();
+	}
+	///Keep ticking
+	return true;
+}
+
+#pragma endregion
@@ -0,0 +1,224 @@
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+#include "SaveSystem/CSWSlotCatalog.h"
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformFilemanager.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/Paths.h"
+#include "SaveSystem/CSWSaveGameFormat.h"
+#include "SaveSystem/CSWSaveGameContainer.h"
+#include "SaveSystem/CSWSaveGameSystem.h"
+#include "BlueprintFunctionLibrary/CSWAutoSaveBlueprintLibrary.h"
+
+
+FCSWSlotCatalog& FCSWSlotCatalog::Get()
+{
+	static FCSWSlotCatalog Catalog;
+	return Catalog;
+}
+
+FString FCSWSlotCatalog::GetSlotsDirectory(const bool bUseCustomPath, const FString& Path)
+{
+	return bUseCustomPath ? Path : UCSWAutoSaveBlueprintLibrary::GetPathSaveGames();
+}
+
+
+#pragma region CATALOG
+
+void FCSWSlotCatalog::GetSlots(TArray<FCSWSlotInfo>& OutSlots, const int32 UserIndex, const bool bFilesAreCompressed, const bool bUseCustomPath, const FString& Path)
+{
+	OutSlots.Reset();
+	/// Validation
+	if (bUseCustomPath && Path.Len() <= 1) return;
+	const FString Directory = GetSlotsDirectory(bUseCustomPath, Path);
+	const FString Extension = bFilesAreCompressed ? TEXT(".csav") : TEXT(".sav");
+
+	///A single listing gives the name, size and modification time of every slot
+	struct FFoundSlot
+	{
+		FString SlotName;
+		FFileStatData StatData;
+	};
+	TArray<FFoundSlot> FoundSlots;
+	///Save systems with an index of their slots (FCSWPackSaveGameSystem) list them without touching the disk
+	ICSWSaveGameSystem* SaveSystem = ICSWPlatformFeaturesModule::Get().GetActiveSaveGameSystem();
+	TArray<FString> IndexedSlotNames;
+	TArray<FFileStatData> IndexedStatData;
+	if (SaveSystem && SaveSystem->GetSaveGames(bUseCustomPath, bFilesAreCompressed, *Path, IndexedSlotNames, IndexedStatData))
+	{
+		for (int32 Index = 0; Index < IndexedSlotNames.Num(); Index++)
+		{
+			FoundSlots.Add({ IndexedSlotNames[Index], IndexedStatData[Index] });
+		}
+	}
+	else
+	{
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+		PlatformFile.IterateDirectoryStat(*Directory, [&FoundSlots, &Extension](const TCHAR* FilenameOrDirectory, const FFileStatData& StatData)
+		{
+			const FString Filename = FPaths::GetCleanFilename(FilenameOrDirectory);
+			if (!StatData.bIsDirectory && Filename.EndsWith(Extension))
+			{
+				FoundSlots.Add({ Filename.LeftChop(Extension.Len()), StatData });
+			}
+			return true;
+		});
+	}
+
+	///Slots that didn't change since they were read come from the cache
+	const FString DirectoryKey = Directory + Extension;
+	TArray<FCSWSlotInfo> Slots;
+	Slots.SetNum(FoundSlots.Num());
+	TArray<int32> ChangedSlots;
+	{
+		FScopeLock Lock(&CacheLock);
+		const TMap<FString, FCachedSlot>* CachedSlots = Directories.Find(DirectoryKey);
+		for (int32 Index = 0; Index < FoundSlots.Num(); Index++)
+		{
+			const FCachedSlot* CachedSlot = CachedSlots ? CachedSlots->Find(FoundSlots[Index].SlotName) : nullptr;
+			if (CachedSlot && CachedSlot->ModificationTime == FoundSlots[Index].StatData.ModificationTime && CachedSlot->FileSize == FoundSlots[Index].StatData.FileSize)
+			{
+				Slots[Index] = CachedSlot->Slot;
+			}
+			else
+			{
+				ChangedSlots.Add(Index);
+			}
+		}
+	}
+
+	///The others are read in parallel, each one is a couple of small reads
+	ParallelFor(ChangedSlots.Num(), [&](int32 Index)
+	{
+		const FFoundSlot& FoundSlot = FoundSlots[ChangedSlots[Index]];
+		Slots[ChangedSlots[Index]] = ReadSlot(FoundSlot.SlotName, FoundSlot.StatData, UserIndex, bFilesAreCompressed, bUseCustomPath, Path);
+	});
+
+	///Rebuild the cache of the directory, so deleted slots go away
+	{
+		FScopeLock Lock(&CacheLock);
+		TMap<FString, FCachedSlot>& CachedSlots = Directories.FindOrAdd(DirectoryKey);
+		CachedSlots.Reset();
+		for (int32 Index = 0; Index < FoundSlots.Num(); Index++)
+		{
+			FCachedSlot& CachedSlot = CachedSlots.Add(FoundSlots[Index].SlotName);
+			CachedSlot.ModificationTime = FoundSlots[Index].StatData.ModificationTime;
+			CachedSlot.FileSize = FoundSlots[Index].StatData.FileSize;
+			CachedSlot.Slot = Slots[Index];
+		}
+	}
+
+	Slots.Sort([](const FCSWSlotInfo& A, const FCSWSlotInfo& B) { return A.SaveTime > B.SaveTime; });
+	OutSlots = MoveTemp(Slots);
+}
+
+bool FCSWSlotCatalog::GetSlot(FCSWSlotInfo& OutSlot, const FString& SlotName, const int32 UserIndex, const bool bFileIsCompressed, const bool bUseCustomPath, const FString& Path)
+{
+	/// Validation
+	if (SlotName.Len() <= 0 || (bUseCustomPath && Path.Len() <= 1)) return false;
+	const FString Directory = GetSlotsDirectory(bUseCustomPath, Path);
+	const FString Extension = bFileIsCompressed ? TEXT(".csav") : TEXT(".sav");
+	ICSWSaveGameSystem* SaveSystem = ICSWPlatformFeaturesModule::Get().GetActiveSaveGameSystem();
+	FFileStatData StatData;
+	if (!SaveSystem || !SaveSystem->GetSaveGameStatData(bUseCustomPath, bFileIsCompressed, *Path, *SlotName, StatData))
+	{
+		StatData = FPlatformFileManager::Get().GetPlatformFile().GetStatData(*(Directory + SlotName + Extension));
+	}
+	if (!StatData.bIsValid || StatData.bIsDirectory) return false;
+
+	const FString DirectoryKey = Directory + Extension;
+	{
+		FScopeLock Lock(&CacheLock);
+		const TMap<FString, FCachedSlot>* CachedSlots = Directories.Find(DirectoryKey);
+		const FCachedSlot* CachedSlot = CachedSlots ? CachedSlots->Find(SlotName) : nullptr;
+		if (CachedSlot && CachedSlot->ModificationTime == StatData.ModificationTime && CachedSlot->FileSize == StatData.FileSize)
+		{
+			OutSlot = CachedSlot->Slot;
+			return OutSlot.bIsValid;
+		}
+	}
+
+	OutSlot = ReadSlot(SlotName, StatData, UserIndex, bFileIsCompressed, bUseCustomPath, Path);
+	FScopeLock Lock(&CacheLock);
+	FCachedSlot& CachedSlot = Directories.FindOrAdd(DirectoryKey).Add(SlotName);
+	CachedSlot.ModificationTime = StatData.ModificationTime;
+	CachedSlot.FileSize = StatData.FileSize;
+	CachedSlot.Slot = OutSlot;
+	return OutSlot.bIsValid;
+}
+
+void FCSWSlotCatalog::InvalidateSlot(const FString& SlotName)
+{
+	FScopeLock Lock(&CacheLock);
+	for (TPair<FString, TMap<FString, FCachedSlot>>& Directory : Directories)
+	{
+		Directory.Value.Remove(SlotName);
+	}
+}
+
+void FCSWSlotCatalog::Empty()
+{
+	FScopeLock Lock(&CacheLock);
+	Directories.Empty();
+}
+
+#pragma endregion
+
+
+#pragma region SLOT METADATA
+
+FCSWSlotInfo FCSWSlotCatalog::ReadSlot(const FString& SlotName, const FFileStatData& StatData, const int32 UserIndex, const bool bFileIsCompressed, const bool bUseCustomPath, const FString& Path)
+{
+	FCSWSlotInfo Slot;
+	Slot.SlotName = SlotName;
+	Slot.SaveTime = StatData.ModificationTime;
+	Slot.FileSize = static_cast<int32>(FMath::Min<int64>(StatData.FileSize, MAX_int32));
+	if (ICSWSaveGameSystem* SaveSystem = ICSWPlatformFeaturesModule::Get().GetActiveSaveGameSystem())
+	{
+		SaveSystem->LoadGameStreamed(false, bUseCustomPath, bFileIsCompressed, *Path, *SlotName, UserIndex, [&Slot, bFileIsCompressed](FArchive& FileAr)
+		{
+			return ReadSlotInfo(FileAr, bFileIsCompressed, Slot);
+		});
+	}
+	return Slot;
+}
+
+bool FCSWSlotCatalog::ReadSlotInfo(FArchive& FileAr, const bool bFileIsCompressed, FCSWSlotInfo& OutSlot)
+{
+	const int64 HeaderStart = FileAr.Tell();
+	FCSWSaveGameHeader Header;
+	FileAr << Header;
+	if (Header.Magic != CSW_SAVEGAME_HEADER_MAGIC)
+	{
+		///Slot written before the header existed, only the file data is known
+		OutSlot.Codec = bFileIsCompressed ? ECSWCompressionCodec::Zlib : ECSWCompressionCodec::None;
+		OutSlot.bIsValid = !FileAr.IsError();
+		return OutSlot.bIsValid;
+	}
+	if (FileAr.IsError() || !Header.IsValid() || !FCSWSaveGameContainerReader::VerifyHeader(FileAr, HeaderStart, Header)) return false;
+
+	OutSlot.Codec = Header.GetCodec();
+	OutSlot.UncompressedSize = static_cast<int32>(FMath::Min<int64>(Header.UncompressedSize, MAX_int32));
+	OutSlot.bHasMetadata = true;
+	OutSlot.SaveTime = Header.Metadata.SaveTime;
+	OutSlot.SaveId = Header.Metadata.SaveId;
+	///The names of the levels are in the table of contents, which is small and at the end of the slot
+	if (Header.TocOffset < FileAr.Tell() || Header.TocOffset >= FileAr.TotalSize()) return false;
+	FCSWSaveGameToc Toc;
+	if (!FCSWSaveGameContainerReader::ReadTableOfContents(FileAr, Header, Toc)) return false;
+	OutSlot.NumActors = 0;
+	OutSlot.LevelNames.Reset(Toc.LevelChunks.Num());
+	for (const FCSWSaveGameChunkEntry& Entry : Toc.LevelChunks)
+	{
+		OutSlot.LevelNames.Add(FName(*Entry.Name));
+		OutSlot.NumActors += Entry.NumActors;
+	}
+	OutSlot.bIsValid = true;
+	return true;
+}
+
+#pragma endregion
@@ -0,0 +1,119 @@
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+#include "SaveSystem/CSWVersionStore.h"
+#include "SaveSystem/CSWSaveGameSystem.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/Crc.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+
+FCSWVersionStore& FCSWVersionStore::Get()
+{
+	static FCSWVersionStore Store;
+	return Store;
+}
+
+void FCSWVersionStore::SetUseCompactVersions(const bool bEnable)
+{
+	FScopeLock Lock(&StoreLock);
+	bUseCompactVersions = bEnable;
+}
+
+bool FCSWVersionStore::GetUseCompactVersions() const
+{
+	FScopeLock Lock(&StoreLock);
+	return bUseCompactVersions;
+}
+
+FString FCSWVersionStore::GetVersionsFileName(const uint32 Hash)
+{
+	return CSW_VERSIONS_FOLDER + FString::Printf(TEXT("%08X"), Hash) + CSW_VERSIONS_EXTENSION;
+}
+
+FString FCSWVersionStore::GetLocationKey(const FCSWVersionsLocation& Location)
+{
+	///The path only matters for custom paths, the save game system decides where the others go
+	return FString::Printf(TEXT("%p:%d:%d:"), Location.SaveSystem, Location.bUseCustomPath ? 1 : 0, Location.UserIndex) + (Location.bUseCustomPath ? Location.Path : FString());
+}
+
+
+#pragma region STORE
+
+void FCSWVersionStore::InitBuildVersions()
+{
+	if (bBuildVersionsInitialized) return;
+	FCSWSaveGameVersions BuildVersions;
+	FMemoryWriter Writer(BuildVersionsBytes);
+	BuildVersions.Serialize(Writer);
+	BuildHash = FCrc::MemCrc32(BuildVersionsBytes.GetData(), BuildVersionsBytes.Num());
+	bBuildVersionsInitialized = true;
+}
+
+uint32 FCSWVersionStore::GetBuildHash()
+{
+	FScopeLock Lock(&StoreLock);
+	InitBuildVersions();
+	return BuildHash;
+}
+
+bool FCSWVersionStore::StoreBuildVersions(const FCSWVersionsLocation& Location)
+{
+	if (!Location.SaveSystem) return false;
+	FScopeLock Lock(&StoreLock);
+	InitBuildVersions();
+	const FString LocationKey = GetLocationKey(Location);
+	if (BuildVersionsLocations.Contains(LocationKey)) return true;
+	///Another run of the same build may have written it already
+	const FString FileName = GetVersionsFileName(BuildHash);
+	TArray<uint8> StoredBytes;
+	const bool bFound = Location.SaveSystem->LoadGameVersions(Location.bUseCustomPath, *Location.Path, Location.UserIndex, *FileName, StoredBytes) && StoredBytes == BuildVersionsBytes;
+	if (!bFound && !Location.SaveSystem->SaveGameVersions(Location.bUseCustomPath, *Location.Path, Location.UserIndex, *FileName, BuildVersionsBytes))
+	{
+		UE_LOG(LogTemp, Error, TEXT("CSWError: The versions of the build couldn't be stored next to the slots of \"%s\", they are written in the save games."), *Location.Path);
+		return false;
+	}
+	BuildVersionsLocations.Add(LocationKey);
+	return true;
+}
+
+bool FCSWVersionStore::FindVersions(const uint32 Hash, const FCSWVersionsLocation* Location, FCSWSaveGameVersions& OutVersions)
+{
+	FScopeLock Lock(&StoreLock);
+	InitBuildVersions();
+	if (Hash == BuildHash)
+	{
+		OutVersions = FCSWSaveGameVersions();
+		return true;
+	}
+	if (const FCSWSaveGameVersions* Versions = StoredVersions.Find(Hash))
+	{
+		OutVersions = *Versions;
+		return true;
+	}
+	///The file is the serialized versions, its CRC is the hash
+	TArray<uint8> VersionsBytes;
+	const FString FileName = GetVersionsFileName(Hash);
+	if (!Location || !Location->SaveSystem || !Location->SaveSystem->LoadGameVersions(Location->bUseCustomPath, *Location->Path, Location->UserIndex, *FileName, VersionsBytes))
+	{
+		UE_LOG(LogTemp, Error, TEXT("CSWError: The versions %08X of the save game weren't found next to its slot (%s)."), Hash, *FileName);
+		return false;
+	}
+	if (FCrc::MemCrc32(VersionsBytes.GetData(), VersionsBytes.Num()) != Hash)
+	{
+		UE_LOG(LogTemp, Error, TEXT("CSWError: The versions file %s is corrupt."), *FileName);
+		return false;
+	}
+	FCSWSaveGameVersions Versions;
+	FMemoryReader Reader(VersionsBytes);
+	Versions.Serialize(Reader);
+	if (Reader.IsError()) return false;
+	OutVersions = StoredVersions.Add(Hash, MoveTemp(Versions));
+	return true;
+}
+
+#pragma endregion
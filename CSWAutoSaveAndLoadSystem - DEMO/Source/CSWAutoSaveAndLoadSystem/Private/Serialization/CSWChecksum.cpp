@@ -0,0 +1,219 @@
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+#include "Serialization/CSWChecksum.h"
+
+/** The crc32 instruction is only used on x64, where it's part of SSE4.2 */
+#if PLATFORM_64BITS && (PLATFORM_WINDOWS || PLATFORM_MAC || PLATFORM_LINUX) && (defined(_M_X64) || defined(__x86_64__))
+	#define CSW_CRC32C_HARDWARE 1
+#else
+	#define CSW_CRC32C_HARDWARE 0
+#endif
+
+#if CSW_CRC32C_HARDWARE
+	#include <nmmintrin.h>
+	#if PLATFORM_WINDOWS
+		#include <intrin.h>
+		#define CSW_SSE42_FUNCTION
+	#else
+		#include <cpuid.h>
+		#define CSW_SSE42_FUNCTION __attribute__((target("sse4.2")))
+	#endif
+#endif
+
+/** Reversed Castagnoli polynomial */
+static const uint32 CSW_CRC32C_POLYNOMIAL = 0x82F63B78;
+
+
+#pragma region SOFTWARE CRC32C
+
+/** Slicing-by-8 tables: Table[0] is the classic byte table, Table[N] advances the CRC of a byte by N more bytes */
+struct FCSWCrc32CTables
+{
+	uint32 Table[8][256];
+
+	FCSWCrc32CTables()
+	{
+		for (uint32 Byte = 0; Byte < 256; Byte++)
+		{
+			uint32 Crc = Byte;
+			for (int32 Bit = 0; Bit < 8; Bit++)
+			{
+				Crc = (Crc >> 1) ^ ((Crc & 1) ? CSW_CRC32C_POLYNOMIAL : 0);
+			}
+			Table[0][Byte] = Crc;
+		}
+		for (uint32 Byte = 0; Byte < 256; Byte++)
+		{
+			for (int32 Slice = 1; Slice < 8; Slice++)
+			{
+				Table[Slice][Byte] = (Table[Slice - 1][Byte] >> 8) ^ Table[0][Table[Slice - 1][Byte] & 0xFF];
+			}
+		}
+	}
+};
+
+static uint32 Crc32CSoftware(const uint8* Data, int64 Num, uint32 Crc)
+{
+	static const FCSWCrc32CTables Tables;
+	const uint32 (*Table)[256] = Tables.Table;
+	///Align to 4 bytes, then 8 bytes per step
+	while (Num > 0 && (reinterpret_cast<UPTRINT>(Data) & 3) != 0)
+	{
+		Crc = (Crc >> 8) ^ Table[0][(Crc ^ *Data++) & 0xFF];
+		Num--;
+	}
+	while (Num >= 8)
+	{
+		const uint32 Low = *reinterpret_cast<const uint32*>(Data) ^ Crc;
+		const uint32 High = *reinterpret_cast<const uint32*>(Data + 4);
+		Crc = Table[7][Low & 0xFF] ^ Table[6][(Low >> 8) & 0xFF] ^ Table[5][(Low >> 16) & 0xFF] ^ Table[4][Low >> 24]
+			^ Table[3][High & 0xFF] ^ Table[2][(High >> 8) & 0xFF] ^ Table[1][(High >> 16) & 0xFF] ^ Table[0][High >> 24];
+		Data += 8;
+		Num -= 8;
+	}
+	while (Num-- > 0)
+	{
+		Crc = (Crc >> 8) ^ Table[0][(Crc ^ *Data++) & 0xFF];
+	}
+	return Crc;
+}
+
+#pragma endregion
+
+
+#pragma region HARDWARE CRC32C
+
+#if CSW_CRC32C_HARDWARE
+CSW_SSE42_FUNCTION static uint32 Crc32CHardware(const uint8* Data, int64 Num, uint32 Crc)
+{
+	while (Num > 0 && (reinterpret_cast<UPTRINT>(Data) & 7) != 0)
+	{
+		Crc = _mm_crc32_u8(Crc, *Data++);
+		Num--;
+	}
+	uint64 Crc64 = Crc;
+	while (Num >= 8)
+	{
+		Crc64 = _mm_crc32_u64(Crc64, *reinterpret_cast<const uint64*>(Data));
+		Data += 8;
+		Num -= 8;
+	}
+	Crc = static_cast<uint32>(Crc64);
+	while (Num-- > 0)
+	{
+		Crc = _mm_crc32_u8(Crc, *Data++);
+	}
+	return Crc;
+}
+
+static bool CpuHasSSE42()
+{
+#if PLATFORM_WINDOWS
+	int32 CpuInfo[4];
+	__cpuid(CpuInfo, 1);
+	return (CpuInfo[2] & (1 << 20)) != 0;
+#else
+	uint32 Eax, Ebx, Ecx, Edx;
+	return __get_cpuid(1, &Eax, &Ebx, &Ecx, &Edx) && (Ecx & bit_SSE4_2) != 0;
+#endif
+}
+#endif
+
+#pragma endregion
+
+
+bool FCSWChecksum::HasHardwareSupport()
+{
+#if CSW_CRC32C_HARDWARE
+	static const bool bHasSSE42 = CpuHasSSE42();
+	return bHasSSE42;
+#else
+	return false;
+#endif
+}
+
+uint32 FCSWChecksum::Crc32C(const void* Data, const int64 Num, const uint32 Crc /*= 0*/)
+{
+	if (Num <= 0) return Crc;
+	const uint8* Bytes = static_cast<const uint8*>(Data);
+#if CSW_CRC32C_HARDWARE
+	if (HasHardwareSupport())
+	{
+		return ~Crc32CHardware(Bytes, Num, ~Crc);
+	}
+#endif
+	return ~Crc32CSoftware(Bytes, Num, ~Crc);
+}
+
+bool FCSWChecksum::Crc32C(FArchive& Ar, const int64 Num, uint32& OutCrc)
+{
+	OutCrc = 0;
+	if (Num < 0 || Num > Ar.TotalSize() - Ar.Tell()) return false;
+	TArray<uint8> Buffer;
+	Buffer.SetNumUninitialized(static_cast<int32>(FMath::Min<int64>(Num, CSW_CHECKSUM_READ_BUFFER_SIZE)));
+	for (int64 Remaining = Num; Remaining > 0;)
+	{
+		const int32 ReadSize = static_cast<int32>(FMath::Min<int64>(Remaining, Buffer.Num()));
+		Ar.Serialize(Buffer.GetData(), ReadSize);
+		if (Ar.IsError()) return false;
+		OutCrc = Crc32C(Buffer.GetData(), ReadSize, OutCrc);
+		Remaining -= ReadSize;
+	}
+	return true;
+}
+
+
+#pragma region CHECKSUM ARCHIVE
+
+FCSWArchiveChecksumProxy::FCSWArchiveChecksumProxy(FArchive& InInnerArchive)
+	: FArchiveProxy(InInnerArchive)
+	, Crc(0)
+	, Position(InInnerArchive.Tell())
+	, ChecksumEnd(Position)
+{}
+
+void FCSWArchiveChecksumProxy::Serialize(void* Data, int64 Num)
+{
+	InnerArchive.Serialize(Data, Num);
+	///Only the part past the bytes already in the CRC is added (the bytes are read again after a seek back)
+	const int64 Counted = FMath::Clamp<int64>(ChecksumEnd - Position, 0, Num);
+	Crc = FCSWChecksum::Crc32C(static_cast<const uint8*>(Data) + Counted, Num - Counted, Crc);
+	Position += Num;
+	ChecksumEnd = FMath::Max(ChecksumEnd, Position);
+}
+
+void FCSWArchiveChecksumProxy::Seek(int64 InPos)
+{
+	///The bytes skipped by a seek forward are read into the CRC
+	if (IsLoading() && InPos > ChecksumEnd)
+	{
+		ChecksumTo(InPos);
+	}
+	InnerArchive.Seek(InPos);
+	Position = InPos;
+}
+
+bool FCSWArchiveChecksumProxy::ChecksumTo(const int64 EndPos)
+{
+	if (EndPos <= ChecksumEnd) return true;
+	if (EndPos > InnerArchive.TotalSize()) return false;
+	InnerArchive.Seek(ChecksumEnd);
+	TArray<uint8> Buffer;
+	Buffer.SetNumUninitialized(static_cast<int32>(FMath::Min<int64>(EndPos - ChecksumEnd, CSW_CHECKSUM_READ_BUFFER_SIZE)));
+	while (ChecksumEnd < EndPos)
+	{
+		const int32 ReadSize = static_cast<int32>(FMath::Min<int64>(EndPos - ChecksumEnd, Buffer.Num()));
+		InnerArchive.Serialize(Buffer.GetData(), ReadSize);
+		if (InnerArchive.IsError()) return false;
+		Crc = FCSWChecksum::Crc32C(Buffer.GetData(), ReadSize, Crc);
+		ChecksumEnd += ReadSize;
+	}
+	Position = ChecksumEnd;
+	return true;
+}
+
+#pragma endregion
@@ -0,0 +1,819 @@
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+#include "Serialization/CSWCipher.h"
+#include "Misc/ScopeLock.h"
+#include "Containers/StringConv.h"
+#include "Misc/SecureHash.h"
+#include "Misc/Guid.h"
+#include "Misc/DateTime.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/ThreadSafeCounter.h"
+
+/** AES-NI and PCLMULQDQ are only used on x64 */
+#if PLATFORM_64BITS && (PLATFORM_WINDOWS || PLATFORM_MAC || PLATFORM_LINUX) && (defined(_M_X64) || defined(__x86_64__))
+	#define CSW_AES_HARDWARE 1
+#else
+	#define CSW_AES_HARDWARE 0
+#endif
+
+#if CSW_AES_HARDWARE
+	#include <wmmintrin.h>
+	#include <smmintrin.h>
+	#if PLATFORM_WINDOWS
+		#include <intrin.h>
+		#define CSW_AES_FUNCTION
+	#else
+		#include <cpuid.h>
+		#define CSW_AES_FUNCTION __attribute__((target("aes,pclmul,sse4.1")))
+	#endif
+#endif
+
+/** Counter blocks encrypted by each call to FAES on the software path */
+#define CSW_CIPHER_SOFTWARE_BATCH 64
+
+
+static void StoreBigEndian32(uint8* Out, const uint32 Value)
+{
+	Out[0] = static_cast<uint8>(Value >> 24);
+	Out[1] = static_cast<uint8>(Value >> 16);
+	Out[2] = static_cast<uint8>(Value >> 8);
+	Out[3] = static_cast<uint8>(Value);
+}
+
+static void StoreBigEndian64(uint8* Out, const uint64 Value)
+{
+	StoreBigEndian32(Out, static_cast<uint32>(Value >> 32));
+	StoreBigEndian32(Out + 4, static_cast<uint32>(Value));
+}
+
+static uint64 LoadBigEndian64(const uint8* In)
+{
+	uint64 Value = 0;
+	for (int32 Index = 0; Index < 8; Index++)
+	{
+		Value = (Value << 8) | In[Index];
+	}
+	return Value;
+}
+
+
+#pragma region SOFTWARE AES-GCM
+
+/** Counter mode on top of FAES, which encrypts whole buffers of blocks: the counter blocks are encrypted in batches, then xored */
+static void CtrSoftware(const FAES::FAESKey& Key, const uint8* Nonce, uint32& InOutCounter, const uint8* Src, uint8* Dst, int64 NumBlocks)
+{
+	uint8 KeystreamBatch[CSW_CIPHER_SOFTWARE_BATCH * CSW_CIPHER_BLOCK_SIZE];
+	while (NumBlocks > 0)
+	{
+		const int32 BatchBlocks = static_cast<int32>(FMath::Min<int64>(NumBlocks, CSW_CIPHER_SOFTWARE_BATCH));
+		for (int32 Block = 0; Block < BatchBlocks; Block++)
+		{
+			uint8* CounterBytes = KeystreamBatch + Block * CSW_CIPHER_BLOCK_SIZE;
+			FMemory::Memcpy(CounterBytes, Nonce, CSW_CIPHER_NONCE_SIZE);
+			StoreBigEndian32(CounterBytes + CSW_CIPHER_NONCE_SIZE, InOutCounter++);
+		}
+		const int32 BatchSize = BatchBlocks * CSW_CIPHER_BLOCK_SIZE;
+		FAES::EncryptData(KeystreamBatch, BatchSize, Key);
+		for (int32 Index = 0; Index < BatchSize; Index++)
+		{
+			Dst[Index] = Src[Index] ^ KeystreamBatch[Index];
+		}
+		Src += BatchSize;
+		Dst += BatchSize;
+		NumBlocks -= BatchBlocks;
+	}
+}
+
+/** H times every 4-bit value (Shoup's tables), so GHASH multiplies by H 4 bits at a time */
+static void BuildGhashTables(const uint8* HashKey, uint64* OutHigh, uint64* OutLow)
+{
+	uint64 High = LoadBigEndian64(HashKey);
+	uint64 Low = LoadBigEndian64(HashKey + 8);
+	OutHigh[0] = 0;
+	OutLow[0] = 0;
+	OutHigh[8] = High;
+	OutLow[8] = Low;
+	///The bits of GHASH are reflected: halving is a multiplication by x
+	for (int32 Index = 4; Index > 0; Index >>= 1)
+	{
+		const uint64 Reduction = (Low & 1) ? 0xE100000000000000ULL : 0;
+		Low = (High << 63) | (Low >> 1);
+		High = (High >> 1) ^ Reduction;
+		OutHigh[Index] = High;
+		OutLow[Index] = Low;
+	}
+	for (int32 Index = 2; Index <= 8; Index *= 2)
+	{
+		for (int32 Other = 1; Other < Index; Other++)
+		{
+			OutHigh[Index + Other] = OutHigh[Index] ^ OutHigh[Other];
+			OutLow[Index + Other] = OutLow[Index] ^ OutLow[Other];
+		}
+	}
+}
+
+/** Reduction of the 4 bits shifted out of the product */
+static const uint64 GhashRemainders[16] =
+{
+	0x0000, 0x1C20, 0x3840, 0x2460, 0x7080, 0x6CA0, 0x48C0, 0x54E0,
+	0xE100, 0xFD20, 0xD940, 0xC560, 0x9180, 0x8DA0, 0xA9C0, 0xB5E0
+};
+
+static void GhashSoftware(const uint64* TableHigh, const uint64* TableLow, uint8* State, const uint8* Data, int64 NumBlocks)
+{
+	uint8 X[CSW_CIPHER_BLOCK_SIZE];
+	for (; NumBlocks > 0; NumBlocks--, Data += CSW_CIPHER_BLOCK_SIZE)
+	{
+		for (int32 Index = 0; Index < CSW_CIPHER_BLOCK_SIZE; Index++)
+		{
+			X[Index] = State[Index] ^ Data[Index];
+		}
+		uint64 High = TableHigh[X[15] & 0xF];
+		uint64 Low = TableLow[X[15] & 0xF];
+		for (int32 Index = 15; Index >= 0; Index--)
+		{
+			if (Index != 15)
+			{
+				const uint8 Remainder = static_cast<uint8>(Low & 0xF);
+				Low = (High << 60) | (Low >> 4);
+				High = (High >> 4) ^ (GhashRemainders[Remainder] << 48);
+				High ^= TableHigh[X[Index] & 0xF];
+				Low ^= TableLow[X[Index] & 0xF];
+			}
+			const uint8 Remainder = static_cast<uint8>(Low & 0xF);
+			Low = (High << 60) | (Low >> 4);
+			High = (High >> 4) ^ (GhashRemainders[Remainder] << 48);
+			High ^= TableHigh[X[Index] >> 4];
+			Low ^= TableLow[X[Index] >> 4];
+		}
+		StoreBigEndian64(State, High);
+		StoreBigEndian64(State + 8, Low);
+	}
+}
+
+#pragma endregion
+
+
+#pragma region HARDWARE AES-GCM
+
+#if CSW_AES_HARDWARE
+/** One step of the AES-256 key schedule: the even round key from the previous even key and the keygen assist of the odd one */
+CSW_AES_FUNCTION static __m128i ExpandKeyEven(__m128i Previous, __m128i Assist)
+{
+	Assist = _mm_shuffle_epi32(Assist, 0xFF);
+	Previous = _mm_xor_si128(Previous, _mm_slli_si128(Previous, 4));
+	Previous = _mm_xor_si128(Previous, _mm_slli_si128(Previous, 4));
+	Previous = _mm_xor_si128(Previous, _mm_slli_si128(Previous, 4));
+	return _mm_xor_si128(Previous, Assist);
+}
+
+/** The odd round key from the previous odd key and the new even one */
+CSW_AES_FUNCTION static __m128i ExpandKeyOdd(__m128i Previous, const __m128i Even)
+{
+	const __m128i Assist = _mm_shuffle_epi32(_mm_aeskeygenassist_si128(Even, 0x00), 0xAA);
+	Previous = _mm_xor_si128(Previous, _mm_slli_si128(Previous, 4));
+	Previous = _mm_xor_si128(Previous, _mm_slli_si128(Previous, 4));
+	Previous = _mm_xor_si128(Previous, _mm_slli_si128(Previous, 4));
+	return _mm_xor_si128(Previous, Assist);
+}
+
+CSW_AES_FUNCTION static void ExpandKeyHardware(const uint8* Key, uint8* OutRoundKeys)
+{
+	__m128i RoundKeys[15];
+	RoundKeys[0] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Key));
+	RoundKeys[1] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Key + 16));
+	///The round constant of _mm_aeskeygenassist_si128 must be an immediate
+#define CSW_EXPAND_KEY_ROUNDS(Round, RoundConstant) \
+	RoundKeys[Round] = ExpandKeyEven(RoundKeys[Round - 2], _mm_aeskeygenassist_si128(RoundKeys[Round - 1], RoundConstant)); \
+	RoundKeys[Round + 1] = ExpandKeyOdd(RoundKeys[Round - 1], RoundKeys[Round]);
+	CSW_EXPAND_KEY_ROUNDS(2, 0x01)
+	CSW_EXPAND_KEY_ROUNDS(4, 0x02)
+	CSW_EXPAND_KEY_ROUNDS(6, 0x04)
+	CSW_EXPAND_KEY_ROUNDS(8, 0x08)
+	CSW_EXPAND_KEY_ROUNDS(10, 0x10)
+	CSW_EXPAND_KEY_ROUNDS(12, 0x20)
+#undef CSW_EXPAND_KEY_ROUNDS
+	RoundKeys[14] = ExpandKeyEven(RoundKeys[12], _mm_aeskeygenassist_si128(RoundKeys[13], 0x40));
+	for (int32 Round = 0; Round < 15; Round++)
+	{
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(OutRoundKeys + Round * CSW_CIPHER_BLOCK_SIZE), RoundKeys[Round]);
+	}
+}
+
+/** Counter block of Counter, big endian in the last 4 bytes of the block */
+CSW_AES_FUNCTION static __m128i CounterBlock(const __m128i Base, const uint32 Counter)
+{
+	const uint32 Swapped = (Counter >> 24) | ((Counter >> 8) & 0xFF00) | ((Counter << 8) & 0xFF0000) | (Counter << 24);
+	return _mm_insert_epi32(Base, static_cast<int32>(Swapped), 3);
+}
+
+CSW_AES_FUNCTION static void CtrHardware(const uint8* RoundKeyBytes, const uint8* Nonce, uint32& InOutCounter, const uint8* Src, uint8* Dst, int64 NumBlocks)
+{
+	__m128i RoundKeys[15];
+	for (int32 Round = 0; Round < 15; Round++)
+	{
+		RoundKeys[Round] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(RoundKeyBytes + Round * CSW_CIPHER_BLOCK_SIZE));
+	}
+	uint8 NonceBlock[CSW_CIPHER_BLOCK_SIZE] = {};
+	FMemory::Memcpy(NonceBlock, Nonce, CSW_CIPHER_NONCE_SIZE);
+	const __m128i Base = _mm_loadu_si128(reinterpret_cast<const __m128i*>(NonceBlock));
+
+	///4 blocks at a time hide the latency of aesenc
+	for (; NumBlocks >= 4; NumBlocks -= 4, Src += 64, Dst += 64)
+	{
+		__m128i Block0 = _mm_xor_si128(CounterBlock(Base, InOutCounter), RoundKeys[0]);
+		__m128i Block1 = _mm_xor_si128(CounterBlock(Base, InOutCounter + 1), RoundKeys[0]);
+		__m128i Block2 = _mm_xor_si128(CounterBlock(Base, InOutCounter + 2), RoundKeys[0]);
+		__m128i Block3 = _mm_xor_si128(CounterBlock(Base, InOutCounter + 3), RoundKeys[0]);
+		InOutCounter += 4;
+		for (int32 Round = 1; Round < 14; Round++)
+		{
+			Block0 = _mm_aesenc_si128(Block0, RoundKeys[Round]);
+			Block1 = _mm_aesenc_si128(Block1, RoundKeys[Round]);
+			Block2 = _mm_aesenc_si128(Block2, RoundKeys[Round]);
+			Block3 = _mm_aesenc_si128(Block3, RoundKeys[Round]);
+		}
+		Block0 = _mm_aesenclast_si128(Block0, RoundKeys[14]);
+		Block1 = _mm_aesenclast_si128(Block1, RoundKeys[14]);
+		Block2 = _mm_aesenclast_si128(Block2, RoundKeys[14]);
+		Block3 = _mm_aesenclast_si128(Block3, RoundKeys[14]);
+		const __m128i* In = reinterpret_cast<const __m128i*>(Src);
+		__m128i* Out = reinterpret_cast<__m128i*>(Dst);
+		_mm_storeu_si128(Out, _mm_xor_si128(_mm_loadu_si128(In), Block0));
+		_mm_storeu_si128(Out + 1, _mm_xor_si128(_mm_loadu_si128(In + 1), Block1));
+		_mm_storeu_si128(Out + 2, _mm_xor_si128(_mm_loadu_si128(In + 2), Block2));
+		_mm_storeu_si128(Out + 3, _mm_xor_si128(_mm_loadu_si128(In + 3), Block3));
+	}
+	for (; NumBlocks > 0; NumBlocks--, Src += 16, Dst += 16)
+	{
+		__m128i Block = _mm_xor_si128(CounterBlock(Base, InOutCounter++), RoundKeys[0]);
+		for (int32 Round = 1; Round < 14; Round++)
+		{
+			Block = _mm_aesenc_si128(Block, RoundKeys[Round]);
+		}
+		Block = _mm_aesenclast_si128(Block, RoundKeys[14]);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst), _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(Src)), Block));
+	}
+}
+
+/** Carry-less multiplication in GF(2^128) of two byte-reversed blocks, reduced by the GCM polynomial */
+CSW_AES_FUNCTION static __m128i GfMultiply(const __m128i A, const __m128i B)
+{
+	__m128i Low = _mm_clmulepi64_si128(A, B, 0x00);
+	__m128i Middle = _mm_xor_si128(_mm_clmulepi64_si128(A, B, 0x10), _mm_clmulepi64_si128(A, B, 0x01));
+	__m128i High = _mm_clmulepi64_si128(A, B, 0x11);
+	Low = _mm_xor_si128(Low, _mm_slli_si128(Middle, 8));
+	High = _mm_xor_si128(High, _mm_srli_si128(Middle, 8));
+
+	///The bits are reflected: shift the 256-bit product left by one
+	__m128i LowCarry = _mm_srli_epi32(Low, 31);
+	__m128i HighCarry = _mm_srli_epi32(High, 31);
+	Low = _mm_slli_epi32(Low, 1);
+	High = _mm_slli_epi32(High, 1);
+	const __m128i CrossCarry = _mm_srli_si128(LowCarry, 12);
+	HighCarry = _mm_slli_si128(HighCarry, 4);
+	LowCarry = _mm_slli_si128(LowCarry, 4);
+	Low = _mm_or_si128(Low, LowCarry);
+	High = _mm_or_si128(_mm_or_si128(High, HighCarry), CrossCarry);
+
+	///Reduce modulo x^128 + x^7 + x^2 + x + 1
+	__m128i Fold = _mm_xor_si128(_mm_xor_si128(_mm_slli_epi32(Low, 31), _mm_slli_epi32(Low, 30)), _mm_slli_epi32(Low, 25));
+	const __m128i FoldHigh = _mm_srli_si128(Fold, 4);
+	Fold = _mm_slli_si128(Fold, 12);
+	Low = _mm_xor_si128(Low, Fold);
+	__m128i Shifted = _mm_xor_si128(_mm_xor_si128(_mm_srli_epi32(Low, 1), _mm_srli_epi32(Low, 2)), _mm_srli_epi32(Low, 7));
+	Shifted = _mm_xor_si128(Shifted, FoldHigh);
+	Low = _mm_xor_si128(Low, Shifted);
+	return _mm_xor_si128(High, Low);
+}
+
+CSW_AES_FUNCTION static void GhashHardware(const uint8* HashKey, uint8* State, const uint8* Data, int64 NumBlocks)
+{
+	const __m128i ByteSwap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+	const __m128i H = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(HashKey)), ByteSwap);
+	__m128i X = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(State)), ByteSwap);
+	for (; NumBlocks > 0; NumBlocks--, Data += CSW_CIPHER_BLOCK_SIZE)
+	{
+		const __m128i Block = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(Data)), ByteSwap);
+		X = GfMultiply(_mm_xor_si128(X, Block), H);
+	}
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(State), _mm_shuffle_epi8(X, ByteSwap));
+}
+
+static bool CpuHasAesAndClmul()
+{
+	///AES-NI (bit 25), PCLMULQDQ (bit 1), SSE4.1 (bit 19) and SSSE3 (bit 9) of ECX
+	const uint32 RequiredBits = (1 << 25) | (1 << 1) | (1 << 19) | (1 << 9);
+#if PLATFORM_WINDOWS
+	int32 CpuInfo[4];
+	__cpuid(CpuInfo, 1);
+	return (static_cast<uint32>(CpuInfo[2]) & RequiredBits) == RequiredBits;
+#else
+	uint32 Eax, Ebx, Ecx, Edx;
+	return __get_cpuid(1, &Eax, &Ebx, &Ecx, &Edx) && (Ecx & RequiredBits) == RequiredBits;
+#endif
+}
+#endif
+
+#pragma endregion
+
+
+#pragma region KEY
+
+FCSWCipherKey::FCSWCipherKey(const uint32 InKeyId, const uint8* Key, const bool bAllowHardware /*= true*/)
+	: KeyId(InKeyId)
+	, bHardware(bAllowHardware && FCSWAesGcm::HasHardwareSupport())
+{
+	FMemory::Memcpy(EngineKey.Key, Key, CSW_CIPHER_KEY_SIZE);
+	FMemory::Memzero(RoundKeys);
+#if CSW_AES_HARDWARE
+	if (bHardware)
+	{
+		ExpandKeyHardware(Key, RoundKeys);
+	}
+#endif
+	///The hash key of GCM is the encryption of a zero block
+	const uint8 ZeroBlock[CSW_CIPHER_BLOCK_SIZE] = {};
+	EncryptBlock(ZeroBlock, HashKey);
+	BuildGhashTables(HashKey, HashTableHigh, HashTableLow);
+}
+
+FCSWCipherKey::~FCSWCipherKey()
+{
+	///Don't leave the key material in freed memory
+	FMemory::Memzero(EngineKey.Key, CSW_CIPHER_KEY_SIZE);
+	FMemory::Memzero(RoundKeys);
+	FMemory::Memzero(HashKey);
+	FMemory::Memzero(HashTableHigh);
+	FMemory::Memzero(HashTableLow);
+}
+
+void FCSWCipherKey::EncryptBlock(const uint8* In, uint8* Out) const
+{
+#if CSW_AES_HARDWARE
+	if (bHardware)
+	{
+		///The keystream of a zero block for the counter block In is the encryption of In
+		uint32 Counter = (static_cast<uint32>(In[12]) << 24) | (static_cast<uint32>(In[13]) << 16) | (static_cast<uint32>(In[14]) << 8) | In[15];
+		const uint8 ZeroBlock[CSW_CIPHER_BLOCK_SIZE] = {};
+		CtrHardware(RoundKeys, In, Counter, ZeroBlock, Out, 1);
+		return;
+	}
+#endif
+	FMemory::Memcpy(Out, In, CSW_CIPHER_BLOCK_SIZE);
+	FAES::EncryptData(Out, CSW_CIPHER_BLOCK_SIZE, EngineKey);
+}
+
+void FCSWCipherKey::EncryptBlocksCtr(const uint8* Nonce, uint32& InOutCounter, const uint8* Src, uint8* Dst, const int64 NumBlocks) const
+{
+	if (NumBlocks <= 0) return;
+#if CSW_AES_HARDWARE
+	if (bHardware)
+	{
+		CtrHardware(RoundKeys, Nonce, InOutCounter, Src, Dst, NumBlocks);
+		return;
+	}
+#endif
+	CtrSoftware(EngineKey, Nonce, InOutCounter, Src, Dst, NumBlocks);
+}
+
+void FCSWCipherKey::Ghash(uint8* InOutState, const uint8* Data, const int64 NumBlocks) const
+{
+	if (NumBlocks <= 0) return;
+#if CSW_AES_HARDWARE
+	if (bHardware)
+	{
+		GhashHardware(HashKey, InOutState, Data, NumBlocks);
+		return;
+	}
+#endif
+	GhashSoftware(HashTableHigh, HashTableLow, InOutState, Data, NumBlocks);
+}
+
+#pragma endregion
+
+
+#pragma region AES-GCM
+
+FCSWAesGcm::FCSWAesGcm(const FCSWCipherKey& InKey, const uint8* InNonce)
+	: Key(InKey)
+	///Counter 1 is kept for the tag, the message starts at 2
+	, Counter(2)
+	, KeystreamUsed(CSW_CIPHER_BLOCK_SIZE)
+	, HashBlockSize(0)
+	, AuthenticatedDataSize(0)
+	, MessageSize(0)
+	, bHashingMessage(false)
+{
+	FMemory::Memcpy(Nonce, InNonce, CSW_CIPHER_NONCE_SIZE);
+	FMemory::Memzero(HashState);
+}
+
+bool FCSWAesGcm::HasHardwareSupport()
+{
+#if CSW_AES_HARDWARE
+	static const bool bHasAesAndClmul = CpuHasAesAndClmul();
+	return bHasAesAndClmul;
+#else
+	return false;
+#endif
+}
+
+void FCSWAesGcm::AddAuthenticatedData(const uint8* Data, const int64 Num)
+{
+	check(!bHashingMessage);
+	Hash(Data, Num);
+	AuthenticatedDataSize += Num;
+}
+
+void FCSWAesGcm::Encrypt(const uint8* Src, uint8* Dst, const int64 Num)
+{
+	///Dst is hashed right after being written, while it's still in the cache
+	ApplyKeystream(Src, Dst, Num);
+	Authenticate(Dst, Num);
+}
+
+void FCSWAesGcm::Decrypt(const uint8* Src, uint8* Dst, const int64 Num)
+{
+	Authenticate(Src, Num);
+	ApplyKeystream(Src, Dst, Num);
+}
+
+void FCSWAesGcm::Authenticate(const uint8* Data, const int64 Num)
+{
+	if (!bHashingMessage)
+	{
+		///The authenticated data is padded to a whole block
+		FlushHashBlock();
+		bHashingMessage = true;
+	}
+	Hash(Data, Num);
+	MessageSize += Num;
+}
+
+void FCSWAesGcm::ApplyKeystream(const uint8* Src, uint8* Dst, int64 Num)
+{
+	///Rest of the keystream block the previous piece stopped in
+	while (Num > 0 && KeystreamUsed < CSW_CIPHER_BLOCK_SIZE)
+	{
+		*Dst++ = *Src++ ^ Keystream[KeystreamUsed++];
+		Num--;
+	}
+	const int64 NumBlocks = Num / CSW_CIPHER_BLOCK_SIZE;
+	Key.EncryptBlocksCtr(Nonce, Counter, Src, Dst, NumBlocks);
+	Src += NumBlocks * CSW_CIPHER_BLOCK_SIZE;
+	Dst += NumBlocks * CSW_CIPHER_BLOCK_SIZE;
+	Num -= NumBlocks * CSW_CIPHER_BLOCK_SIZE;
+	if (Num > 0)
+	{
+		const uint8 ZeroBlock[CSW_CIPHER_BLOCK_SIZE] = {};
+		Key.EncryptBlocksCtr(Nonce, Counter, ZeroBlock, Keystream, 1);
+		for (KeystreamUsed = 0; KeystreamUsed < Num; KeystreamUsed++)
+		{
+			Dst[KeystreamUsed] = Src[KeystreamUsed] ^ Keystream[KeystreamUsed];
+		}
+	}
+}
+
+void FCSWAesGcm::Hash(const uint8* Data, int64 Num)
+{
+	if (HashBlockSize > 0)
+	{
+		const int32 Fill = static_cast<int32>(FMath::Min<int64>(Num, CSW_CIPHER_BLOCK_SIZE - HashBlockSize));
+		FMemory::Memcpy(HashBlock + HashBlockSize, Data, Fill);
+		HashBlockSize += Fill;
+		Data += Fill;
+		Num -= Fill;
+		if (HashBlockSize < CSW_CIPHER_BLOCK_SIZE) return;
+		Key.Ghash(HashState, HashBlock, 1);
+		HashBlockSize = 0;
+	}
+	const int64 NumBlocks = Num / CSW_CIPHER_BLOCK_SIZE;
+	Key.Ghash(HashState, Data, NumBlocks);
+	Data += NumBlocks * CSW_CIPHER_BLOCK_SIZE;
+	Num -= NumBlocks * CSW_CIPHER_BLOCK_SIZE;
+	if (Num > 0)
+	{
+		FMemory::Memcpy(HashBlock, Data, Num);
+		HashBlockSize = static_cast<int32>(Num);
+	}
+}
+
+void FCSWAesGcm::FlushHashBlock()
+{
+	if (HashBlockSize <= 0) return;
+	FMemory::Memzero(HashBlock + HashBlockSize, CSW_CIPHER_BLOCK_SIZE - HashBlockSize);
+	Key.Ghash(HashState, HashBlock, 1);
+	HashBlockSize = 0;
+}
+
+void FCSWAesGcm::Finish(uint8* OutTag)
+{
+	FlushHashBlock();
+	///Sizes in bits
+	uint8 Sizes[CSW_CIPHER_BLOCK_SIZE];
+	StoreBigEndian64(Sizes, static_cast<uint64>(AuthenticatedDataSize) * 8);
+	StoreBigEndian64(Sizes + 8, static_cast<uint64>(MessageSize) * 8);
+	Key.Ghash(HashState, Sizes, 1);
+
+	///Tag = GHASH ^ AES(Nonce || 1)
+	uint8 Tag[CSW_CIPHER_BLOCK_SIZE];
+	uint32 TagCounter = 1;
+	Key.EncryptBlocksCtr(Nonce, TagCounter, HashState, Tag, 1);
+	FMemory::Memcpy(OutTag, Tag, CSW_CIPHER_TAG_SIZE);
+}
+
+bool FCSWAesGcm::FinishAndVerify(const uint8* ExpectedTag)
+{
+	uint8 Tag[CSW_CIPHER_TAG_SIZE];
+	Finish(Tag);
+	uint8 Difference = 0;
+	for (int32 Index = 0; Index < CSW_CIPHER_TAG_SIZE; Index++)
+	{
+		Difference |= Tag[Index] ^ ExpectedTag[Index];
+	}
+	return Difference == 0;
+}
+
+void FCSWAesGcm::GenerateNonce(uint8* OutNonce)
+{
+	///Hash of everything that tells this save apart from any other save of any machine
+	static FThreadSafeCounter Sequence;
+	struct FNonceSeed
+	{
+		FGuid Guid;
+		int64 Ticks;
+		uint64 Cycles;
+		uint32 ProcessId;
+		int32 Sequence;
+	} Seed;
+	Seed.Guid = FGuid::NewGuid();
+	Seed.Ticks = FDateTime::UtcNow().GetTicks();
+	Seed.Cycles = FPlatformTime::Cycles64();
+	Seed.ProcessId = FPlatformProcess::GetCurrentProcessId();
+	Seed.Sequence = Sequence.Increment();
+	uint8 Hash[20];
+	FSHA1::HashBuffer(&Seed, sizeof(Seed), Hash);
+	FMemory::Memcpy(OutNonce, Hash, CSW_CIPHER_NONCE_SIZE);
+}
+
+void FCSWAesGcm::MakeChunkNonce(const uint8* SlotNonce, const uint32 ChunkIndex, uint8* OutNonce)
+{
+	FMemory::Memcpy(OutNonce, SlotNonce, CSW_CIPHER_NONCE_SIZE);
+	uint8 Index[4];
+	StoreBigEndian32(Index, ChunkIndex);
+	for (int32 Byte = 0; Byte < 4; Byte++)
+	{
+		OutNonce[Byte] ^= Index[Byte];
+	}
+}
+
+void FCSWAesGcm::MakeSegmentNonce(const uint8* ChunkNonce, const uint32 SegmentIndex, uint8* OutNonce)
+{
+	///The chunk index is in the first 4 bytes, the segment index goes in the next 4
+	FMemory::Memcpy(OutNonce, ChunkNonce, CSW_CIPHER_NONCE_SIZE);
+	uint8 Index[4];
+	StoreBigEndian32(Index, SegmentIndex);
+	for (int32 Byte = 0; Byte < 4; Byte++)
+	{
+		OutNonce[4 + Byte] ^= Index[Byte];
+	}
+}
+
+#pragma endregion
+
+
+#pragma region KEY REGISTRY
+
+FCSWCipherKeyRegistry& FCSWCipherKeyRegistry::Get()
+{
+	static FCSWCipherKeyRegistry Registry;
+	return Registry;
+}
+
+bool FCSWCipherKeyRegistry::RegisterKey(const uint32 KeyId, const TArray<uint8>& Key, const bool bUseForSaving /*= true*/)
+{
+	if (KeyId == 0 || Key.Num() != CSW_CIPHER_KEY_SIZE)
+	{
+		UE_LOG(LogTemp, Error, TEXT("CSWError: Invalid encryption key %u, it must have a non zero ID and %d bytes."), KeyId, CSW_CIPHER_KEY_SIZE);
+		return false;
+	}
+	FCSWCipherKeyPtr CipherKey = MakeShared<FCSWCipherKey, ESPMode::ThreadSafe>(KeyId, Key.GetData());
+	FScopeLock Lock(&KeysLock);
+	Keys.Add(KeyId, CipherKey);
+	if (bUseForSaving)
+	{
+		SavingKeyId = KeyId;
+	}
+	return true;
+}
+
+void FCSWCipherKeyRegistry::UnregisterKey(const uint32 KeyId)
+{
+	FScopeLock Lock(&KeysLock);
+	Keys.Remove(KeyId);
+	if (SavingKeyId == KeyId)
+	{
+		SavingKeyId = 0;
+	}
+}
+
+FCSWCipherKeyPtr FCSWCipherKeyRegistry::FindKey(const uint32 KeyId) const
+{
+	FScopeLock Lock(&KeysLock);
+	const FCSWCipherKeyPtr* CipherKey = Keys.Find(KeyId);
+	return CipherKey ? *CipherKey : FCSWCipherKeyPtr();
+}
+
+bool FCSWCipherKeyRegistry::SetSavingKey(const uint32 KeyId)
+{
+	FScopeLock Lock(&KeysLock);
+	if (KeyId != 0 && !Keys.Contains(KeyId)) return false;
+	SavingKeyId = KeyId;
+	return true;
+}
+
+FCSWCipherKeyPtr FCSWCipherKeyRegistry::GetSavingKey() const
+{
+	return SavingKeyId != 0 ? FindKey(SavingKeyId) : FCSWCipherKeyPtr();
+}
+
+#pragma endregion
+
+
+#pragma region ARCHIVES
+
+/** The name of the chunk, authenticated with each of its segments */
+static void GetChunkAuthenticatedData(const FString& ChunkName, TArray<uint8>& OutData)
+{
+	FTCHARToUTF8 NameUtf8(*ChunkName);
+	OutData.Append(reinterpret_cast<const uint8*>(NameUtf8.Get()), NameUtf8.Length());
+}
+
+/** Cipher of a segment: its nonce, the name of the chunk and whether it's the last segment (a chunk can't be cut at a segment boundary) */
+static void InitSegmentCipher(FCSWAesGcm& Cipher, const TArray<uint8>& AuthenticatedData, const bool bLast)
+{
+	Cipher.AddAuthenticatedData(AuthenticatedData.GetData(), AuthenticatedData.Num());
+	const uint8 LastSegment = bLast ? 1 : 0;
+	Cipher.AddAuthenticatedData(&LastSegment, 1);
+}
+
+FCSWArchiveEncryptProxy::FCSWArchiveEncryptProxy(FArchive& InInnerArchive, const FCSWCipherKey& InKey, const uint8* InChunkNonce, const FString& ChunkName)
+	: FArchiveProxy(InInnerArchive)
+	, Key(InKey)
+	, SegmentSize(0)
+	, SegmentIndex(0)
+{
+	FMemory::Memcpy(ChunkNonce, InChunkNonce, CSW_CIPHER_NONCE_SIZE);
+	GetChunkAuthenticatedData(ChunkName, AuthenticatedData);
+	Segment.SetNumUninitialized(CSW_CIPHER_SEGMENT_SIZE + CSW_CIPHER_TAG_SIZE);
+}
+
+void FCSWArchiveEncryptProxy::Serialize(void* Data, int64 Num)
+{
+	const uint8* Src = static_cast<const uint8*>(Data);
+	while (Num > 0)
+	{
+		///A full segment is written once more data comes, so only the last segment can be empty (if the whole chunk is)
+		if (SegmentSize == CSW_CIPHER_SEGMENT_SIZE)
+		{
+			WriteSegment(false, nullptr);
+		}
+		const int32 Size = static_cast<int32>(FMath::Min<int64>(Num, CSW_CIPHER_SEGMENT_SIZE - SegmentSize));
+		FMemory::Memcpy(Segment.GetData() + SegmentSize, Src, Size);
+		SegmentSize += Size;
+		Src += Size;
+		Num -= Size;
+	}
+}
+
+void FCSWArchiveEncryptProxy::Finish(uint8* OutTag)
+{
+	WriteSegment(true, OutTag);
+}
+
+void FCSWArchiveEncryptProxy::WriteSegment(const bool bLast, uint8* OutTag)
+{
+	uint8 SegmentNonce[CSW_CIPHER_NONCE_SIZE];
+	FCSWAesGcm::MakeSegmentNonce(ChunkNonce, SegmentIndex, SegmentNonce);
+	FCSWAesGcm Cipher(Key, SegmentNonce);
+	InitSegmentCipher(Cipher, AuthenticatedData, bLast);
+	///Encrypted in place, the tag goes right after the segment
+	Cipher.Encrypt(Segment.GetData(), Segment.GetData(), SegmentSize);
+	Cipher.Finish(Segment.GetData() + SegmentSize);
+	if (OutTag)
+	{
+		FMemory::Memcpy(OutTag, Segment.GetData() + SegmentSize, CSW_CIPHER_TAG_SIZE);
+	}
+	InnerArchive.Serialize(Segment.GetData(), SegmentSize + CSW_CIPHER_TAG_SIZE);
+	SegmentIndex++;
+	SegmentSize = 0;
+}
+
+FCSWArchiveDecryptProxy::FCSWArchiveDecryptProxy(FArchive& InInnerArchive, const FCSWCipherKey& InKey, const uint8* InChunkNonce, const FString& ChunkName, const int64 InStoredSize)
+	: FArchiveProxy(InInnerArchive)
+	, Key(InKey)
+	, ChunkStart(InInnerArchive.Tell())
+	, StoredSize(InStoredSize)
+	, SegmentIndex(INDEX_NONE)
+	, SegmentSize(0)
+	, Position(0)
+{
+	FMemory::Memcpy(ChunkNonce, InChunkNonce, CSW_CIPHER_NONCE_SIZE);
+	GetChunkAuthenticatedData(ChunkName, AuthenticatedData);
+	const int64 StoredSegmentSize = CSW_CIPHER_SEGMENT_SIZE + CSW_CIPHER_TAG_SIZE;
+	NumSegments = StoredSize > 0 ? static_cast<int32>(FMath::Min<int64>((StoredSize + StoredSegmentSize - 1) / StoredSegmentSize, MAX_int32)) : 0;
+	Segment.SetNumUninitialized(StoredSegmentSize);
+}
+
+bool FCSWArchiveDecryptProxy::ReadSegment(const int32 Index, const bool bDecrypt)
+{
+	SegmentIndex = INDEX_NONE;
+	const int64 SegmentStart = static_cast<int64>(Index) * (CSW_CIPHER_SEGMENT_SIZE + CSW_CIPHER_TAG_SIZE);
+	const int64 StoredSegmentSize = FMath::Min<int64>(StoredSize - SegmentStart, CSW_CIPHER_SEGMENT_SIZE + CSW_CIPHER_TAG_SIZE);
+	///Past the end of the chunk, or a last segment too short to have its tag
+	if (Index < 0 || Index >= NumSegments || StoredSegmentSize < CSW_CIPHER_TAG_SIZE)
+	{
+		SetError();
+		return false;
+	}
+	///The segments are read in order, the inner archive is only seeked if the chunk is
+	if (InnerArchive.Tell() != ChunkStart + SegmentStart)
+	{
+		InnerArchive.Seek(ChunkStart + SegmentStart);
+	}
+	InnerArchive.Serialize(Segment.GetData(), StoredSegmentSize);
+	if (InnerArchive.IsError())
+	{
+		SetError();
+		return false;
+	}
+	SegmentSize = static_cast<int32>(StoredSegmentSize) - CSW_CIPHER_TAG_SIZE;
+
+	uint8 SegmentNonce[CSW_CIPHER_NONCE_SIZE];
+	FCSWAesGcm::MakeSegmentNonce(ChunkNonce, static_cast<uint32>(Index), SegmentNonce);
+	FCSWAesGcm Cipher(Key, SegmentNonce);
+	InitSegmentCipher(Cipher, AuthenticatedData, Index == NumSegments - 1);
+	///Decrypted in the buffer while it's hashed, nothing of it is handed out before the tag matches
+	if (bDecrypt)
+	{
+		Cipher.Decrypt(Segment.GetData(), Segment.GetData(), SegmentSize);
+	}
+	else
+	{
+		Cipher.Authenticate(Segment.GetData(), SegmentSize);
+	}
+	if (!Cipher.FinishAndVerify(Segment.GetData() + SegmentSize))
+	{
+		UE_LOG(LogTemp, Error, TEXT("CSWError: Corrupt encrypted chunk in save game (segment %d doesn't match its tag)."), Index);
+		SetError();
+		return false;
+	}
+	if (bDecrypt)
+	{
+		SegmentIndex = Index;
+	}
+	return true;
+}
+
+void FCSWArchiveDecryptProxy::Serialize(void* Data, int64 Num)
+{
+	uint8* Dst = static_cast<uint8*>(Data);
+	while (Num > 0 && !IsError())
+	{
+		const int32 Index = static_cast<int32>(Position / CSW_CIPHER_SEGMENT_SIZE);
+		if (Index != SegmentIndex && !ReadSegment(Index, true)) break;
+		const int32 Offset = static_cast<int32>(Position - static_cast<int64>(Index) * CSW_CIPHER_SEGMENT_SIZE);
+		const int32 Size = static_cast<int32>(FMath::Min<int64>(Num, SegmentSize - Offset));
+		///Past the end of the last segment
+		if (Size <= 0)
+		{
+			SetError();
+			break;
+		}
+		FMemory::Memcpy(Dst, Segment.GetData() + Offset, Size);
+		Dst += Size;
+		Num -= Size;
+		Position += Size;
+	}
+	if (Num > 0)
+	{
+		FMemory::Memzero(Dst, Num);
+	}
+}
+
+bool FCSWArchiveDecryptProxy::VerifySegments()
+{
+	for (int32 Index = 0; Index < NumSegments; Index++)
+	{
+		if (!ReadSegment(Index, false)) return false;
+	}
+	return NumSegments > 0;
+}
+
+#pragma endregion
@@ -0,0 +1,400 @@
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+#include "Serialization/CSWCompressedArchive.h"
+#include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+
+/** Blocks bigger than this are considered corrupt when reading */
+static const int32 CSW_COMPRESSED_STREAM_MAX_BLOCK_SIZE = 64 * 1024 * 1024;
+
+/** Compress a block into OutBlock. The block is stored raw if there's no Codec, if it can't be compressed or if it doesn't get smaller */
+static void CompressBlock(const ICSWCompressionCodec* Codec, const uint8* Data, const int32 DataSize, TArray<uint8>& OutBlock)
+{
+	int32 CompressedSize = Codec ? Codec->CompressMemoryBound(DataSize) : DataSize;
+	OutBlock.SetNumUninitialized(CompressedSize, false);
+	const bool bCompressed = Codec && Codec->CompressMemory(OutBlock.GetData(), CompressedSize, Data, DataSize);
+	if (!bCompressed || CompressedSize >= DataSize)
+	{
+		OutBlock.SetNumUninitialized(DataSize, false);
+		FMemory::Memcpy(OutBlock.GetData(), Data, DataSize);
+		return;
+	}
+	OutBlock.SetNumUninitialized(CompressedSize, false);
+}
+
+/** Decompress a block into OutData, which must already have the uncompressed size. Raw blocks are copied */
+static bool UncompressBlock(const ICSWCompressionCodec* Codec, const uint8* Block, const int32 BlockSize, uint8* OutData, const int32 DataSize)
+{
+	if (BlockSize == DataSize)
+	{
+		FMemory::Memcpy(OutData, Block, DataSize);
+		return true;
+	}
+	return Codec && Codec->UncompressMemory(OutData, DataSize, Block, BlockSize);
+}
+
+/** Are the sizes read from a block header possible? */
+static bool IsValidBlockSize(const ICSWCompressionCodec* Codec, const int32 UncompressedSize, const int32 CompressedSize)
+{
+	const int32 MaxCompressedSize = Codec ? FMath::Max(Codec->CompressMemoryBound(UncompressedSize), UncompressedSize) : UncompressedSize;
+	return UncompressedSize > 0 && CompressedSize > 0 && UncompressedSize <= CSW_COMPRESSED_STREAM_MAX_BLOCK_SIZE && CompressedSize <= MaxCompressedSize;
+}
+
+
+#pragma region BLOCK COMPRESSION
+
+bool FCSWBlockCompression::CompressBlocks(const uint8* Data, const int64 DataSize, TArray<uint8>& OutCompressed, ECSWCompressionCodec CodecID, const int32 BlockSize /*= CSW_COMPRESSED_STREAM_BLOCK_SIZE*/)
+{
+	OutCompressed.Reset();
+	if (DataSize < 0 || BlockSize <= 0) return false;
+	const FCSWCompressionCodecPtr Codec = FCSWCompressionCodecRegistry::Get().FindCodecOrDefault(CodecID);
+
+	const int32 NumBlocks = static_cast<int32>((DataSize + BlockSize - 1) / BlockSize);
+	///Compress every block on its own
+	TArray<TArray<uint8>> CompressedBlocks;
+	CompressedBlocks.SetNum(NumBlocks);
+	ParallelFor(NumBlocks, [&](int32 Index)
+	{
+		const int64 Offset = static_cast<int64>(Index) * BlockSize;
+		CompressBlock(Codec.Get(), Data + Offset, static_cast<int32>(FMath::Min<int64>(BlockSize, DataSize - Offset)), CompressedBlocks[Index]);
+	});
+
+	///Header, index and blocks
+	FMemoryWriter Writer(OutCompressed);
+	int32 Magic = CSW_BLOCK_BUFFER_CODEC_MAGIC;
+	int32 SavedCodecID = static_cast<int32>(CodecID);
+	int32 SavedBlockSize = BlockSize;
+	int64 UncompressedSize = DataSize;
+	int32 SavedNumBlocks = NumBlocks;
+	Writer << Magic << SavedCodecID;
+	if (CodecID == ECSWCompressionCodec::ZlibDictionary)
+	{
+		uint32 DictionaryId = Codec->GetDictionaryId();
+		Writer << DictionaryId;
+	}
+	Writer << SavedBlockSize << UncompressedSize << SavedNumBlocks;
+	for (TArray<uint8>& CompressedBlock : CompressedBlocks)
+	{
+		int32 CompressedSize = CompressedBlock.Num();
+		Writer << CompressedSize;
+	}
+	for (TArray<uint8>& CompressedBlock : CompressedBlocks)
+	{
+		Writer.Serialize(CompressedBlock.GetData(), CompressedBlock.Num());
+	}
+	return !Writer.IsError();
+}
+
+bool FCSWBlockCompression::UncompressBlocks(const TArray<uint8>& Compressed, TArray<uint8>& OutData)
+{
+	OutData.Reset();
+	if (!IsBlockBuffer(Compressed)) return false;
+
+	FMemoryReader Reader(Compressed);
+	int32 Magic, BlockSize, NumBlocks;
+	int32 CodecID = static_cast<int32>(ECSWCompressionCodec::Zlib);
+	uint32 DictionaryId = 0;
+	int64 UncompressedSize;
+	Reader << Magic;
+	if (Magic == CSW_BLOCK_BUFFER_CODEC_MAGIC)
+	{
+		Reader << CodecID;
+		if (CodecID == static_cast<int32>(ECSWCompressionCodec::ZlibDictionary))
+		{
+			Reader << DictionaryId;
+		}
+	}
+	Reader << BlockSize << UncompressedSize << NumBlocks;
+	///The codec must be registered (None has no codec, its blocks are all raw)
+	if (CodecID < 0 || !FCSWCompressionCodecRegistry::IsKnownCodec(static_cast<uint8>(CodecID)))
+	{
+		UE_LOG(LogTemp, Error, TEXT("CSWError: Unknown compression codec %d in block buffer."), CodecID);
+		return false;
+	}
+	const FCSWCompressionCodecPtr Codec = FCSWCompressionCodecRegistry::Get().FindCodecForLoading(static_cast<ECSWCompressionCodec>(CodecID), DictionaryId);
+	if (!Codec.IsValid() && CodecID != static_cast<int32>(ECSWCompressionCodec::None))
+	{
+		UE_LOG(LogTemp, Error, TEXT("CSWError: Compression codec %d isn't registered."), CodecID);
+		return false;
+	}
+	///Validation
+	if (Reader.IsError() || BlockSize <= 0 || BlockSize > CSW_COMPRESSED_STREAM_MAX_BLOCK_SIZE || UncompressedSize < 0 || UncompressedSize > MAX_int32
+		|| NumBlocks != static_cast<int32>((UncompressedSize + BlockSize - 1) / BlockSize) || NumBlocks > (Compressed.Num() - Reader.Tell()) / 4)
+	{
+		UE_LOG(LogTemp, Error, TEXT("CSWError: Corrupt header in block buffer."));
+		return false;
+	}
+	///Index: where each block starts
+	TArray<int32> BlockOffsets;
+	TArray<int32> BlockSizes;
+	BlockOffsets.SetNumUninitialized(NumBlocks);
+	BlockSizes.SetNumUninitialized(NumBlocks);
+	int64 Offset = Reader.Tell() + static_cast<int64>(NumBlocks) * sizeof(int32);
+	for (int32 Index = 0; Index < NumBlocks; Index++)
+	{
+		Reader << BlockSizes[Index];
+		const int32 BlockUncompressedSize = static_cast<int32>(FMath::Min<int64>(BlockSize, UncompressedSize - static_cast<int64>(Index) * BlockSize));
+		if (!IsValidBlockSize(Codec.Get(), BlockUncompressedSize, BlockSizes[Index]) || Offset + BlockSizes[Index] > Compressed.Num())
+		{
+			UE_LOG(LogTemp, Error, TEXT("CSWError: Corrupt index in block buffer."));
+			return false;
+		}
+		BlockOffsets[Index] = static_cast<int32>(Offset);
+		Offset += BlockSizes[Index];
+	}
+
+	///Decompress every block straight into its place
+	OutData.SetNumUninitialized(static_cast<int32>(UncompressedSize));
+	FThreadSafeCounter NumFailedBlocks;
+	ParallelFor(NumBlocks, [&](int32 Index)
+	{
+		const int64 DataOffset = static_cast<int64>(Index) * BlockSize;
+		const int32 DataSize = static_cast<int32>(FMath::Min<int64>(BlockSize, UncompressedSize - DataOffset));
+		if (!UncompressBlock(Codec.Get(), Compressed.GetData() + BlockOffsets[Index], BlockSizes[Index], OutData.GetData() + DataOffset, DataSize))
+		{
+			NumFailedBlocks.Increment();
+		}
+	});
+	if (NumFailedBlocks.GetValue() > 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("CSWError: Couldn't decompress block buffer."));
+		OutData.Reset();
+		return false;
+	}
+	return true;
+}
+
+bool FCSWBlockCompression::IsBlockBuffer(const TArray<uint8>& Buffer)
+{
+	if (Buffer.Num() < static_cast<int32>(sizeof(int32))) return false;
+	int32 Magic;
+	FMemoryReader Reader(Buffer);
+	Reader << Magic;
+	return Magic == CSW_BLOCK_BUFFER_MAGIC || Magic == CSW_BLOCK_BUFFER_CODEC_MAGIC;
+}
+
+int32 FCSWBlockCompression::GetNumBlocksInFlight()
+{
+	///One block per worker plus the calling thread
+	const int32 NumWorkers = FTaskGraphInterface::IsRunning() ? FTaskGraphInterface::Get().GetNumWorkerThreads() : 0;
+	return FMath::Clamp(NumWorkers + 1, 1, CSW_COMPRESSED_STREAM_MAX_BLOCKS_IN_FLIGHT);
+}
+
+#pragma endregion
+
+
+#pragma region SAVE COMPRESSED STREAM
+
+FCSWArchiveSaveCompressedStream::FCSWArchiveSaveCompressedStream(FArchive& InInnerArchive, const FCSWCompressionCodecRef& InCodec, const int32 InBlockSize /*= CSW_COMPRESSED_STREAM_BLOCK_SIZE*/)
+	: InnerArchive(InInnerArchive)
+	, Codec(InCodec)
+	, BlockSize(FMath::Max(InBlockSize, 1024))
+	, NumBlocksInFlight(FCSWBlockCompression::GetNumBlocksInFlight())
+	, Position(0)
+	, bClosed(false)
+{
+	ArIsSaving = true;
+	ArIsPersistent = true;
+	PendingData.Reserve(BlockSize * NumBlocksInFlight);
+}
+
+FCSWArchiveSaveCompressedStream::~FCSWArchiveSaveCompressedStream()
+{
+	Close();
+}
+
+void FCSWArchiveSaveCompressedStream::Serialize(void* Data, int64 Num)
+{
+	if (Num <= 0 || bClosed || ArIsError) return;
+
+	const uint8* Source = static_cast<const uint8*>(Data);
+	const int32 BatchSize = BlockSize * NumBlocksInFlight;
+	Position += Num;
+	///Fill the pending blocks, compress them each time they are all full
+	while (Num > 0)
+	{
+		const int64 BytesToCopy = FMath::Min<int64>(Num, BatchSize - PendingData.Num());
+		PendingData.Append(Source, BytesToCopy);
+		Source += BytesToCopy;
+		Num -= BytesToCopy;
+		if (PendingData.Num() >= BatchSize)
+		{
+			WritePendingBlocks();
+		}
+	}
+}
+
+void FCSWArchiveSaveCompressedStream::Flush()
+{
+	WritePendingBlocks();
+	InnerArchive.Flush();
+}
+
+bool FCSWArchiveSaveCompressedStream::Close()
+{
+	if (!bClosed)
+	{
+		WritePendingBlocks();
+		///Write the terminator
+		int32 EndOfStream = 0;
+		InnerArchive << EndOfStream;
+		InnerArchive << EndOfStream;
+		bClosed = true;
+	}
+	return !ArIsError && !InnerArchive.IsError();
+}
+
+void FCSWArchiveSaveCompressedStream::WritePendingBlocks()
+{
+	if (PendingData.Num() <= 0 || bClosed) return;
+
+	const int32 NumBlocks = (PendingData.Num() + BlockSize - 1) / BlockSize;
+	if (CompressedBlocks.Num() < NumBlocks)
+	{
+		CompressedBlocks.SetNum(NumBlocks);
+	}
+	ParallelFor(NumBlocks, [this](int32 Index)
+	{
+		const int32 Offset = Index * BlockSize;
+		CompressBlock(&Codec.Get(), PendingData.GetData() + Offset, FMath::Min(BlockSize, PendingData.Num() - Offset), CompressedBlocks[Index]);
+	});
+	///Blocks are written in order
+	for (int32 Index = 0; Index < NumBlocks; Index++)
+	{
+		int32 UncompressedSize = FMath::Min(BlockSize, PendingData.Num() - Index * BlockSize);
+		int32 CompressedSize = CompressedBlocks[Index].Num();
+		InnerArchive << UncompressedSize;
+		InnerArchive << CompressedSize;
+		InnerArchive.Serialize(CompressedBlocks[Index].GetData(), CompressedSize);
+	}
+	///Keep the allocation, the next batch has the same size
+	PendingData.Reset();
+	if (InnerArchive.IsError())
+	{
+		ArIsError = true;
+	}
+}
+
+#pragma endregion
+
+
+#pragma region LOAD COMPRESSED STREAM
+
+FCSWArchiveLoadCompressedStream::FCSWArchiveLoadCompressedStream(FArchive& InInnerArchive, const FCSWCompressionCodecRef& InCodec)
+	: InnerArchive(InInnerArchive)
+	, Codec(InCodec)
+	, NumBlocksInFlight(FCSWBlockCompression::GetNumBlocksInFlight())
+	, NumBlocks(0)
+	, BlockIndex(0)
+	, BlockOffset(0)
+	, Position(0)
+	, bEndOfStream(false)
+{
+	ArIsLoading = true;
+	ArIsPersistent = true;
+	Blocks.SetNum(NumBlocksInFlight);
+	CompressedBlocks.SetNum(NumBlocksInFlight);
+}
+
+void FCSWArchiveLoadCompressedStream::Serialize(void* Data, int64 Num)
+{
+	if (Num <= 0 || ArIsError) return;
+
+	uint8* Dest = static_cast<uint8*>(Data);
+	while (Num > 0)
+	{
+		///Move to the next block once the current one is consumed, decompress the next batch once all of them are
+		while (BlockIndex < NumBlocks && BlockOffset >= Blocks[BlockIndex].Num())
+		{
+			BlockIndex++;
+			BlockOffset = 0;
+		}
+		if (BlockIndex >= NumBlocks && !ReadNextBlocks())
+		{
+			UE_LOG(LogTemp, Error, TEXT("CSWError: Unexpected end of compressed stream."));
+			ArIsError = true;
+			FMemory::Memzero(Dest, Num);
+			return;
+		}
+		const TArray<uint8>& Block = Blocks[BlockIndex];
+		const int64 BytesToCopy = FMath::Min<int64>(Num, Block.Num() - BlockOffset);
+		FMemory::Memcpy(Dest, Block.GetData() + BlockOffset, BytesToCopy);
+		BlockOffset += BytesToCopy;
+		Position += BytesToCopy;
+		Dest += BytesToCopy;
+		Num -= BytesToCopy;
+	}
+}
+
+void FCSWArchiveLoadCompressedStream::SkipToEnd()
+{
+	while (!ArIsError && ReadNextBlocks())
+	{
+	}
+}
+
+bool FCSWArchiveLoadCompressedStream::ReadNextBlocks()
+{
+	NumBlocks = 0;
+	BlockIndex = 0;
+	BlockOffset = 0;
+	if (bEndOfStream || ArIsError) return false;
+
+	///Read ahead as many blocks as can be decompressed at the same time
+	while (NumBlocks < NumBlocksInFlight)
+	{
+		int32 UncompressedSize = 0;
+		int32 CompressedSize = 0;
+		InnerArchive << UncompressedSize;
+		InnerArchive << CompressedSize;
+		///Terminator
+		if (UncompressedSize == 0 && CompressedSize == 0)
+		{
+			bEndOfStream = true;
+			break;
+		}
+		///Validation
+		if (InnerArchive.IsError() || !IsValidBlockSize(&Codec.Get(), UncompressedSize, CompressedSize))
+		{
+			UE_LOG(LogTemp, Error, TEXT("CSWError: Corrupt block in compressed stream."));
+			ArIsError = true;
+			return false;
+		}
+		Blocks[NumBlocks].SetNumUninitialized(UncompressedSize, false);
+		CompressedBlocks[NumBlocks].SetNumUninitialized(CompressedSize, false);
+		InnerArchive.Serialize(CompressedBlocks[NumBlocks].GetData(), CompressedSize);
+		if (InnerArchive.IsError())
+		{
+			ArIsError = true;
+			return false;
+		}
+		NumBlocks++;
+	}
+	if (NumBlocks == 0) return false;
+
+	FThreadSafeCounter NumFailedBlocks;
+	ParallelFor(NumBlocks, [this, &NumFailedBlocks](int32 Index)
+	{
+		if (!UncompressBlock(&Codec.Get(), CompressedBlocks[Index].GetData(), CompressedBlocks[Index].Num(), Blocks[Index].GetData(), Blocks[Index].Num()))
+		{
+			NumFailedBlocks.Increment();
+		}
+	});
+	if (NumFailedBlocks.GetValue() > 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("CSWError: Couldn't decompress block in compressed stream."));
+		ArIsError = true;
+		NumBlocks = 0;
+		return false;
+	}
+	return true;
+}
+
+#pragma endregion
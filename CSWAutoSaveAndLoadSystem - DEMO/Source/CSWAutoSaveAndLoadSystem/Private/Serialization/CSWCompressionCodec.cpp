@@ -0,0 +1,164 @@
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+#include "Serialization/CSWCompressionCodec.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/CSWCompressionDictionary.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "zlib.h"
+THIRD_PARTY_INCLUDES_END
+
+
+#pragma region ENGINE CODEC
+
+int32 FCSWEngineCompressionCodec::CompressMemoryBound(const int32 UncompressedSize) const
+{
+	return FCompression::CompressMemoryBound(CompressionFlags, UncompressedSize);
+}
+
+bool FCSWEngineCompressionCodec::CompressMemory(void* Dst, int32& CompressedSize, const void* Src, const int32 UncompressedSize) const
+{
+	return FCompression::CompressMemory(CompressionFlags, Dst, CompressedSize, Src, UncompressedSize);
+}
+
+bool FCSWEngineCompressionCodec::UncompressMemory(void* Dst, const int32 UncompressedSize, const void* Src, const int32 CompressedSize) const
+{
+	return FCompression::UncompressMemory(CompressionFlags, Dst, UncompressedSize, Src, CompressedSize);
+}
+
+#pragma endregion
+
+
+#pragma region ZLIB DICTIONARY CODEC
+
+int32 FCSWZlibDictionaryCodec::CompressMemoryBound(const int32 UncompressedSize) const
+{
+	///The stream also stores the ID of the dictionary (4 bytes)
+	return static_cast<int32>(compressBound(static_cast<uLong>(UncompressedSize))) + 4;
+}
+
+bool FCSWZlibDictionaryCodec::CompressMemory(void* Dst, int32& CompressedSize, const void* Src, const int32 UncompressedSize) const
+{
+	z_stream Stream;
+	FMemory::Memzero(Stream);
+	if (deflateInit(&Stream, Z_DEFAULT_COMPRESSION) != Z_OK) return false;
+
+	bool bSuccess = deflateSetDictionary(&Stream, Dictionary.GetData(), Dictionary.Num()) == Z_OK;
+	if (bSuccess)
+	{
+		Stream.next_in = (Bytef*)Src;
+		Stream.avail_in = UncompressedSize;
+		Stream.next_out = (Bytef*)Dst;
+		Stream.avail_out = CompressedSize;
+		bSuccess = deflate(&Stream, Z_FINISH) == Z_STREAM_END;
+		CompressedSize = static_cast<int32>(Stream.total_out);
+	}
+	deflateEnd(&Stream);
+	return bSuccess;
+}
+
+bool FCSWZlibDictionaryCodec::UncompressMemory(void* Dst, const int32 UncompressedSize, const void* Src, const int32 CompressedSize) const
+{
+	z_stream Stream;
+	FMemory::Memzero(Stream);
+	if (inflateInit(&Stream) != Z_OK) return false;
+
+	Stream.next_in = (Bytef*)Src;
+	Stream.avail_in = CompressedSize;
+	Stream.next_out = (Bytef*)Dst;
+	Stream.avail_out = UncompressedSize;
+	int32 Result = inflate(&Stream, Z_FINISH);
+	///Zlib asks for the dictionary once it has read its ID
+	if (Result == Z_NEED_DICT && Stream.adler == static_cast<uLong>(adler32(adler32(0L, Z_NULL, 0), Dictionary.GetData(), Dictionary.Num())))
+	{
+		Result = inflateSetDictionary(&Stream, Dictionary.GetData(), Dictionary.Num()) == Z_OK ? inflate(&Stream, Z_FINISH) : Z_DATA_ERROR;
+	}
+	const bool bSuccess = Result == Z_STREAM_END && Stream.total_out == static_cast<uLong>(UncompressedSize);
+	inflateEnd(&Stream);
+	return bSuccess;
+}
+
+#pragma endregion
+
+
+#pragma region CODEC REGISTRY
+
+FCSWCompressionCodecRegistry& FCSWCompressionCodecRegistry::Get()
+{
+	static FCSWCompressionCodecRegistry Registry;
+	return Registry;
+}
+
+FCSWCompressionCodecRegistry::FCSWCompressionCodecRegistry()
+{
+	///Codecs provided by FCompression. LZ4 isn't part of FCompression, the project has to register it
+	Codecs.Add(static_cast<uint8>(ECSWCompressionCodec::Zlib), MakeShared<FCSWEngineCompressionCodec, ESPMode::ThreadSafe>(ECompressionFlags::COMPRESS_ZLIB));
+	Codecs.Add(static_cast<uint8>(ECSWCompressionCodec::Gzip), MakeShared<FCSWEngineCompressionCodec, ESPMode::ThreadSafe>(ECompressionFlags::COMPRESS_GZIP));
+	Codecs.Add(static_cast<uint8>(ECSWCompressionCodec::ZlibFast), MakeShared<FCSWEngineCompressionCodec, ESPMode::ThreadSafe>(static_cast<ECompressionFlags>(ECompressionFlags::COMPRESS_ZLIB | ECompressionFlags::COMPRESS_BiasSpeed)));
+	Codecs.Add(static_cast<uint8>(ECSWCompressionCodec::Custom), MakeShared<FCSWEngineCompressionCodec, ESPMode::ThreadSafe>(ECompressionFlags::COMPRESS_Custom));
+}
+
+void FCSWCompressionCodecRegistry::RegisterCodec(const ECSWCompressionCodec CodecID, const FCSWCompressionCodecRef& Codec)
+{
+	if (CodecID == ECSWCompressionCodec::None) return;
+	FScopeLock Lock(&CodecsLock);
+	Codecs.Add(static_cast<uint8>(CodecID), Codec);
+}
+
+void FCSWCompressionCodecRegistry::UnregisterCodec(const ECSWCompressionCodec CodecID)
+{
+	FScopeLock Lock(&CodecsLock);
+	Codecs.Remove(static_cast<uint8>(CodecID));
+}
+
+FCSWCompressionCodecPtr FCSWCompressionCodecRegistry::FindCodec(const ECSWCompressionCodec CodecID) const
+{
+	FScopeLock Lock(&CodecsLock);
+	const FCSWCompressionCodecRef* Codec = Codecs.Find(static_cast<uint8>(CodecID));
+	return Codec ? FCSWCompressionCodecPtr(*Codec) : FCSWCompressionCodecPtr();
+}
+
+uint32 FCSWCompressionCodecRegistry::RegisterDictionary(const TArray<uint8>& Dictionary, const bool bUseForSaving /*= true*/)
+{
+	///The same dictionary always gets the same ID
+	const uint32 DictionaryId = FCSWCompressionDictionary::GetDictionaryId(Dictionary);
+	FCSWCompressionCodecRef Codec = MakeShared<FCSWZlibDictionaryCodec, ESPMode::ThreadSafe>(Dictionary, DictionaryId);
+	FScopeLock Lock(&CodecsLock);
+	DictionaryCodecs.Add(DictionaryId, Codec);
+	if (bUseForSaving)
+	{
+		Codecs.Add(static_cast<uint8>(ECSWCompressionCodec::ZlibDictionary), Codec);
+	}
+	return DictionaryId;
+}
+
+FCSWCompressionCodecPtr FCSWCompressionCodecRegistry::FindDictionaryCodec(const uint32 DictionaryId) const
+{
+	FScopeLock Lock(&CodecsLock);
+	const FCSWCompressionCodecRef* Codec = DictionaryCodecs.Find(DictionaryId);
+	return Codec ? FCSWCompressionCodecPtr(*Codec) : FCSWCompressionCodecPtr();
+}
+
+FCSWCompressionCodecPtr FCSWCompressionCodecRegistry::FindCodecForLoading(const ECSWCompressionCodec CodecID, const uint32 DictionaryId) const
+{
+	return CodecID == ECSWCompressionCodec::ZlibDictionary ? FindDictionaryCodec(DictionaryId) : FindCodec(CodecID);
+}
+
+FCSWCompressionCodecPtr FCSWCompressionCodecRegistry::FindCodecOrDefault(ECSWCompressionCodec& InOutCodecID) const
+{
+	if (InOutCodecID == ECSWCompressionCodec::None) return FCSWCompressionCodecPtr();
+	FCSWCompressionCodecPtr Codec = FindCodec(InOutCodecID);
+	if (!Codec.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("CSWError: Compression codec %d isn't registered, using Zlib."), static_cast<int32>(InOutCodecID));
+		InOutCodecID = ECSWCompressionCodec::Zlib;
+		Codec = FindCodec(InOutCodecID);
+	}
+	return Codec;
+}
+
+#pragma endregion
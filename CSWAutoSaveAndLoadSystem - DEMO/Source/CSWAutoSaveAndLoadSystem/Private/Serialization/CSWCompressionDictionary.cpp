@@ -0,0 +1,181 @@
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+#include "Serialization/CSWCompressionDictionary.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+
+/** Size of the segments copied from the corpus into the dictionary */
+static const int32 CSW_DICTIONARY_SEGMENT_SIZE = 64;
+/** Size of the byte sequences counted in the corpus */
+static const int32 CSW_DICTIONARY_DMER_SIZE = 8;
+/** Samples past this size are ignored, the counts of the corpus must fit in memory */
+static const int32 CSW_DICTIONARY_MAX_CORPUS_SIZE = 16 * 1024 * 1024;
+
+static uint64 ReadDmer(const uint8* Data)
+{
+	uint64 Dmer;
+	FMemory::Memcpy(&Dmer, Data, sizeof(uint64));
+	return Dmer;
+}
+
+
+#pragma region TRAINING
+
+TArray<uint8> FCSWCompressionDictionary::Train(const TArray<TArray<uint8>>& Samples, const int32 MaxDictionarySize /*= CSW_DICTIONARY_MAX_SIZE*/)
+{
+	TArray<uint8> Dictionary;
+	const int32 DictionarySize = FMath::Min(MaxDictionarySize, CSW_DICTIONARY_MAX_SIZE);
+	if (Samples.Num() <= 0 || DictionarySize < CSW_DICTIONARY_SEGMENT_SIZE) return Dictionary;
+
+	///Concatenate the samples, remembering where each one starts
+	TArray<uint8> Corpus;
+	TArray<int32> SampleStarts;
+	for (const TArray<uint8>& Sample : Samples)
+	{
+		if (Sample.Num() < CSW_DICTIONARY_DMER_SIZE) continue;
+		if (Corpus.Num() + Sample.Num() > CSW_DICTIONARY_MAX_CORPUS_SIZE) break;
+		SampleStarts.Add(Corpus.Num());
+		Corpus.Append(Sample);
+	}
+	const int32 NumSamples = SampleStarts.Num();
+	if (NumSamples <= 0) return Dictionary;
+	SampleStarts.Add(Corpus.Num());
+
+	///Count in how many samples each dmer appears. A dmer that appears in a single sample isn't worth keeping
+	struct FDmerCount
+	{
+		int32 LastSample = INDEX_NONE;
+		int32 NumSamples = 0;
+	};
+	TMap<uint64, FDmerCount> DmerCounts;
+	for (int32 SampleIndex = 0; SampleIndex < NumSamples; SampleIndex++)
+	{
+		for (int32 Pos = SampleStarts[SampleIndex]; Pos + CSW_DICTIONARY_DMER_SIZE <= SampleStarts[SampleIndex + 1]; Pos++)
+		{
+			FDmerCount& Count = DmerCounts.FindOrAdd(ReadDmer(Corpus.GetData() + Pos));
+			if (Count.LastSample != SampleIndex)
+			{
+				Count.LastSample = SampleIndex;
+				Count.NumSamples++;
+			}
+		}
+	}
+	auto GetDmerScore = [&DmerCounts, &Corpus](const int32 Pos)
+	{
+		if (Pos + CSW_DICTIONARY_DMER_SIZE > Corpus.Num()) return 0;
+		const FDmerCount* Count = DmerCounts.Find(ReadDmer(Corpus.GetData() + Pos));
+		return (Count && Count->NumSamples > 1) ? Count->NumSamples : 0;
+	};
+
+	///Pick the best segment of each epoch
+	struct FSegment
+	{
+		int32 Start;
+		int64 Score;
+	};
+	TArray<FSegment> Segments;
+	const int32 NumSegments = DictionarySize / CSW_DICTIONARY_SEGMENT_SIZE;
+	const int32 EpochSize = FMath::Max(Corpus.Num() / NumSegments, CSW_DICTIONARY_SEGMENT_SIZE);
+	const int32 DmersPerSegment = CSW_DICTIONARY_SEGMENT_SIZE - CSW_DICTIONARY_DMER_SIZE + 1;
+	TArray<int32> EpochScores;
+	for (int32 EpochStart = 0; EpochStart + CSW_DICTIONARY_SEGMENT_SIZE <= Corpus.Num() && Segments.Num() < NumSegments; EpochStart += EpochSize)
+	{
+		const int32 EpochEnd = FMath::Min(EpochStart + EpochSize, Corpus.Num());
+		EpochScores.Reset(EpochEnd - EpochStart);
+		for (int32 Pos = EpochStart; Pos < EpochEnd; Pos++)
+		{
+			EpochScores.Add(GetDmerScore(Pos));
+		}
+		///Rolling sum of the scores of the dmers of each segment
+		int64 Score = 0;
+		for (int32 Index = 0; Index < DmersPerSegment; Index++)
+		{
+			Score += EpochScores[Index];
+		}
+		FSegment BestSegment = { EpochStart, Score };
+		for (int32 Index = 1; Index + CSW_DICTIONARY_SEGMENT_SIZE <= EpochScores.Num(); Index++)
+		{
+			Score += EpochScores[Index + DmersPerSegment - 1] - EpochScores[Index - 1];
+			if (Score > BestSegment.Score)
+			{
+				BestSegment = { EpochStart + Index, Score };
+			}
+		}
+		if (BestSegment.Score <= 0) continue;
+		Segments.Add(BestSegment);
+		///The dmers of the segment are in the dictionary now, they don't score anymore
+		for (int32 Pos = BestSegment.Start; Pos < BestSegment.Start + DmersPerSegment; Pos++)
+		{
+			if (FDmerCount* Count = DmerCounts.Find(ReadDmer(Corpus.GetData() + Pos)))
+			{
+				Count->NumSamples = 0;
+			}
+		}
+	}
+
+	///Best segments last, zlib reaches the end of the dictionary with shorter distances
+	Segments.Sort([](const FSegment& A, const FSegment& B) { return A.Score < B.Score; });
+	Dictionary.Reserve(Segments.Num() * CSW_DICTIONARY_SEGMENT_SIZE);
+	for (const FSegment& Segment : Segments)
+	{
+		Dictionary.Append(Corpus.GetData() + Segment.Start, CSW_DICTIONARY_SEGMENT_SIZE);
+	}
+	return Dictionary;
+}
+
+uint32 FCSWCompressionDictionary::GetDictionaryId(const TArray<uint8>& Dictionary)
+{
+	return FCrc::MemCrc32(Dictionary.GetData(), Dictionary.Num());
+}
+
+#pragma endregion
+
+
+#pragma region DICTIONARY FILES
+
+bool FCSWCompressionDictionary::SaveToFile(const TArray<uint8>& Dictionary, const FString& FilePath)
+{
+	if (Dictionary.Num() <= 0) return false;
+
+	TArray<uint8> FileData;
+	FMemoryWriter Writer(FileData);
+	int32 Magic = CSW_DICTIONARY_FILE_MAGIC;
+	uint32 DictionaryId = GetDictionaryId(Dictionary);
+	TArray<uint8> DictionaryToSave = Dictionary;
+	Writer << Magic << DictionaryId << DictionaryToSave;
+	return FFileHelper::SaveArrayToFile(FileData, *FilePath);
+}
+
+bool FCSWCompressionDictionary::LoadFromFile(const FString& FilePath, TArray<uint8>& OutDictionary)
+{
+	OutDictionary.Reset();
+	TArray<uint8> FileData;
+	if (!FFileHelper::LoadFileToArray(FileData, *FilePath)) return false;
+
+	FMemoryReader Reader(FileData);
+	int32 Magic = 0;
+	uint32 DictionaryId = 0;
+	Reader << Magic;
+	if (Magic != CSW_DICTIONARY_FILE_MAGIC)
+	{
+		UE_LOG(LogTemp, Error, TEXT("CSWError: %s isn't a compression dictionary."), *FilePath);
+		return false;
+	}
+	Reader << DictionaryId << OutDictionary;
+	///The ID is the CRC of the dictionary, a mismatch means the file is corrupt
+	if (Reader.IsError() || OutDictionary.Num() <= 0 || DictionaryId != GetDictionaryId(OutDictionary))
+	{
+		UE_LOG(LogTemp, Error, TEXT("CSWError: Corrupt compression dictionary %s."), *FilePath);
+		OutDictionary.Reset();
+		return false;
+	}
+	return true;
+}
+
+#pragma endregion
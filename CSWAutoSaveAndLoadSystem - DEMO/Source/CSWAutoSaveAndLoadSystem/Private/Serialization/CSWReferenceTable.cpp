@@ -0,0 +1,257 @@
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+#include "Serialization/CSWReferenceTable.h"
+#include "UObject/UObjectGlobals.h"
+
+
+#pragma region REFERENCE TABLE
+
+void FCSWReferenceTable::BuildIndices()
+{
+	NameIndices.Reset();
+	for (int32 Index = 0; Index < Names.Num(); Index++)
+	{
+		NameIndices.Add(Names[Index], Index);
+	}
+	ObjectIndices.Reset();
+	for (int32 Index = 0; Index < ObjectPaths.Num(); Index++)
+	{
+		ObjectIndices.Add(ObjectPaths[Index], Index);
+	}
+	ObjectPointerIndices.Reset();
+}
+
+uint32 FCSWReferenceTable::AddName(const FName& Name)
+{
+	if (NameIndices.Num() != Names.Num())
+	{
+		BuildIndices();
+	}
+	if (const int32* Index = NameIndices.Find(Name))
+	{
+		return *Index;
+	}
+	const int32 Index = Names.Add(Name);
+	NameIndices.Add(Name, Index);
+	return Index;
+}
+
+uint32 FCSWReferenceTable::AddObject(UObject* Object)
+{
+	if (!Object) return 0;
+	if (ObjectIndices.Num() != ObjectPaths.Num())
+	{
+		BuildIndices();
+	}
+	const TWeakObjectPtr<UObject> ObjectPointer(Object);
+	if (const int32* Index = ObjectPointerIndices.Find(ObjectPointer))
+	{
+		return *Index + 1;
+	}
+	const uint32 Index = AddObjectPath(Object->GetPathName());
+	ObjectPointerIndices.Add(ObjectPointer, Index - 1);
+	return Index;
+}
+
+uint32 FCSWReferenceTable::AddObjectPath(const FString& ObjectPath)
+{
+	if (ObjectIndices.Num() != ObjectPaths.Num())
+	{
+		BuildIndices();
+	}
+	if (const int32* Index = ObjectIndices.Find(ObjectPath))
+	{
+		return *Index + 1;
+	}
+	const int32 Index = ObjectPaths.Add(ObjectPath);
+	ObjectIndices.Add(ObjectPath, Index);
+	return Index + 1;
+}
+
+FName FCSWReferenceTable::GetName(const uint32 Index) const
+{
+	return Names.IsValidIndex(Index) ? Names[Index] : NAME_None;
+}
+
+UObject* FCSWReferenceTable::ResolveObject(const uint32 Index, const bool bLoadIfFindFails) const
+{
+	if (Index == 0 || !ObjectPaths.IsValidIndex(Index - 1)) return nullptr;
+	if (ResolvedObjects.Num() != ObjectPaths.Num())
+	{
+		ResolvedObjects.SetNum(ObjectPaths.Num());
+	}
+	TWeakObjectPtr<UObject>& ResolvedObject = ResolvedObjects[Index - 1];
+	if (UObject* Object = ResolvedObject.Get())
+	{
+		return Object;
+	}
+	///Same lookup as FObjectAndNameAsStringProxyArchive
+	const FString& ObjectPath = ObjectPaths[Index - 1];
+	UObject* Object = FindObject<UObject>(nullptr, *ObjectPath, false);
+	if (!Object && bLoadIfFindFails)
+	{
+		Object = LoadObject<UObject>(nullptr, *ObjectPath);
+	}
+	ResolvedObject = Object;
+	return Object;
+}
+
+void FCSWReferenceTable::ResetResolvedObjects() const
+{
+	ResolvedObjects.Reset();
+}
+
+void FCSWReferenceTable::OnLoaded()
+{
+	BuildIndices();
+	ResetResolvedObjects();
+}
+
+#pragma endregion
+
+
+#pragma region REFERENCE LIST
+
+/** 7 bits per byte, the high bit tells if another byte follows */
+static void SerializeVarint(FArchive& Ar, uint32& Value)
+{
+	if (Ar.IsLoading())
+	{
+		Value = 0;
+		uint8 Byte = 0;
+		int32 Shift = 0;
+		do
+		{
+			Ar << Byte;
+			Value |= static_cast<uint32>(Byte & 0x7F) << Shift;
+			Shift += 7;
+		} while ((Byte & 0x80) && Shift < 32 && !Ar.IsError());
+	}
+	else
+	{
+		uint32 Remaining = Value;
+		do
+		{
+			uint8 Byte = Remaining & 0x7F;
+			Remaining >>= 7;
+			if (Remaining)
+			{
+				Byte |= 0x80;
+			}
+			Ar << Byte;
+		} while (Remaining);
+	}
+}
+
+static void SerializeOffsets(FArchive& Ar, TArray<int32, TInlineAllocator<16>>& Offsets)
+{
+	int32 NumOffsets = Offsets.Num();
+	Ar << NumOffsets;
+	if (Ar.IsLoading())
+	{
+		///An offset takes at least a byte, don't trust counts bigger than what is left of the archive
+		if (NumOffsets < 0 || NumOffsets > Ar.TotalSize() - Ar.Tell())
+		{
+			Ar.ArIsError = true;
+			return;
+		}
+		Offsets.SetNumUninitialized(NumOffsets);
+	}
+	int32 PreviousOffset = 0;
+	for (int32& Offset : Offsets)
+	{
+		uint32 Distance = Offset - PreviousOffset;
+		SerializeVarint(Ar, Distance);
+		Offset = PreviousOffset + Distance;
+		PreviousOffset = Offset;
+	}
+}
+
+FArchive& operator<<(FArchive& Ar, FCSWReferenceList& List)
+{
+	SerializeOffsets(Ar, List.NameOffsets);
+	SerializeOffsets(Ar, List.ObjectOffsets);
+	return Ar;
+}
+
+bool FCSWReferenceList::Remap(TArray<uint8>& Data, const FCSWReferenceTable& From, FCSWReferenceTable& To) const
+{
+	for (const int32 Offset : NameOffsets)
+	{
+		if (Offset < 0 || Offset > Data.Num() - static_cast<int32>(sizeof(uint32))) return false;
+		uint32 Index = 0;
+		FMemory::Memcpy(&Index, Data.GetData() + Offset, sizeof(uint32));
+		Index = To.AddName(From.GetName(Index));
+		FMemory::Memcpy(Data.GetData() + Offset, &Index, sizeof(uint32));
+	}
+	for (const int32 Offset : ObjectOffsets)
+	{
+		if (Offset < 0 || Offset > Data.Num() - static_cast<int32>(sizeof(uint32))) return false;
+		uint32 Index = 0;
+		FMemory::Memcpy(&Index, Data.GetData() + Offset, sizeof(uint32));
+		Index = Index > 0 && From.ObjectPaths.IsValidIndex(Index - 1) ? To.AddObjectPath(From.ObjectPaths[Index - 1]) : 0;
+		FMemory::Memcpy(Data.GetData() + Offset, &Index, sizeof(uint32));
+	}
+	return true;
+}
+
+#pragma endregion
+
+
+#pragma region REFERENCE TABLE ARCHIVE
+
+FCSWReferenceTableArchive::FCSWReferenceTableArchive(FArchive& InInnerArchive, FCSWReferenceTable& InTable, FCSWReferenceList& InReferences)
+	: FCSWSaveGameArchive(InInnerArchive, false)
+	, Table(InTable)
+	, MutableTable(&InTable)
+	, References(&InReferences)
+{
+}
+
+FCSWReferenceTableArchive::FCSWReferenceTableArchive(FArchive& InInnerArchive, bool bInLoadIfFindFails, const FCSWReferenceTable& InTable)
+	: FCSWSaveGameArchive(InInnerArchive, bInLoadIfFindFails)
+	, Table(InTable)
+	, MutableTable(nullptr)
+	, References(nullptr)
+{
+}
+
+FArchive& FCSWReferenceTableArchive::operator<<(FName& N)
+{
+	uint32 Index = 0;
+	if (IsLoading())
+	{
+		InnerArchive << Index;
+		N = Table.GetName(Index);
+	}
+	else if (MutableTable)
+	{
+		References->NameOffsets.Add(static_cast<int32>(InnerArchive.Tell()));
+		Index = MutableTable->AddName(N);
+		InnerArchive << Index;
+	}
+	return *this;
+}
+
+FArchive& FCSWReferenceTableArchive::operator<<(UObject*& Obj)
+{
+	uint32 Index = 0;
+	if (IsLoading())
+	{
+		InnerArchive << Index;
+		Obj = Table.ResolveObject(Index, bLoadIfFindFails);
+	}
+	else if (MutableTable)
+	{
+		References->ObjectOffsets.Add(static_cast<int32>(InnerArchive.Tell()));
+		Index = MutableTable->AddObject(Obj);
+		InnerArchive << Index;
+	}
+	return *this;
+}
+
+#pragma endregion
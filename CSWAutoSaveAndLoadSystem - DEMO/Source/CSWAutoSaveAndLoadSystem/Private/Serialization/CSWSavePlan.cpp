@@ -0,0 +1,585 @@
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+#include "Serialization/CSWSavePlan.h"
+#include "Serialization/CSWReferenceTable.h"
+#include "Serialization/CSWChecksum.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "Misc/Crc.h"
+#include "Misc/ScopeLock.h"
+
+
+#pragma region SAVE PLAN
+
+/** Type of a variable as it's stored in the layouts: a variable loads into another only if both have the same signature */
+static FString GetPropertySignature(const UProperty* Property)
+{
+	FString ExtendedType;
+	FString Signature = Property->GetClass()->GetName() + TEXT(" ") + Property->GetCPPType(&ExtendedType) + ExtendedType;
+	if (Property->ArrayDim > 1)
+	{
+		Signature += FString::Printf(TEXT("[%d]"), Property->ArrayDim);
+	}
+	return Signature;
+}
+
+FCSWSavePlan::FCSWSavePlan(UClass* Class)
+	: PlannedClass(Class)
+	, PropertyLink(Class->PropertyLink)
+	, PropertiesSize(Class->GetPropertiesSize())
+{
+	///The variables the tagged path would save: SaveGame flagged and persistent
+	for (TFieldIterator<UProperty> It(Class); It; ++It)
+	{
+		UProperty* Property = *It;
+		if (!Property->HasAnyPropertyFlags(CPF_SaveGame) || Property->HasAnyPropertyFlags(CPF_Transient | CPF_Deprecated | CPF_SkipSerialization)) continue;
+
+		FCSWSavePlanStep Step;
+		Step.Offset = Property->GetOffset_ForInternal();
+		Step.Property = Property;
+		if (Property->IsA<UNumericProperty>())
+		{
+			Step.Kind = FCSWSavePlanStep::EKind::Raw;
+			Step.Size = Property->ElementSize * Property->ArrayDim;
+		}
+		else if (Property->IsA<UBoolProperty>() && Property->ArrayDim == 1)
+		{
+			Step.Kind = FCSWSavePlanStep::EKind::Bool;
+			Step.Size = 1;
+		}
+		else
+		{
+			Step.Kind = FCSWSavePlanStep::EKind::Item;
+			Step.Size = -1;
+		}
+		PropertySteps.Add(Step);
+	}
+	PropertySteps.StableSort([](const FCSWSavePlanStep& A, const FCSWSavePlanStep& B) { return A.Offset < B.Offset; });
+
+	///Layout and its hash
+	FString LayoutText;
+	for (int32 Index = 0; Index < PropertySteps.Num(); Index++)
+	{
+		const FCSWSavePlanStep& Step = PropertySteps[Index];
+		const FName Name = Step.Property->GetFName();
+		const FString Signature = GetPropertySignature(Step.Property);
+		Layout.Names.Add(Name);
+		Layout.Signatures.Add(Signature);
+		Layout.FixedSizes.Add(Step.Size);
+		PropertyIndices.Add(Name, Index);
+		LayoutText += FString::Printf(TEXT("%s %s %d;"), *Name.ToString(), *Signature, Step.Size);
+	}
+	Layout.LayoutHash = FCrc::StrCrc32(*LayoutText);
+
+	///Merge the numeric variables that are contiguous in memory, they are copied at once
+	for (const FCSWSavePlanStep& Step : PropertySteps)
+	{
+		FCSWSavePlanStep* Previous = Steps.Num() > 0 ? &Steps.Last() : nullptr;
+		if (Previous && Step.Kind == FCSWSavePlanStep::EKind::Raw && Previous->Kind == FCSWSavePlanStep::EKind::Raw && Previous->Offset + Previous->Size == Step.Offset)
+		{
+			Previous->Size += Step.Size;
+			continue;
+		}
+		Steps.Add(Step);
+	}
+}
+
+bool FCSWSavePlan::IsValidFor(const UClass* Class) const
+{
+	return PlannedClass.Get() == Class && Class->PropertyLink == PropertyLink && Class->GetPropertiesSize() == PropertiesSize;
+}
+
+void FCSWSavePlan::SaveStep(const FCSWSavePlanStep& Step, uint8* Base, FArchive& Ar)
+{
+	uint8* Value = Base + Step.Offset;
+	switch (Step.Kind)
+	{
+	case FCSWSavePlanStep::EKind::Raw:
+		Ar.Serialize(Value, Step.Size);
+		break;
+	case FCSWSavePlanStep::EKind::Bool:
+	{
+		uint8 bValue = static_cast<const UBoolProperty*>(Step.Property)->GetPropertyValue(Value) ? 1 : 0;
+		Ar << bValue;
+		break;
+	}
+	case FCSWSavePlanStep::EKind::Item:
+	{
+		///The size is patched once the value is written
+		const int64 SizePos = Ar.Tell();
+		int32 ItemSize = 0;
+		Ar << ItemSize;
+		for (int32 Index = 0; Index < Step.Property->ArrayDim; Index++)
+		{
+			Step.Property->SerializeItem(Ar, Value + Index * Step.Property->ElementSize, nullptr);
+		}
+		const int64 EndPos = Ar.Tell();
+		ItemSize = static_cast<int32>(EndPos - SizePos - sizeof(int32));
+		Ar.Seek(SizePos);
+		Ar << ItemSize;
+		Ar.Seek(EndPos);
+		break;
+	}
+	}
+}
+
+void FCSWSavePlan::LoadStep(const FCSWSavePlanStep& Step, uint8* Base, FArchive& Ar)
+{
+	uint8* Value = Base + Step.Offset;
+	switch (Step.Kind)
+	{
+	case FCSWSavePlanStep::EKind::Raw:
+		Ar.Serialize(Value, Step.Size);
+		break;
+	case FCSWSavePlanStep::EKind::Bool:
+	{
+		uint8 bValue = 0;
+		Ar << bValue;
+		static_cast<const UBoolProperty*>(Step.Property)->SetPropertyValue(Value, bValue != 0);
+		break;
+	}
+	case FCSWSavePlanStep::EKind::Item:
+	{
+		int32 ItemSize = 0;
+		Ar << ItemSize;
+		const int64 EndPos = Ar.Tell() + ItemSize;
+		for (int32 Index = 0; Index < Step.Property->ArrayDim; Index++)
+		{
+			Step.Property->SerializeItem(Ar, Value + Index * Step.Property->ElementSize, nullptr);
+		}
+		///Never read past the value, even if its property read less or more than it was written
+		Ar.Seek(EndPos);
+		break;
+	}
+	}
+}
+
+/** The variable has the same value(s) in Object and Defaults */
+static bool IsIdenticalToDefault(const UProperty* Property, const UObject* Object, const UObject* Defaults)
+{
+	for (int32 ArrayIndex = 0; ArrayIndex < Property->ArrayDim; ArrayIndex++)
+	{
+		if (!Property->Identical_InContainer(Object, Defaults, ArrayIndex)) return false;
+	}
+	return true;
+}
+
+bool FCSWSavePlan::CanBeDefaultsOf(const UObject* Defaults, const UObject* Object)
+{
+	return Defaults && Defaults != Object && Defaults->IsA(Object->GetClass());
+}
+
+void FCSWSavePlan::CopyDefault(const FCSWSavePlanStep& Step, UObject* Object, const UObject* Defaults)
+{
+	if (Defaults)
+	{
+		Step.Property->CopyCompleteValue_InContainer(Object, Defaults);
+	}
+}
+
+void FCSWSavePlan::Save(UObject* Object, FArchive& Ar, const UObject* Defaults /*= nullptr*/) const
+{
+	uint8* Base = reinterpret_cast<uint8*>(Object);
+	if (!Defaults)
+	{
+		for (const FCSWSavePlanStep& Step : Steps)
+		{
+			SaveStep(Step, Base, Ar);
+		}
+		return;
+	}
+	///A presence bit per variable, then the values of the variables that differ from the defaults
+	TArray<uint8, TInlineAllocator<16>> PresenceBits;
+	PresenceBits.SetNumZeroed((PropertySteps.Num() + 7) / 8);
+	for (int32 Index = 0; Index < PropertySteps.Num(); Index++)
+	{
+		if (!IsIdenticalToDefault(PropertySteps[Index].Property, Object, Defaults))
+		{
+			PresenceBits[Index >> 3] |= 1 << (Index & 7);
+		}
+	}
+	Ar.Serialize(PresenceBits.GetData(), PresenceBits.Num());
+	for (int32 Index = 0; Index < PropertySteps.Num(); Index++)
+	{
+		if (PresenceBits[Index >> 3] & (1 << (Index & 7)))
+		{
+			SaveStep(PropertySteps[Index], Base, Ar);
+		}
+	}
+}
+
+void FCSWSavePlan::Load(UObject* Object, FArchive& Ar, const bool bDelta /*= false*/, const UObject* Defaults /*= nullptr*/) const
+{
+	uint8* Base = reinterpret_cast<uint8*>(Object);
+	if (!bDelta)
+	{
+		for (const FCSWSavePlanStep& Step : Steps)
+		{
+			if (Ar.IsError()) return;
+			LoadStep(Step, Base, Ar);
+		}
+		return;
+	}
+	TArray<uint8, TInlineAllocator<16>> PresenceBits;
+	PresenceBits.SetNumZeroed((PropertySteps.Num() + 7) / 8);
+	Ar.Serialize(PresenceBits.GetData(), PresenceBits.Num());
+	for (int32 Index = 0; Index < PropertySteps.Num() && !Ar.IsError(); Index++)
+	{
+		if (PresenceBits[Index >> 3] & (1 << (Index & 7)))
+		{
+			LoadStep(PropertySteps[Index], Base, Ar);
+		}
+		else
+		{
+			CopyDefault(PropertySteps[Index], Object, Defaults);
+		}
+	}
+}
+
+void FCSWSavePlan::LoadFromLayout(UObject* Object, FArchive& Ar, const FCSWClassLayout& SavedLayout, const bool bDelta /*= false*/, const UObject* Defaults /*= nullptr*/) const
+{
+	uint8* Base = reinterpret_cast<uint8*>(Object);
+	const int32 NumSaved = FMath::Min3(SavedLayout.Names.Num(), SavedLayout.Signatures.Num(), SavedLayout.FixedSizes.Num());
+	TArray<uint8, TInlineAllocator<16>> PresenceBits;
+	if (bDelta)
+	{
+		PresenceBits.SetNumZeroed((SavedLayout.Names.Num() + 7) / 8);
+		Ar.Serialize(PresenceBits.GetData(), PresenceBits.Num());
+	}
+	for (int32 SavedIndex = 0; SavedIndex < NumSaved && !Ar.IsError(); SavedIndex++)
+	{
+		const int32* Index = PropertyIndices.Find(SavedLayout.Names[SavedIndex]);
+		const bool bMatches = Index && Layout.Signatures[*Index] == SavedLayout.Signatures[SavedIndex];
+		if (bDelta && !(PresenceBits[SavedIndex >> 3] & (1 << (SavedIndex & 7))))
+		{
+			///Saved with the default value
+			if (bMatches)
+			{
+				CopyDefault(PropertySteps[*Index], Object, Defaults);
+			}
+			continue;
+		}
+
+		///Where the saved value ends, to skip it whether it's loaded or not
+		const int64 ValuePos = Ar.Tell();
+		int64 EndPos = ValuePos + SavedLayout.FixedSizes[SavedIndex];
+		if (SavedLayout.FixedSizes[SavedIndex] < 0)
+		{
+			int32 ItemSize = 0;
+			Ar << ItemSize;
+			EndPos = Ar.Tell() + ItemSize;
+			Ar.Seek(ValuePos);
+		}
+		if (bMatches)
+		{
+			LoadStep(PropertySteps[*Index], Base, Ar);
+		}
+		Ar.Seek(EndPos);
+	}
+}
+
+#pragma endregion
+
+
+#pragma region SAVE PLAN CACHE
+
+FCSWSavePlanCache& FCSWSavePlanCache::Get()
+{
+	static FCSWSavePlanCache Cache;
+	return Cache;
+}
+
+void FCSWSavePlanCache::SetEnabled(const bool bEnable)
+{
+	FScopeLock Lock(&CacheLock);
+	bEnabled = bEnable;
+}
+
+bool FCSWSavePlanCache::IsEnabled() const
+{
+	FScopeLock Lock(&CacheLock);
+	return bEnabled;
+}
+
+void FCSWSavePlanCache::SetUseReferenceTables(const bool bEnable)
+{
+	FScopeLock Lock(&CacheLock);
+	bUseReferenceTables = bEnable;
+}
+
+bool FCSWSavePlanCache::GetUseReferenceTables() const
+{
+	FScopeLock Lock(&CacheLock);
+	return bUseReferenceTables;
+}
+
+void FCSWSavePlanCache::SetUseDeltaFromDefaults(const bool bEnable)
+{
+	FScopeLock Lock(&CacheLock);
+	bUseDeltaFromDefaults = bEnable;
+}
+
+bool FCSWSavePlanCache::GetUseDeltaFromDefaults() const
+{
+	FScopeLock Lock(&CacheLock);
+	return bUseDeltaFromDefaults;
+}
+
+FCSWSavePlanPtr FCSWSavePlanCache::FindOrBuild(UClass* Class)
+{
+	FScopeLock Lock(&CacheLock);
+	FCSWSavePlanPtr& Plan = Plans.FindOrAdd(Class);
+	if (!Plan.IsValid() || !Plan->IsValidFor(Class))
+	{
+		Plan = MakeShareable(new FCSWSavePlan(Class));
+		Layouts.Add(Plan->GetLayoutHash(), Plan->GetLayout());
+	}
+	return Plan;
+}
+
+void FCSWSavePlanCache::RegisterLayouts(const TArray<FCSWClassLayout>& InLayouts)
+{
+	FScopeLock Lock(&CacheLock);
+	for (const FCSWClassLayout& Layout : InLayouts)
+	{
+		if (!Layouts.Contains(Layout.LayoutHash))
+		{
+			Layouts.Add(Layout.LayoutHash, Layout);
+		}
+	}
+}
+
+bool FCSWSavePlanCache::FindLayout(const uint32 LayoutHash, FCSWClassLayout& OutLayout) const
+{
+	FScopeLock Lock(&CacheLock);
+	const FCSWClassLayout* Layout = Layouts.Find(LayoutHash);
+	if (!Layout) return false;
+	OutLayout = *Layout;
+	return true;
+}
+
+void FCSWSavePlanCache::CollectLayouts(const TArray<FCSWMapRecord>& LevelsRecord, TArray<FCSWClassLayout>& OutLayouts) const
+{
+	///Only the first bytes of each record are read
+	TSet<uint32> LayoutHashes;
+	FCSWSavePlanHeader Header;
+	for (const FCSWMapRecord& MapRecord : LevelsRecord)
+	{
+		for (const FCSWActorRecord& ActorRecord : MapRecord.ActorsRecord)
+		{
+			if (ReadHeader(ActorRecord.Data, Header))
+			{
+				LayoutHashes.Add(Header.LayoutHash);
+			}
+			for (const FCSWActorComponentRecord& ComponentRecord : ActorRecord.ComponentsRecord)
+			{
+				if (ReadHeader(ComponentRecord.Data, Header))
+				{
+					LayoutHashes.Add(Header.LayoutHash);
+				}
+			}
+		}
+	}
+
+	OutLayouts.Reset(LayoutHashes.Num());
+	FScopeLock Lock(&CacheLock);
+	for (const uint32 Hash : LayoutHashes)
+	{
+		if (const FCSWClassLayout* Layout = Layouts.Find(Hash))
+		{
+			OutLayouts.Add(*Layout);
+		}
+	}
+	OutLayouts.Sort([](const FCSWClassLayout& A, const FCSWClassLayout& B) { return A.LayoutHash < B.LayoutHash; });
+}
+
+void FCSWSavePlanCache::SaveObject(UObject* Object, TArray<uint8>& OutData, FCSWReferenceTable* Table /*= nullptr*/)
+{
+	///Written straight into OutData, its memory is reused when the record is updated in place
+	OutData.Reset();
+	FMemoryWriter MemoryWriter(OutData, true);
+	if (!IsEnabled())
+	{
+		/// Use a wrapper archive that converts FNames and UObject*'s to strings that can be read back in
+		FCSWSaveGameArchive Ar(MemoryWriter, false);
+		Object->Serialize(Ar);
+		return;
+	}
+	FCSWSavePlanPtr Plan = FindOrBuild(Object->GetClass());
+	const UObject* Defaults = GetUseDeltaFromDefaults() ? Object->GetArchetype() : nullptr;
+	if (!FCSWSavePlan::CanBeDefaultsOf(Defaults, Object))
+	{
+		Defaults = nullptr;
+	}
+	const bool bUseTable = Table && GetUseReferenceTables();
+
+	uint32 Magic = CSW_SAVE_PLAN_MAGIC;
+	uint32 LayoutHash = Plan->GetLayoutHash();
+	uint8 Flags = (bUseTable ? ECSWSavePlanFlags::ReferenceTable : 0) | (Defaults ? ECSWSavePlanFlags::Delta : 0);
+	MemoryWriter << Magic;
+	MemoryWriter << LayoutHash;
+	MemoryWriter << Flags;
+	if (bUseTable)
+	{
+		///The offset of the reference list is patched once the values are written
+		int32 ReferencesOffset = 0;
+		MemoryWriter << ReferencesOffset;
+		FCSWReferenceList References;
+		FCSWReferenceTableArchive Ar(MemoryWriter, *Table, References);
+		Plan->Save(Object, Ar, Defaults);
+		ReferencesOffset = static_cast<int32>(MemoryWriter.Tell());
+		MemoryWriter << References;
+		const int64 EndPos = MemoryWriter.Tell();
+		MemoryWriter.Seek(CSW_SAVE_PLAN_HEADER_SIZE);
+		MemoryWriter << ReferencesOffset;
+		MemoryWriter.Seek(EndPos);
+	}
+	else
+	{
+		FCSWSaveGameArchive Ar(MemoryWriter, false);
+		Plan->Save(Object, Ar, Defaults);
+	}
+}
+
+/** Writes the names and objects by identity, the values are only hashed */
+class FCSWHashWriter : public FMemoryWriter
+{
+public:
+	FCSWHashWriter(TArray<uint8>& InBytes)
+		: FMemoryWriter(InBytes)
+	{
+		ArIsSaveGame = true;
+		ArNoDelta = true;
+	}
+
+	virtual FArchive& operator<<(FName& N) override
+	{
+		int32 Index = N.GetDisplayIndex();
+		int32 Number = N.GetNumber();
+		return *this << Index << Number;
+	}
+
+	virtual FArchive& operator<<(UObject*& Obj) override
+	{
+		UPTRINT Pointer = reinterpret_cast<UPTRINT>(Obj);
+		Serialize(&Pointer, sizeof(Pointer));
+		return *this;
+	}
+};
+
+uint32 FCSWSavePlanCache::HashObject(UObject* Object, TArray<uint8>& Scratch, const uint32 Crc /*= 0*/)
+{
+	if (!Object) return Crc;
+	FCSWSavePlanPtr Plan = FindOrBuild(Object->GetClass());
+	Scratch.Reset();
+	FCSWHashWriter Writer(Scratch);
+	Plan->Save(Object, Writer);
+	return FCSWChecksum::Crc32C(Scratch.GetData(), Scratch.Num(), Crc);
+}
+
+/** Load planned data with the plan of the class of Object */
+static void LoadPlannedObject(FCSWSavePlanCache& Cache, UObject* Object, FArchive& Ar, const FCSWSavePlanHeader& Header)
+{
+	Ar.Seek(Header.Size);
+	const bool bDelta = (Header.Flags & ECSWSavePlanFlags::Delta) != 0;
+	const UObject* Defaults = bDelta ? Object->GetArchetype() : nullptr;
+	if (!FCSWSavePlan::CanBeDefaultsOf(Defaults, Object))
+	{
+		Defaults = nullptr;
+	}
+	FCSWSavePlanPtr Plan = Cache.FindOrBuild(Object->GetClass());
+	if (Plan->GetLayoutHash() == Header.LayoutHash)
+	{
+		Plan->Load(Object, Ar, bDelta, Defaults);
+		return;
+	}
+	///The class changed since the data was saved
+	FCSWClassLayout SavedLayout;
+	if (!Cache.FindLayout(Header.LayoutHash, SavedLayout))
+	{
+		UE_LOG(LogTemp, Error, TEXT("CSWError: The layout %u the data of %s was saved with is unknown, its SaveGame variables aren't loaded."), Header.LayoutHash, *Object->GetName());
+		return;
+	}
+	Plan->LoadFromLayout(Object, Ar, SavedLayout, bDelta, Defaults);
+}
+
+void FCSWSavePlanCache::LoadObject(UObject* Object, const TArray<uint8>& Data, const FCSWReferenceTable* Table /*= nullptr*/)
+{
+	FMemoryReader MemoryReader(Data, true);
+	FCSWSavePlanHeader Header;
+	if (!ReadHeader(Data, Header))
+	{
+		FCSWSaveGameArchive Ar(MemoryReader, true);
+		Object->Serialize(Ar);
+		return;
+	}
+	if (!(Header.Flags & ECSWSavePlanFlags::ReferenceTable))
+	{
+		FCSWSaveGameArchive Ar(MemoryReader, true);
+		LoadPlannedObject(*this, Object, Ar, Header);
+		return;
+	}
+	if (!Table)
+	{
+		UE_LOG(LogTemp, Error, TEXT("CSWError: The data of %s references the names and objects of a save game, but it's loaded without it."), *Object->GetName());
+		return;
+	}
+	FCSWReferenceTableArchive Ar(MemoryReader, true, *Table);
+	LoadPlannedObject(*this, Object, Ar, Header);
+}
+
+bool FCSWSavePlanCache::ReadHeader(const TArray<uint8>& Data, FCSWSavePlanHeader& OutHeader)
+{
+	if (Data.Num() < CSW_SAVE_PLAN_HEADER_SIZE) return false;
+	uint32 Magic = 0;
+	FMemory::Memcpy(&Magic, Data.GetData(), sizeof(uint32));
+	if (Magic != CSW_SAVE_PLAN_MAGIC) return false;
+	FMemory::Memcpy(&OutHeader.LayoutHash, Data.GetData() + sizeof(uint32), sizeof(uint32));
+	OutHeader.Flags = Data[sizeof(uint32) * 2];
+	OutHeader.Size = CSW_SAVE_PLAN_HEADER_SIZE;
+	OutHeader.ReferencesOffset = INDEX_NONE;
+	if (OutHeader.Flags & ECSWSavePlanFlags::ReferenceTable)
+	{
+		OutHeader.Size += sizeof(int32);
+		if (Data.Num() < OutHeader.Size) return false;
+		FMemory::Memcpy(&OutHeader.ReferencesOffset, Data.GetData() + CSW_SAVE_PLAN_HEADER_SIZE, sizeof(int32));
+		if (OutHeader.ReferencesOffset < OutHeader.Size || OutHeader.ReferencesOffset > Data.Num()) return false;
+	}
+	return true;
+}
+
+bool FCSWSavePlanCache::RemapReferences(TArray<uint8>& Data, const FCSWReferenceTable& From, FCSWReferenceTable& To)
+{
+	FCSWSavePlanHeader Header;
+	///Tagged data writes names and objects as strings
+	if (!ReadHeader(Data, Header) || Header.ReferencesOffset == INDEX_NONE) return true;
+	FCSWReferenceList References;
+	FMemoryReader MemoryReader(Data, true);
+	MemoryReader.Seek(Header.ReferencesOffset);
+	MemoryReader << References;
+	///The indices are in the values, the reference list stays as it is
+	return !MemoryReader.IsError() && References.Remap(Data, From, To);
+}
+
+void FCSWSavePlanCache::RemapReferences(FCSWMapRecord& MapRecord, const FCSWReferenceTable& From, FCSWReferenceTable& To)
+{
+	int32 NumDamaged = 0;
+	for (FCSWActorRecord& ActorRecord : MapRecord.ActorsRecord)
+	{
+		NumDamaged += RemapReferences(ActorRecord.Data, From, To) ? 0 : 1;
+		for (FCSWActorComponentRecord& ComponentRecord : ActorRecord.ComponentsRecord)
+		{
+			NumDamaged += RemapReferences(ComponentRecord.Data, From, To) ? 0 : 1;
+		}
+	}
+	if (NumDamaged > 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("CSWError: The names and objects of %d records of the level %s couldn't be moved to another reference table, their data is damaged."), NumDamaged, *MapRecord.Name.ToString());
+	}
+}
+
+#pragma endregion
@@ -0,0 +1,387 @@
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+#include "Serialization/CSWTransformCodec.h"
+#include "Math/Float16.h"
+
+
+#pragma region QUANTIZATION
+
+/** What is in the pose of the actor */
+namespace ECSWActorPoseFlags
+{
+	enum Type : uint8
+	{
+		/** The location is fixed point inside the bounds, floats otherwise */
+		QuantizedLocation = 1 << 0,
+		/** The scale isn't the identity */
+		Scale = 1 << 1,
+	};
+}
+
+/** The smallest three components of a normalized quaternion are within +-1/sqrt(2) */
+static const float SmallestThreeRange = 0.707106781f;
+
+/** Write the low NumBytes bytes of Value, least significant first */
+static void SavePacked(FArchive& Ar, const uint64 Value, const int32 NumBytes)
+{
+	for (int32 Index = 0; Index < NumBytes; Index++)
+	{
+		uint8 Byte = static_cast<uint8>(Value >> (Index * 8));
+		Ar << Byte;
+	}
+}
+
+static uint64 LoadPacked(FArchive& Ar, const int32 NumBytes)
+{
+	uint64 Value = 0;
+	for (int32 Index = 0; Index < NumBytes; Index++)
+	{
+		uint8 Byte = 0;
+		Ar << Byte;
+		Value |= static_cast<uint64>(Byte) << (Index * 8);
+	}
+	return Value;
+}
+
+static uint32 QuantizeUnit(const float Value, const int32 Bits)
+{
+	const uint32 MaxValue = (1u << Bits) - 1;
+	return static_cast<uint32>(FMath::Clamp(FMath::RoundToInt(FMath::Clamp(Value, 0.f, 1.f) * MaxValue), 0, static_cast<int32>(MaxValue)));
+}
+
+static float DequantizeUnit(const uint32 Value, const int32 Bits)
+{
+	return static_cast<float>(static_cast<double>(Value) / ((1u << Bits) - 1));
+}
+
+/** Smallest three: the index of the largest component and the other three, in (2 + 3 * Bits) bits */
+static void SaveRotation(FArchive& Ar, const FQuat& Rotation, const int32 Bits)
+{
+	const FQuat Normalized = Rotation.GetNormalized();
+	const float Components[4] = { Normalized.X, Normalized.Y, Normalized.Z, Normalized.W };
+	int32 Largest = 0;
+	for (int32 Index = 1; Index < 4; Index++)
+	{
+		if (FMath::Abs(Components[Index]) > FMath::Abs(Components[Largest]))
+		{
+			Largest = Index;
+		}
+	}
+	///Q and -Q are the same rotation, the dropped component is always positive
+	const float Sign = Components[Largest] < 0.f ? -1.f : 1.f;
+	uint64 Packed = static_cast<uint64>(Largest);
+	int32 Shift = 2;
+	for (int32 Index = 0; Index < 4; Index++)
+	{
+		if (Index == Largest) continue;
+		const float Unit = (Components[Index] * Sign / SmallestThreeRange) * 0.5f + 0.5f;
+		Packed |= static_cast<uint64>(QuantizeUnit(Unit, Bits)) << Shift;
+		Shift += Bits;
+	}
+	SavePacked(Ar, Packed, (Shift + 7) / 8);
+}
+
+static FQuat LoadRotation(FArchive& Ar, const int32 Bits)
+{
+	const uint64 Packed = LoadPacked(Ar, (2 + 3 * Bits + 7) / 8);
+	const int32 Largest = static_cast<int32>(Packed & 3);
+	const uint64 Mask = (1ull << Bits) - 1;
+	float Components[4];
+	float SumSquares = 0.f;
+	int32 Shift = 2;
+	for (int32 Index = 0; Index < 4; Index++)
+	{
+		if (Index == Largest) continue;
+		Components[Index] = (DequantizeUnit(static_cast<uint32>((Packed >> Shift) & Mask), Bits) * 2.f - 1.f) * SmallestThreeRange;
+		SumSquares += Components[Index] * Components[Index];
+		Shift += Bits;
+	}
+	Components[Largest] = FMath::Sqrt(FMath::Max(0.f, 1.f - SumSquares));
+	return FQuat(Components[0], Components[1], Components[2], Components[3]).GetNormalized();
+}
+
+/** Fixed point inside the bounds, Bits per axis */
+static void SaveLocation(FArchive& Ar, const FVector& Location, const FBox& Bounds, const int32 Bits)
+{
+	const FVector Extent = Bounds.Max - Bounds.Min;
+	for (int32 Axis = 0; Axis < 3; Axis++)
+	{
+		const float Unit = Extent[Axis] > 0.f ? (Location[Axis] - Bounds.Min[Axis]) / Extent[Axis] : 0.f;
+		SavePacked(Ar, QuantizeUnit(Unit, Bits), Bits / 8);
+	}
+}
+
+static FVector LoadLocation(FArchive& Ar, const FBox& Bounds, const int32 Bits)
+{
+	const FVector Extent = Bounds.Max - Bounds.Min;
+	FVector Location;
+	for (int32 Axis = 0; Axis < 3; Axis++)
+	{
+		const uint32 Value = static_cast<uint32>(LoadPacked(Ar, Bits / 8));
+		Location[Axis] = Bounds.Min[Axis] + static_cast<float>(static_cast<double>(Value) / ((1u << Bits) - 1) * Extent[Axis]);
+	}
+	return Location;
+}
+
+/** Half floats if bQuantized, floats otherwise */
+static void SaveVelocity(FArchive& Ar, const FVector& Velocity, const bool bQuantized)
+{
+	if (bQuantized)
+	{
+		FFloat16 X(Velocity.X), Y(Velocity.Y), Z(Velocity.Z);
+		Ar << X << Y << Z;
+		return;
+	}
+	FVector FloatVelocity = Velocity;
+	Ar << FloatVelocity;
+}
+
+static FVector LoadVelocity(FArchive& Ar, const bool bQuantized)
+{
+	if (bQuantized)
+	{
+		FFloat16 X, Y, Z;
+		Ar << X << Y << Z;
+		return FVector(X, Y, Z);
+	}
+	FVector Velocity;
+	Ar << Velocity;
+	return Velocity;
+}
+
+#pragma endregion
+
+
+#pragma region TRANSFORM CODEC
+
+FBox FCSWTransformCodec::ComputeBounds(const FCSWMapRecord& MapRecord)
+{
+	FBox Bounds(ForceInit);
+	for (const FCSWActorRecord& ActorRecord : MapRecord.ActorsRecord)
+	{
+		if (IsQuantized(ActorRecord))
+		{
+			Bounds += ActorRecord.XForm.GetLocation();
+		}
+	}
+	return Bounds;
+}
+
+bool FCSWTransformCodec::IsCompactData(const TArray<uint8>& Data)
+{
+	if (Data.Num() < sizeof(uint32)) return false;
+	uint32 Magic = 0;
+	FMemory::Memcpy(&Magic, Data.GetData(), sizeof(uint32));
+	return Magic == CSW_COMPACT_RECORD_MAGIC;
+}
+
+void FCSWTransformCodec::GetBits(const ECSWTransformPrecision Precision, int32& OutLocationBits, int32& OutRotationBits)
+{
+	const bool bHigh = Precision != ECSWTransformPrecision::Low;
+	OutLocationBits = bHigh ? 24 : 16;
+	OutRotationBits = bHigh ? 15 : 10;
+}
+
+void FCSWTransformCodec::SaveCompactRecord(FArchive& Ar, FCSWActorRecord& ActorRecord, const FBox& Bounds)
+{
+	uint32 Magic = CSW_COMPACT_RECORD_MAGIC;
+	uint8 Precision = static_cast<uint8>(ActorRecord.Precision);
+	Ar << Magic << Precision;
+
+	///The record and its components are written natively without the transform and the fields, they go in the pose
+	FCSWRecordVersion::SaveHeader(Ar);
+	ActorRecord.SerializeRecord(Ar, FCSWRecordVersion::LatestVersion, false);
+
+	SavePose(Ar, ActorRecord, Bounds);
+}
+
+void FCSWTransformCodec::LoadCompactRecord(FArchive& Ar, FCSWActorRecord& ActorRecord, const FBox& Bounds)
+{
+	uint32 Magic = 0;
+	uint8 Precision = 0;
+	Ar << Magic << Precision;
+	if (Magic != CSW_COMPACT_RECORD_MAGIC || Precision > static_cast<uint8>(ECSWTransformPrecision::Low))
+	{
+		Ar.SetError();
+		return;
+	}
+	int32 Version = 0;
+	if (FCSWRecordVersion::LoadHeader(Ar, Version))
+	{
+		if (Ar.IsError()) return;
+		ActorRecord.SerializeRecord(Ar, Version, false);
+	}
+	else
+	{
+		///Compact records of older saves have the record and its components tagged
+		FCSWActorRecord::StaticStruct()->SerializeItem(Ar, &ActorRecord, nullptr);
+		int32 NumComponents = 0;
+		Ar << NumComponents;
+		if (Ar.IsError() || NumComponents < 0) return;
+		ActorRecord.ComponentsRecord.Reset(NumComponents);
+		for (int32 ComponentIndex = 0; ComponentIndex < NumComponents && !Ar.IsError(); ComponentIndex++)
+		{
+			FCSWActorComponentRecord& ComponentRecord = ActorRecord.ComponentsRecord[ActorRecord.ComponentsRecord.AddDefaulted()];
+			FCSWActorComponentRecord::StaticStruct()->SerializeItem(Ar, &ComponentRecord, nullptr);
+		}
+	}
+	ActorRecord.Precision = static_cast<ECSWTransformPrecision>(Precision);
+	if (Ar.IsError()) return;
+
+	LoadPose(Ar, ActorRecord, Bounds);
+}
+
+void FCSWTransformCodec::SavePose(FArchive& Ar, const FCSWActorRecord& ActorRecord, const FBox& Bounds)
+{
+	const bool bQuantized = IsQuantized(ActorRecord);
+	int32 LocationBits, RotationBits;
+	GetBits(ActorRecord.Precision, LocationBits, RotationBits);
+
+	///Actor
+	const FVector Location = ActorRecord.XForm.GetLocation();
+	FVector Scale = ActorRecord.XForm.GetScale3D();
+	uint8 Flags = 0;
+	if (bQuantized && Bounds.IsValid && Bounds.IsInsideOrOn(Location))
+	{
+		Flags |= ECSWActorPoseFlags::QuantizedLocation;
+	}
+	if (!Scale.Equals(FVector::OneVector, 0.f))
+	{
+		Flags |= ECSWActorPoseFlags::Scale;
+	}
+	Ar << Flags;
+	if (Flags & ECSWActorPoseFlags::QuantizedLocation)
+	{
+		SaveLocation(Ar, Location, Bounds, LocationBits);
+	}
+	else
+	{
+		FVector FloatLocation = Location;
+		Ar << FloatLocation;
+	}
+	if (bQuantized)
+	{
+		SaveRotation(Ar, ActorRecord.XForm.GetRotation(), RotationBits);
+	}
+	else
+	{
+		FQuat Rotation = ActorRecord.XForm.GetRotation();
+		Ar << Rotation;
+	}
+	if (Flags & ECSWActorPoseFlags::Scale)
+	{
+		Ar << Scale;
+	}
+
+	///Components, only the fields that were captured (see FCSWAutoSaveComponentOption)
+	for (const FCSWActorComponentRecord& ComponentRecord : ActorRecord.ComponentsRecord)
+	{
+		uint8 Fields = ComponentRecord.Fields & static_cast<uint8>(ECSWComponentRecordField::All);
+		Ar << Fields;
+		if (ComponentRecord.HasField(ECSWComponentRecordField::Location))
+		{
+			FVector RelativeLocation = ComponentRecord.Loc;
+			Ar << RelativeLocation;
+		}
+		if (ComponentRecord.HasField(ECSWComponentRecordField::Rotation))
+		{
+			if (bQuantized)
+			{
+				SaveRotation(Ar, ComponentRecord.Rot.Quaternion(), RotationBits);
+			}
+			else
+			{
+				FRotator RelativeRotation = ComponentRecord.Rot;
+				Ar << RelativeRotation;
+			}
+		}
+		if (ComponentRecord.HasField(ECSWComponentRecordField::Scale))
+		{
+			FVector RelativeScale = ComponentRecord.Scale;
+			Ar << RelativeScale;
+		}
+		if (ComponentRecord.HasField(ECSWComponentRecordField::LinearVelocity))
+		{
+			SaveVelocity(Ar, ComponentRecord.LinearVel, bQuantized);
+		}
+		if (ComponentRecord.HasField(ECSWComponentRecordField::AngularVelocity))
+		{
+			SaveVelocity(Ar, ComponentRecord.AngularVel, bQuantized);
+		}
+	}
+}
+
+void FCSWTransformCodec::LoadPose(FArchive& Ar, FCSWActorRecord& ActorRecord, const FBox& Bounds)
+{
+	const bool bQuantized = IsQuantized(ActorRecord);
+	int32 LocationBits, RotationBits;
+	GetBits(ActorRecord.Precision, LocationBits, RotationBits);
+
+	///Actor
+	uint8 Flags = 0;
+	Ar << Flags;
+	FVector Location;
+	if (Flags & ECSWActorPoseFlags::QuantizedLocation)
+	{
+		Location = LoadLocation(Ar, Bounds, LocationBits);
+	}
+	else
+	{
+		Ar << Location;
+	}
+	FQuat Rotation = FQuat::Identity;
+	if (bQuantized)
+	{
+		Rotation = LoadRotation(Ar, RotationBits);
+	}
+	else
+	{
+		Ar << Rotation;
+	}
+	FVector Scale = FVector::OneVector;
+	if (Flags & ECSWActorPoseFlags::Scale)
+	{
+		Ar << Scale;
+	}
+	ActorRecord.XForm = FTransform(Rotation, Location, Scale);
+
+	///Components, the fields that are missing keep the defaults of FCSWActorComponentRecord
+	for (FCSWActorComponentRecord& ComponentRecord : ActorRecord.ComponentsRecord)
+	{
+		if (Ar.IsError()) return;
+		Ar << ComponentRecord.Fields;
+		if (ComponentRecord.HasField(ECSWComponentRecordField::Location))
+		{
+			Ar << ComponentRecord.Loc;
+		}
+		if (ComponentRecord.HasField(ECSWComponentRecordField::Rotation))
+		{
+			if (bQuantized)
+			{
+				ComponentRecord.Rot = LoadRotation(Ar, RotationBits).Rotator();
+			}
+			else
+			{
+				Ar << ComponentRecord.Rot;
+			}
+		}
+		if (ComponentRecord.HasField(ECSWComponentRecordField::Scale))
+		{
+			Ar << ComponentRecord.Scale;
+		}
+		if (ComponentRecord.HasField(ECSWComponentRecordField::LinearVelocity))
+		{
+			ComponentRecord.LinearVel = LoadVelocity(Ar, bQuantized);
+		}
+		if (ComponentRecord.HasField(ECSWComponentRecordField::AngularVelocity))
+		{
+			ComponentRecord.AngularVel = LoadVelocity(Ar, bQuantized);
+		}
+	}
+}
+
+#pragma endregion
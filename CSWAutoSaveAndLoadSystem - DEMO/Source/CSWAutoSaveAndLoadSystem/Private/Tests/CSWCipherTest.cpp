@@ -0,0 +1,137 @@
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+#include "Serialization/CSWCipher.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/** A NIST AES-256-GCM vector (test cases 13 to 16 of the GCM specification), in hex */
+struct FCSWAesGcmTestVector
+{
+	const TCHAR* Key;
+	const TCHAR* Nonce;
+	const TCHAR* Plaintext;
+	const TCHAR* AuthenticatedData;
+	const TCHAR* Ciphertext;
+	const TCHAR* Tag;
+};
+
+static const FCSWAesGcmTestVector AesGcmTestVectors[] =
+{
+	{
+		TEXT("0000000000000000000000000000000000000000000000000000000000000000"),
+		TEXT("000000000000000000000000"),
+		TEXT(""),
+		TEXT(""),
+		TEXT(""),
+		TEXT("530f8afbc74536b9a963b4f1c4cb738b")
+	},
+	{
+		TEXT("0000000000000000000000000000000000000000000000000000000000000000"),
+		TEXT("000000000000000000000000"),
+		TEXT("00000000000000000000000000000000"),
+		TEXT(""),
+		TEXT("cea7403d4d606b6e074ec5d3baf39d18"),
+		TEXT("d0d1c8a799996bf0265b98b5d48ab919")
+	},
+	{
+		TEXT("feffe9928665731c6d6a8f9467308308feffe9928665731c6d6a8f9467308308"),
+		TEXT("cafebabefacedbaddecaf888"),
+		TEXT("d9313225f88406e5a55909c5aff5269a86a7a9531534f7da2e4c303d8a318a721c3c0c95956809532fcf0e2449a6b525b16aedf5aa0de657ba637b391aafd255"),
+		TEXT(""),
+		TEXT("522dc1f099567d07f47f37a32a84427d643a8cdcbfe5c0c97598a2bd2555d1aa8cb08e48590dbb3da7b08b1056828838c5f61e6393ba7a0abcc9f662898015ad"),
+		TEXT("b094dac5d93471bdec1a502270e3cc6c")
+	},
+	{
+		TEXT("feffe9928665731c6d6a8f9467308308feffe9928665731c6d6a8f9467308308"),
+		TEXT("cafebabefacedbaddecaf888"),
+		TEXT("d9313225f88406e5a55909c5aff5269a86a7a9531534f7da2e4c303d8a318a721c3c0c95956809532fcf0e2449a6b525b16aedf5aa0de657ba637b39"),
+		TEXT("feedfacedeadbeeffeedfacedeadbeefabaddad2"),
+		TEXT("522dc1f099567d07f47f37a32a84427d643a8cdcbfe5c0c97598a2bd2555d1aa8cb08e48590dbb3da7b08b1056828838c5f61e6393ba7a0abcc9f662"),
+		TEXT("76fc6ece0f4e1768cddf8853bb2d551b")
+	}
+};
+
+static TArray<uint8> CSWHexToBytes(const TCHAR* Hex)
+{
+	const FString HexString(Hex);
+	TArray<uint8> Bytes;
+	Bytes.SetNumZeroed(HexString.Len() / 2);
+	if (Bytes.Num() > 0)
+	{
+		HexToBytes(HexString, Bytes.GetData());
+	}
+	return Bytes;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCSWAesGcmVectorsTest, "CSWAutoSaveAndLoadSystem.Cipher.AesGcmVectors", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FCSWAesGcmVectorsTest::RunTest(const FString& Parameters)
+{
+	///The software path always runs, the hardware path only where the CPU has it
+	const bool bHasHardware = FCSWAesGcm::HasHardwareSupport();
+	if (!bHasHardware)
+	{
+		AddWarning(TEXT("The CPU doesn't run AES-GCM in hardware, only the software path is tested."));
+	}
+
+	for (int32 Path = 0; Path < (bHasHardware ? 2 : 1); Path++)
+	{
+		const bool bHardware = Path == 1;
+		const TCHAR* PathName = bHardware ? TEXT("hardware") : TEXT("software");
+		for (int32 VectorIndex = 0; VectorIndex < ARRAY_COUNT(AesGcmTestVectors); VectorIndex++)
+		{
+			const FCSWAesGcmTestVector& Vector = AesGcmTestVectors[VectorIndex];
+			const TArray<uint8> Key = CSWHexToBytes(Vector.Key);
+			const TArray<uint8> Nonce = CSWHexToBytes(Vector.Nonce);
+			const TArray<uint8> Plaintext = CSWHexToBytes(Vector.Plaintext);
+			const TArray<uint8> AuthenticatedData = CSWHexToBytes(Vector.AuthenticatedData);
+			const TArray<uint8> Ciphertext = CSWHexToBytes(Vector.Ciphertext);
+			const TArray<uint8> Tag = CSWHexToBytes(Vector.Tag);
+
+			const FCSWCipherKey CipherKey(1, Key.GetData(), bHardware);
+			TestEqual(FString::Printf(TEXT("Key of vector %d runs on the %s path"), VectorIndex, PathName), CipherKey.UsesHardware(), bHardware);
+
+			///Encrypted in pieces that stop in the middle of blocks, like the segments of a chunk are
+			TArray<uint8> Encrypted;
+			Encrypted.SetNumZeroed(Plaintext.Num());
+			uint8 EncryptedTag[CSW_CIPHER_TAG_SIZE];
+			FCSWAesGcm Encryption(CipherKey, Nonce.GetData());
+			Encryption.AddAuthenticatedData(AuthenticatedData.GetData(), AuthenticatedData.Num());
+			const int32 PieceSizes[] = { 7, 16, 21 };
+			int32 Offset = 0;
+			for (int32 PieceIndex = 0; Offset < Plaintext.Num(); PieceIndex++)
+			{
+				const int32 PieceSize = FMath::Min(PieceSizes[PieceIndex % ARRAY_COUNT(PieceSizes)], Plaintext.Num() - Offset);
+				Encryption.Encrypt(Plaintext.GetData() + Offset, Encrypted.GetData() + Offset, PieceSize);
+				Offset += PieceSize;
+			}
+			Encryption.Finish(EncryptedTag);
+			TestTrue(FString::Printf(TEXT("Ciphertext of vector %d (%s)"), VectorIndex, PathName), Encrypted == Ciphertext);
+			TestTrue(FString::Printf(TEXT("Tag of vector %d (%s)"), VectorIndex, PathName), FMemory::Memcmp(EncryptedTag, Tag.GetData(), CSW_CIPHER_TAG_SIZE) == 0);
+
+			TArray<uint8> Decrypted;
+			Decrypted.SetNumZeroed(Ciphertext.Num());
+			FCSWAesGcm Decryption(CipherKey, Nonce.GetData());
+			Decryption.AddAuthenticatedData(AuthenticatedData.GetData(), AuthenticatedData.Num());
+			Decryption.Decrypt(Ciphertext.GetData(), Decrypted.GetData(), Ciphertext.Num());
+			TestTrue(FString::Printf(TEXT("Tag of vector %d verifies (%s)"), VectorIndex, PathName), Decryption.FinishAndVerify(Tag.GetData()));
+			TestTrue(FString::Printf(TEXT("Plaintext of vector %d (%s)"), VectorIndex, PathName), Decrypted == Plaintext);
+
+			///A flipped bit of the tag is rejected
+			TArray<uint8> BadTag = Tag;
+			BadTag[0] ^= 1;
+			FCSWAesGcm Verification(CipherKey, Nonce.GetData());
+			Verification.AddAuthenticatedData(AuthenticatedData.GetData(), AuthenticatedData.Num());
+			Verification.Authenticate(Ciphertext.GetData(), Ciphertext.Num());
+			TestFalse(FString::Printf(TEXT("Wrong tag of vector %d is rejected (%s)"), VectorIndex, PathName), Verification.FinishAndVerify(BadTag.GetData()));
+		}
+	}
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
@@ -1,561 +1,857 @@
-/**
-* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
-*
-* Developed by Kevin Yabar Garces
-*/
-
-#pragma once
-
-#include "Kismet/GameplayStatics.h"
-#include "Field/Struct/CSWAutoSaveStruct.h"
-#include "CSWAutoSaveBlueprintLibrary.generated.h"
-
-/**
-* Structure that holds an Actor reference and its respective AutosaveComponent
-*/
-USTRUCT(BlueprintType)
-struct FCSWAutosaveActor
-{
-	GENERATED_USTRUCT_BODY()
-	/**
-	* The array of Actor references
-	*/
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Actor", meta = (DisplayName = "Actor"))
-		AActor* Actor;
-	/**
-	* The array of CSWAutosaveComponent references
-	*/
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CSW", meta = (DisplayName = "AutosaveComponent"))
-		UCSWAutoSaveComponent* AutosaveComponent;
-
-	FCSWAutosaveActor()
-	{
-
-	}
-};
-/**
-* Structure that holds a Level Name, each Level Names has an array AutosaveActors Associated.
-*/
-USTRUCT(BlueprintType)
-struct FCSWLevelWithAutosaveActors
-{
-	GENERATED_USTRUCT_BODY()
-	/**
-	* The name of the level (can be many levels in a single file)
-	*/
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Name", meta = (DisplayName = "Level Name"))
-		FName Name;
-	/**
-	* The array of AutosaveActors
-	*/
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AutosaveActor", meta = (DisplayName = "Autosave Actors"))
-		TArray<FCSWAutosaveActor> AutosaveActors;
-
-	FCSWLevelWithAutosaveActors()
-	{
-
-	}
-};
-
-/// Save and load to disk
-DECLARE_DYNAMIC_DELEGATE_OneParam(FCSWOnSaveGameResponse, const bool, bWasSuccesful);
-DECLARE_DYNAMIC_DELEGATE_OneParam(FCSWOnLoadGameResponse, USaveGame*, SaveObject);
-/// Convert and restore object
-DECLARE_DYNAMIC_DELEGATE_OneParam(FOnRestoreObject, UObject*, ObjectFromString);
-DECLARE_DYNAMIC_DELEGATE_OneParam(FOnConvertObject, FString, ObjectAsString);
-
- /**
- * GameplayStatics Blueprint Function Library that contains all the statics functions related to AutoSave and AutoLoad system
- *
- * This Blueprint Function Library is responsible for the global functionality of the Save and Load System (mainly AutoFillSaveGameObject(), AutoLoadActorsDataFromSave(), CSWSaveGameToSlot() and CSWLoadGameFromSlot()).
- * This Blueprint Function Library is designed to be called from anywhere.
- * 
- * @see UCSWAutoSaveComponent, UCSWAutoSaveStruct, AutoSaveObject, USaveDummyObject
- */
-UCLASS()
-class CSWAUTOSAVEANDLOADSYSTEM_API UCSWAutoSaveBlueprintLibrary : public UGameplayStatics
-{
-	GENERATED_BODY()
-	
-public:
-#pragma region AUTO SAVE AND LOAD MAIN FUNCTIONS
-	/**
-	*	Save the contents of the SaveGameObject to a slot.
-	*	@param SaveGameObject	Object that contains data about the save game that we want to write out
-	*	@param SlotName			Name of save game slot to save to.
-	*   @param UserIndex		For some platforms, master user index to identify the user doing the saving.
-	*	@param bCompressFile	Compressed files have a .csav extension
-	*   @param bUseCustomPath	Use "Path" as a custom save directory?
-	*	@param Path				Custom Path where the .sav file will be stored. (ex. GetPathSaveGames())
-	*	@return					Whether we successfully saved this information
-	*/
-	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Main", meta = (DisplayName = "CSW::Save Game To Slot", AdvancedDisplay = "Path,bUseCustomPath,bCompressFile"))
-		static bool CSWSaveGameToSlot(USaveGame* SaveGameObject, const FString& SlotName, const int32 UserIndex, const bool bCompressFile = true, const bool bUseCustomPath = false, const FString& Path = "");
-	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Main", meta = (DisplayName = "CSW::Async Save Game To Slot", AutoCreateRefTerm = "OnCompleted", AdvancedDisplay = "Path,bUseCustomPath,bCompressFile", bCompressFile = "true", bUseCustomPath = "false"))
-		static void CSWSaveGameToSlot_Async(USaveGame* SaveGameObject, const FString& SlotName, const int32 UserIndex, const bool bCompressFile, const bool bUseCustomPath, const FString& Path, const FCSWOnSaveGameResponse& OnCompleted);
-
-
-	/**
-	*	Load the contents from a given slot.
-	*	@param SaveGameObject		Object containing loaded game state.
-	*	@param SlotName				Name of the save game slot to load from.
-	*   @param UserIndex			For some platforms, master user index to identify the user doing the loading.
-	*	@param bFileIsCompressed	Compressed files have a .csav extension
-	*   @param bUseCustomPath		Use "Path" as a custom load directory?
-	*	@param Path					Custom Path where the .sav file will be stored. (ex. GetPathSaveGames())
-	*	@return						Return loaded USaveGame object.
-	*/
-	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Main", meta = (DisplayName = "CSW::Load Game From Slot", DeterminesOutputType = "SaveGameObject", AdvancedDisplay = "Path,bUseCustomPath,bFileIsCompressed"))
-		static USaveGame* CSWLoadGameFromSlot(USaveGame* SaveGameObject, const FString& SlotName, const int32 UserIndex, const bool bFileIsCompressed = true, const bool bUseCustomPath = false, const FString& Path = "");
-	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Main", meta = (DisplayName = "CSW::Async Load Game From Slot", AutoCreateRefTerm = "OnCompleted", AdvancedDisplay = "Path,bUseCustomPath,bFileIsCompressed", bFileIsCompressed = "true", bUseCustomPath = "false"))
-		static void CSWLoadGameFromSlot_Async(USaveGame* SaveGameObject, const FString& SlotName, const int32 UserIndex, const bool bFileIsCompressed, const bool bUseCustomPath, const FString& Path, UPARAM(DisplayName = "OnCompleted (Use Delay of 0)") const FCSWOnLoadGameResponse& OnCompleted);
-
-	/**
-	*  Check if there's a save game file with the specified name. Works for compressed files too.
-	*  @param SlotName				Name of save game slot.
-	*  @param UserIndex				For some platforms, master user index to identify the user doing the saving.
-	*  @param bFileIsCompressed		Was the Game saved using compression? Very important as compressed files have a .csav extension.
-	*  @param bUseCustomPath		Search in a custom "Path"?
-	*  @param Path					Custom Path to search the save file.
-	*/
-	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Main", meta = (DisplayName = "CSW::Does Save Game Exist", AdvancedDisplay = "Path,bUseCustomPath,bFileIsCompressed"))
-		static bool CSWDoesSaveGameExist(const FString& SlotName, const int32 UserIndex, const bool bFileIsCompressed = true, const bool bUseCustomPath = false, const FString& Path = "");
-
-	/**
-	*  Delete the file for the corresponding slot. Works for compressed files too.
-	*  @param SlotName				Name of save game slot.
-	*  @param UserIndex				For some platforms, master user index to identify the user doing the saving.
-	*  @param bFileIsCompressed		Was the Game saved using compression? Very important as compressed files have a .csav extension.
-	*  @param bUseCustomPath		Search in a custom "Path"?
-	*  @param Path					Custom Path to search the save file.
-	*/
-	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Main", meta = (DisplayName = "CSW::Delete Save Game In Slot", AdvancedDisplay = "Path,bUseCustomPath,bFileIsCompressed"))
-		static bool CSWDeleteSaveGameInSlot(const FString& SlotName, const int32 UserIndex, const bool bFileIsCompressed = true, const bool bUseCustomPath = false, const FString& Path = "");
-
-	/**
-	*  Get a list of .sav or .csav file names that exist inside a directory.
-	*  @param bFileIsCompressed		Search for .sav or .csav files?
-	*  @param bUseCustomPath		Search in a custom "Path"?
-	*  @param Path					Custom Path to search the save files.
-	*  @param SlotNames				List of names of the save files found.
-	*/
-	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Main", meta = (DisplayName = "CSW::Get Save Games In Directory", AdvancedDisplay = "Path,bUseCustomPath,bFilesAreCompressed"))
-		static void CSWGetSaveGames(TArray<FString>& SlotNames, const bool bFilesAreCompressed = true, const bool bUseCustomPath = false, const FString& Path = "");
-
-	/**
-	*	Auto Fill the SaveGameObject, it needs an already Created "AutoSaveObject". Use CreateSaveGame() Node to create one.
-	*	Auto Fill means that the AutoSaveObject will be populated with all the actors that have a UCSWAutoSaveComponent of the levels in LevelNameArray.
-	*	Use SaveGameToSlot() to actually save the SaveGameObject into a file.
-	*	@param AutoSaveGameObject				The UCSWAutoSaveObject reference, it can be created using the CreateSaveGameObject() node.
-	*	@param LevelNameArray					Filter the save using a level name array (use GetLevels() to obtain the list of levels).
-	*	@param ActorsToSerialize				Actors that will be serialized into the SaveGameObject (use GetActorsWithComponent()).
-	*	@param AutoSaveAndLoadComponentArray	AutoSaveAndLoadComponents that belong to the ActorsToSerialize (use GetActorsWithComponent()).
-	*	@return									The UCSWAutoSaveObject filled with all the actors data from all the maps loaded.
-	*/
-	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Main", meta = (DisplayName = "CSW::Auto Fill Save Game Object"))
-		static UCSWAutoSaveObject* AutoFillSaveGameObject(UCSWAutoSaveObject* AutoSaveGameObject, const TArray<FCSWLevelWithAutosaveActors>& LevelsWithAutosaveActors);
-
-	/**
-	*	Auto Load the Game and updates the data for all the actors (and components) that were saved.
-	*	If an actor was saved and don't exist in the world anymore, the actors will be recreated (if the option is enabled in the CSWAutoSaveComponent).
-	*	This method loads the data for all the levels in LevelNameArray.
-	*	Use LoadGameFromSlot() to obtain an AutoSaveObject from file.
-	*	@param AutoSaveGameObject				The UCSWAutoSaveObject reference, needs to carry data from saved Actors.
-	*	@param LevelNameArray					Filter the save using a level name array (use GetLevels() to obtain the list of levels).
-	*	@param ActorsToSerialize				Actors that will be serialized into the SaveGameObject (use GetActorsWithComponent()).
-	*	@param AutoSaveAndLoadComponentArray	AutoSaveAndLoadComponents that belong to the ActorsToSerialize (use GetActorsWithComponent()).
-	*	@return									Whether if the Load was successful or Not.
-	*/
-	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Main", meta = (DisplayName = "CSW::Auto Load Actors Data From Save", HidePin = "WorldContextObject", DefaultToSelf = "WorldContextObject"))
-		static bool AutoLoadActorsDataFromSave(const UObject* WorldContextObject, UCSWAutoSaveObject* AutoSaveGameObject, UPARAM(ref) TArray<FCSWLevelWithAutosaveActors>& LevelsWithAutosaveActors);
-
-	/**
-	* Get an array of struct of type FCSWLevelWithAutosaveActors.
-	* This struct contains a "Level Name" and an array of AutosaveActors (Actors with their respective AutosaveComponent reference).
-	* @param LevelNameArray				Array of Level Names. Use GetLevelNames() to obtain it.
-	* @param LevelsWithAutosaveActors	Array of FCSWLevelWithAutosaveActors
-	*/
-	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Main", meta = (DisplayName = "CSW::Get Levels with AutosaveActors", HidePin = "WorldContextObject", DefaultToSelf = "WorldContextObject"))
-		static void GetLevelsWithAutosaveActors(const UObject* WorldContextObject, const TArray<FName>& LevelNameArray, TArray<FCSWLevelWithAutosaveActors>& LevelsWithAutosaveActors);
-#pragma endregion
-
-#pragma region FUNCTIONS FOR CUSTOMIZING THE AUTO SAVE AND LOAD SYSTEM
-	/**
-	*	Used for customizing the functionality.
-	*	Remove the MapRecords from the AutoSaveGameObject that match the name of the LevelsNameArray input.
-	*	Use CSW::GetLevelsNames() function to obtain the array of maps currently loaded.
-	*	@param	AutoSaveGameObject		The CSWAutoSaveObject.
-	*	@param	LevelsNameArray			Array of levels names. Use CSW::GetLevelsNames() function to obtain the array of maps currently loaded (it supports level streaming).
-	*	@return							True if at least one MapRecords was removed.
-	*/
-	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Custom", meta = (DisplayName = "CSW::Remove Save Data From Levels with Autosave Actors"))
-		static void TryRemoveSavedDataFromLevels(UCSWAutoSaveObject* AutoSaveGameObject, const TArray<FCSWLevelWithAutosaveActors>& LevelsWithAutosaveActors); ///#CronofearTODO Remove it?
-	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Custom", meta = (DisplayName = "CSW::Remove Save Data From Level"))
-		static bool TryRemoveSavedDataFromLevel(UCSWAutoSaveObject* AutoSaveGameObject, const FName& LevelName);
-
-	/**
-	*	Used for customizing the functionality.
-	*	Save an array of Actors into the AutoSaveGameObject. Used to save Actors that attaches the CSWAutosaveComponent.
-	*	NOTE: This doesn't delete data from levels inside the AutoSaveGameObject. Use of TryRemoveCurrentMapSavedData() will prevent duplication of data.
-	*	@param AutoSaveGameObject						The save object where the data will be stored.
-	*	@param ActorsArray								The array of actors that will be serialized.
-	*	@param AutoSaveAndLoadComponentArray			The array of components that belongs to the actors.
-	*	@param LevelsNameArray							The array of Map Names in order to filter which maps have to be saved.
-	*/
-	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Custom", meta = (DisplayName = "CSW::Save Actors into Save Object"))
-		static void SaveActorsToArrayOfMaps(UCSWAutoSaveObject* AutoSaveGameObject, const TArray<FCSWLevelWithAutosaveActors>& LevelsWithAutosaveActors);
-
-	/**
-	*	Used for customizing the functionality.
-	*	Load the Actors Data from an Array of MapRecords (that is inside the AutoSaveGameObject).
-	*	@param AutoSaveGameObject						The save object where the data is stored.
-	*	@param LevelsNameArray							The array of LevelsNames Loaded (or filtered). Use GetLevelsNames().
-	*	@param ActorsArray								The array of the actors in the world that will be updated on load. Use GetActorsWithComponent(CSWAutoSaveComponent).
-	*   @param AutoSaveAndLoadComponentArray			The array of AutoSaveAndLoadComponent that belongs to the actors. Use GetActorsWithComponent(CSWAutoSaveComponent).
-	*/
-	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Custom", meta = (DisplayName = "CSW::Load Actors Data From Save", HidePin = "WorldContextObject", DefaultToSelf = "WorldContextObject"))
-		static void LoadActorDataFromArrayOfMapRecords(const UObject* WorldContextObject, const UCSWAutoSaveObject* AutoSaveGameObject, UPARAM(ref) TArray<FCSWLevelWithAutosaveActors>& LevelsWithAutosaveActors);
-	UFUNCTION()
-		static void LoadActorDataFromArrayOfMapRecords_Internal(const UObject* WorldContextObject, const UCSWAutoSaveObject* AutoSaveGameObject, UPARAM(ref) TArray<FCSWLevelWithAutosaveActors>& LevelsWithAutosaveActors, const bool bLoadInEditorTime = false);
-
-	/**
-	* Get total number of Actors with an Autosavecomponent
-	* @param LevelsWithAutosaveActors				Struct of Levels containing Actors with AutosaveComponents.
-	*/
-	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Custom", meta = (DisplayName = "CSW::Get Total Num Of Autosave Actors"))
-		static int32 GetTotalAutosaveActors(const TArray<FCSWLevelWithAutosaveActors>& LevelsWithAutosaveActors);
-
-#pragma endregion
-
-
-#pragma region COMPRESSION UTILITIES
-
-	/**	
-	* Compress an array of Bytes using ZLIB.
-	* Use Length() node to see the difference in size.
-	* @param DataArray				Array of Bytes that will be compressed.
-	* @param CompressedDataArray	The Compressed version of the DataArray.
-	* @return						Is the CompressedDataArray result less in size than the DataArray? When the DataArray input is too small (less than 100 bytes), the result is usually bigger.
-	*/
-	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Compress", meta = (DisplayName = "CSW::Compress Array Of Bytes"))
-		static void CompressArrayOfBytes(UPARAM(ref) TArray<uint8>& DataArray, TArray<uint8>& CompressedDataArray);
-
-	/**
-	* Decompress an array of Bytes using ZLIB.
-	* Use Length() node to see the difference in size.
-	* @param DataArray					Array of Bytes that will be compressed.
-	* @param DeCompressedDataArray		The Decompressed Version of the Array Of Bytes.
-	* @return							Decompressed Array of Bytes.
-	*/
-	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Compress", meta = (DisplayName = "CSW::Decompress Array Of Bytes", Keywords = "Uncompress"))
-		static void DecompressArrayOfBytes(UPARAM(ref) TArray<uint8>& DataArray, TArray<uint8>& DecompressedDataArray);
-
-	/**
-	* Convert a String into an Array of Bytes. Useful for sending data through the network.
-	* @param InString	The String to be converted.
-	* @param bUseUtf8	Convert the text to Standard UTF-8 before compressing it. Useful for sending data through the network.
-	* @return			An Array of Bytes representing the text.
-	*/
-	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Compress", meta = (DisplayName = "CSW::String To Bytes"))
-		static TArray<uint8> CSWStringToBytes(const FString& InString, const bool bUseUtf8 = true);
-
-	/**
-	* Convert an Array of Bytes into String. Useful for sending data through the network.
-	* @param DataArray	The Array of Bytes to be converted.
-	* @return			A String based on the array of bytes.
-	*/
-	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Compress", meta = (DisplayName = "CSW::Bytes To String"))
-		static FString CSWBytesToString(const TArray<uint8>& DataArray);
-
-	/**
-	* Serialize an Object into a Compressed String
-	* Useful for sending objects data trough the network
-	* Note: Object is not deleted in the process
-	* @param Object						The Object that will be converted.
-	* @param CompressedDataString		The String Result.
-	*/
-	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Compress", meta = (DisplayName = "CSW::Serialize Object To Compressed String"))
-		static void ConvertObjectToString(UObject* Object, FString& ObjectAsString);
-	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Compress", meta = (AutoCreateRefTerm = "OnConvertObject", DisplayName = "CSW::Async Serialize Object To Compressed String"))
-		static void ConvertObjectToString_Async(UObject* Object, const FOnConvertObject& OnConvertObject);
-	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Compress", meta = (DisplayName = "CSW::Serialize Object To Bytes"))
-		static void ConvertObjectToBytes(UObject* Object, TArray<uint8>& ObjectAsBytes);
-	
-	/**
-	* Restore and Object from a String Input.
-	* Caution: The String must belong to the same type of the object previously serialized.
-	* Note: CompressedDataString is not deleted in the process
-	* @param Object						The Object that will be Restored.
-	* @param CompressedDataString		The String Input.
-	*/
-	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Compress", meta = (DisplayName = "CSW::Restore Object From Compressed String", DeterminesOutputType = "Object"))
-		static UObject* RestoreObjectFromString(UObject* Object, const FString& ObjectAsString);
-	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Compress", meta = (AutoCreateRefTerm = "OnRestoreObject", DisplayName = "CSW::Async Restore Object From Compressed String", DeterminesOutputType = "Object"))
-		static void RestoreObjectFromString_Async(UObject* Object, const FString& ObjectAsString, const FOnRestoreObject& OnRestoreObject);
-	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Compress", meta = (DisplayName = "CSW::Restore Object From Bytes", DeterminesOutputType = "Object"))
-		static UObject* RestoreObjectFromBytes(UObject* Object, const TArray<uint8>& ObjectAsBytes);
-
-#pragma endregion
-
-
-#pragma region GENERAL UTILITIES
-
-	/**
-	*	Given a Source String, obtain a Substring between FirstString and EndString
-	*   Example, in: "This is a -hello world/ string example" - If FirstString is "-" and EndString is "/" the result will be "hello world".
-	*	@param	SearchIn				SourceString where the search will be performed.
-	*	@param	FirstString				The first string to find (Using FindSubstring()).
-	*	@param	EndString				The end string to find (Using FindSubstring()).
-	*	@param	SubstringResult			Substring Result between the FirstString and the EndString.
-	*	@param	bFirstUseCase			The search of the FirstString will be case sensitive?
-	*	@param	bEndUseCase				The search of the EndString will be case sensitive?
-	*	@param	bFirstSearchFromEnd		The search of the FirstString will be performed starting from the end of the SourceString?
-	*	@param	bEndSearchFromEnd		The search of the EndString will be performed starting from the end of the SourceString?
-	*	@param	FirstStartPos			The position to start the search from FirstString.
-	*	@param	EndStartPos				The position to start the search from EndString.
-	*	@param	bIncludeFirstString		Include the FirstString in the SubstringResult?
-	*	@param	bIncludeEndString		Include the EndString in the SubstringResult?
-	*/
-	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Utils", meta = (DisplayName = "CSW::Get Substring Between", AdvancedDisplay = "bFirstUseCase,bEndUseCase,bFirstSearchFromEnd,bEndSearchFromEnd,FirstStartPos,EndStartPos,bIncludeFirstString,bIncludeEndString"))
-		static void GetSubstringBetween(const FString& SearchIn, const FString& FirstString, const FString& EndString, FString& SubstringResult,
-			const bool bFirstUseCase = false, const bool bEndUseCase = false, const bool bFirstSearchFromEnd = false, const bool bEndSearchFromEnd = false, 
-			const int32 FirstStartPos = -1, const int32 EndStartPos = -1, const bool bIncludeFirstString = false, const bool bIncludeEndString = false);
-
-	/**
-	*	Find all Actors in the world with the specified component.
-	*	This is a slow operation, use with caution e.g. do not use every frame.
-	*	@param	Component			Component to find. Must be specified or result array will be empty.
-	*	@param	OutActors			Output array of Actors that have specified component.
-	*	@param	OutActorComponents	Output array of Actor Components that belongs to the array of actors.
-	*/
-	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Utils", meta = (DisplayName = "CSW::Get All Actors With Component", HidePin = "WorldContextObject", DefaultToSelf = "WorldContextObject", DeterminesOutputType = "Component", DynamicOutputParam = "OutActorComponents"))
-		static void GetAllActorsWithComponent(const UObject* WorldContextObject, const TSubclassOf<UActorComponent> Component, TArray<AActor*>& OutActors, TArray<UActorComponent*>& OutActorComponents);
-
-	/**
-	*	Find all Actors in the world with the specified component (filtered by level names)
-	*	This is a slow operation, use with caution e.g. do not use every frame.
-	*	@param	Component			Component to find. Must be specified or result array will be empty.
-	*	@param	OutActors			Output array of Actors that have specified component.
-	*	@param	OutActorComponents	Output array of Actor Components that belongs to the array of actors.
-	*	@param	LevelNameArray		Array of level names used to filter the search (use GetLevelsNames()).
-	*/
-	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Utils", meta = (DisplayName = "CSW::Get All Actors With Component In Levels", HidePin = "WorldContextObject", DefaultToSelf = "WorldContextObject", DeterminesOutputType = "Component", DynamicOutputParam = "OutActorComponents"))
-		static void GetActorsWithComponentInLevels(const UObject* WorldContextObject, const TSubclassOf<UActorComponent> Component, const TArray<FName>& LevelNameArray, TArray<AActor*>& OutActors, TArray<UActorComponent*>& OutActorComponents);
-
-	/**
-	*	Get an actor by IDName and Class in the world (hover the mouse in the world outliner to see the actor ID Name).
-	*	This is a slow operation, use with caution e.g. do not use every frame.
-	*	@param	IDName				ID Name to find. Must be specified or the result will be nullptr.
-	*	@param	ActorClass			Class Filter of the actor, determines the OutputType.
-	*	@return						The Actor found.
-	*/
-	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Utils", meta = (DisplayName = "CSW::Get Actor By ID Name and Class", HidePin = "WorldContextObject", DefaultToSelf = "WorldContextObject", DeterminesOutputType = "ActorClass"))
-		static AActor* GetActorByIDNameAndClass(const UObject* WorldContextObject, const FName IDName, const TSubclassOf<AActor> ActorClass);
-
-	/**
-	*	Get an actor by IDName from a given Array of Actors.
-	*	@param	IDName				ID Name to find. Must be specified or the result will be nullptr.
-	*	@param	ArrayOfActors		The Array of Actors in which the search will be performed.
-	*	@param	Actor				The Actor found.
-	*	@return						The Index of the array where the Actor was found (it's -1 if no actor was found).
-	*/
-	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Utils", meta = (DisplayName = "CSW::Get Actor By ID Name From Array Of Actors"))
-		static int32 GetActorByIDNameFromAnArrayOfActors(const FName IDName, const TArray<AActor*>& ArrayOfActors, AActor*& Actor);
-
-	/**
-	* Get an array of FNames based on the levels currently loaded (including sublevels in level streaming).
-	* Names also contain the name of the path of the levels. Ex: "/Game/Content/Levels/level01"
-	* If a Level is moved to another location, the name will be changed.
-	* @param CurrentMapNameArray - Array of Level Names.
-	*/
-	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Utils", meta = (DisplayName = "CSW::Get Levels Names", HidePin = "WorldContextObject", DefaultToSelf = "WorldContextObject"))
-		static void GetLevelsNames(const UObject* WorldContextObject, TArray<FName>& CurrentLevelNameArray);
-
-	/**
-	*	Get the Level name (path/name) from the ULevel input reference (i.e obtained from CSW::GetLevelOwnerFromActor()).
-	*	You can use this name to load a level, stream load/unload, etc.
-	*	@param Level	The Level reference.
-	*	@return			The name of the Level ("path/name").
-	*/
-	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Utils", meta = (DisplayName = "CSW::Get Name From Level"))
-		static FName CSWGetLevelName(ULevel* Level);
-
-	/**
-	*	Get the Level reference where the actor is loaded (supports level streaming).
-	*	@param Actor	The actor reference.
-	*	@return			The Level reference where the actor belongs (supports level streaming).
-	*/
-	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Utils", meta = (DisplayName = "CSW::Get Level Owner From Actor"))
-		static ULevel* GetActorLevel(AActor* Actor);
-
-	/**
-	* Get ULevel Reference based on the Name of the level. Iterate over UWord::GetLevels() and see if any of the Levels match.
-	* Names are sanitated by using CSWGetLevelName();
-	*/
-	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Utils", meta = (DisplayName = "CSW::Get Level From Name", HidePin = "WorldContextObject", DefaultToSelf = "WorldContextObject"))
-		static ULevel* GetLevelReferenceFromName(const UObject* WorldContextObject, const FName& NameOfTheLevel);
-
-	/**
-	* Get an actor of this class, only if there's only one actor of this class in the world.
-	* This is an slow operation. Use this function with caution, e.g do not use it every frame.
-	* @param ActorClass		Class of the actor to return
-	* @return				The reference of the actor, can be nullptr if there are none or two+ actors in the world.
-	*/
-	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Utils", meta = (HidePin = "WorldContextObject", DefaultToSelf = "WorldContextObject", UnsafeDuringActorConstruction = "true", DisplayName = "CSW::Get Unique Actor Of Class", DeterminesOutputType = "ActorClass"))
-		static class AActor* GetUniqueActorOfClass(const UObject* WorldContextObject, const TSubclassOf<AActor> ActorClass);
-
-	/**
-	*	Spawn an Actor in the world with a given Name and Class.
-	*	CAUTION: Use it wisely, don't give an ID Name that already exists in the world or the previous Actor will be deleted.
-	*	@param Class				The class of the actor that will be spawned.
-	*	@param SpawnTransformm		The transform data.
-	*	@param NameID				The Given Name.
-	*	@return						The Spawned Actor Reference.
-	*/
-	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Utils", meta = (HidePin = "WorldContextObject", DefaultToSelf = "WorldContextObject", DisplayName = "CSW::Spawn Actor With a Name ID From Class", DeterminesOutputType = "Class"))
-		static AActor* SpawnActorWithIDNameFromClass(const UObject* WorldContextObject, const TSubclassOf<AActor> Class, const FTransform& SpawnTransform, FName NameID, ULevel* OwnerLevel);
-	UFUNCTION()
-		static AActor* SpawnActorWithIDNameFromClass_Internal(const UObject* WorldContextObject, const TSubclassOf<AActor> Class, const FTransform& SpawnTransform, FName NameID, ULevel* OwnerLevel, bool bLoadInEditorTime = false);
-
-	/**
-	* Verify if a directory exists.
-	* @param Path				Path to check.
-	* @return					True if the directory exists.
-	*/
-	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Utils", meta = (DisplayName = "CSW::Does Directory Exist"))
-		static bool CSWDoesDirectoryExists(const FString& Path);
-
-	/**
-	* Attempt to create a directory tree.
-	* Doesn't do anything if the directory already exists, in which case it returns false.
-	* Ex1: GetPathSaved()+"Test/" will attempt to create a "Test/" directory inside ".../Project/Saved/".
-	* Ex2: GetPathProject()+"Test/a/b/" will attempt to create a "Test/a/b/" directory TREE inside ".../Project/".
-	* @param Path				Path that should also contain non-existent directories.
-	* @return					True if the directory is successfully created.
-	*/
-	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Utils", meta = (DisplayName = "CSW::Create Directory"))
-		static bool CSWMakeDirectory(const FString& Path);
-
-	/**
-	* Get the absolute path of the ".../Project/" folder.
-	*/
-	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Utils", meta = (DisplayName = "CSW::Get Path of /Project"))
-		static FString GetPathProject();
-	/**
-	* Get the absolute path of the ".../Project/Saved/" folder.
-	*/
-	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Utils", meta = (DisplayName = "CSW::Get Path of /Saved"))
-		static FString GetPathSaved();
-	/**
-	* Get the absolute path of the ".../Project/Saved/SaveGames/" folder.
-	*/
-	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Utils", meta = (DisplayName = "CSW::Get Path of /SaveGames"))
-		static FString GetPathSaveGames();
-#pragma endregion
-
-
-#pragma region PRIVATE (NOT DIRECTLY EXPOSED TO BLUEPRINTS)
-
-public:
-	/**
-	* Save All Actors in a Level
-	* Each Actor call FullSaveActorIntoRecord()
-	*/
-	UFUNCTION()
-		static void SaveAllActorsInLevel(UCSWAutoSaveObject* AutoSaveGameObject, const FCSWLevelWithAutosaveActors& LevelWithAutosaveActors, uint32 LevelRecordIndex);
-	/**
-	* Call OnBeginSave, FullSaveActorInRecord and OnEndSave
-	*/
-	UFUNCTION()
-		static void SaveActorInLevel(const FCSWAutosaveActor &AutosaveActor, UCSWAutoSaveObject* AutoSaveGameObject, uint32 LevelRecordIndex);
-	/**
-	* Full save Actor into a Record.
-	* Call SaveActor() and SaveActorComponents()
-	*/
-	UFUNCTION()
-		static void FullSaveActorIntoRecord(FCSWActorRecord& ActorRecord, AActor* Actor, const UCSWAutoSaveComponent* AutosaveComponent);
-	/**
-	* Save an Actor Data into a CSWActorStruct.
-	*/
-	UFUNCTION()
-		static void SaveActor(FCSWActorRecord& ActorRecord, AActor* Actor, const UCSWAutoSaveComponent* AutoSaveAndLoadComponent);
-	/**
-	* Save the components of an Actor into an Array of CSWActorComponentArrayRecords
-	*/
-	UFUNCTION()
-		static void SaveActorComponents(FCSWActorRecord& ActorRecord, AActor* Actor, const UCSWAutoSaveComponent* AutoSaveAndLoadComponent);
-	/**
-	* Save the components of an Actor into an Array of CSWActorComponentArrayRecords
-	*/
-	UFUNCTION()
-		static void SaveActorComponent(FCSWActorRecord& ActorRecord, UActorComponent* ActorComponent, const UCSWAutoSaveComponent* AutoSaveAndLoadComponent, FCSWAutoSaveComponentOption& ComponentOptions);
-	
-	//-----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
-
-
-	UFUNCTION()
-		static void LoadAllActorsInLevel(const UObject* WorldContextObject, const UCSWAutoSaveObject* AutoSaveGameObject, const FCSWMapRecord& levelRecord, TArray<FCSWAutosaveActor>& AutosaveActorsInLevel, const bool bLoadInEditorTime);
-
-	UFUNCTION()
-		static void LoadActorInLevel(const FCSWActorRecord &ActorRecord, TArray<FCSWAutosaveActor> &AutosaveActorsInLevel, const UCSWAutoSaveObject* AutoSaveGameObject, const UObject* WorldContextObject, const FCSWMapRecord &levelRecord, const bool bLoadInEditorTime);
-
-	/**
-	*	Load a FCSWActorRecord data into the corresponding actor (the actor components too).
-	*/
-	UFUNCTION()
-		static void FullLoadActorFromRecord(const FCSWActorRecord& ActorRecord, AActor* Actor, UCSWAutoSaveComponent* AutoSaveAndLoadComponent, const bool bLoadActorComponents = true);
-	/**
-	* Load an Actor from a FCSWActorRecord.
-	*/
-	UFUNCTION()
-		static void LoadActor(const FCSWActorRecord& ActorRecord, AActor* DynamicActor);
-	/**
-	* Load the components of an Actor from an array of CSWActorComponentArrayRecords
-	*/
-	UFUNCTION()
-		static void LoadActorComponents(const FCSWActorRecord& ActorRecord, AActor* DynamicActor, const UCSWAutoSaveComponent* AutoSaveAndLoadComponent);
-
-	/**
-	* Load a component of an actor from a CSWActorComponentRecord
-	*/
-	UFUNCTION()
-		static void LoadActorComponent(const FCSWActorComponentRecord &actorComponentRecord, UActorComponent* actorcomponent, const FCSWAutoSaveComponentOption &componentOptions, const UCSWAutoSaveComponent* AutoSaveAndLoadComponent);
-
-	
-	//-----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
-
-	/**
-	* Try to destroy an array of actors if their corresponding AutoSaveAndLoadComponents have the bDestroyActorOnLoadGameIfWasNotSaved set to true
-	*/
-	UFUNCTION()
-		static void CSWTryDestroyActors(const UCSWAutoSaveObject* AutoSaveGameObject, TArray<FCSWAutosaveActor>& AutosaveActorsInLevel);
-	UFUNCTION()
-		static void TryDestroyActor(FCSWAutosaveActor &autosaveActor, const UCSWAutoSaveObject* AutoSaveGameObject);
-
-
-	/**
-	* Check if the component can be saved or not. If it can be saved, returns the componentOptions that can be used to customize the functionality
-	*/
-	UFUNCTION()
-		static bool GetComponentSaveAndLoadConditions(const UCSWAutoSaveComponent* AutoSaveAndLoadComponent, const UActorComponent* actorcomponent, FCSWAutoSaveComponentOption &componentOptions);
-
-	/**
-	* Get the LevelRecordIndex to use in the AutoSaveGameObject->LevelRecords array. The index is based on the match of LevelsWithAutosaveActors.Name and AutoSaveGameObject->LevelRecords
-	*/
-	UFUNCTION()
-		static uint32 GetLevelRecordIndexSave(UCSWAutoSaveObject* AutoSaveGameObject, const FCSWLevelWithAutosaveActors& LevelWithAutosaveActors, bool& bMatchFound);
-	UFUNCTION()
-		static uint32 GetLevelRecordIndexLoad(const FCSWMapRecord& LevelRecord, const TArray<FCSWLevelWithAutosaveActors>& LevelSWithAutosaveActors, bool& bMatchFound);
-
-	/**
-	* Get the index and the Actor reference where the Actor was found by Name inside the AutosaveActorsInLevel array
-	*/
-	UFUNCTION()
-		static int32 GetActorByIDFromAutosaveActors(const FName IDName, const TArray<FCSWAutosaveActor>& AutosaveActorsInLevel, AActor*& Actor);
-	/**
-	* Internal Load Actor
-	*/
-	UFUNCTION()
-		static void LoadActor_Internal(const FCSWActorRecord& ActorRecord, const UCSWAutoSaveObject* AutoSaveGameObject, UCSWAutoSaveComponent* AutosaveComponent, AActor* LoadedActor, bool bDestroyActorIfAutosaveComponentDisabled);
-#pragma endregion
-};
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+#pragma once
+
+#include "Kismet/GameplayStatics.h"
+#include "Field/Struct/CSWAutoSaveStruct.h"
+#include "Field/Enum/CSWAutoSaveEnum.h"
+#include "CSWAutoSaveBlueprintLibrary.generated.h"
+
+/**
+* Structure that holds an Actor reference and its respective AutosaveComponent
+*/
+USTRUCT(BlueprintType)
+struct FCSWAutosaveActor
+{
+	GENERATED_USTRUCT_BODY()
+	/**
+	* The array of Actor references
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Actor", meta = (DisplayName = "Actor"))
+		AActor* Actor;
+	/**
+	* The array of CSWAutosaveComponent references
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CSW", meta = (DisplayName = "AutosaveComponent"))
+		UCSWAutoSaveComponent* AutosaveComponent;
+
+	FCSWAutosaveActor()
+	{
+
+	}
+};
+/**
+* Structure that holds a Level Name, each Level Names has an array AutosaveActors Associated.
+*/
+USTRUCT(BlueprintType)
+struct FCSWLevelWithAutosaveActors
+{
+	GENERATED_USTRUCT_BODY()
+	/**
+	* The name of the level (can be many levels in a single file)
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Name", meta = (DisplayName = "Level Name"))
+		FName Name;
+	/**
+	* The array of AutosaveActors
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AutosaveActor", meta = (DisplayName = "Autosave Actors"))
+		TArray<FCSWAutosaveActor> AutosaveActors;
+
+	FCSWLevelWithAutosaveActors()
+	{
+
+	}
+};
+
+/// Save and load to disk
+DECLARE_DYNAMIC_DELEGATE_OneParam(FCSWOnSaveGameResponse, const bool, bWasSuccesful);
+DECLARE_DYNAMIC_DELEGATE_OneParam(FCSWOnLoadGameResponse, USaveGame*, SaveObject);
+DECLARE_DYNAMIC_DELEGATE_OneParam(FCSWOnGetSaveGamesInfoResponse, const TArray<FCSWSlotInfo>&, SlotsInfo);
+/// Convert and restore object
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnRestoreObject, UObject*, ObjectFromString);
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnConvertObject, FString, ObjectAsString);
+
+ /**
+ * GameplayStatics Blueprint Function Library that contains all the statics functions related to AutoSave and AutoLoad system
+ *
+ * This Blueprint Function Library is responsible for the global functionality of the Save and Load System (mainly AutoFillSaveGameObject(), AutoLoadActorsDataFromSave(), CSWSaveGameToSlot() and CSWLoadGameFromSlot()).
+ * This Blueprint Function Library is designed to be called from anywhere.
+ * 
+ * @see UCSWAutoSaveComponent, UCSWAutoSaveStruct, AutoSaveObject, USaveDummyObject
+ */
+UCLASS()
+class CSWAUTOSAVEANDLOADSYSTEM_API UCSWAutoSaveBlueprintLibrary : public UGameplayStatics
+{
+	GENERATED_BODY()
+	
+public:
+#pragma region AUTO SAVE AND LOAD MAIN FUNCTIONS
+	/**
+	*	Save the contents of the SaveGameObject to a slot.
+	*	The object is streamed into the slot (and compressed) in bounded-size blocks, so the whole file is never held in memory. Each level gets its own chunk (see CSWLoadLevelsFromSlot()).
+	*	@param SaveGameObject	Object that contains data about the save game that we want to write out
+	*	@param SlotName			Name of save game slot to save to.
+	*   @param UserIndex		For some platforms, master user index to identify the user doing the saving.
+	*	@param bCompressFile	Compressed files have a .csav extension
+	*   @param bUseCustomPath	Use "Path" as a custom save directory?
+	*	@param Path				Custom Path where the .sav file will be stored. (ex. GetPathSaveGames())
+	*	@param Codec			Codec used to compress the file (ex. Zlib (Fast) for frequent autosaves). Stored in the file, loading detects it. Ignored if bCompressFile is false.
+	*	@return					Whether we successfully saved this information
+	*/
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Main", meta = (DisplayName = "CSW::Save Game To Slot", AdvancedDisplay = "Path,bUseCustomPath,bCompressFile,Codec"))
+		static bool CSWSaveGameToSlot(USaveGame* SaveGameObject, const FString& SlotName, const int32 UserIndex, const bool bCompressFile = true, const bool bUseCustomPath = false, const FString& Path = "", const ECSWCompressionCodec Codec = ECSWCompressionCodec::Zlib);
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Main", meta = (DisplayName = "CSW::Async Save Game To Slot", AutoCreateRefTerm = "OnCompleted", AdvancedDisplay = "Path,bUseCustomPath,bCompressFile,Codec", bCompressFile = "true", bUseCustomPath = "false", Codec = "Zlib"))
+		static void CSWSaveGameToSlot_Async(USaveGame* SaveGameObject, const FString& SlotName, const int32 UserIndex, const bool bCompressFile, const bool bUseCustomPath, const FString& Path, const FCSWOnSaveGameResponse& OnCompleted, const ECSWCompressionCodec Codec = ECSWCompressionCodec::Zlib);
+
+	/**
+	*	Save the contents of the SaveGameObject to a slot in the background (CSWSaveGameToSlot_Async() uses Normal priority).
+	*	The object is copied on the calling thread, a single writer thread writes the saves one at a time, highest priority first.
+	*	If a save of the same slot is still waiting, it's replaced by this one and both OnCompleted get its result, so bursts of saves only write the newest state.
+	*	@param SaveGameObject	Object that contains data about the save game that we want to write out
+	*	@param SlotName			Name of save game slot to save to.
+	*   @param UserIndex		For some platforms, master user index to identify the user doing the saving.
+	*	@param Priority			Saves with a higher priority are written first.
+	*	@param bCompressFile	Compressed files have a .csav extension
+	*   @param bUseCustomPath	Use "Path" as a custom save directory?
+	*	@param Path				Custom Path where the .sav file will be stored. (ex. GetPathSaveGames())
+	*	@param Codec			Codec used to compress the file. Ignored if bCompressFile is false.
+	*	@param OnCompleted		Executed on the game thread once the save is written (or cancelled, or refused).
+	*	@return					ID of the save job (see CSWCancelSaveJob()), -1 if it couldn't be queued
+	*/
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Main", meta = (DisplayName = "CSW::Schedule Save Game To Slot", AutoCreateRefTerm = "OnCompleted", AdvancedDisplay = "Path,bUseCustomPath,bCompressFile,Codec", Priority = "Normal", bCompressFile = "true", bUseCustomPath = "false", Codec = "Zlib"))
+		static int32 CSWScheduleSaveGameToSlot(USaveGame* SaveGameObject, const FString& SlotName, const int32 UserIndex, const ECSWSaveJobPriority Priority, const bool bCompressFile, const bool bUseCustomPath, const FString& Path, const ECSWCompressionCodec Codec, const FCSWOnSaveGameResponse& OnCompleted);
+
+	/**
+	*	Cancel a save that is still waiting (see CSWScheduleSaveGameToSlot()). Its OnCompleted get false.
+	*	@return					False if the save already started or doesn't exist
+	*/
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Main", meta = (DisplayName = "CSW::Cancel Save Job"))
+		static bool CSWCancelSaveJob(const int32 JobId);
+
+	/**
+	*	Save the contents of the SaveGameObject to a slot, writing only what changed since the previous journaled save (for frequent autosaves).
+	*	The first call writes the whole slot. The next ones append the actor records that changed, were added or removed to a journal next to the slot (.csj).
+	*	CSWLoadGameFromSlot() and CSWLoadLevelsFromSlot() replay the journal on top of the slot. Once the journal is bigger than half the slot,
+	*	it's folded into a new slot in the background. Saving the slot with CSWSaveGameToSlot() discards the journal.
+	*	@param SaveGameObject	Object that contains data about the save game that we want to write out
+	*	@param SlotName			Name of save game slot to save to.
+	*   @param UserIndex		For some platforms, master user index to identify the user doing the saving.
+	*	@param bCompressFile	Compressed files have a .csav extension
+	*   @param bUseCustomPath	Use "Path" as a custom save directory?
+	*	@param Path				Custom Path where the .sav file will be stored. (ex. GetPathSaveGames())
+	*	@param Codec			Codec used to compress the slot and the journal entries. Ignored if bCompressFile is false.
+	*	@return					Whether we successfully saved this information
+	*/
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Main", meta = (DisplayName = "CSW::Save Game To Slot (Journaled)", AdvancedDisplay = "Path,bUseCustomPath,bCompressFile,Codec"))
+		static bool CSWSaveGameToSlotJournaled(USaveGame* SaveGameObject, const FString& SlotName, const int32 UserIndex, const bool bCompressFile = true, const bool bUseCustomPath = false, const FString& Path = "", const ECSWCompressionCodec Codec = ECSWCompressionCodec::ZlibFast);
+
+	/** Write a snapshot taken by CSWSaveGameToSlotJournaled() as the new slot and discard its journal. Called by the save job writer */
+	static bool CompactSaveGameJournal(struct FCSWSaveGameJournalSnapshot& Snapshot);
+
+	/**
+	* Copy the SaveGameObject into a snapshot that can be written from another thread (see SaveSnapshotToSlot()). Must be called on the game thread.
+	* VersionsLocation is the directory of the slot the snapshot will be written to.
+	*/
+	static void TakeSaveGameSnapshot(USaveGame* SaveGameObject, const struct FCSWVersionsLocation& VersionsLocation, struct FCSWSaveGameSnapshot& OutSnapshot);
+
+	/**
+	* Write a snapshot into a slot, like CSWSaveGameToSlot(). Can be called from any thread.
+	* OutState receives what a journal needs to use the slot as its base, without it the journal of the slot is discarded.
+	* NewSaveId is the generation of the written slot, a new one if it isn't valid.
+	* Once written, the snapshot is moved into the decoded slot cache if it's enabled.
+	*/
+	static bool SaveSnapshotToSlot(struct FCSWSaveGameSnapshot&& Snapshot, const FString& SlotName, const int32 UserIndex, const bool bCompressFile, const bool bUseCustomPath, const FString& Path, const ECSWCompressionCodec Codec, struct FCSWSaveGameJournalState* OutState = nullptr, const FGuid& NewSaveId = FGuid());
+
+
+	/**
+	*	Load the contents from a given slot. The codec the slot was compressed with is read from its header.
+	*	@param SaveGameObject		Object containing loaded game state.
+	*	@param SlotName				Name of the save game slot to load from.
+	*   @param UserIndex			For some platforms, master user index to identify the user doing the loading.
+	*	@param bFileIsCompressed	Compressed files have a .csav extension
+	*   @param bUseCustomPath		Use "Path" as a custom load directory?
+	*	@param Path					Custom Path where the .sav file will be stored. (ex. GetPathSaveGames())
+	*	@return						Return loaded USaveGame object.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Main", meta = (DisplayName = "CSW::Load Game From Slot", DeterminesOutputType = "SaveGameObject", AdvancedDisplay = "Path,bUseCustomPath,bFileIsCompressed"))
+		static USaveGame* CSWLoadGameFromSlot(USaveGame* SaveGameObject, const FString& SlotName, const int32 UserIndex, const bool bFileIsCompressed = true, const bool bUseCustomPath = false, const FString& Path = "");
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Main", meta = (DisplayName = "CSW::Async Load Game From Slot", AutoCreateRefTerm = "OnCompleted", AdvancedDisplay = "Path,bUseCustomPath,bFileIsCompressed", bFileIsCompressed = "true", bUseCustomPath = "false"))
+		static void CSWLoadGameFromSlot_Async(USaveGame* SaveGameObject, const FString& SlotName, const int32 UserIndex, const bool bFileIsCompressed, const bool bUseCustomPath, const FString& Path, const FCSWOnLoadGameResponse& OnCompleted);
+
+	/**
+	*	Load only some levels from a given slot. Only the chunks of the requested levels are read and decompressed.
+	*	The levels already in AutoSaveGameObject that weren't requested are kept, the requested ones are replaced.
+	*	Slots saved by older versions of the plugin have no table of contents and are read completely.
+	*	@param AutoSaveGameObject	Object the levels are loaded into.
+	*	@param LevelNames			Names of the levels to load.
+	*	@param SlotName				Name of the save game slot to load from.
+	*   @param UserIndex			For some platforms, master user index to identify the user doing the loading.
+	*	@param bFileIsCompressed	Compressed files have a .csav extension
+	*   @param bUseCustomPath		Use "Path" as a custom load directory?
+	*	@param Path					Custom Path where the .sav file will be stored. (ex. GetPathSaveGames())
+	*	@return						Return AutoSaveGameObject, or null if the slot couldn't be loaded.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Main", meta = (DisplayName = "CSW::Load Levels From Slot", AdvancedDisplay = "Path,bUseCustomPath,bFileIsCompressed"))
+		static UCSWAutoSaveObject* CSWLoadLevelsFromSlot(UCSWAutoSaveObject* AutoSaveGameObject, const TArray<FName>& LevelNames, const FString& SlotName, const int32 UserIndex, const bool bFileIsCompressed = true, const bool bUseCustomPath = false, const FString& Path = "");
+
+	/**
+	*	Save the contents of the SaveGameObject into the oldest slot of a ring of autosave slots ("<RingName>_0" ... "<RingName>_<RingSize - 1>").
+	*	The object is copied on the calling thread and written by a single background writer, so saves never overlap on disk.
+	*	If the ring already has a save waiting, it's replaced by this one (both OnCompleted get its result).
+	*	@param SaveGameObject	Object that contains data about the save game that we want to write out
+	*	@param RingName			Name of the ring, the slots are named after it.
+	*	@param RingSize			Number of slots (generations) the ring keeps.
+	*   @param UserIndex		For some platforms, master user index to identify the user doing the saving.
+	*	@param bCompressFile	Compressed files have a .csav extension
+	*   @param bUseCustomPath	Use "Path" as a custom save directory?
+	*	@param Path				Custom Path where the .sav file will be stored. (ex. GetPathSaveGames())
+	*	@param Codec			Codec used to compress the file. Ignored if bCompressFile is false.
+	*	@param OnCompleted		Executed on the game thread once the save is written, or with false if it couldn't be queued.
+	*	@return					Whether the save was queued
+	*/
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Main", meta = (DisplayName = "CSW::Save Game To Ring", AutoCreateRefTerm = "OnCompleted", AdvancedDisplay = "Path,bUseCustomPath,bCompressFile,Codec", RingSize = "3", bCompressFile = "true", bUseCustomPath = "false", Codec = "ZlibFast"))
+		static bool CSWSaveGameToRing(USaveGame* SaveGameObject, const FString& RingName, const int32 RingSize, const int32 UserIndex, const bool bCompressFile, const bool bUseCustomPath, const FString& Path, const ECSWCompressionCodec Codec, const FCSWOnSaveGameResponse& OnCompleted);
+
+	/**
+	*	Load the newest generation of a ring of autosave slots (see CSWSaveGameToRing()). If it can't be loaded, the older ones are tried.
+	*	@param SaveGameObject		Object containing loaded game state.
+	*	@param RingName				Name of the ring.
+	*	@param RingSize				Number of slots of the ring.
+	*   @param UserIndex			For some platforms, master user index to identify the user doing the loading.
+	*	@param SlotName				Slot that was loaded.
+	*	@param bFileIsCompressed	Compressed files have a .csav extension
+	*   @param bUseCustomPath		Use "Path" as a custom load directory?
+	*	@param Path					Custom Path where the .sav file will be stored. (ex. GetPathSaveGames())
+	*	@return						Return loaded USaveGame object, or null if no slot of the ring could be loaded.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Main", meta = (DisplayName = "CSW::Load Game From Ring", DeterminesOutputType = "SaveGameObject", AdvancedDisplay = "Path,bUseCustomPath,bFileIsCompressed"))
+		static USaveGame* CSWLoadGameFromRing(USaveGame* SaveGameObject, const FString& RingName, const int32 RingSize, const int32 UserIndex, FString& SlotName, const bool bFileIsCompressed = true, const bool bUseCustomPath = false, const FString& Path = "");
+
+	/**
+	*	Get the slot with the newest generation of a ring of autosave slots (see CSWSaveGameToRing()).
+	*	@return						Whether the ring has any slot
+	*/
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Main", meta = (DisplayName = "CSW::Get Latest Ring Slot", AdvancedDisplay = "Path,bUseCustomPath,bFileIsCompressed"))
+		static bool CSWGetLatestRingSlot(const FString& RingName, const int32 RingSize, const int32 UserIndex, FCSWSlotInfo& SlotInfo, const bool bFileIsCompressed = true, const bool bUseCustomPath = false, const FString& Path = "");
+
+	/**
+	*  Check if there's a save game file with the specified name. Works for compressed files too.
+	*  @param SlotName				Name of save game slot.
+	*  @param UserIndex				For some platforms, master user index to identify the user doing the saving.
+	*  @param bFileIsCompressed		Was the Game saved using compression? Very important as compressed files have a .csav extension.
+	*  @param bUseCustomPath		Search in a custom "Path"?
+	*  @param Path					Custom Path to search the save file.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Main", meta = (DisplayName = "CSW::Does Save Game Exist", AdvancedDisplay = "Path,bUseCustomPath,bFileIsCompressed"))
+		static bool CSWDoesSaveGameExist(const FString& SlotName, const int32 UserIndex, const bool bFileIsCompressed = true, const bool bUseCustomPath = false, const FString& Path = "");
+
+	/**
+	*  Check a save game file against its checksums without loading it. The whole file is read, but nothing is decompressed or deserialized.
+	*  @param SlotName				Name of save game slot.
+	*  @param UserIndex				For some platforms, master user index to identify the user doing the saving.
+	*  @param bFileIsCompressed		Was the Game saved using compression? Very important as compressed files have a .csav extension.
+	*  @param bUseCustomPath		Search in a custom "Path"?
+	*  @param Path					Custom Path to search the save file.
+	*  @return						Valid, Corrupt, DoesNotExist or Unverified (slots saved before the checksums existed).
+	*/
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Main", meta = (DisplayName = "CSW::Validate Save Game", AdvancedDisplay = "Path,bUseCustomPath,bFileIsCompressed"))
+		static ECSWSlotValidationResult CSWValidateSaveGame(const FString& SlotName, const int32 UserIndex, const bool bFileIsCompressed = true, const bool bUseCustomPath = false, const FString& Path = "");
+
+	/**
+	*  Delete the file for the corresponding slot. Works for compressed files too.
+	*  @param SlotName				Name of save game slot.
+	*  @param UserIndex				For some platforms, master user index to identify the user doing the saving.
+	*  @param bFileIsCompressed		Was the Game saved using compression? Very important as compressed files have a .csav extension.
+	*  @param bUseCustomPath		Search in a custom "Path"?
+	*  @param Path					Custom Path to search the save file.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Main", meta = (DisplayName = "CSW::Delete Save Game In Slot", AdvancedDisplay = "Path,bUseCustomPath,bFileIsCompressed"))
+		static bool CSWDeleteSaveGameInSlot(const FString& SlotName, const int32 UserIndex, const bool bFileIsCompressed = true, const bool bUseCustomPath = false, const FString& Path = "");
+
+	/**
+	*  Get a list of .sav or .csav file names that exist inside a directory.
+	*  @param bFileIsCompressed		Search for .sav or .csav files?
+	*  @param bUseCustomPath		Search in a custom "Path"?
+	*  @param Path					Custom Path to search the save files.
+	*  @param SlotNames				List of names of the save files found.
+	*/
+	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Main", meta = (DisplayName = "CSW::Get Save Games In Directory", AdvancedDisplay = "Path,bUseCustomPath,bFilesAreCompressed"))
+		static void CSWGetSaveGames(TArray<FString>& SlotNames, const bool bFilesAreCompressed = true, const bool bUseCustomPath = false, const FString& Path = "");
+
+	/**
+	*  Get the .sav or .csav files that exist inside a directory with their metadata (save time, levels, number of actors, sizes...), newest first.
+	*  Only the headers of the files are read, the save games aren't loaded. The result is cached: calling it again only reads the files that changed.
+	*  @param SlotsInfo				Metadata of the save files found.
+	*  @param UserIndex				For some platforms, master user index to identify the user doing the loading.
+	*  @param bFilesAreCompressed	Search for .sav or .csav files?
+	*  @param bUseCustomPath		Search in a custom "Path"?
+	*  @param Path					Custom Path to search the save files.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Main", meta = (DisplayName = "CSW::Get Save Games Info In Directory", AdvancedDisplay = "Path,bUseCustomPath,bFilesAreCompressed"))
+		static void CSWGetSaveGamesInfo(TArray<FCSWSlotInfo>& SlotsInfo, const int32 UserIndex, const bool bFilesAreCompressed = true, const bool bUseCustomPath = false, const FString& Path = "");
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Main", meta = (DisplayName = "CSW::Async Get Save Games Info In Directory", AutoCreateRefTerm = "OnCompleted", AdvancedDisplay = "Path,bUseCustomPath,bFilesAreCompressed", bFilesAreCompressed = "true", bUseCustomPath = "false"))
+		static void CSWGetSaveGamesInfo_Async(const int32 UserIndex, const bool bFilesAreCompressed, const bool bUseCustomPath, const FString& Path, const FCSWOnGetSaveGamesInfoResponse& OnCompleted);
+
+	/**
+	*  Get the metadata of a single save file without loading it. See CSWGetSaveGamesInfo().
+	*  @param SlotName				Name of save game slot.
+	*  @param SlotInfo				Metadata of the save file.
+	*  @param UserIndex				For some platforms, master user index to identify the user doing the loading.
+	*  @param bFileIsCompressed		Was the Game saved using compression? Very important as compressed files have a .csav extension.
+	*  @param bUseCustomPath		Search in a custom "Path"?
+	*  @param Path					Custom Path to search the save file.
+	*  @return						False if the file doesn't exist or its header can't be read.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Main", meta = (DisplayName = "CSW::Get Save Game Info", AdvancedDisplay = "Path,bUseCustomPath,bFileIsCompressed"))
+		static bool CSWGetSaveGameInfo(const FString& SlotName, FCSWSlotInfo& SlotInfo, const int32 UserIndex, const bool bFileIsCompressed = true, const bool bUseCustomPath = false, const FString& Path = "");
+
+	/**
+	*	Auto Fill the SaveGameObject, it needs an already Created "AutoSaveObject". Use CreateSaveGame() Node to create one.
+	*	Auto Fill means that the AutoSaveObject will be populated with all the actors that have a UCSWAutoSaveComponent of the levels in LevelNameArray.
+	*	Use SaveGameToSlot() to actually save the SaveGameObject into a file.
+	*	@param AutoSaveGameObject				The UCSWAutoSaveObject reference, it can be created using the CreateSaveGameObject() node.
+	*	@param LevelNameArray					Filter the save using a level name array (use GetLevels() to obtain the list of levels).
+	*	@param ActorsToSerialize				Actors that will be serialized into the SaveGameObject (use GetActorsWithComponent()).
+	*	@param AutoSaveAndLoadComponentArray	AutoSaveAndLoadComponents that belong to the ActorsToSerialize (use GetActorsWithComponent()).
+	*	@return									The UCSWAutoSaveObject filled with all the actors data from all the maps loaded.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Main", meta = (DisplayName = "CSW::Auto Fill Save Game Object"))
+		static UCSWAutoSaveObject* AutoFillSaveGameObject(UCSWAutoSaveObject* AutoSaveGameObject, const TArray<FCSWLevelWithAutosaveActors>& LevelsWithAutosaveActors);
+
+	/**
+	*	Auto Load the Game and updates the data for all the actors (and components) that were saved.
+	*	If an actor was saved and don't exist in the world anymore, the actors will be recreated (if the option is enabled in the CSWAutoSaveComponent).
+	*	This method loads the data for all the levels in LevelNameArray.
+	*	Use LoadGameFromSlot() to obtain an AutoSaveObject from file.
+	*	@param AutoSaveGameObject				The UCSWAutoSaveObject reference, needs to carry data from saved Actors.
+	*	@param LevelNameArray					Filter the save using a level name array (use GetLevels() to obtain the list of levels).
+	*	@param ActorsToSerialize				Actors that will be serialized into the SaveGameObject (use GetActorsWithComponent()).
+	*	@param AutoSaveAndLoadComponentArray	AutoSaveAndLoadComponents that belong to the ActorsToSerialize (use GetActorsWithComponent()).
+	*	@return									Whether if the Load was successful or Not.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Main", meta = (DisplayName = "CSW::Auto Load Actors Data From Save", HidePin = "WorldContextObject", DefaultToSelf = "WorldContextObject"))
+		static bool AutoLoadActorsDataFromSave(const UObject* WorldContextObject, UCSWAutoSaveObject* AutoSaveGameObject, UPARAM(ref) TArray<FCSWLevelWithAutosaveActors>& LevelsWithAutosaveActors);
+
+	/**
+	* Get an array of struct of type FCSWLevelWithAutosaveActors.
+	* This struct contains a "Level Name" and an array of AutosaveActors (Actors with their respective AutosaveComponent reference).
+	* @param LevelNameArray				Array of Level Names. Use GetLevelNames() to obtain it.
+	* @param LevelsWithAutosaveActors	Array of FCSWLevelWithAutosaveActors
+	*/
+	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Main", meta = (DisplayName = "CSW::Get Levels with AutosaveActors", HidePin = "WorldContextObject", DefaultToSelf = "WorldContextObject"))
+		static void GetLevelsWithAutosaveActors(const UObject* WorldContextObject, const TArray<FName>& LevelNameArray, TArray<FCSWLevelWithAutosaveActors>& LevelsWithAutosaveActors);
+#pragma endregion
+
+#pragma region FUNCTIONS FOR CUSTOMIZING THE AUTO SAVE AND LOAD SYSTEM
+	/**
+	*	Used for customizing the functionality.
+	*	Remove the MapRecords from the AutoSaveGameObject that match the name of the LevelsNameArray input.
+	*	Use CSW::GetLevelsNames() function to obtain the array of maps currently loaded.
+	*	@param	AutoSaveGameObject		The CSWAutoSaveObject.
+	*	@param	LevelsNameArray			Array of levels names. Use CSW::GetLevelsNames() function to obtain the array of maps currently loaded (it supports level streaming).
+	*	@return							True if at least one MapRecords was removed.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Custom", meta = (DisplayName = "CSW::Remove Save Data From Levels with Autosave Actors"))
+		static void TryRemoveSavedDataFromLevels(UCSWAutoSaveObject* AutoSaveGameObject, const TArray<FCSWLevelWithAutosaveActors>& LevelsWithAutosaveActors); ///#CronofearTODO Remove it?
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Custom", meta = (DisplayName = "CSW::Remove Save Data From Level"))
+		static bool TryRemoveSavedDataFromLevel(UCSWAutoSaveObject* AutoSaveGameObject, const FName& LevelName);
+
+	/**
+	*	Used for customizing the functionality.
+	*	Save an array of Actors into the AutoSaveGameObject. Used to save Actors that attaches the CSWAutosaveComponent.
+	*	NOTE: This doesn't delete data from levels inside the AutoSaveGameObject. Use of TryRemoveCurrentMapSavedData() will prevent duplication of data.
+	*	@param AutoSaveGameObject						The save object where the data will be stored.
+	*	@param ActorsArray								The array of actors that will be serialized.
+	*	@param AutoSaveAndLoadComponentArray			The array of components that belongs to the actors.
+	*	@param LevelsNameArray							The array of Map Names in order to filter which maps have to be saved.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Custom", meta = (DisplayName = "CSW::Save Actors into Save Object"))
+		static void SaveActorsToArrayOfMaps(UCSWAutoSaveObject* AutoSaveGameObject, const TArray<FCSWLevelWithAutosaveActors>& LevelsWithAutosaveActors);
+
+	/**
+	*	Used for customizing the functionality.
+	*	Load the Actors Data from an Array of MapRecords (that is inside the AutoSaveGameObject).
+	*	@param AutoSaveGameObject						The save object where the data is stored.
+	*	@param LevelsNameArray							The array of LevelsNames Loaded (or filtered). Use GetLevelsNames().
+	*	@param ActorsArray								The array of the actors in the world that will be updated on load. Use GetActorsWithComponent(CSWAutoSaveComponent).
+	*   @param AutoSaveAndLoadComponentArray			The array of AutoSaveAndLoadComponent that belongs to the actors. Use GetActorsWithComponent(CSWAutoSaveComponent).
+	*/
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Custom", meta = (DisplayName = "CSW::Load Actors Data From Save", HidePin = "WorldContextObject", DefaultToSelf = "WorldContextObject"))
+		static void LoadActorDataFromArrayOfMapRecords(const UObject* WorldContextObject, const UCSWAutoSaveObject* AutoSaveGameObject, UPARAM(ref) TArray<FCSWLevelWithAutosaveActors>& LevelsWithAutosaveActors);
+	UFUNCTION()
+		static void LoadActorDataFromArrayOfMapRecords_Internal(const UObject* WorldContextObject, const UCSWAutoSaveObject* AutoSaveGameObject, UPARAM(ref) TArray<FCSWLevelWithAutosaveActors>& LevelsWithAutosaveActors, const bool bLoadInEditorTime = false);
+
+	/**
+	* Get total number of Actors with an Autosavecomponent
+	* @param LevelsWithAutosaveActors				Struct of Levels containing Actors with AutosaveComponents.
+	*/
+	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Custom", meta = (DisplayName = "CSW::Get Total Num Of Autosave Actors"))
+		static int32 GetTotalAutosaveActors(const TArray<FCSWLevelWithAutosaveActors>& LevelsWithAutosaveActors);
+
+	/**
+	* Enable or disable atomic slot commits (enabled by default).
+	* When enabled, slots are written to a temp file, flushed and renamed over the previous slot, so a crash while saving never leaves a truncated slot.
+	* @param bEnable				Use atomic commits for CSW::Save Game To Slot?
+	*/
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Custom", meta = (DisplayName = "CSW::Set Use Atomic Save Writes"))
+		static void CSWSetUseAtomicSaveWrites(const bool bEnable = true);
+
+	/**
+	* Store the slots of each directory in a single pack file ("Slots.cswpack") instead of a file per slot.
+	* Faster for many small slots (mobile storage, a slot per player on a server): finding, listing and deleting slots never touch the disk.
+	* Slots saved before switching stay where they were and aren't seen by the other save system. Call it before saving or loading anything.
+	* @param bEnable				Use the pack file save system?
+	*/
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Custom", meta = (DisplayName = "CSW::Set Use Pack File Save System"))
+		static void CSWSetUsePackFileSaveSystem(const bool bEnable = true);
+
+	/**
+	* Memory used to keep decoded copies of the slots saved and loaded recently (disabled by default).
+	* Loading a cached slot skips reading, decompressing and deserializing it, the least recently used slots are dropped to stay within the budget.
+	* @param BudgetMegaBytes		Size of the cache in MB, 0 disables it
+	*/
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Custom", meta = (DisplayName = "CSW::Set Decoded Slot Cache Budget"))
+		static void CSWSetDecodedSlotCacheBudget(const int32 BudgetMegaBytes = 0);
+
+	/**
+	* Save the SaveGame variables of actors and components with a plan compiled once per class (enabled by default): no property tags, numeric variables copied in blocks.
+	* Data saved before a class changed is still loaded, variable by variable. Disable it for classes that save extra data in their Serialize() override,
+	* the plan only writes the SaveGame variables. Saves made with either option can always be loaded.
+	* @param bEnable				Use the compiled save plans?
+	*/
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Custom", meta = (DisplayName = "CSW::Set Use Compiled Save Plans"))
+		static void CSWSetUseCompiledSavePlans(const bool bEnable = true);
+
+	/**
+	* Store each name and object referenced by the SaveGame variables once per save game, the data of the actors only has their indices (disabled by default).
+	* Smaller save games, and every object is resolved once per load instead of once per reference. Needs the compiled save plans.
+	* @param bEnable				Use reference tables?
+	*/
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Custom", meta = (DisplayName = "CSW::Set Use Reference Tables"))
+		static void CSWSetUseReferenceTables(const bool bEnable = true);
+
+	/**
+	* Only save the SaveGame variables that differ from the defaults of the actor or component (its class defaults, or its template), enabled by default.
+	* The variables that weren't saved get the default value back when loading. Needs the compiled save plans.
+	* @param bEnable				Save the variables that differ from the defaults only?
+	*/
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Custom", meta = (DisplayName = "CSW::Set Use Delta From Defaults"))
+		static void CSWSetUseDeltaFromDefaults(const bool bEnable = true);
+
+	/**
+	* Only serialize again the actors that changed since they were saved into the save object, the records of the others are kept (enabled by default).
+	* An actor changed if its transform, the SaveGame variables of the actor and its components, or the transforms and velocities of its components changed,
+	* or if Mark Dirty was called on its CSWAutoSaveComponent. Actors with CSWStorerComponents are always serialized.
+	* The records are kept where they are, so it needs the in place record updates (see CSWSetUseInPlaceRecordUpdates()).
+	* @param bEnable				Keep the records of the actors that didn't change?
+	*/
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Custom", meta = (DisplayName = "CSW::Set Use Dirty Tracking"))
+		static void CSWSetUseDirtyTracking(const bool bEnable = true);
+
+	/**
+	* Update the records of the save object in place when it's filled again (enabled by default), so a save object reused between autosaves keeps its memory.
+	* Each actor record is overwritten where it is and only the records of the Actors that weren't saved again are removed.
+	* Otherwise the records of the levels are removed and rebuilt, and the levels saved are moved at the end of the levels record.
+	* @param bEnable				Update the records in place?
+	*/
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Custom", meta = (DisplayName = "CSW::Set Use In Place Record Updates"))
+		static void CSWSetUseInPlaceRecordUpdates(const bool bEnable = true);
+
+	/**
+	* Write only a hash of the engine and custom versions in the slots and journal entries, instead of the hundreds of custom versions registered (disabled by default).
+	* The versions are stored once per build in the "CSWVersions/" folder of each slot directory (in the pack with the pack save system), keep that folder with the slots:
+	* the slots of another build can't be loaded without the versions file of that build. Slots saved by the running build are loaded without reading any version.
+	* @param bEnable				Write the hash of the versions?
+	*/
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Custom", meta = (DisplayName = "CSW::Set Use Compact Versions"))
+		static void CSWSetUseCompactVersions(const bool bEnable = true);
+
+	/**
+	* Register an AES-256 key to encrypt the slots at rest (AES-256-GCM, in hardware on x64 CPUs). Slots are decrypted and authenticated when they are loaded.
+	* Slots remember the ID of their key: keep registering the previous keys (bUseForSaving = false) after changing it, or their slots can't be loaded.
+	* Save times and level names stay readable without the key. The journal of CSW::Save Game To Slot (Journaled) isn't encrypted.
+	* @param KeyId					ID of the key stored in the slots, can't be 0.
+	* @param Key					The 32 bytes of the key in Base64.
+	* @param bUseForSaving			Encrypt the slots saved from now on with this key?
+	* @return						Was the key registered?
+	*/
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Custom", meta = (DisplayName = "CSW::Register Encryption Key"))
+		static bool CSWRegisterEncryptionKey(const int32 KeyId, const FString& Key, const bool bUseForSaving = true);
+
+	/**
+	* Choose the key the slots saved from now on are encrypted with.
+	* @param KeyId					ID of a registered key, 0 saves the slots unencrypted.
+	* @return						False if the key isn't registered.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Custom", meta = (DisplayName = "CSW::Set Save Game Encryption Key"))
+		static bool CSWSetSaveGameEncryptionKey(const int32 KeyId = 0);
+
+#pragma endregion
+
+
+#pragma region COMPRESSION UTILITIES
+
+	/**	
+	* Compress an array of Bytes using ZLIB.
+	* Use Length() node to see the difference in size.
+	* @param DataArray				Array of Bytes that will be compressed.
+	* @param CompressedDataArray	The Compressed version of the DataArray.
+	* @param bUseParallelBlocks		Cut the DataArray into blocks that are compressed (and later decompressed) in parallel. Much faster for big arrays, but older versions of the plugin can't decompress the result.
+	* @param Codec					Codec used for the blocks, stored in the CompressedDataArray. Only used with bUseParallelBlocks (ZLIB otherwise).
+	* @return						Is the CompressedDataArray result less in size than the DataArray? When the DataArray input is too small (less than 100 bytes), the result is usually bigger.
+	*/
+	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Compress", meta = (DisplayName = "CSW::Compress Array Of Bytes", AdvancedDisplay = "bUseParallelBlocks,Codec"))
+		static void CompressArrayOfBytes(UPARAM(ref) TArray<uint8>& DataArray, TArray<uint8>& CompressedDataArray, const bool bUseParallelBlocks = false, const ECSWCompressionCodec Codec = ECSWCompressionCodec::Zlib);
+
+	/**
+	* Decompress an array of Bytes using ZLIB.
+	* Arrays compressed with parallel blocks are detected and decompressed in parallel with the codec stored in them.
+	* Use Length() node to see the difference in size.
+	* @param DataArray					Array of Bytes that will be compressed.
+	* @param DeCompressedDataArray		The Decompressed Version of the Array Of Bytes.
+	* @return							Decompressed Array of Bytes.
+	*/
+	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Compress", meta = (DisplayName = "CSW::Decompress Array Of Bytes", Keywords = "Uncompress"))
+		static void DecompressArrayOfBytes(UPARAM(ref) TArray<uint8>& DataArray, TArray<uint8>& DecompressedDataArray);
+
+	/**
+	* Train a compression dictionary from the actor records of a corpus of save games and write it to a file (offline step, ex. from an editor utility).
+	* Ship the file with the game and register it with CSW::Register Compression Dictionary to save with the "Zlib (Trained Dictionary)" codec.
+	* @param AutoSaveGameObject		Its class is the one of the slots, they are loaded into a transient object of that class (its content isn't changed).
+	* @param SlotNames				Slots of the corpus.
+	* @param DictionaryFilePath		File where the dictionary is written (ex. GetPathProject() + "Content/SaveGame.cswdict").
+	* @param UserIndex				For some platforms, master user index to identify the user doing the loading.
+	* @param bFilesAreCompressed	Compressed files have a .csav extension
+	* @param bUseCustomPath			Use "Path" as a custom load directory?
+	* @param Path					Custom Path where the slots are stored. (ex. GetPathSaveGames())
+	* @return						ID of the dictionary, 0 if it couldn't be trained.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Compress", meta = (DisplayName = "CSW::Train Compression Dictionary", AdvancedDisplay = "Path,bUseCustomPath,bFilesAreCompressed"))
+		static int32 CSWTrainCompressionDictionary(UCSWAutoSaveObject* AutoSaveGameObject, const TArray<FString>& SlotNames, const FString& DictionaryFilePath, const int32 UserIndex, const bool bFilesAreCompressed = true, const bool bUseCustomPath = false, const FString& Path = "");
+
+	/**
+	* Load a dictionary written by CSW::Train Compression Dictionary and register it, so slots compressed with it can be loaded.
+	* @param DictionaryFilePath		File of the dictionary.
+	* @param bUseForSaving			Save with this dictionary when the codec is "Zlib (Trained Dictionary)"?
+	* @return						ID of the dictionary, 0 if it couldn't be loaded.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Compress", meta = (DisplayName = "CSW::Register Compression Dictionary"))
+		static int32 CSWRegisterCompressionDictionary(const FString& DictionaryFilePath, const bool bUseForSaving = true);
+
+	/**
+	* Convert a String into an Array of Bytes. Useful for sending data through the network.
+	* @param InString	The String to be converted.
+	* @param bUseUtf8	Convert the text to Standard UTF-8 before compressing it. Useful for sending data through the network.
+	* @return			An Array of Bytes representing the text.
+	*/
+	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Compress", meta = (DisplayName = "CSW::String To Bytes"))
+		static TArray<uint8> CSWStringToBytes(const FString& InString, const bool bUseUtf8 = true);
+
+	/**
+	* Convert an Array of Bytes into String. Useful for sending data through the network.
+	* @param DataArray	The Array of Bytes to be converted.
+	* @return			A String based on the array of bytes.
+	*/
+	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Compress", meta = (DisplayName = "CSW::Bytes To String"))
+		static FString CSWBytesToString(const TArray<uint8>& DataArray);
+
+	/**
+	* Serialize an Object into a Compressed String
+	* Useful for sending objects data trough the network
+	* Note: Object is not deleted in the process
+	* @param Object						The Object that will be converted.
+	* @param CompressedDataString		The String Result.
+	*/
+	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Compress", meta = (DisplayName = "CSW::Serialize Object To Compressed String"))
+		static void ConvertObjectToString(UObject* Object, FString& ObjectAsString);
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Compress", meta = (AutoCreateRefTerm = "OnConvertObject", DisplayName = "CSW::Async Serialize Object To Compressed String"))
+		static void ConvertObjectToString_Async(UObject* Object, const FOnConvertObject& OnConvertObject);
+	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Compress", meta = (DisplayName = "CSW::Serialize Object To Bytes"))
+		static void ConvertObjectToBytes(UObject* Object, TArray<uint8>& ObjectAsBytes);
+	
+	/**
+	* Restore and Object from a String Input.
+	* Caution: The String must belong to the same type of the object previously serialized.
+	* Note: CompressedDataString is not deleted in the process
+	* @param Object						The Object that will be Restored.
+	* @param CompressedDataString		The String Input.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Compress", meta = (DisplayName = "CSW::Restore Object From Compressed String", DeterminesOutputType = "Object"))
+		static UObject* RestoreObjectFromString(UObject* Object, const FString& ObjectAsString);
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Compress", meta = (AutoCreateRefTerm = "OnRestoreObject", DisplayName = "CSW::Async Restore Object From Compressed String", DeterminesOutputType = "Object"))
+		static void RestoreObjectFromString_Async(UObject* Object, const FString& ObjectAsString, const FOnRestoreObject& OnRestoreObject);
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Compress", meta = (DisplayName = "CSW::Restore Object From Bytes", DeterminesOutputType = "Object"))
+		static UObject* RestoreObjectFromBytes(UObject* Object, const TArray<uint8>& ObjectAsBytes);
+
+#pragma endregion
+
+
+#pragma region GENERAL UTILITIES
+
+	/**
+	*	Given a Source String, obtain a Substring between FirstString and EndString
+	*   Example, in: "This is a -hello world/ string example" - If FirstString is "-" and EndString is "/" the result will be "hello world".
+	*	@param	SearchIn				SourceString where the search will be performed.
+	*	@param	FirstString				The first string to find (Using FindSubstring()).
+	*	@param	EndString				The end string to find (Using FindSubstring()).
+	*	@param	SubstringResult			Substring Result between the FirstString and the EndString.
+	*	@param	bFirstUseCase			The search of the FirstString will be case sensitive?
+	*	@param	bEndUseCase				The search of the EndString will be case sensitive?
+	*	@param	bFirstSearchFromEnd		The search of the FirstString will be performed starting from the end of the SourceString?
+	*	@param	bEndSearchFromEnd		The search of the EndString will be performed starting from the end of the SourceString?
+	*	@param	FirstStartPos			The position to start the search from FirstString.
+	*	@param	EndStartPos				The position to start the search from EndString.
+	*	@param	bIncludeFirstString		Include the FirstString in the SubstringResult?
+	*	@param	bIncludeEndString		Include the EndString in the SubstringResult?
+	*/
+	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Utils", meta = (DisplayName = "CSW::Get Substring Between", AdvancedDisplay = "bFirstUseCase,bEndUseCase,bFirstSearchFromEnd,bEndSearchFromEnd,FirstStartPos,EndStartPos,bIncludeFirstString,bIncludeEndString"))
+		static void GetSubstringBetween(const FString& SearchIn, const FString& FirstString, const FString& EndString, FString& SubstringResult,
+			const bool bFirstUseCase = false, const bool bEndUseCase = false, const bool bFirstSearchFromEnd = false, const bool bEndSearchFromEnd = false, 
+			const int32 FirstStartPos = -1, const int32 EndStartPos = -1, const bool bIncludeFirstString = false, const bool bIncludeEndString = false);
+
+	/**
+	*	Find all Actors in the world with the specified component.
+	*	This is a slow operation, use with caution e.g. do not use every frame.
+	*	@param	Component			Component to find. Must be specified or result array will be empty.
+	*	@param	OutActors			Output array of Actors that have specified component.
+	*	@param	OutActorComponents	Output array of Actor Components that belongs to the array of actors.
+	*/
+	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Utils", meta = (DisplayName = "CSW::Get All Actors With Component", HidePin = "WorldContextObject", DefaultToSelf = "WorldContextObject", DeterminesOutputType = "Component", DynamicOutputParam = "OutActorComponents"))
+		static void GetAllActorsWithComponent(const UObject* WorldContextObject, const TSubclassOf<UActorComponent> Component, TArray<AActor*>& OutActors, TArray<UActorComponent*>& OutActorComponents);
+
+	/**
+	*	Find all Actors in the world with the specified component (filtered by level names)
+	*	This is a slow operation, use with caution e.g. do not use every frame.
+	*	@param	Component			Component to find. Must be specified or result array will be empty.
+	*	@param	OutActors			Output array of Actors that have specified component.
+	*	@param	OutActorComponents	Output array of Actor Components that belongs to the array of actors.
+	*	@param	LevelNameArray		Array of level names used to filter the search (use GetLevelsNames()).
+	*/
+	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Utils", meta = (DisplayName = "CSW::Get All Actors With Component In Levels", HidePin = "WorldContextObject", DefaultToSelf = "WorldContextObject", DeterminesOutputType = "Component", DynamicOutputParam = "OutActorComponents"))
+		static void GetActorsWithComponentInLevels(const UObject* WorldContextObject, const TSubclassOf<UActorComponent> Component, const TArray<FName>& LevelNameArray, TArray<AActor*>& OutActors, TArray<UActorComponent*>& OutActorComponents);
+
+	/**
+	*	Get an actor by IDName and Class in the world (hover the mouse in the world outliner to see the actor ID Name).
+	*	This is a slow operation, use with caution e.g. do not use every frame.
+	*	@param	IDName				ID Name to find. Must be specified or the result will be nullptr.
+	*	@param	ActorClass			Class Filter of the actor, determines the OutputType.
+	*	@return						The Actor found.
+	*/
+	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Utils", meta = (DisplayName = "CSW::Get Actor By ID Name and Class", HidePin = "WorldContextObject", DefaultToSelf = "WorldContextObject", DeterminesOutputType = "ActorClass"))
+		static AActor* GetActorByIDNameAndClass(const UObject* WorldContextObject, const FName IDName, const TSubclassOf<AActor> ActorClass);
+
+	/**
+	*	Get an actor by IDName from a given Array of Actors.
+	*	@param	IDName				ID Name to find. Must be specified or the result will be nullptr.
+	*	@param	ArrayOfActors		The Array of Actors in which the search will be performed.
+	*	@param	Actor				The Actor found.
+	*	@return						The Index of the array where the Actor was found (it's -1 if no actor was found).
+	*/
+	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Utils", meta = (DisplayName = "CSW::Get Actor By ID Name From Array Of Actors"))
+		static int32 GetActorByIDNameFromAnArrayOfActors(const FName IDName, const TArray<AActor*>& ArrayOfActors, AActor*& Actor);
+
+	/**
+	* Get an array of FNames based on the levels currently loaded (including sublevels in level streaming).
+	* Names also contain the name of the path of the levels. Ex: "/Game/Content/Levels/level01"
+	* If a Level is moved to another location, the name will be changed.
+	* @param CurrentMapNameArray - Array of Level Names.
+	*/
+	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Utils", meta = (DisplayName = "CSW::Get Levels Names", HidePin = "WorldContextObject", DefaultToSelf = "WorldContextObject"))
+		static void GetLevelsNames(const UObject* WorldContextObject, TArray<FName>& CurrentLevelNameArray);
+
+	/**
+	*	Get the Level name (path/name) from the ULevel input reference (i.e obtained from CSW::GetLevelOwnerFromActor()).
+	*	You can use this name to load a level, stream load/unload, etc.
+	*	@param Level	The Level reference.
+	*	@return			The name of the Level ("path/name").
+	*/
+	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Utils", meta = (DisplayName = "CSW::Get Name From Level"))
+		static FName CSWGetLevelName(ULevel* Level);
+
+	/**
+	*	Get the Level reference where the actor is loaded (supports level streaming).
+	*	@param Actor	The actor reference.
+	*	@return			The Level reference where the actor belongs (supports level streaming).
+	*/
+	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Utils", meta = (DisplayName = "CSW::Get Level Owner From Actor"))
+		static ULevel* GetActorLevel(AActor* Actor);
+
+	/**
+	* Get ULevel Reference based on the Name of the level. Iterate over UWord::GetLevels() and see if any of the Levels match.
+	* Names are sanitated by using CSWGetLevelName();
+	*/
+	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Utils", meta = (DisplayName = "CSW::Get Level From Name", HidePin = "WorldContextObject", DefaultToSelf = "WorldContextObject"))
+		static ULevel* GetLevelReferenceFromName(const UObject* WorldContextObject, const FName& NameOfTheLevel);
+
+	/**
+	* Get an actor of this class, only if there's only one actor of this class in the world.
+	* This is an slow operation. Use this function with caution, e.g do not use it every frame.
+	* @param ActorClass		Class of the actor to return
+	* @return				The reference of the actor, can be nullptr if there are none or two+ actors in the world.
+	*/
+	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Utils", meta = (HidePin = "WorldContextObject", DefaultToSelf = "WorldContextObject", UnsafeDuringActorConstruction = "true", DisplayName = "CSW::Get Unique Actor Of Class", DeterminesOutputType = "ActorClass"))
+		static class AActor* GetUniqueActorOfClass(const UObject* WorldContextObject, const TSubclassOf<AActor> ActorClass);
+
+	/**
+	*	Spawn an Actor in the world with a given Name and Class.
+	*	CAUTION: Use it wisely, don't give an ID Name that already exists in the world or the previous Actor will be deleted.
+	*	@param Class				The class of the actor that will be spawned.
+	*	@param SpawnTransformm		The transform data.
+	*	@param NameID				The Given Name.
+	*	@return						The Spawned Actor Reference.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Utils", meta = (HidePin = "WorldContextObject", DefaultToSelf = "WorldContextObject", DisplayName = "CSW::Spawn Actor With a Name ID From Class", DeterminesOutputType = "Class"))
+		static AActor* SpawnActorWithIDNameFromClass(const UObject* WorldContextObject, const TSubclassOf<AActor> Class, const FTransform& SpawnTransform, FName NameID, ULevel* OwnerLevel);
+	UFUNCTION()
+		static AActor* SpawnActorWithIDNameFromClass_Internal(const UObject* WorldContextObject, const TSubclassOf<AActor> Class, const FTransform& SpawnTransform, FName NameID, ULevel* OwnerLevel, bool bLoadInEditorTime = false);
+
+	/**
+	* Verify if a directory exists.
+	* @param Path				Path to check.
+	* @return					True if the directory exists.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Utils", meta = (DisplayName = "CSW::Does Directory Exist"))
+		static bool CSWDoesDirectoryExists(const FString& Path);
+
+	/**
+	* Attempt to create a directory tree.
+	* Doesn't do anything if the directory already exists, in which case it returns false.
+	* Ex1: GetPathSaved()+"Test/" will attempt to create a "Test/" directory inside ".../Project/Saved/".
+	* Ex2: GetPathProject()+"Test/a/b/" will attempt to create a "Test/a/b/" directory TREE inside ".../Project/".
+	* @param Path				Path that should also contain non-existent directories.
+	* @return					True if the directory is successfully created.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "CSW|AutoSaveAndLoadSystem::Utils", meta = (DisplayName = "CSW::Create Directory"))
+		static bool CSWMakeDirectory(const FString& Path);
+
+	/**
+	* Get the absolute path of the ".../Project/" folder.
+	*/
+	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Utils", meta = (DisplayName = "CSW::Get Path of /Project"))
+		static FString GetPathProject();
+	/**
+	* Get the absolute path of the ".../Project/Saved/" folder.
+	*/
+	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Utils", meta = (DisplayName = "CSW::Get Path of /Saved"))
+		static FString GetPathSaved();
+	/**
+	* Get the absolute path of the ".../Project/Saved/SaveGames/" folder.
+	*/
+	UFUNCTION(BlueprintPure, Category = "CSW|AutoSaveAndLoadSystem::Utils", meta = (DisplayName = "CSW::Get Path of /SaveGames"))
+		static FString GetPathSaveGames();
+#pragma endregion
+
+
+#pragma region PRIVATE (NOT DIRECTLY EXPOSED TO BLUEPRINTS)
+
+public:
+	/**
+	* Save All Actors in a Level
+	* Each Actor call FullSaveActorIntoRecord()
+	*/
+	UFUNCTION()
+		static void SaveAllActorsInLevel(UCSWAutoSaveObject* AutoSaveGameObject, const FCSWLevelWithAutosaveActors& LevelWithAutosaveActors, uint32 LevelRecordIndex);
+	/**
+	* Call OnBeginSave, FullSaveActorInRecord and OnEndSave
+	*/
+	UFUNCTION()
+		static void SaveActorInLevel(const FCSWAutosaveActor &AutosaveActor, UCSWAutoSaveObject* AutoSaveGameObject, uint32 LevelRecordIndex);
+	/**
+	* Full save Actor into a Record.
+	* Call SaveActor() and SaveActorComponents()
+	* The names and objects of the data are added to the reference table of AutoSaveGameObject, if it isn't null and the reference tables are used.
+	*/
+	UFUNCTION()
+		static void FullSaveActorIntoRecord(FCSWActorRecord& ActorRecord, AActor* Actor, const UCSWAutoSaveComponent* AutosaveComponent, UCSWAutoSaveObject* AutoSaveGameObject = nullptr);
+	/**
+	* Save an Actor Data into a CSWActorStruct.
+	*/
+	UFUNCTION()
+		static void SaveActor(FCSWActorRecord& ActorRecord, AActor* Actor, const UCSWAutoSaveComponent* AutoSaveAndLoadComponent, UCSWAutoSaveObject* AutoSaveGameObject = nullptr);
+	/**
+	* Save the components of an Actor into an Array of CSWActorComponentArrayRecords
+	*/
+	UFUNCTION()
+		static void SaveActorComponents(FCSWActorRecord& ActorRecord, AActor* Actor, const UCSWAutoSaveComponent* AutoSaveAndLoadComponent, UCSWAutoSaveObject* AutoSaveGameObject = nullptr);
+	/**
+	* Save the components of an Actor into an Array of CSWActorComponentArrayRecords
+	*/
+	UFUNCTION()
+		static void SaveActorComponent(FCSWActorRecord& ActorRecord, UActorComponent* ActorComponent, const UCSWAutoSaveComponent* AutoSaveAndLoadComponent, FCSWAutoSaveComponentOption& ComponentOptions, UCSWAutoSaveObject* AutoSaveGameObject = nullptr);
+
+	/**
+	* The functions above with the pose batch of the level being saved (see SaveAllActorsInLevel()).
+	* With a batch only the pose fields of the records are chosen, the poses are gathered into it and scattered into the records once every actor of the level is built.
+	* Without one (nullptr) the poses are read right away.
+	* SaveActorComponent_Internal() builds the component record at RecordIndex of the actor record, over the one there if any (INDEX_NONE adds it).
+	*/
+	static void FullSaveActorIntoRecord_Internal(FCSWActorRecord& ActorRecord, AActor* Actor, const UCSWAutoSaveComponent* AutosaveComponent, UCSWAutoSaveObject* AutoSaveGameObject, class FCSWPoseBatch* PoseBatch);
+	static void SaveActor_Internal(FCSWActorRecord& ActorRecord, AActor* Actor, const UCSWAutoSaveComponent* AutoSaveAndLoadComponent, UCSWAutoSaveObject* AutoSaveGameObject, class FCSWPoseBatch* PoseBatch);
+	static void SaveActorComponents_Internal(FCSWActorRecord& ActorRecord, AActor* Actor, const UCSWAutoSaveComponent* AutoSaveAndLoadComponent, UCSWAutoSaveObject* AutoSaveGameObject, class FCSWPoseBatch* PoseBatch);
+	static void SaveActorComponent_Internal(FCSWActorRecord& ActorRecord, UActorComponent* ActorComponent, const UCSWAutoSaveComponent* AutoSaveAndLoadComponent, FCSWAutoSaveComponentOption& ComponentOptions, UCSWAutoSaveObject* AutoSaveGameObject, const int32 RecordIndex, class FCSWPoseBatch* PoseBatch);
+	
+	//-----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+
+	UFUNCTION()
+		static void LoadAllActorsInLevel(const UObject* WorldContextObject, const UCSWAutoSaveObject* AutoSaveGameObject, const FCSWMapRecord& levelRecord, TArray<FCSWAutosaveActor>& AutosaveActorsInLevel, const bool bLoadInEditorTime);
+
+	UFUNCTION()
+		static void LoadActorInLevel(const FCSWActorRecord &ActorRecord, TArray<FCSWAutosaveActor> &AutosaveActorsInLevel, const UCSWAutoSaveObject* AutoSaveGameObject, const UObject* WorldContextObject, const FCSWMapRecord &levelRecord, const bool bLoadInEditorTime);
+
+	/**
+	*	Load a FCSWActorRecord data into the corresponding actor (the actor components too).
+	*	AutoSaveGameObject is the save object the record belongs to, its reference table resolves the names and objects of the data.
+	*/
+	UFUNCTION()
+		static void FullLoadActorFromRecord(const FCSWActorRecord& ActorRecord, AActor* Actor, UCSWAutoSaveComponent* AutoSaveAndLoadComponent, const bool bLoadActorComponents = true, const UCSWAutoSaveObject* AutoSaveGameObject = nullptr);
+	/**
+	* Load an Actor from a FCSWActorRecord.
+	*/
+	UFUNCTION()
+		static void LoadActor(const FCSWActorRecord& ActorRecord, AActor* DynamicActor, const UCSWAutoSaveObject* AutoSaveGameObject = nullptr);
+	/**
+	* Load the components of an Actor from an array of CSWActorComponentArrayRecords
+	*/
+	UFUNCTION()
+		static void LoadActorComponents(const FCSWActorRecord& ActorRecord, AActor* DynamicActor, const UCSWAutoSaveComponent* AutoSaveAndLoadComponent, const UCSWAutoSaveObject* AutoSaveGameObject = nullptr);
+
+	/**
+	* Load a component of an actor from a CSWActorComponentRecord
+	*/
+	UFUNCTION()
+		static void LoadActorComponent(const FCSWActorComponentRecord &actorComponentRecord, UActorComponent* actorcomponent, const FCSWAutoSaveComponentOption &componentOptions, const UCSWAutoSaveComponent* AutoSaveAndLoadComponent, const UCSWAutoSaveObject* AutoSaveGameObject = nullptr);
+
+	
+	//-----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+	/**
+	* Try to destroy an array of actors if their corresponding AutoSaveAndLoadComponents have the bDestroyActorOnLoadGameIfWasNotSaved set to true
+	*/
+	UFUNCTION()
+		static void CSWTryDestroyActors(const UCSWAutoSaveObject* AutoSaveGameObject, TArray<FCSWAutosaveActor>& AutosaveActorsInLevel);
+	UFUNCTION()
+		static void TryDestroyActor(FCSWAutosaveActor &autosaveActor, const UCSWAutoSaveObject* AutoSaveGameObject);
+
+
+	/**
+	* Check if the component can be saved or not. If it can be saved, returns the componentOptions that can be used to customize the functionality
+	*/
+	UFUNCTION()
+		static bool GetComponentSaveAndLoadConditions(const UCSWAutoSaveComponent* AutoSaveAndLoadComponent, const UActorComponent* actorcomponent, FCSWAutoSaveComponentOption &componentOptions);
+
+	/**
+	* Get the LevelRecordIndex to use in the AutoSaveGameObject->LevelRecords array. The index is based on the match of LevelsWithAutosaveActors.Name and AutoSaveGameObject->LevelRecords
+	*/
+	UFUNCTION()
+		static uint32 GetLevelRecordIndexSave(UCSWAutoSaveObject* AutoSaveGameObject, const FCSWLevelWithAutosaveActors& LevelWithAutosaveActors, bool& bMatchFound);
+	UFUNCTION()
+		static uint32 GetLevelRecordIndexLoad(const FCSWMapRecord& LevelRecord, const TArray<FCSWLevelWithAutosaveActors>& LevelSWithAutosaveActors, bool& bMatchFound);
+
+	/**
+	* Get the index and the Actor reference where the Actor was found by Name inside the AutosaveActorsInLevel array
+	*/
+	UFUNCTION()
+		static int32 GetActorByIDFromAutosaveActors(const FName IDName, const TArray<FCSWAutosaveActor>& AutosaveActorsInLevel, AActor*& Actor);
+	/**
+	* Internal Load Actor
+	*/
+	UFUNCTION()
+		static void LoadActor_Internal(const FCSWActorRecord& ActorRecord, const UCSWAutoSaveObject* AutoSaveGameObject, UCSWAutoSaveComponent* AutosaveComponent, AActor* LoadedActor, bool bDestroyActorIfAutosaveComponentDisabled);
+#pragma endregion
+};
@@ -0,0 +1,104 @@
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+#pragma once
+#include "CoreMinimal.h"
+#include "CSWAutoSaveEnum.generated.h"
+
+
+/**
+* Codecs the save games can be compressed with. The codec is stored in the header of the slot, so loading doesn't need to know it.
+* NOTE: The values are written to disk, never change them.
+*
+* @see FCSWCompressionCodecRegistry
+*/
+UENUM(BlueprintType)
+enum class ECSWCompressionCodec : uint8
+{
+	/** Not compressed */
+	None = 0		UMETA(DisplayName = "None"),
+	/** Zlib, good ratio (default for manual saves) */
+	Zlib = 1		UMETA(DisplayName = "Zlib"),
+	/** Gzip */
+	Gzip = 2		UMETA(DisplayName = "Gzip"),
+	/** Zlib biased for speed, for frequent autosaves */
+	ZlibFast = 3	UMETA(DisplayName = "Zlib (Fast)"),
+	/** LZ4, very fast. Not available until the project registers a codec for it */
+	LZ4 = 4			UMETA(DisplayName = "LZ4"),
+	/** The custom compressor of the engine (-compressor=<Module>, ex. Oodle) */
+	Custom = 5		UMETA(DisplayName = "Custom (Engine Compressor)"),
+	/** Zlib with a dictionary trained on previous save games (see CSWTrainCompressionDictionary()). The dictionary must be registered before saving and loading */
+	ZlibDictionary = 6	UMETA(DisplayName = "Zlib (Trained Dictionary)"),
+};
+
+/**
+* Result of checking the checksums of a slot (see CSWValidateSaveGame()).
+*/
+UENUM(BlueprintType)
+enum class ECSWSlotValidationResult : uint8
+{
+	/** The slot matches its checksums */
+	Valid = 0		UMETA(DisplayName = "Valid"),
+	/** The slot was written before the checksums existed (or by a newer version of the plugin), it can't be verified */
+	Unverified = 1	UMETA(DisplayName = "Unverified"),
+	/** The slot is damaged or cut */
+	Corrupt = 2		UMETA(DisplayName = "Corrupt"),
+	/** There's no slot with that name */
+	DoesNotExist = 3	UMETA(DisplayName = "Does Not Exist"),
+};
+
+/**
+* Priority of a background save job (see CSWScheduleSaveGameToSlot()). The writer runs the jobs with the highest priority first.
+*/
+UENUM(BlueprintType)
+enum class ECSWSaveJobPriority : uint8
+{
+	/** Journal compactions and other housekeeping */
+	Low = 0			UMETA(DisplayName = "Low"),
+	/** Autosaves */
+	Normal = 1		UMETA(DisplayName = "Normal"),
+	/** Saves the player asked for */
+	High = 2		UMETA(DisplayName = "High"),
+};
+
+/**
+* How the transforms and velocities of the records of an Actor are stored in the slots (see FCSWTransformCodec). The records keep full precision values in memory,
+* the quantized values are decoded back into them when the slot is loaded.
+* NOTE: The values are written to disk, never change them.
+*/
+UENUM(BlueprintType)
+enum class ECSWTransformPrecision : uint8
+{
+	/** Full precision floats */
+	Full = 0		UMETA(DisplayName = "Full"),
+	/** Location with 24 bits per axis inside the bounds of the level, rotations with 15 bits per component (smallest three), half float velocities */
+	High = 1		UMETA(DisplayName = "High (Quantized)"),
+	/** Location with 16 bits per axis inside the bounds of the level, rotations with 10 bits per component (smallest three), half float velocities */
+	Low = 2			UMETA(DisplayName = "Low (Quantized)"),
+};
+
+/**
+* Fields of a FCSWActorComponentRecord that were captured when the component was saved (see FCSWActorComponentRecord::Fields).
+* Only those are stored in the slots and restored on load, the others keep the values of the component.
+* NOTE: The values are written to disk, never change them.
+*/
+UENUM(BlueprintType, meta = (Bitflags, UseEnumValuesAsMaskValuesInEditor = "true"))
+enum class ECSWComponentRecordField : uint8
+{
+	None = 0				UMETA(Hidden),
+	/** Relative location (scene components) */
+	Location = 1 << 0		UMETA(DisplayName = "Location"),
+	/** Relative rotation (scene components) */
+	Rotation = 1 << 1		UMETA(DisplayName = "Rotation"),
+	/** Relative scale (scene components) */
+	Scale = 1 << 2			UMETA(DisplayName = "Scale"),
+	/** Physics linear velocity (primitive components) */
+	LinearVelocity = 1 << 3	UMETA(DisplayName = "Linear Velocity"),
+	/** Physics angular velocity (primitive components) */
+	AngularVelocity = 1 << 4	UMETA(DisplayName = "Angular Velocity"),
+	All = 0x1F				UMETA(Hidden),
+};
+ENUM_CLASS_FLAGS(ECSWComponentRecordField);
@@ -1,210 +1,429 @@
-/**
-* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
-*
-* Developed by Kevin Yabar Garces
-*/
-
-#pragma once
-#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
-#include "CSWAutoSaveStruct.generated.h"
-
-
-/**
-* Custom GameArchive that allows to serialize SAVEGAME flagged variables
-*/
-struct FCSWSaveGameArchive : public FObjectAndNameAsStringProxyArchive
-{
-	FCSWSaveGameArchive(FArchive& InInnerArchive, bool bInLoadIfFindFails) :FObjectAndNameAsStringProxyArchive(InInnerArchive, bInLoadIfFindFails)
-	{
-		ArIsSaveGame = true;
-		ArNoDelta = true;
-	}
-};
-
-/**
-* The structure where the actor components data will be stored.
-* This structure is used to save the components data for each actor for each level loaded.
-* The data can be used then to restore the state of the components.
-* 
-* Each FCSWActorComponentRecord belongs to a FCSWActorRecord.
-*/
-USTRUCT(BlueprintType)
-struct FCSWActorComponentRecord
-{
-	GENERATED_USTRUCT_BODY()
-	
-	/**
-	* The name of the component
-	*/
-	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Name", meta = (DisplayName = "Actor Component Name"))
-		FName Name;
-
-	/**
-	* The serialized data from the component (SAVEGAME flagged variables mainly)
-	*/
-	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "ComponentData", meta = (DisplayName = "Actor Component Data"))
-		TArray<uint8> Data;
-
-	/**
-	* The Location of the component (Only for components that inherits from SceneComponents)
-	*/
-	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Transform", meta = (DisplayName = "Scene Component Location"))
-		FVector Loc;
-	/**
-	* The Rotation of the component (Only for components that inherits from SceneComponents)
-	*/
-	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Transform", meta = (DisplayName = "Scene Component Rotation"))
-		FRotator Rot;
-	/**
-	* The Scale of the component (Only for components that inherits from SceneComponents)
-	*/
-	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Transform", meta = (DisplayName = "Scene Component Scale"))
-		FVector Scale;
-
-	/**
-	* The Linear Velocity of the component (Only for components that inherits from PrimitiveComponents)
-	*/
-	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Physics", meta = (DisplayName = "Primitive Component Linear Velocity"))
-		FVector LinearVel;
-	/**
-	* The Angular Velocity of the component (Only for components that inherits from PrimitiveComponents)
-	*/
-	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Physics", meta = (DisplayName = "Primitive Component Linear Velocity"))
-		FVector AngularVel;
-
-	FCSWActorComponentRecord()
-	{
-
-	}
-};
-
-/**
-* The structure where the actors data will be stored.
-* This structure is used to save the actors data for each level loaded.
-* The data can be used then to restore the state of the actors.
-* 
-* Each FCSWActorRecord has an array of FCSWActorComponentRecord.
-* Each FCSWActorRecord belongs to a FCSWMapRecord.
-*/
-USTRUCT(BlueprintType)
-struct FCSWActorRecord
-{
-	GENERATED_USTRUCT_BODY()
-
-	/**
-	* The name of the Actor
-	*/
-	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Name", meta = (DisplayName = "Actor Name"))
-		FName Name;
-	/**
-	* The Class of the Actor
-	*/
-	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Class", meta = (DisplayName = "Actor Class"))
-		UClass*	Class;
-	/**
-	* The Transform of the Actor
-	*/
-	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Transform", meta = (DisplayName = "Actor Transform"))
-		FTransform XForm;
-	/**
-	* Determines if the Actor will be loaded with a random name or not
-	*/
-	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Bool", meta = (DisplayName = "Load with Random ID Name?"))
-		bool bLoadRandomID;
-	/**
-	* The data of the Actor (mainly SAVEGAME flagged variables)
-	*/
-	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "ActorData", meta = (DisplayName = "Actor Data"))
-		TArray<uint8> Data;
-	/**
-	* The array of FCSWActorComponentRecord that this FCSWActorRecord has
-	*/
-	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "ComponentData", meta = (DisplayName = "Actor Component Records"))
-		TArray<FCSWActorComponentRecord> ComponentsRecord;
-
-	FCSWActorRecord()
-	{
-
-	}
-};
-
-/**
-* The structure where the map data will be stored.
-* This structure is used to save the levels loaded data.
-* The data can be used then to restore the state of the levels.
-* 
-* Each FCSWMapRecord has an array of FCSWActorRecord.
-*/
-USTRUCT(BlueprintType)
-struct FCSWMapRecord
-{
-	GENERATED_USTRUCT_BODY()
-	/**
-	* The name of the level (can be many levels in a single file)
-	*/
-	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Name", meta = (DisplayName = "Level Name"))
-		FName Name;
-	/**
-	* The array of FCSWActorRecord
-	*/
-	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "ActorRecord", meta = (DisplayName = "Actor Record Array"))
-		TArray<FCSWActorRecord> ActorsRecord;
-
-	FCSWMapRecord()
-	{
-
-	}
-};
-
-/**
-* Options used to customize the auto save and load functionality from certain components in an actor that has the CSWAutoSaveComponent attached.
-* Print the object name from the component to be certain that the name is correct.
-* 
-* This structure is used in the CSWAutoSaveComponent.
-* These options override the Default options that can be seen in the CSWAutoSaveComponent Property Panel.
-*/
-USTRUCT(BlueprintType)
-struct FCSWAutoSaveComponentOption
-{
-	GENERATED_USTRUCT_BODY()
-	/**
-	* The name of the component to be customized (print the object name from the component to be certain that the name is correct)
-	*/
-	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "ActorComponent", meta = (DisplayName = "Component Name"))
-		FName Name="";
-	/**
-	* If true, the component will be saved (and the functionality can be customized).
-	*/
-	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "SceneComponent", meta = (DisplayName = "Save Component?"))
-		uint32 bSave : 1;
-	/**
-	* If true, the location of the component will be saved (if it's a SceneComponent).
-	*/
-	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "SceneComponent", meta = (EditCondition = "bSave", DisplayName = "Save Component Location?"))
-		bool bSaveLoc = true;
-	/**
-	* If true, the rotation of the component will be saved (if it's a SceneComponent).
-	*/
-	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "SceneComponent", meta = (EditCondition = "bSave", DisplayName = "Save Component Rotation?"))
-		bool bSaveRot = true;
-	/**
-	* If true, the scale of the component will be saved (if it's a SceneComponent).
-	*/
-	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "SceneComponent", meta = (EditCondition = "bSave", DisplayName = "Save Component Scale?"))
-		bool bSaveScale = true;
-	/**
-	* If true, the Linear Velocity of the component will be saved (if it's a PrimitiveComponent).
-	*/
-	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "PrimitiveComponent", meta = (EditCondition = "bSave", DisplayName = "Save Component Linear Velocity?"))
-		bool bSaveLVel = true;
-	/**
-	* If true, the Angular Velocity of the component will be saved (if it's a PrimitiveComponent).
-	*/
-	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "PrimitiveComponent", meta = (EditCondition = "bSave", DisplayName = "Save Component Angular Velocity?"))
-		bool bSaveAVel = true;
-
-	FCSWAutoSaveComponentOption()
-	{
-
-	}
-};
\ No newline at end of file
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+#pragma once
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+#include "Field/Enum/CSWAutoSaveEnum.h"
+#include "CSWAutoSaveStruct.generated.h"
+
+
+/**
+* Custom GameArchive that allows to serialize SAVEGAME flagged variables
+*/
+struct FCSWSaveGameArchive : public FObjectAndNameAsStringProxyArchive
+{
+	FCSWSaveGameArchive(FArchive& InInnerArchive, bool bInLoadIfFindFails) :FObjectAndNameAsStringProxyArchive(InInnerArchive, bInLoadIfFindFails)
+	{
+		ArIsSaveGame = true;
+		ArNoDelta = true;
+	}
+};
+
+/** Identifies the records written by their native serializers ("CSWR"). Tagged records start with the length of a property name and can't be mistaken for it */
+#define CSW_NATIVE_RECORD_MAGIC 0x52575343
+
+/**
+* Versions of the native format of FCSWMapRecord, FCSWActorRecord and FCSWActorComponentRecord (TStructOpsTypeTraits::WithSerializer).
+* The records are written untagged: their fields in a fixed order, their data arrays as a single block. The outermost record written starts with
+* CSW_NATIVE_RECORD_MAGIC and the version, the records inside it are written with the same version and without them.
+* Records without the magic are tagged (older saves) and are still loaded by the tagged properties.
+*/
+struct CSWAUTOSAVEANDLOADSYSTEM_API FCSWRecordVersion
+{
+	enum Type
+	{
+		InitialVersion = 1,
+
+		// -----<new versions can be added above this line>-------------------------------------------------
+		VersionPlusOne,
+		LatestVersion = VersionPlusOne - 1
+	};
+
+	/** Write the magic and the latest version */
+	static void SaveHeader(FArchive& Ar);
+
+	/** Read the magic and the version. False if the record is tagged, the archive is left where it was then. Newer versions set an error on the archive */
+	static bool LoadHeader(FArchive& Ar, int32& OutVersion);
+};
+
+/**
+* The structure where the actor components data will be stored.
+* This structure is used to save the components data for each actor for each level loaded.
+* The data can be used then to restore the state of the components.
+* 
+* Each FCSWActorComponentRecord belongs to a FCSWActorRecord.
+*/
+USTRUCT(BlueprintType)
+struct CSWAUTOSAVEANDLOADSYSTEM_API FCSWActorComponentRecord
+{
+	GENERATED_USTRUCT_BODY()
+	
+	/**
+	* The name of the component
+	*/
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Name", meta = (DisplayName = "Actor Component Name"))
+		FName Name;
+
+	/**
+	* The serialized data from the component (SAVEGAME flagged variables mainly)
+	*/
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "ComponentData", meta = (DisplayName = "Actor Component Data"))
+		TArray<uint8> Data;
+
+	/**
+	* The Location of the component (Only for components that inherits from SceneComponents)
+	*/
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Transform", meta = (DisplayName = "Scene Component Location"))
+		FVector Loc;
+	/**
+	* The Rotation of the component (Only for components that inherits from SceneComponents)
+	*/
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Transform", meta = (DisplayName = "Scene Component Rotation"))
+		FRotator Rot;
+	/**
+	* The Scale of the component (Only for components that inherits from SceneComponents)
+	*/
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Transform", meta = (DisplayName = "Scene Component Scale"))
+		FVector Scale;
+
+	/**
+	* The Linear Velocity of the component (Only for components that inherits from PrimitiveComponents)
+	*/
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Physics", meta = (DisplayName = "Primitive Component Linear Velocity"))
+		FVector LinearVel;
+	/**
+	* The Angular Velocity of the component (Only for components that inherits from PrimitiveComponents)
+	*/
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Physics", meta = (DisplayName = "Primitive Component Linear Velocity"))
+		FVector AngularVel;
+
+	/**
+	* The fields (ECSWComponentRecordField) captured when the component was saved. Only those are written to the slots and loaded back into the component.
+	* Records of older saves don't have it and have every field.
+	*/
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Fields", meta = (DisplayName = "Actor Component Fields", Bitmask, BitmaskEnum = "ECSWComponentRecordField"))
+		uint8 Fields;
+
+	FCSWActorComponentRecord()
+		: Loc(FVector::ZeroVector)
+		, Rot(FRotator::ZeroRotator)
+		, Scale(FVector::OneVector)
+		, LinearVel(FVector::ZeroVector)
+		, AngularVel(FVector::ZeroVector)
+		, Fields(static_cast<uint8>(ECSWComponentRecordField::All))
+	{
+
+	}
+
+	bool HasField(const ECSWComponentRecordField Field) const { return (Fields & static_cast<uint8>(Field)) != 0; }
+	void AddField(const ECSWComponentRecordField Field) { Fields |= static_cast<uint8>(Field); }
+
+	/** Native serializer, see FCSWRecordVersion. False when loading a tagged record */
+	bool Serialize(FArchive& Ar);
+
+	/**
+	* The fields of the record without the magic and the version. Only the fields in Fields are written.
+	* bWithPose: Fields and the fields, left out by the compact records (see FCSWTransformCodec) which write them in their pose.
+	*/
+	void SerializeRecord(FArchive& Ar, const int32 Version, const bool bWithPose);
+};
+
+template<>
+struct TStructOpsTypeTraits<FCSWActorComponentRecord> : public TStructOpsTypeTraitsBase2<FCSWActorComponentRecord>
+{
+	enum
+	{
+		WithSerializer = true,
+	};
+};
+
+/**
+* The structure where the actors data will be stored.
+* This structure is used to save the actors data for each level loaded.
+* The data can be used then to restore the state of the actors.
+* 
+* Each FCSWActorRecord has an array of FCSWActorComponentRecord.
+* Each FCSWActorRecord belongs to a FCSWMapRecord.
+*/
+USTRUCT(BlueprintType)
+struct CSWAUTOSAVEANDLOADSYSTEM_API FCSWActorRecord
+{
+	GENERATED_USTRUCT_BODY()
+
+	/**
+	* The name of the Actor
+	*/
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Name", meta = (DisplayName = "Actor Name"))
+		FName Name;
+	/**
+	* The Class of the Actor
+	*/
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Class", meta = (DisplayName = "Actor Class"))
+		UClass*	Class;
+	/**
+	* The Transform of the Actor
+	*/
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Transform", meta = (DisplayName = "Actor Transform"))
+		FTransform XForm;
+	/**
+	* Determines if the Actor will be loaded with a random name or not
+	*/
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Bool", meta = (DisplayName = "Load with Random ID Name?"))
+		bool bLoadRandomID;
+	/**
+	* The data of the Actor (mainly SAVEGAME flagged variables)
+	*/
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "ActorData", meta = (DisplayName = "Actor Data"))
+		TArray<uint8> Data;
+	/**
+	* The array of FCSWActorComponentRecord that this FCSWActorRecord has
+	*/
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "ComponentData", meta = (DisplayName = "Actor Component Records"))
+		TArray<FCSWActorComponentRecord> ComponentsRecord;
+	/**
+	* How the transforms and velocities of this record are stored in the slots. Not a property, it's part of the compact records (see FCSWTransformCodec)
+	*/
+	ECSWTransformPrecision Precision;
+	/**
+	* When the record was last filled from its Actor (see NewChangeStamp()), 0 if it wasn't (loaded records). Not a property, the journaled saves only
+	* compare the records filled since their previous entry (see FCSWSaveGameJournalState::RecordStamp)
+	*/
+	uint64 ChangeStamp;
+
+	FCSWActorRecord()
+		: Class(nullptr)
+		, XForm(FTransform::Identity)
+		, bLoadRandomID(false)
+		, Precision(ECSWTransformPrecision::Full)
+		, ChangeStamp(0)
+	{
+
+	}
+
+	/** A ChangeStamp greater than every one given before. Game thread */
+	static uint64 NewChangeStamp();
+	/** The last ChangeStamp given, 0 if none was */
+	static uint64 GetLastChangeStamp();
+
+	/** Native serializer, see FCSWRecordVersion. False when loading a tagged record */
+	bool Serialize(FArchive& Ar);
+
+	/**
+	* The fields of the record and of its component records without the magic and the version.
+	* bWithPose: the transform, the precision and the fields of the components, left out by the compact records (see FCSWTransformCodec).
+	*/
+	void SerializeRecord(FArchive& Ar, const int32 Version, const bool bWithPose);
+};
+
+template<>
+struct TStructOpsTypeTraits<FCSWActorRecord> : public TStructOpsTypeTraitsBase2<FCSWActorRecord>
+{
+	enum
+	{
+		WithSerializer = true,
+	};
+};
+
+/**
+* The structure where the map data will be stored.
+* This structure is used to save the levels loaded data.
+* The data can be used then to restore the state of the levels.
+* 
+* Each FCSWMapRecord has an array of FCSWActorRecord.
+*/
+USTRUCT(BlueprintType)
+struct CSWAUTOSAVEANDLOADSYSTEM_API FCSWMapRecord
+{
+	GENERATED_USTRUCT_BODY()
+	/**
+	* The name of the level (can be many levels in a single file)
+	*/
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Name", meta = (DisplayName = "Level Name"))
+		FName Name;
+	/**
+	* The array of FCSWActorRecord
+	*/
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "ActorRecord", meta = (DisplayName = "Actor Record Array"))
+		TArray<FCSWActorRecord> ActorsRecord;
+	/**
+	* Bounds of the locations of the quantized actor records, computed when the level is written to a slot (see FCSWTransformCodec). Not a property
+	*/
+	FBox Bounds;
+
+	FCSWMapRecord()
+		: Bounds(ForceInit)
+	{
+
+	}
+
+	/** Native serializer, see FCSWRecordVersion. False when loading a tagged record. Bounds aren't written */
+	bool Serialize(FArchive& Ar);
+};
+
+template<>
+struct TStructOpsTypeTraits<FCSWMapRecord> : public TStructOpsTypeTraitsBase2<FCSWMapRecord>
+{
+	enum
+	{
+		WithSerializer = true,
+	};
+};
+
+/**
+* The layout of the SaveGame variables of a class, as the compiled save plan of the class writes them (see FCSWSavePlan).
+* The layouts used by the records are stored with them, so data saved before a class changed can still be matched variable by variable.
+*
+* Each UCSWAutoSaveObject has an array of FCSWClassLayout.
+*/
+USTRUCT()
+struct FCSWClassLayout
+{
+	GENERATED_USTRUCT_BODY()
+	/**
+	* Hash of the layout, written at the start of the data saved with it
+	*/
+	UPROPERTY(SaveGame)
+		uint32 LayoutHash = 0;
+	/**
+	* The names of the variables, in the order they are saved
+	*/
+	UPROPERTY(SaveGame)
+		TArray<FName> Names;
+	/**
+	* The types of the variables (property class and C++ type)
+	*/
+	UPROPERTY(SaveGame)
+		TArray<FString> Signatures;
+	/**
+	* The size of each saved value, -1 if the value is prefixed with its size
+	*/
+	UPROPERTY(SaveGame)
+		TArray<int32> FixedSizes;
+
+	FCSWClassLayout()
+	{
+
+	}
+};
+
+/**
+* Options used to customize the auto save and load functionality from certain components in an actor that has the CSWAutoSaveComponent attached.
+* Print the object name from the component to be certain that the name is correct.
+* 
+* This structure is used in the CSWAutoSaveComponent.
+* These options override the Default options that can be seen in the CSWAutoSaveComponent Property Panel.
+*/
+USTRUCT(BlueprintType)
+struct FCSWAutoSaveComponentOption
+{
+	GENERATED_USTRUCT_BODY()
+	/**
+	* The name of the component to be customized (print the object name from the component to be certain that the name is correct)
+	*/
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "ActorComponent", meta = (DisplayName = "Component Name"))
+		FName Name="";
+	/**
+	* If true, the component will be saved (and the functionality can be customized).
+	*/
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "SceneComponent", meta = (DisplayName = "Save Component?"))
+		uint32 bSave : 1;
+	/**
+	* If true, the location of the component will be saved (if it's a SceneComponent).
+	*/
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "SceneComponent", meta = (EditCondition = "bSave", DisplayName = "Save Component Location?"))
+		bool bSaveLoc = true;
+	/**
+	* If true, the rotation of the component will be saved (if it's a SceneComponent).
+	*/
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "SceneComponent", meta = (EditCondition = "bSave", DisplayName = "Save Component Rotation?"))
+		bool bSaveRot = true;
+	/**
+	* If true, the scale of the component will be saved (if it's a SceneComponent).
+	*/
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "SceneComponent", meta = (EditCondition = "bSave", DisplayName = "Save Component Scale?"))
+		bool bSaveScale = true;
+	/**
+	* If true, the Linear Velocity of the component will be saved (if it's a PrimitiveComponent).
+	*/
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "PrimitiveComponent", meta = (EditCondition = "bSave", DisplayName = "Save Component Linear Velocity?"))
+		bool bSaveLVel = true;
+	/**
+	* If true, the Angular Velocity of the component will be saved (if it's a PrimitiveComponent).
+	*/
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "PrimitiveComponent", meta = (EditCondition = "bSave", DisplayName = "Save Component Angular Velocity?"))
+		bool bSaveAVel = true;
+
+	FCSWAutoSaveComponentOption()
+	{
+
+	}
+};
+
+/**
+* What a load menu needs to know about a slot, read from its header without loading it.
+* 
+* This structure is used by CSWGetSaveGamesInfo() and CSWGetSaveGameInfo().
+*/
+USTRUCT(BlueprintType)
+struct FCSWSlotInfo
+{
+	GENERATED_USTRUCT_BODY()
+	/**
+	* The name of the slot (can be used to load the save game directly)
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Name", meta = (DisplayName = "Slot Name"))
+		FString SlotName;
+	/**
+	* False if the slot is corrupt or was written by a newer version of the plugin
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bool", meta = (DisplayName = "Is Valid?"))
+		bool bIsValid = false;
+	/**
+	* False for slots written by older versions of the plugin. Only the file data (time, size) is known then
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bool", meta = (DisplayName = "Has Metadata?"))
+		bool bHasMetadata = false;
+	/**
+	* When the slot was saved (UTC). The modification time of the file if the slot has no metadata
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Metadata", meta = (DisplayName = "Save Time"))
+		FDateTime SaveTime;
+	/**
+	* Unique ID of the save, every save of the slot gets a new one
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Metadata", meta = (DisplayName = "Save ID"))
+		FGuid SaveId;
+	/**
+	* Size of the file in bytes
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Metadata", meta = (DisplayName = "File Size"))
+		int32 FileSize = 0;
+	/**
+	* Size of the data once decompressed in bytes
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Metadata", meta = (DisplayName = "Uncompressed Size"))
+		int32 UncompressedSize = 0;
+	/**
+	* The codec the slot is compressed with
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Metadata", meta = (DisplayName = "Codec"))
+		ECSWCompressionCodec Codec = ECSWCompressionCodec::None;
+	/**
+	* The levels stored in the slot
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Metadata", meta = (DisplayName = "Level Names"))
+		TArray<FName> LevelNames;
+	/**
+	* Total number of actors stored in the slot
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Metadata", meta = (DisplayName = "Num Actors"))
+		int32 NumActors = 0;
+
+	FCSWSlotInfo()
+	{
+
+	}
+};
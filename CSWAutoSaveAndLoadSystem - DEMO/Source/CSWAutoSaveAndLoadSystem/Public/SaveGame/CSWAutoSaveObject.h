@@ -1,72 +1,139 @@
-/**
-* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
-*
-* Developed by Kevin Yabar Garces
-*/
-
-#pragma once
-
-#include "GameFramework/SaveGame.h"
-#include "Field/Struct/CSWAutoSaveStruct.h"
-#include "CSWAutoSaveObject.generated.h"
-
-/**
-* Save Game Object that contains an array of FCSWMapRecord so it can be used to store data.
-*
-* This Save Game Object is responsible for storing the data of Actors (and components) inside their corresponding levels. The data is persistent even if the levels are changed or loaded/unloaded (level streaming).
-* This Save Game Object is designed to store data from multiple levels (including level streaming) so all the data can be stored into a single file using the SaveGameToSlot() function.
-*
-* @see UCSWAutoSaveStruct
-*/
-UCLASS(meta = (DisplayName = "CSWAuto Save and Load Game Object"))
-class CSWAUTOSAVEANDLOADSYSTEM_API UCSWAutoSaveObject : public USaveGame
-{
-	GENERATED_BODY()
-
-public:
-	/**
-	* Array of Map records that contain each Map actor records (Each map contains an array of actor records)
-	*/
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, SaveGame, Category = "CSW|AutoSaveAndLoadSystem", meta = (DisplayName = "Levels Record Array"))
-		TArray<FCSWMapRecord> LevelsRecord;
-
-	/**
-	* Return true if there's data stored inside this SaveGameObject
-	*/
-	UFUNCTION(BlueprintPure, Category = "CSW|AutosaveObject")
-		bool GetContainsSaveData() { if (LevelsRecord.Num() > 0) { return true; } else { return false; } }
-
-	/**
-	* Return the number of levels that are stored in this Save Object
-	*/
-	UFUNCTION(BlueprintPure, Category = "CSW|AutosaveObject")
-		int32 GetNumberOfLevelsStored() { return LevelsRecord.Num(); }
-
-	/**
-	* The Number of Actors that are stored in a Level (by index)
-	*/
-	UFUNCTION(BlueprintPure, Category = "CSW|AutosaveObject")
-		int32 GetNumberOfActorsStoredInLevel(int32 index)
-	{
-		if (LevelsRecord.IsValidIndex(index))
-		{
-			return LevelsRecord[index].ActorsRecord.Num();
-		}
-		return 0;
-	}
-
-	/**
-	* The total Number of Actors that are stored in the save object
-	*/
-	UFUNCTION(BlueprintPure, Category = "CSW|AutosaveObject")
-		int32 GetTotalNumberOfActorsStored()
-	{
-		int32 NumberOfLevels = GetNumberOfLevelsStored();
-		int32 TotalNumberOfActorsStored = 0;
-		for (int32 i = 0; i < NumberOfLevels; i++)
-		{
-			TotalNumberOfActorsStored += GetNumberOfActorsStoredInLevel(i);
-		}
-		return TotalNumberOfActorsStored;
-	}
-};
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+#pragma once
+
+#include "GameFramework/SaveGame.h"
+#include "Field/Struct/CSWAutoSaveStruct.h"
+#include "Serialization/CSWReferenceTable.h"
+#include "CSWAutoSaveObject.generated.h"
+
+/**
+* Save Game Object that contains an array of FCSWMapRecord so it can be used to store data.
+*
+* This Save Game Object is responsible for storing the data of Actors (and components) inside their corresponding levels. The data is persistent even if the levels are changed or loaded/unloaded (level streaming).
+* This Save Game Object is designed to store data from multiple levels (including level streaming) so all the data can be stored into a single file using the SaveGameToSlot() function.
+*
+* @see UCSWAutoSaveStruct
+*/
+UCLASS(meta = (DisplayName = "CSWAuto Save and Load Game Object"))
+class CSWAUTOSAVEANDLOADSYSTEM_API UCSWAutoSaveObject : public USaveGame
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	* Array of Map records that contain each Map actor records (Each map contains an array of actor records)
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, SaveGame, Category = "CSW|AutoSaveAndLoadSystem", meta = (DisplayName = "Levels Record Array"))
+		TArray<FCSWMapRecord> LevelsRecord;
+
+	/**
+	* Layouts of the classes whose data is in the levels record (see FCSWSavePlan), so it still loads once the classes change
+	*/
+	UPROPERTY(SaveGame)
+		TArray<FCSWClassLayout> ClassLayouts;
+
+	/**
+	* Names and objects referenced by the data of the levels record, when it's saved with reference tables (see FCSWReferenceTable)
+	*/
+	UPROPERTY(SaveGame)
+		FCSWReferenceTable ReferenceTable;
+
+	/**
+	* Update ClassLayouts with the layouts used by the levels record. Called before the object is saved
+	*/
+	void UpdateClassLayouts();
+
+	/**
+	* Rebuild the reference table with only the names and objects the levels record references, its records are moved to the new table.
+	* Called before the object is saved
+	*/
+	void RebuildReferenceTable();
+
+	/**
+	* Keeps ClassLayouts and the reference table up to date when saving. Registers the layouts when loading
+	*/
+	virtual void Serialize(FArchive& Ar) override;
+
+	/**
+	* Update the records of the levels saved by AutoFillSaveGameObject() where they are instead of rebuilding them (enabled by default).
+	* The level records, actor records and their arrays keep their storage: the record of each Actor is overwritten at its index, and only the records of
+	* the Actors that weren't saved again are removed.
+	*/
+	static void SetUseInPlaceUpdates(const bool bEnable);
+	static bool GetUseInPlaceUpdates();
+
+	/**
+	* Start updating the actor records of a level in place, adding its level record if there isn't one. Its actor records are indexed by actor name
+	*/
+	void BeginRecordUpdate(const FName& LevelName);
+
+	/**
+	* Index of the record of an Actor in a level being updated, added at the end of its level record if it didn't have one (bOutAdded).
+	* INDEX_NONE if the level isn't being updated
+	*/
+	int32 FindOrAddUpdatedActorRecord(const int32 LevelRecordIndex, const FName& ActorName, bool& bOutAdded);
+
+	/**
+	* Remove the actor records of the levels being updated that weren't updated, keeping the order of the others
+	*/
+	void EndRecordUpdates();
+
+	/**
+	* Return true if there's data stored inside this SaveGameObject
+	*/
+	UFUNCTION(BlueprintPure, Category = "CSW|AutosaveObject")
+		bool GetContainsSaveData() { if (LevelsRecord.Num() > 0) { return true; } else { return false; } }
+
+	/**
+	* Return the number of levels that are stored in this Save Object
+	*/
+	UFUNCTION(BlueprintPure, Category = "CSW|AutosaveObject")
+		int32 GetNumberOfLevelsStored() { return LevelsRecord.Num(); }
+
+	/**
+	* The Number of Actors that are stored in a Level (by index)
+	*/
+	UFUNCTION(BlueprintPure, Category = "CSW|AutosaveObject")
+		int32 GetNumberOfActorsStoredInLevel(int32 index)
+	{
+		if (LevelsRecord.IsValidIndex(index))
+		{
+			return LevelsRecord[index].ActorsRecord.Num();
+		}
+		return 0;
+	}
+
+	/**
+	* The total Number of Actors that are stored in the save object
+	*/
+	UFUNCTION(BlueprintPure, Category = "CSW|AutosaveObject")
+		int32 GetTotalNumberOfActorsStored()
+	{
+		int32 NumberOfLevels = GetNumberOfLevelsStored();
+		int32 TotalNumberOfActorsStored = 0;
+		for (int32 i = 0; i < NumberOfLevels; i++)
+		{
+			TotalNumberOfActorsStored += GetNumberOfActorsStoredInLevel(i);
+		}
+		return TotalNumberOfActorsStored;
+	}
+
+private:
+	/** A level whose actor records are being updated in place */
+	struct FLevelRecordUpdate
+	{
+		/** Index of the record of each Actor in the level record */
+		TMap<FName, int32> ActorRecordIndices;
+		/** The records updated, by index */
+		TArray<bool> Updated;
+		bool bActive = false;
+	};
+
+	/** By level name. Kept between saves with their memory */
+	TMap<FName, FLevelRecordUpdate> LevelRecordUpdates;
+};
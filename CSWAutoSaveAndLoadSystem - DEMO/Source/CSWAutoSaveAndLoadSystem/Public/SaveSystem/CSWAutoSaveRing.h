@@ -0,0 +1,53 @@
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+/**
+* Rotating ring of autosave slots ("<RingName>_0" ... "<RingName>_<RingSize - 1>"), written by CSWSaveGameToRing().
+* Every save of a ring goes into its oldest (or missing) slot, so the ring always keeps its RingSize newest generations.
+* The game thread only takes a snapshot of the save game, the slot is written by the writer of FCSWSaveJobScheduler.
+* A ring has at most one save waiting, a newer save of the same ring replaces it (the older generation would be overwritten anyway).
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/UniquePtr.h"
+#include "SaveSystem/CSWSaveGameSnapshot.h"
+#include "BlueprintFunctionLibrary/CSWAutoSaveBlueprintLibrary.h"
+
+/** Rings can't have more slots than this */
+#define CSW_AUTOSAVE_RING_MAX_SIZE 32
+
+struct FCSWAutoSaveRingRequest
+{
+	FString RingName;
+	int32 RingSize = 1;
+	int32 UserIndex = 0;
+	bool bCompressFile = true;
+	bool bUseCustomPath = false;
+	FString Path;
+	ECSWCompressionCodec Codec = ECSWCompressionCodec::ZlibFast;
+	FCSWSaveGameSnapshot Snapshot;
+};
+
+struct CSWAUTOSAVEANDLOADSYSTEM_API FCSWAutoSaveRing
+{
+	/** Queue a save of a ring. OnCompleted is executed on the game thread, with false if the save is refused. Returns the ID of the save job, INDEX_NONE if it was refused */
+	static int32 Enqueue(TUniquePtr<FCSWAutoSaveRingRequest>&& Request, const FCSWOnSaveGameResponse& OnCompleted);
+
+	/** Name of the slot Index of a ring */
+	static FString GetRingSlotName(const FString& RingName, const int32 Index);
+
+	/** Valid slots of a ring, newest first */
+	static void GetRingSlots(TArray<FCSWSlotInfo>& OutSlots, const FString& RingName, const int32 RingSize, const int32 UserIndex, const bool bFilesAreCompressed, const bool bUseCustomPath, const FString& Path);
+
+private:
+	/** Write a save into the oldest slot of its ring. Runs on the writer thread */
+	static bool WriteRequest(FCSWAutoSaveRingRequest& Request);
+
+	/** Slot of the ring the next generation goes into: the first missing or unreadable slot, otherwise the oldest one */
+	static FString FindOldestRingSlot(const FCSWAutoSaveRingRequest& Request);
+};
@@ -0,0 +1,86 @@
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+/**
+* Memory-budgeted LRU cache of decoded slots, so a quickload right after a quicksave doesn't read, decompress and deserialize the slot again.
+* Each slot is kept as a FCSWSaveGameSnapshot: the object chunk and the plain chunks of its levels with the entries of its journal, or the levels record of an async save.
+* Saves fill the cache with the chunks they wrote and loads with the chunks they read, the records are only decoded again when the slot is loaded from the cache. Deleting a slot or appending to its journal drops it.
+* An entry is only used while the slot on disk is still the generation (FCSWSlotMetadata::SaveId) it was cached for, so slots written by other means are never served stale.
+* Disabled (budget of 0) by default, see UCSWAutoSaveBlueprintLibrary::CSWSetDecodedSlotCacheBudget().
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+#include "HAL/CriticalSection.h"
+#include "Async/Future.h"
+#include "Misc/Guid.h"
+#include "SaveSystem/CSWSaveGameSnapshot.h"
+
+class CSWAUTOSAVEANDLOADSYSTEM_API FCSWDecodedSlotCache
+{
+public:
+	static FCSWDecodedSlotCache& Get();
+
+	/** Memory the cached snapshots can use. 0 disables the cache and empties it */
+	void SetBudget(const int64 BudgetBytes);
+	bool IsEnabled() const;
+
+	/** Cached snapshot of the generation SaveId of a slot, null if it isn't cached. Thread safe */
+	FCSWSaveGameSnapshotPtr Find(const FString& SlotKey, const FGuid& SaveId);
+
+	/**
+	* Cached snapshot of the generation SaveId of a slot, decoded with Decode if it isn't cached. Thread safe.
+	* Decode returns the snapshot (null if the slot couldn't be read) and the SaveId of what it read.
+	* Loads of a slot that is already being decoded wait for that decode and share its snapshot instead of reading the slot again.
+	*/
+	FCSWSaveGameSnapshotPtr FindOrDecode(const FString& SlotKey, const FGuid& SaveId, TFunctionRef<FCSWSaveGameSnapshotPtr(FGuid&)> Decode);
+
+	/** Cache the snapshot of the generation SaveId of a slot, evicting the least recently used slots to stay within the budget */
+	void Add(const FString& SlotKey, const FGuid& SaveId, const FCSWSaveGameSnapshotPtr& Snapshot);
+
+	/** Forget a slot (it was deleted or its journal changed). A decode of the slot running meanwhile isn't cached */
+	void Invalidate(const FString& SlotKey);
+
+	/** Forget every slot */
+	void Empty();
+
+	/** Memory used by a snapshot, what is counted against the budget */
+	static int64 GetAllocatedSize(const FCSWSaveGameSnapshot& Snapshot);
+
+private:
+	struct FCachedSlot
+	{
+		FGuid SaveId;
+		FCSWSaveGameSnapshotPtr Snapshot;
+		int64 Size = 0;
+	};
+
+	struct FDecodingSlot
+	{
+		/** Tells apart the decodes of a slot, the ones invalidated while running aren't cached */
+		uint32 Serial = 0;
+		TSharedFuture<FCSWSaveGameSnapshotPtr> Result;
+	};
+
+	/** Move a cached slot to the most recently used end */
+	void Touch(const FString& SlotKey);
+
+	/** Drop the least recently used slots until the cache fits in the budget */
+	void EvictToBudget();
+
+	void RemoveSlot(const FString& SlotKey);
+
+	mutable FCriticalSection CacheLock;
+	int64 Budget = 0;
+	int64 UsedSize = 0;
+	TMap<FString, FCachedSlot> Slots;
+	/** Keys of the cached slots, least recently used first. There are a handful of slots, a list is enough */
+	TArray<FString> UsageOrder;
+	TMap<FString, FDecodingSlot> DecodingSlots;
+	uint32 NextDecodeSerial = 1;
+};
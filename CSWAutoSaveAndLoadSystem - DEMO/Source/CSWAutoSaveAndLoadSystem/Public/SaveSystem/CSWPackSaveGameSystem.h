@@ -0,0 +1,244 @@
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+/**
+* Save game system that stores every slot (and journal and versions file) of a directory as an entry of a single pack file ("<directory>/Slots.cswpack").
+* Meant for many small slots (mobile flash storage, dedicated servers with a slot per player), where opening, stating and closing a file per slot
+* costs more than writing the slot. The index of the pack lives in memory: finding, listing and deleting slots never touch the disk.
+*
+* Pack layout:
+* - Two copies of FCSWPackHeader at the start. The valid copy with the highest generation is the current one, a new checkpoint writes the other copy.
+* - Index checkpoint: { int32 NumEntries, { FString Key, FCSWPackEntry }[NumEntries] }, pointed by the header.
+* - Index log: fixed-size area, pointed by the header, where every change of the index after the checkpoint is appended as a record
+*   { int32 Magic, uint64 Generation, uint8 Op, FString Key, FCSWPackEntry, uint32 RecordCrc }. A full log is folded into a new checkpoint.
+* - Entry data anywhere else. Space freed by replaced and deleted entries is reused by the next writes (first fit).
+*
+* Writes never overwrite data the index on disk still references: the entry is written to free space and flushed before its log record,
+* so a crash at any point leaves the previous generation of the slot. Once the freed space passes half the pack, it is compacted in the background.
+* Entries are written from memory, the pack targets small slots.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "Templates/SharedPointer.h"
+#include "Templates/UniquePtr.h"
+#include "SaveSystem/CSWSaveGameSystem.h"
+
+/** Name of the pack file of a directory */
+#define CSW_PACK_FILE_NAME TEXT("Slots.cswpack")
+
+/** Identifies pack files ("CSWP") */
+#define CSW_PACK_HEADER_MAGIC 0x50575343
+/** Identifies the records of the index log ("CSWL") */
+#define CSW_PACK_LOG_RECORD_MAGIC 0x4C575343
+
+/** Space reserved at the start of the pack for each copy of the header */
+#define CSW_PACK_HEADER_COPY_SIZE 128
+/** Size of the index log, a record takes about 60 bytes + the slot name */
+#define CSW_PACK_LOG_CAPACITY (64 * 1024)
+/** The pack is compacted once its free space is bigger than this and than half the pack */
+#define CSW_PACK_COMPACTION_MIN_FREE_SIZE (1024 * 1024)
+
+struct FCSWPackHeader
+{
+	int32 Magic = CSW_PACK_HEADER_MAGIC;
+	int32 Version = 1;
+	/** Incremented by every checkpoint of the index */
+	uint64 Generation = 0;
+	int64 IndexOffset = 0;
+	int64 IndexSize = 0;
+	uint32 IndexCrc = 0;
+	int64 LogOffset = 0;
+	int64 LogCapacity = 0;
+
+	/** Everything but the checksum, which follows it in the pack */
+	friend FArchive& operator<<(FArchive& Ar, FCSWPackHeader& Header)
+	{
+		Ar << Header.Magic;
+		Ar << Header.Version;
+		Ar << Header.Generation;
+		Ar << Header.IndexOffset;
+		Ar << Header.IndexSize;
+		Ar << Header.IndexCrc;
+		Ar << Header.LogOffset;
+		Ar << Header.LogCapacity;
+		return Ar;
+	}
+};
+
+/** Where an entry is in the pack */
+struct FCSWPackEntry
+{
+	int64 Offset = 0;
+	int64 Size = 0;
+	/** CRC32C of the entry data */
+	uint32 Crc = 0;
+	/** When the entry was written, what the slot catalog sees as the modification time of the slot */
+	FDateTime ModificationTime;
+
+	friend FArchive& operator<<(FArchive& Ar, FCSWPackEntry& Entry)
+	{
+		Ar << Entry.Offset;
+		Ar << Entry.Size;
+		Ar << Entry.Crc;
+		Ar << Entry.ModificationTime;
+		return Ar;
+	}
+};
+
+/**
+* A pack file and its index. Thread safe.
+*/
+class CSWAUTOSAVEANDLOADSYSTEM_API FCSWPackFile : public TSharedFromThis<FCSWPackFile, ESPMode::ThreadSafe>
+{
+public:
+	explicit FCSWPackFile(const FString& InPackPath);
+	~FCSWPackFile();
+
+	/** Open the pack (creating it if it doesn't exist yet) and rebuild its index. Fails on a pack whose headers are both corrupt, it isn't overwritten */
+	bool Open();
+
+	const FString& GetPackPath() const { return PackPath; }
+
+	bool FindEntry(const FString& Key, FCSWPackEntry& OutEntry) const;
+
+	/** Keys and entries of the index whose key ends with Suffix */
+	void GetEntries(const FString& Suffix, TArray<FString>& OutKeys, TArray<FCSWPackEntry>& OutEntries) const;
+
+	/** Read a whole entry, checking its CRC */
+	bool Read(const FString& Key, TArray<uint8>& OutData);
+
+	/** Read part of an entry. Only used through the archives of CreateEntryReader() */
+	bool ReadAt(const FCSWPackEntry& Entry, const int64 Position, void* Data, const int64 Num);
+
+	/**
+	* Archive that streams an entry from the pack, null if the entry doesn't exist.
+	* The entry stays readable until the archive is destroyed, even if it's replaced or deleted meanwhile.
+	*/
+	TUniquePtr<FArchive> CreateEntryReader(const FString& Key);
+
+	/** Write an entry, replacing the previous one with the same key */
+	bool Write(const FString& Key, const TArray<uint8>& Data);
+
+	/** Delete an entry, false if it didn't exist */
+	bool Remove(const FString& Key);
+
+	/** There is enough free space in the pack to compact it */
+	bool NeedsCompaction() const;
+
+	/**
+	* Rewrite the pack without its free space. The live entries are copied without blocking the pack, the entries written or removed meanwhile
+	* are applied to the copy under the lock before the packs are swapped. Fails if entries are being streamed
+	*/
+	bool Compact();
+
+private:
+	struct FExtent
+	{
+		int64 Offset;
+		int64 Size;
+	};
+
+	/** Close the pack and forget its index */
+	void Reset();
+
+	/** First free extent big enough for Size (the end of the pack if there's none) */
+	int64 Allocate(const int64 Size);
+	/** Give an extent back, merging it with its neighbours. Extents being streamed are freed once the stream ends */
+	void Free(const int64 Offset, const int64 Size);
+	void Pin(const int64 Offset);
+	void Unpin(const int64 Offset);
+
+	bool WriteAt(const int64 Offset, const void* Data, const int64 Num);
+	bool ReadAtUnlocked(const int64 Offset, void* Data, const int64 Num);
+	/** Copy an entry to InOutOffset of TargetHandle (and move InOutOffset past it), InOutEntry is updated to its new place. Locks the pack for the read only */
+	bool CopyEntry(IFileHandle& TargetHandle, FCSWPackEntry& InOutEntry, int64& InOutOffset, TArray<uint8>& Buffer);
+
+	/** Make the change of an entry durable: a record in the index log, or a new checkpoint if the log is full. NewEntry null removes the entry */
+	bool CommitChange(const FString& Key, const FCSWPackEntry* NewEntry);
+	/** Write NewIndex as the checkpoint of a new generation with an empty log */
+	bool WriteCheckpoint(TMap<FString, FCSWPackEntry>& NewIndex);
+
+	/** Rebuild the free extents from the index, everything that isn't referenced is free */
+	void RebuildFreeExtents();
+
+	static void SerializeIndex(FArchive& Ar, TMap<FString, FCSWPackEntry>& InOutIndex);
+	static bool WriteHeader(IFileHandle& Handle, const int32 Copy, FCSWPackHeader& InHeader);
+	static bool ReadHeader(IFileHandle& Handle, const int32 Copy, FCSWPackHeader& OutHeader);
+
+	const FString PackPath;
+	mutable FCriticalSection PackLock;
+	TUniquePtr<IFileHandle> FileHandle;
+	int64 FileSize = 0;
+	FCSWPackHeader Header;
+	/** Copy of the header Header was read from or written to */
+	int32 HeaderCopy = 0;
+	/** Bytes used in the index log */
+	int64 LogSize = 0;
+	TMap<FString, FCSWPackEntry> Index;
+	/** Free extents sorted by offset */
+	TArray<FExtent> FreeExtents;
+	int64 FreeSize = 0;
+	/** Offsets of the entries being streamed, with the number of streams */
+	TMap<int64, int32> PinnedOffsets;
+	/** Extents freed while they were being streamed */
+	TArray<FExtent> DeferredFrees;
+	/** A compaction is copying the entries */
+	bool bCompacting = false;
+	/** Keys written or removed since the compaction took its snapshot of the index */
+	TSet<FString> CompactionChangedKeys;
+	/** Extents freed while compacting, the entries being copied may still be in them */
+	TArray<FExtent> CompactionFrees;
+
+	friend class FCSWPackEntryReader;
+};
+
+typedef TSharedPtr<FCSWPackFile, ESPMode::ThreadSafe> FCSWPackFilePtr;
+
+/**
+* Save game system storing the slots of each directory in a pack file, see above.
+* Enabled with UCSWAutoSaveBlueprintLibrary::CSWSetUsePackFileSaveSystem(). Slots saved as separate files before aren't moved into the pack.
+*/
+class CSWAUTOSAVEANDLOADSYSTEM_API FCSWPackSaveGameSystem : public ICSWSaveGameSystem
+{
+public:
+	virtual bool PlatformHasNativeUI() override { return false; }
+
+	virtual bool DoesSaveGameExist(const bool bUseCustomPath, const bool bCompressFile, const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex) override;
+	virtual ESaveExistsResult DoesSaveGameExistWithResult(const bool bUseCustomPath, const bool bCompressFile, const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex) override;
+	virtual bool SaveGame(bool bAttemptToUseUI, const bool bUseCustomPath, const bool bCompressFile, const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex, const TArray<uint8>& Data) override;
+	virtual bool LoadGame(bool bAttemptToUseUI, const bool bUseCustomPath, const bool bCompressFile, const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex, TArray<uint8>& Data) override;
+	virtual bool LoadGameStreamed(bool bAttemptToUseUI, const bool bUseCustomPath, const bool bCompressFile, const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex, TFunctionRef<bool(FArchive&)> ReadData) override;
+	virtual bool DeleteGame(bool bAttemptToUseUI, const bool bUseCustomPath, const bool bCompressFile, const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex) override;
+	virtual bool WriteSaveGameJournal(const bool bAppend, const bool bUseCustomPath, const bool bCompressFile, const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex, TFunctionRef<bool(FArchive&)> WriteData) override;
+	virtual bool LoadSaveGameJournal(const bool bUseCustomPath, const bool bCompressFile, const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex, TFunctionRef<bool(FArchive&)> ReadData) override;
+	virtual bool DeleteSaveGameJournal(const bool bUseCustomPath, const bool bCompressFile, const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex) override;
+	virtual bool SaveGameVersions(const bool bUseCustomPath, const TCHAR* FilePath, const int32 UserIndex, const TCHAR* FileName, const TArray<uint8>& Data) override;
+	virtual bool LoadGameVersions(const bool bUseCustomPath, const TCHAR* FilePath, const int32 UserIndex, const TCHAR* FileName, TArray<uint8>& OutData) override;
+	virtual bool GetSaveGames(const bool bUseCustomPath, const bool bCompressFile, const TCHAR* FilePath, TArray<FString>& OutSlotNames, TArray<FFileStatData>& OutStatData) override;
+	virtual bool GetSaveGameStatData(const bool bUseCustomPath, const bool bCompressFile, const TCHAR* FilePath, const TCHAR* FileName, FFileStatData& OutStatData) override;
+
+	/** Close every pack. They are opened again by the next access */
+	void ClosePacks();
+
+protected:
+	/** Pack of a directory, opened on first use */
+	FCSWPackFilePtr GetPack(const bool bUseCustomPath, const TCHAR* FilePath);
+
+	/** Key of a slot in its pack */
+	static FString GetSlotKey(const bool bCompressFile, const TCHAR* FileName);
+
+	/** Compact the pack in the background if it has too much free space */
+	static void ScheduleCompaction(const FCSWPackFilePtr& Pack);
+
+private:
+	FCriticalSection PacksLock;
+	/** Packs by directory */
+	TMap<FString, FCSWPackFilePtr> Packs;
+};
@@ -0,0 +1,102 @@
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+/**
+* Batched capture of the poses saved with the actor records of a level: the transforms of the Actors, the relative transforms of their scene components
+* and the velocities of their primitive components.
+* The records of the Actors that changed are built first without their poses, gathering the root and scene components with the record fields their
+* pose goes into (by dense index). Then every pose is read in tight loops (one per channel), packed four at a time into structure-of-arrays float buffers,
+* and scattered into the records in a loop per kind of target.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/VectorRegister.h"
+#include "Containers/ContainerAllocationPolicies.h"
+
+class AActor;
+class UActorComponent;
+class USceneComponent;
+class UPrimitiveComponent;
+struct FCSWActorComponentRecord;
+
+/** A vector per element, with each of its components in its own 16 byte aligned array padded to a multiple of 4 */
+struct CSWAUTOSAVEANDLOADSYSTEM_API FCSWSoAVectors
+{
+	typedef TArray<float, TAlignedHeapAllocator<16>> FFloatArray;
+
+	FFloatArray X;
+	FFloatArray Y;
+	FFloatArray Z;
+	FFloatArray W;
+
+	void Reset();
+
+	/** Transpose the registers (one per element) into the arrays, four elements per step */
+	void Pack(const TArray<VectorRegister>& Registers);
+
+	FVector GetVector(const int32 Index) const { return FVector(X[Index], Y[Index], Z[Index]); }
+	FQuat GetQuat(const int32 Index) const { return FQuat(X[Index], Y[Index], Z[Index], W[Index]); }
+	/** Pitch, yaw and roll are X, Y and Z */
+	FRotator GetRotator(const int32 Index) const { return FRotator(X[Index], Y[Index], Z[Index]); }
+};
+
+/**
+* The poses of the Actors and components of a level, captured before their records are filled.
+* Game thread only, like the rest of the saving of the actors.
+*/
+class CSWAUTOSAVEANDLOADSYSTEM_API FCSWPoseBatch
+{
+public:
+	/** Gather an Actor whose transform (the one of its root component) is saved into Target. False if it has no root component */
+	bool AddActor(AActor* Actor, FTransform* Target);
+
+	/**
+	* Gather a component whose pose is saved into Target, only the fields in Target->Fields (see ECSWComponentRecordField).
+	* False if it isn't a scene component. The targets must stay where they are until Scatter()
+	*/
+	bool AddComponent(UActorComponent* Component, FCSWActorComponentRecord* Target);
+
+	/** Read and pack the poses of everything gathered */
+	void Capture();
+
+	/** Write the captured poses into their targets */
+	void Scatter() const;
+
+	/** Empty the batch, keeping the memory for the next level */
+	void Reset();
+
+	/**
+	* Apply the pose fields of a record to a scene component with a single transform update, instead of one per field.
+	* bLocation, bRotation and bScale tell which fields are loaded.
+	*/
+	static void ApplyComponentPose(USceneComponent* SceneComponent, const FCSWActorComponentRecord& ComponentRecord, const bool bLocation, const bool bRotation, const bool bScale);
+
+private:
+	/** Gathered, by dense index */
+	TArray<USceneComponent*> ActorRoots;
+	TArray<FTransform*> ActorTargets;
+	TArray<USceneComponent*> SceneComponents;
+	/** Null for the scene components that aren't primitive components */
+	TArray<UPrimitiveComponent*> PrimitiveComponents;
+	TArray<FCSWActorComponentRecord*> ComponentTargets;
+	/** Fields of the component targets */
+	TArray<uint8> ComponentFields;
+
+	/** Captured */
+	FCSWSoAVectors ActorLocations;
+	FCSWSoAVectors ActorRotations;
+	FCSWSoAVectors ActorScales;
+	FCSWSoAVectors ComponentLocations;
+	FCSWSoAVectors ComponentRotations;
+	FCSWSoAVectors ComponentScales;
+	FCSWSoAVectors LinearVelocities;
+	FCSWSoAVectors AngularVelocities;
+
+	/** One register per element, reused by every channel */
+	TArray<VectorRegister> Staging;
+};
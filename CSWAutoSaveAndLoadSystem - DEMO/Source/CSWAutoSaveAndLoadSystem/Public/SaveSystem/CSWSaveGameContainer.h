@@ -0,0 +1,114 @@
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+/**
+* Writer and reader of the chunked slot container described in CSWSaveGameFormat.h.
+* They only know about chunks and the table of contents, what goes inside each chunk is up to the caller.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Serialization/Archive.h"
+#include "Templates/Function.h"
+#include "SaveSystem/CSWSaveGameFormat.h"
+#include "Serialization/CSWCompressionCodec.h"
+#include "Serialization/CSWCipher.h"
+
+/**
+* Writes a slot chunk by chunk. FileAr must be seekable, the offset of the table of contents is patched into the header by Finish().
+* The chunks are encrypted if a saving key is registered (FCSWCipherKeyRegistry::GetSavingKey()).
+*/
+class CSWAUTOSAVEANDLOADSYSTEM_API FCSWSaveGameContainerWriter
+{
+public:
+	/**
+	* The chunks are compressed with CodecID (Zlib if it isn't registered), ECSWCompressionCodec::None writes them uncompressed.
+	* SaveId is the generation of the slot, a new one if it isn't valid.
+	*/
+	FCSWSaveGameContainerWriter(FArchive& InFileAr, ECSWCompressionCodec CodecID, const FGuid& SaveId = FGuid());
+
+	/** Write the header. Must be called before any chunk */
+	bool WriteHeader();
+
+	/** Write the object chunk (preamble + object) */
+	bool WriteObjectChunk(TFunctionRef<bool(FArchive&)> WriteContent);
+
+	/** Write the chunk of a level */
+	bool WriteLevelChunk(const FString& LevelName, const int32 NumActors, TFunctionRef<bool(FArchive&)> WriteContent);
+
+	/** Write the table of contents and patch its offset and the metadata into the header */
+	bool Finish();
+
+	const FCSWSaveGameHeader& GetHeader() const { return Header; }
+
+private:
+	/** Write a chunk through WriteContent (compressed if there's a codec, then encrypted if there's a key) and record where it is, its CRC and its tag in OutEntry */
+	bool WriteChunk(FCSWSaveGameChunkEntry& OutEntry, const uint32 ChunkIndex, TFunctionRef<bool(FArchive&)> WriteContent);
+
+	/** Serialize the header into FileAr with its CRC */
+	bool SerializeHeader();
+
+	FArchive& FileAr;
+	FCSWSaveGameHeader Header;
+	FCSWSaveGameToc Toc;
+	FCSWCompressionCodecPtr Codec;
+	FCSWCipherKeyPtr CipherKey;
+	int64 HeaderPos;
+};
+
+/**
+* Reads the chunks of a slot in any order. The header must already be read from FileAr.
+*/
+class CSWAUTOSAVEANDLOADSYSTEM_API FCSWSaveGameContainerReader
+{
+public:
+	FCSWSaveGameContainerReader(FArchive& InFileAr, const FCSWSaveGameHeader& InHeader);
+
+	/** Read and validate the table of contents. Fails if the codec or the encryption key of the slot aren't registered */
+	bool ReadToc();
+
+	/**
+	* Read a chunk through ReadContent (decrypted and decompressed if needed).
+	* The chunk is read into memory as stored (at most the size of its level, compressed) and checked against its CRC before ReadContent runs,
+	* a damaged chunk fails without anything of it being decoded. Each segment of an encrypted chunk is verified before it's decrypted.
+	*/
+	bool ReadChunk(const FCSWSaveGameChunkEntry& Entry, TFunctionRef<bool(FArchive&)> ReadContent);
+
+	/**
+	* Check the stored bytes of a chunk against its CRC without decoding them (see ValidateSlot()).
+	* The tags of the segments of an encrypted chunk are checked in the same read if its key is registered.
+	*/
+	bool VerifyChunk(const FCSWSaveGameChunkEntry& Entry);
+
+	/** Check the header that was just read from FileAr (it started at HeaderStart) against its CRC */
+	static bool VerifyHeader(FArchive& FileAr, const int64 HeaderStart, const FCSWSaveGameHeader& Header);
+
+	/** Seek to the table of contents of the slot and read it, checking its CRC. The entries aren't validated */
+	static bool ReadTableOfContents(FArchive& FileAr, const FCSWSaveGameHeader& Header, FCSWSaveGameToc& OutToc);
+
+	/**
+	* Check a slot against its checksums without decoding anything, reading it at disk speed. FileAr must be at the start of the slot.
+	* If bVerifyChunks is false only the header and the table of contents are checked (a couple of small reads).
+	*/
+	static ECSWSlotValidationResult ValidateSlot(FArchive& FileAr, const bool bVerifyChunks = true);
+
+	const FCSWSaveGameHeader& GetHeader() const { return Header; }
+	const FCSWSaveGameToc& GetToc() const { return Toc; }
+
+private:
+	/** Read the table of contents and check that every chunk is between the header and it */
+	bool ReadAndValidateToc();
+
+	/** Nonce of a chunk of the table of contents (the object chunk is chunk 0, the levels follow it). False if the entry isn't in the table */
+	bool GetChunkNonce(const FCSWSaveGameChunkEntry& Entry, uint8* OutNonce) const;
+
+	FArchive& FileAr;
+	FCSWSaveGameHeader Header;
+	FCSWSaveGameToc Toc;
+	FCSWCompressionCodecPtr Codec;
+	FCSWCipherKeyPtr CipherKey;
+};
@@ -0,0 +1,280 @@
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+/**
+* Layout of the slots written by CSWSaveGameToSlot():
+* - FCSWSaveGameHeader (never compressed), with the codec, the total uncompressed size of the chunks and the offset of the table of contents.
+*   It ends with a fixed-size FCSWSlotMetadata (save time, save ID, number of levels and actors) for the load menus.
+* - Object chunk:
+*   - UE4 save game preamble ("sAvG" tag, file version, engine versions, custom versions and class name).
+*     With compact versions the versions are replaced by their hash, they are stored once per build apart (see CSWVersionStore.h).
+*   - The object serialized into a length-prefixed block (the levels record of an UCSWAutoSaveObject is left out).
+* - One chunk per level of an UCSWAutoSaveObject: the FBox of the locations of its quantized records, int32 NumActors and one length-prefixed block per actor record.
+*   The actor records are compact (see CSWTransformCodec.h), records without the compact magic are whole records, tagged or native (see FCSWRecordVersion).
+* - FCSWSaveGameToc: where each chunk starts and how big it is.
+* Every chunk is an independent block stream (FCSWArchiveSaveCompressedStream) compressed with the codec of the header if it has the Compressed flag,
+* so a single level can be read and decoded without touching the rest of the file.
+* Slots compressed with ECSWCompressionCodec::ZlibDictionary reference their dictionary by ID, it must be registered to load them.
+* The header, the table of contents and every chunk have a CRC32C (FCSWChecksum): the header CRC is its last field,
+* the CRC of the table of contents (which runs to the end of the slot) is in the header and the CRC of each chunk (as stored) is in its entry.
+* A chunk is read as stored and checked against its CRC before anything of it is decoded, so a damaged slot fails to load instead of loading garbage.
+* FCSWSaveGameContainerReader::ValidateSlot() checks a slot without decoding it.
+* A slot can have the Encrypted flag: every chunk is encrypted with AES-256-GCM (see CSWCipher.h) after being compressed, as a series of segments with a tag each.
+* The header stores the ID of the key and the nonce of the slot and each entry of the table of contents the tag of the last segment of its chunk.
+* The header and the table of contents stay readable without the key (load menus), the chunk CRCs are of the encrypted bytes.
+* Slots written by CSWSaveGameToSlotJournaled() can have a journal next to them with the changes saved since (see CSWSaveGameJournal.h).
+*
+* Slots written before this header existed start directly with the "sAvG" tag (.sav) or with zlib data (.csav) and are still loaded.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Serialization/Archive.h"
+#include "Misc/Guid.h"
+#include "Misc/DateTime.h"
+#include "Field/Enum/CSWAutoSaveEnum.h"
+#include "Serialization/CSWCipher.h"
+
+/** Identifies slots written with a FCSWSaveGameHeader ("CSWS") */
+#define CSW_SAVEGAME_HEADER_MAGIC 0x53575343
+
+/** Bytes reserved for FCSWSlotMetadata (size prefix included). New fields go in the unused bytes, so the header keeps its size */
+#define CSW_SLOT_METADATA_SIZE 64
+
+struct FCSWSaveGameHeaderVersion
+{
+	enum Type
+	{
+		InitialVersion = 1,
+
+		// -----<new versions can be added above this line>-------------------------------------------------
+		VersionPlusOne,
+		LatestVersion = VersionPlusOne - 1
+	};
+};
+
+namespace ECSWSaveGameHeaderFlags
+{
+	enum Type : uint32
+	{
+		None = 0,
+		/** The chunks are compressed block streams */
+		Compressed = 1 << 0,
+		/** The chunks are encrypted with the key KeyId */
+		Encrypted = 1 << 2,
+	};
+}
+
+/**
+* What a load menu shows about a slot, readable without touching the chunks.
+* Stored as { int32 Size, Size bytes }: readers skip the bytes they don't know, writers pad up to CSW_SLOT_METADATA_SIZE.
+*/
+struct FCSWSlotMetadata
+{
+	/** When the slot was written (UTC) */
+	FDateTime SaveTime;
+	/** Unique ID of this generation of the slot, every save writes a new one */
+	FGuid SaveId;
+	/** Number of level chunks. Patched once all the chunks are written */
+	int32 NumLevels;
+	/** Number of actor records of all the levels. Patched once all the chunks are written */
+	int32 NumActors;
+
+	FCSWSlotMetadata()
+		: NumLevels(0)
+		, NumActors(0)
+	{}
+
+	friend FArchive& operator<<(FArchive& Ar, FCSWSlotMetadata& Metadata)
+	{
+		int32 Size = CSW_SLOT_METADATA_SIZE - sizeof(int32);
+		Ar << Size;
+		const int64 Start = Ar.Tell();
+		int64 Ticks = Metadata.SaveTime.GetTicks();
+		Ar << Ticks;
+		Ar << Metadata.SaveId;
+		Ar << Metadata.NumLevels;
+		Ar << Metadata.NumActors;
+		const int64 Used = Ar.Tell() - Start;
+		if (Ar.IsLoading())
+		{
+			Metadata.SaveTime = FDateTime(Ticks);
+			if (Size < Used || Size > Ar.TotalSize() - Start)
+			{
+				Ar.ArIsError = true;
+				return Ar;
+			}
+			///Fields added by newer versions of the plugin
+			Ar.Seek(Start + Size);
+		}
+		else
+		{
+			uint8 Padding[CSW_SLOT_METADATA_SIZE] = {};
+			Ar.Serialize(Padding, Size - Used);
+		}
+		return Ar;
+	}
+};
+
+/**
+* Small header in front of every slot, it's never compressed so it can be read without touching the payload.
+*/
+struct FCSWSaveGameHeader
+{
+	int32 Magic;
+	int32 Version;
+	uint32 Flags;
+	/** Where the FCSWSaveGameToc starts. Patched once all the chunks are written */
+	int64 TocOffset;
+	/** Codec of the chunks (ECSWCompressionCodec). None if the slot isn't compressed */
+	uint8 Codec;
+	/** Sum of the uncompressed sizes of the chunks. Patched once all the chunks are written */
+	int64 UncompressedSize;
+	/** ID of the dictionary of the codec (FCSWCompressionCodecRegistry::RegisterDictionary()), 0 if the codec doesn't use one */
+	uint32 DictionaryId;
+	/** Save time, save ID and counts, for the load menus */
+	FCSWSlotMetadata Metadata;
+	/** ID of the encryption key (FCSWCipherKeyRegistry::RegisterKey()), 0 if the slot isn't encrypted */
+	uint32 KeyId;
+	/** Nonce of the slot, each chunk mixes its index into it */
+	uint8 Nonce[CSW_CIPHER_NONCE_SIZE];
+	/** CRC32C of the table of contents. Patched once all the chunks are written */
+	uint32 TocCrc;
+	/** CRC32C of the header up to this field, always the last field */
+	uint32 HeaderCrc;
+
+	FCSWSaveGameHeader()
+		: Magic(CSW_SAVEGAME_HEADER_MAGIC)
+		, Version(FCSWSaveGameHeaderVersion::LatestVersion)
+		, Flags(ECSWSaveGameHeaderFlags::None)
+		, TocOffset(0)
+		, Codec(static_cast<uint8>(ECSWCompressionCodec::None))
+		, UncompressedSize(0)
+		, DictionaryId(0)
+		, KeyId(0)
+		, TocCrc(0)
+		, HeaderCrc(0)
+	{
+		FMemory::Memzero(Nonce);
+	}
+
+	/** Codec of the chunks */
+	ECSWCompressionCodec GetCodec() const
+	{
+		return HasFlag(ECSWSaveGameHeaderFlags::Compressed) ? static_cast<ECSWCompressionCodec>(Codec) : ECSWCompressionCodec::None;
+	}
+
+	bool HasFlag(const uint32 Flag) const { return (Flags & Flag) != 0; }
+
+	/** True if the chunks are encrypted */
+	bool IsEncrypted() const { return HasFlag(ECSWSaveGameHeaderFlags::Encrypted); }
+
+	/** False if the slot doesn't start with a header (old slot) or if it was written by a newer version of the plugin */
+	bool IsValid() const { return Magic == CSW_SAVEGAME_HEADER_MAGIC && Version >= FCSWSaveGameHeaderVersion::InitialVersion && Version <= FCSWSaveGameHeaderVersion::LatestVersion; }
+
+	/** Stops right after the magic number when loading an old slot, so the caller can seek back */
+	friend FArchive& operator<<(FArchive& Ar, FCSWSaveGameHeader& Header)
+	{
+		Ar << Header.Magic;
+		if (Header.Magic != CSW_SAVEGAME_HEADER_MAGIC) return Ar;
+		Ar << Header.Version;
+		///The fields of newer versions can't be known, IsValid() rejects them
+		if (!Header.IsValid()) return Ar;
+		Ar << Header.Flags;
+		Ar << Header.TocOffset;
+		Ar << Header.Codec;
+		Ar << Header.UncompressedSize;
+		Ar << Header.DictionaryId;
+		Ar << Header.Metadata;
+		Ar << Header.KeyId;
+		Ar.Serialize(Header.Nonce, CSW_CIPHER_NONCE_SIZE);
+		Ar << Header.TocCrc;
+		Ar << Header.HeaderCrc;
+		return Ar;
+	}
+};
+
+/**
+* Location of a chunk inside the slot.
+*/
+struct FCSWSaveGameChunkEntry
+{
+	/** Name of the level stored in the chunk (empty for the object chunk) */
+	FString Name;
+	/** Offset of the chunk from the start of the slot */
+	int64 Offset;
+	/** Size of the chunk as stored in the slot */
+	int64 Size;
+	/** Number of actor records stored in the chunk */
+	int32 NumActors;
+	/** CRC32C of the chunk as stored in the slot */
+	uint32 Crc;
+	/** GCM tag of the last segment of the chunk (only if the header IsEncrypted()) */
+	uint8 Tag[CSW_CIPHER_TAG_SIZE];
+
+	FCSWSaveGameChunkEntry()
+		: Offset(0)
+		, Size(0)
+		, NumActors(0)
+		, Crc(0)
+	{
+		FMemory::Memzero(Tag);
+	}
+
+	void Serialize(FArchive& Ar, const bool bWithTag)
+	{
+		Ar << Name;
+		Ar << Offset;
+		Ar << Size;
+		Ar << NumActors;
+		Ar << Crc;
+		if (bWithTag)
+		{
+			Ar.Serialize(Tag, CSW_CIPHER_TAG_SIZE);
+		}
+	}
+};
+
+/**
+* Table of contents of a slot: the object chunk and one chunk per level.
+*/
+struct FCSWSaveGameToc
+{
+	FCSWSaveGameChunkEntry ObjectChunk;
+	TArray<FCSWSaveGameChunkEntry> LevelChunks;
+	/** The entries have a tag (FCSWSaveGameHeader::IsEncrypted()). Not serialized, set it from the header before reading */
+	bool bHasTags = false;
+
+	/** Find the chunk of a level by name, nullptr if the level isn't stored in the slot */
+	const FCSWSaveGameChunkEntry* FindLevelChunk(const FString& LevelName) const
+	{
+		return LevelChunks.FindByPredicate([&LevelName](const FCSWSaveGameChunkEntry& Entry) { return Entry.Name == LevelName; });
+	}
+
+	friend FArchive& operator<<(FArchive& Ar, FCSWSaveGameToc& Toc)
+	{
+		Toc.ObjectChunk.Serialize(Ar, Toc.bHasTags);
+		int32 NumLevelChunks = Toc.LevelChunks.Num();
+		Ar << NumLevelChunks;
+		if (Ar.IsLoading())
+		{
+			///An entry takes at least 24 bytes, don't trust counts bigger than what is left of the archive
+			if (NumLevelChunks < 0 || NumLevelChunks > (Ar.TotalSize() - Ar.Tell()) / 24)
+			{
+				Ar.ArIsError = true;
+				return Ar;
+			}
+			Toc.LevelChunks.Reset(NumLevelChunks);
+			Toc.LevelChunks.AddDefaulted(NumLevelChunks);
+		}
+		for (FCSWSaveGameChunkEntry& Entry : Toc.LevelChunks)
+		{
+			Entry.Serialize(Ar, Toc.bHasTags);
+		}
+		return Ar;
+	}
+};
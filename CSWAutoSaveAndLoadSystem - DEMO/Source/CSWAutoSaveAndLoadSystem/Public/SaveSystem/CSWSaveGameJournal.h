@@ -0,0 +1,153 @@
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+/**
+* Append-only journal of a slot ("<slot>.csav.csj"), written by CSWSaveGameToSlotJournaled().
+* The slot is the base snapshot, each journaled save appends an entry with what changed since the previous one. Loading replays the entries on top of the slot.
+*
+* Journal layout: FCSWSaveGameJournalHeader, then one entry per journaled save: { int32 Magic, int32 Size, uint32 Crc, uint8[Size] }.
+* The CRC is a CRC32C (FCSWChecksum) since the version 2 of the journal, the one of FCrc::MemCrc32() before.
+* The bytes of an entry are a FCSWBlockCompression buffer, what goes inside is up to the caller.
+* A journal belongs to the generation of the slot whose SaveId (FCSWSlotMetadata) is in its header, it's ignored once the slot is rewritten.
+* An entry cut by a crash fails its CRC, the entries before it are still replayed.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Serialization/Archive.h"
+#include "Templates/Function.h"
+#include "Templates/SharedPointer.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/Guid.h"
+#include "UObject/WeakObjectPtr.h"
+#include "SaveSystem/CSWSaveGameSnapshot.h"
+
+class USaveGame;
+
+/** Identifies journals ("CSWJ") */
+#define CSW_JOURNAL_HEADER_MAGIC 0x4A575343
+/** Identifies the entries of a journal ("CSWE") */
+#define CSW_JOURNAL_ENTRY_MAGIC 0x45575343
+
+/** The journal is folded into a new slot once it's bigger than this and than half the slot */
+#define CSW_JOURNAL_COMPACTION_MIN_SIZE (256 * 1024)
+
+/** What a record of a journal entry does to the levels record of an UCSWAutoSaveObject */
+namespace ECSWJournalRecordOp
+{
+	enum Type : uint8
+	{
+		/** Add or replace an actor record */
+		SetActor = 0,
+		/** Remove an actor record */
+		RemoveActor = 1,
+		/** Remove a level */
+		RemoveLevel = 2,
+		/** Set the bounds of the quantized locations of a level, the compact actor records after it are decoded with them */
+		SetLevelBounds = 3,
+	};
+}
+
+struct FCSWSaveGameJournalHeader
+{
+	int32 Magic;
+	int32 Version;
+	/** SaveId of the slot the journal applies to */
+	FGuid BaseSaveId;
+
+	FCSWSaveGameJournalHeader()
+		: Magic(CSW_JOURNAL_HEADER_MAGIC)
+		, Version(2)
+	{}
+
+	friend FArchive& operator<<(FArchive& Ar, FCSWSaveGameJournalHeader& Header)
+	{
+		Ar << Header.Magic;
+		Ar << Header.Version;
+		Ar << Header.BaseSaveId;
+		return Ar;
+	}
+};
+
+/**
+* What the journaled saves of a slot wrote so far, to find what changed since.
+* Only lives in memory: the first journaled save of a slot after starting the game writes the whole slot.
+*/
+struct FCSWSaveGameJournalState
+{
+	/** Locked while a journaled save or a compaction of the slot is writing */
+	FCriticalSection Lock;
+	/** SaveId of the base slot */
+	FGuid BaseSaveId;
+	/** Size of the base slot */
+	int64 BaseSize = 0;
+	/** Size of the journal, 0 if it has no entries */
+	int64 JournalSize = 0;
+	/** CRC of the object without its levels record */
+	uint32 ObjectCrc = 0;
+	/** CRC of every actor record, by level and actor name */
+	TMap<FName, TMap<FName, uint32>> ActorCrcs;
+	/** Bounds of the quantized locations of every level (FCSWMapRecord::Bounds) */
+	TMap<FName, FBox> LevelBounds;
+	/** The save object the CRCs come from, and the last FCSWActorRecord::ChangeStamp given when they were taken */
+	TWeakObjectPtr<const USaveGame> SaveGameObject;
+	uint64 RecordStamp = 0;
+	/** A compaction of the slot is running */
+	bool bCompacting = false;
+};
+
+typedef TSharedPtr<FCSWSaveGameJournalState, ESPMode::ThreadSafe> FCSWSaveGameJournalStatePtr;
+
+/**
+* Save game written as the new base of a slot by a background compaction.
+*/
+struct FCSWSaveGameJournalSnapshot
+{
+	FString SlotName;
+	int32 UserIndex = 0;
+	bool bCompressFile = true;
+	bool bUseCustomPath = false;
+	FString Path;
+	ECSWCompressionCodec Codec = ECSWCompressionCodec::Zlib;
+	FCSWSaveGameSnapshot Data;
+	/** Size of the journal when the snapshot was taken, the entries after it aren't in the snapshot */
+	int64 JournalSize = 0;
+	FCSWSaveGameJournalStatePtr State;
+};
+
+class CSWAUTOSAVEANDLOADSYSTEM_API FCSWSaveGameJournal
+{
+public:
+	static FCSWSaveGameJournal& Get();
+
+	/** Write the header of a new journal for the slot generation BaseSaveId */
+	static bool WriteHeader(FArchive& Ar, const FGuid& BaseSaveId);
+
+	/** Compress Payload with CodecID and append it as an entry */
+	static bool WriteEntry(FArchive& Ar, const TArray<uint8>& Payload, const ECSWCompressionCodec CodecID);
+
+	/**
+	* Read the entries of a journal in order. Stops at the first entry cut by a crash.
+	* Returns false if the journal belongs to another generation of the slot than BaseSaveId or if ReadEntry fails.
+	*/
+	static bool ReadEntries(FArchive& Ar, const FGuid& BaseSaveId, TFunctionRef<bool(const TArray<uint8>&)> ReadEntry);
+
+	/** Key of a slot in the journal states */
+	static FString GetSlotKey(const FString& SlotName, const bool bCompressFile, const bool bUseCustomPath, const FString& Path);
+
+	/** State of a slot, null if no journaled save of the slot was done (or the last one failed) */
+	FCSWSaveGameJournalStatePtr FindState(const FString& SlotKey) const;
+	void SetState(const FString& SlotKey, const FCSWSaveGameJournalStatePtr& State);
+	/** Forget a slot, its next journaled save writes it completely */
+	void RemoveState(const FString& SlotKey);
+	/** Forget every slot */
+	void RemoveAllStates();
+
+private:
+	mutable FCriticalSection StatesLock;
+	TMap<FString, FCSWSaveGameJournalStatePtr> States;
+};
@@ -0,0 +1,45 @@
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/SharedPointer.h"
+#include "Field/Struct/CSWAutoSaveStruct.h"
+#include "SaveSystem/CSWVersionStore.h"
+
+/** Plain bytes of the chunk of a level, before compression (what WriteLevelRecord() writes) */
+struct FCSWSaveGameLevelChunk
+{
+	FName Name;
+	TArray<uint8> Data;
+};
+
+/**
+* Copy of a save game taken on the game thread (UCSWAutoSaveBlueprintLibrary::TakeSaveGameSnapshot()),
+* so another thread can write it into a slot while the game keeps changing the object.
+* The decoded slot cache also builds snapshots from the chunks of the slots it saves and loads, so caching a slot never copies its records.
+*/
+struct FCSWSaveGameSnapshot
+{
+	/** Object chunk (preamble + object without its levels record) */
+	TArray<uint8> ObjectChunk;
+	/** CRC of the object without its levels record */
+	uint32 ObjectCrc = 0;
+	/** Directory of the slots the snapshot was taken for or decoded from, where the versions of its preambles are stored */
+	FCSWVersionsLocation VersionsLocation;
+	/** Levels record of an UCSWAutoSaveObject */
+	TArray<FCSWMapRecord> LevelsRecord;
+
+	/** Built from the chunks of a slot: the levels are LevelChunks and JournalEntries, decoded when the snapshot is applied, instead of LevelsRecord */
+	bool bFromChunks = false;
+	TArray<FCSWSaveGameLevelChunk> LevelChunks;
+	/** Payloads of the journal entries of the slot, replayed on top of the level chunks */
+	TArray<TArray<uint8>> JournalEntries;
+};
+
+/** Snapshot shared between threads, read only once shared (see FCSWDecodedSlotCache) */
+typedef TSharedPtr<const FCSWSaveGameSnapshot, ESPMode::ThreadSafe> FCSWSaveGameSnapshotPtr;
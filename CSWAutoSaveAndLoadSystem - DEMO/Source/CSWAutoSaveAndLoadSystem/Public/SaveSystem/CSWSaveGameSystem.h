@@ -1,175 +1,574 @@
-/**
-* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
-*
-* Developed by Kevin Yabar Garces
-*/
-
-/**
-* Custom Save Game System based on "\Engine\Source\Runtime\Engine\Public\SaveGameSystem.h"
-* This custom system adds:
-* - Save/load data in custom paths/folders.
-* - Custom ".csav" extension for compressed files.
-*/
-
-#pragma once
-
-#include "HAL/FileManager.h"
-#include "Misc/FileHelper.h"
-#include "Misc/Paths.h"
-#include "Modules/ModuleInterface.h"
-#include "Modules/ModuleManager.h"
-
-/**
- * Interface for platform feature modules
- */
-
-/** Defines the interface to platform's save game system (or a generic file based one) */
-class ICSWSaveGameSystem
-{
-public:
-
-	// Possible result codes when using DoesSaveGameExist.
-	// Not all codes are guaranteed to be returned on all platforms.
-	enum class ESaveExistsResult
-	{
-		OK,						// Operation on the file completely successfully.
-		DoesNotExist,			// Operation on the file failed, because the file was not found / does not exist.
-		Corrupt,				// Operation on the file failed, because the file was corrupt.
-		UnspecifiedError		// Operation on the file failed due to an unspecified error.
-	};
-
-	/** Returns true if the platform has a native UI (like many consoles) */
-	virtual bool PlatformHasNativeUI() = 0;
-
-	/** Return true if the named savegame exists (probably not useful with NativeUI */
-	virtual bool DoesSaveGameExist(const bool bUseCustomPath, const bool bCompressFile,  const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex) = 0;
-
-	/** Similar to DoesSaveGameExist, except returns a result code with more information. */
-	virtual ESaveExistsResult DoesSaveGameExistWithResult(const bool bUseCustomPath, const bool bCompressFile,  const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex) = 0;
-
-	/** Saves the game, blocking until complete. Platform may use FGameDelegates to get more information from the game */
-	virtual bool SaveGame(bool bAttemptToUseUI, const bool bUseCustomPath, const bool bCompressFile,  const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex, const TArray<uint8>& Data) = 0;
-
-	/** Loads the game, blocking until complete */
-	virtual bool LoadGame(bool bAttemptToUseUI, const bool bUseCustomPath, const bool bCompressFile,  const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex, TArray<uint8>& Data) = 0;
-
-	/** Delete an existing save game, blocking until complete */
-	virtual bool DeleteGame(bool bAttemptToUseUI, const bool bUseCustomPath, const bool bCompressFile,  const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex) = 0;
-};
-
-
-/** A generic save game system that just uses IFileManager to save/load with normal files */
-class FGenericCSWSaveGameSystem : public ICSWSaveGameSystem
-{
-public:
-	virtual bool PlatformHasNativeUI() override
-	{
-		return false;
-	}
-
-	virtual ESaveExistsResult DoesSaveGameExistWithResult(const bool bUseCustomPath, const bool bCompressFile,  const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex) override
-	{
-		///Check if returns "null"
-		FString FullPath = GetSaveGamePath(bUseCustomPath, bCompressFile, FilePath, FileName);
-		if (FullPath == "null") return ESaveExistsResult::DoesNotExist;
-		///
-		if (IFileManager::Get().FileSize(*FullPath) >= 0)
-		{
-			return ESaveExistsResult::OK;
-		}
-		return ESaveExistsResult::DoesNotExist;
-	}
-
-	virtual bool DoesSaveGameExist(const bool bUseCustomPath, const bool bCompressFile,  const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex) override
-	{
-		return ESaveExistsResult::OK == DoesSaveGameExistWithResult(bUseCustomPath, bCompressFile, FilePath, FileName, UserIndex);
-	}
-
-	virtual bool SaveGame(bool bAttemptToUseUI, const bool bUseCustomPath, const bool bCompressFile,  const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex, const TArray<uint8>& Data) override
-	{
-		///Check if returns "null"
-		FString FullPath = GetSaveGamePath(bUseCustomPath, bCompressFile, FilePath, FileName);
-		if (FullPath == "null") return false;
-		///
-		return FFileHelper::SaveArrayToFile(Data, *FullPath);
-	}
-
-	virtual bool LoadGame(bool bAttemptToUseUI, const bool bUseCustomPath, const bool bCompressFile,  const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex, TArray<uint8>& Data) override
-	{
-		///Check if returns "null"
-		FString FullPath = GetSaveGamePath(bUseCustomPath, bCompressFile, FilePath, FileName);
-		if (FullPath == "null") return false;
-		///
-		return FFileHelper::LoadFileToArray(Data, *FullPath);
-	}
-
-	virtual bool DeleteGame(bool bAttemptToUseUI, const bool bUseCustomPath, const bool bCompressFile,  const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex) override
-	{
-		///Check if returns "null"
-		FString FullPath = GetSaveGamePath(bUseCustomPath, bCompressFile, FilePath, FileName);
-		if (FullPath == "null") return false;
-		///
-		return IFileManager::Get().Delete(*FullPath, true, false, !bAttemptToUseUI);
-	}
-
-protected:
-
-	/** Get the path to save game file for the given name, a platform _may_ be able to simply override this and no other functions above */
-	virtual FString GetSaveGamePath(const bool bUseCustomPath, const bool bCompressFile,  const TCHAR* FilePath, const TCHAR* FileName)
-	{
-		/// Declare FString wether to use .sav or .csav (compressed)
-		FString extension;
-		if (bCompressFile)
-		{
-			extension = "csav";
-		}
-		else
-		{
-			extension = "sav";
-		}
-		/// Save in custom directory. note: If directory doesn't exist there will be an error message.
-		if (bUseCustomPath)
-		{
-			if (!FPaths::DirectoryExists(FilePath))
-			{
-				UE_LOG(LogTemp, Warning, TEXT("CSWError: Directory \"%s\" doesn't exists."), FilePath);
-				return "null";
-			}
-			/// Return FullPathName if everything was correct. Also, add a ".sav" string at the end
-			return FString::Printf(TEXT("%s%s.%s"), FilePath, FileName, *extension);
-		}
-		/// Save in default "Saved/SaveGames/" folder
-		else
-		{
-			return FString::Printf(TEXT("%sSaveGames/%s.%s"), *FPaths::ProjectSavedDir(), FileName, *extension);
-		}
-	}
-};
-
-class CSWAUTOSAVEANDLOADSYSTEM_API ICSWPlatformFeaturesModule : public IModuleInterface
-{
-public:
-
-	static ICSWPlatformFeaturesModule& Get()
-	{
-		static ICSWPlatformFeaturesModule* StaticModule = NULL;
-		// first time initialization
-		if (!StaticModule)
-		{
-			const TCHAR* PlatformModuleName = FPlatformMisc::GetPlatformFeaturesModuleName();
-			if (PlatformModuleName)
-			{
-				StaticModule = &FModuleManager::LoadModuleChecked<ICSWPlatformFeaturesModule>(PlatformModuleName);
-			}
-			else
-			{
-				// if the platform doesn't care about a platform features module, then use this generic almost empty implementation
-				StaticModule = new ICSWPlatformFeaturesModule;
-			}
-		}
-
-		return *StaticModule;
-	}
-
-	virtual class ICSWSaveGameSystem* GetSaveGameSystem();
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+/**
+* Custom Save Game System based on "\Engine\Source\Runtime\Engine\Public\SaveGameSystem.h"
+* This custom system adds:
+* - Save/load data in custom paths/folders.
+* - Custom ".csav" extension for compressed files.
+* - Atomic slot commits (write to a temp file, flush and rename over the previous slot).
+* - Streamed saves and loads, so the slot never has to be materialized in memory.
+* - Append-only journals next to the slots (see FCSWSaveGameJournal).
+* - The versions of the builds that wrote the slots next to them (see FCSWVersionStore).
+* - Replacing the platform save game system (e.g. with FCSWPackSaveGameSystem, which keeps every slot of a directory in a single file).
+*/
+
+#pragma once
+
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFilemanager.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "Templates/UniquePtr.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Templates/Function.h"
+#include "Modules/ModuleInterface.h"
+#include "Modules/ModuleManager.h"
+#include "Runtime/Launch/Resources/Version.h"
+
+/** Suffixes used by atomic slot commits */
+#define CSW_SLOT_TEMP_SUFFIX TEXT(".tmp")
+#define CSW_SLOT_BACKUP_SUFFIX TEXT(".bak")
+
+/** Suffix of the journal of a slot */
+#define CSW_SLOT_JOURNAL_SUFFIX TEXT(".csj")
+
+/** Size of the buffer used when streaming a slot into a file */
+#define CSW_SLOT_WRITE_BUFFER_SIZE (64 * 1024)
+
+/**
+* Archive that writes sequentially into a file handle through a bounded buffer.
+* Used to stream slots to disk, Close() flushes the handle to disk and fails if it couldn't be flushed.
+*/
+class FCSWFileHandleWriter : public FArchive
+{
+public:
+	FCSWFileHandleWriter(IFileHandle& InFileHandle, const int32 InBufferSize = CSW_SLOT_WRITE_BUFFER_SIZE)
+		: FileHandle(InFileHandle)
+		, BufferSize(InBufferSize)
+	{
+		ArIsSaving = true;
+		ArIsPersistent = true;
+		Buffer.Reserve(BufferSize);
+	}
+
+	virtual void Serialize(void* Data, int64 Num) override
+	{
+		if (Num <= 0 || ArIsError) return;
+		/// Make room in the buffer, big writes skip the buffer completely
+		if (Buffer.Num() + Num > BufferSize)
+		{
+			FlushBuffer();
+		}
+		if (Num >= BufferSize)
+		{
+			if (!FileHandle.Write(static_cast<const uint8*>(Data), Num)) ArIsError = true;
+		}
+		else
+		{
+			Buffer.Append(static_cast<const uint8*>(Data), Num);
+		}
+	}
+
+	virtual int64 Tell() override { return FileHandle.Tell() + Buffer.Num(); }
+	virtual int64 TotalSize() override { FlushBuffer(); return FileHandle.Size(); }
+	virtual void Seek(int64 InPos) override
+	{
+		FlushBuffer();
+		if (!FileHandle.Seek(InPos)) ArIsError = true;
+	}
+	virtual void Flush() override { FlushBuffer(); }
+	virtual bool Close() override
+	{
+		FlushBuffer();
+		if (!FlushToDisk(FileHandle)) ArIsError = true;
+		return !ArIsError;
+	}
+	virtual FString GetArchiveName() const override { return TEXT("FCSWFileHandleWriter"); }
+
+	/** Flushes what was written to the handle, a full flush (down to the device) where the engine supports it. False if it failed */
+	static bool FlushToDisk(IFileHandle& Handle)
+	{
+#if ENGINE_MAJOR_VERSION > 4 || ENGINE_MINOR_VERSION >= 22
+		return Handle.Flush(true);
+#else
+		///4.21 and older only have the plain flush
+		return Handle.Flush();
+#endif
+	}
+
+private:
+	void FlushBuffer()
+	{
+		if (Buffer.Num() <= 0) return;
+		if (!FileHandle.Write(Buffer.GetData(), Buffer.Num())) ArIsError = true;
+		Buffer.Reset();
+	}
+
+	IFileHandle& FileHandle;
+	const int32 BufferSize;
+	TArray<uint8> Buffer;
+};
+
+/**
+ * Interface for platform feature modules
+ */
+
+/** Defines the interface to platform's save game system (or a generic file based one) */
+class ICSWSaveGameSystem
+{
+public:
+
+	// Possible result codes when using DoesSaveGameExist.
+	// Not all codes are guaranteed to be returned on all platforms.
+	enum class ESaveExistsResult
+	{
+		OK,						// Operation on the file completely successfully.
+		DoesNotExist,			// Operation on the file failed, because the file was not found / does not exist.
+		Corrupt,				// Operation on the file failed, because the file was corrupt.
+		UnspecifiedError		// Operation on the file failed due to an unspecified error.
+	};
+
+	/** Returns true if the platform has a native UI (like many consoles) */
+	virtual bool PlatformHasNativeUI() = 0;
+
+	/** Return true if the named savegame exists (probably not useful with NativeUI */
+	virtual bool DoesSaveGameExist(const bool bUseCustomPath, const bool bCompressFile,  const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex) = 0;
+
+	/** Similar to DoesSaveGameExist, except returns a result code with more information. */
+	virtual ESaveExistsResult DoesSaveGameExistWithResult(const bool bUseCustomPath, const bool bCompressFile,  const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex) = 0;
+
+	/** Saves the game, blocking until complete. Platform may use FGameDelegates to get more information from the game */
+	virtual bool SaveGame(bool bAttemptToUseUI, const bool bUseCustomPath, const bool bCompressFile,  const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex, const TArray<uint8>& Data) = 0;
+
+	/** Loads the game, blocking until complete */
+	virtual bool LoadGame(bool bAttemptToUseUI, const bool bUseCustomPath, const bool bCompressFile,  const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex, TArray<uint8>& Data) = 0;
+
+	/** Delete an existing save game, blocking until complete */
+	virtual bool DeleteGame(bool bAttemptToUseUI, const bool bUseCustomPath, const bool bCompressFile,  const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex) = 0;
+
+	/** Enable or disable atomic slot commits (write to a temp file, flush and rename). Platforms without support can ignore it */
+	virtual void SetUseAtomicWrites(const bool bEnable) {}
+
+	/**
+	* Saves the game by streaming it into the slot, blocking until complete.
+	* WriteData receives the archive of the slot and returns false to abort the save.
+	* Platforms that can't stream fall back to SaveGame() with a memory buffer.
+	*/
+	virtual bool SaveGameStreamed(bool bAttemptToUseUI, const bool bUseCustomPath, const bool bCompressFile, const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex, TFunctionRef<bool(FArchive&)> WriteData)
+	{
+		TArray<uint8> Data;
+		FMemoryWriter MemoryWriter(Data, true);
+		return WriteData(MemoryWriter) && SaveGame(bAttemptToUseUI, bUseCustomPath, bCompressFile, FilePath, FileName, UserIndex, Data);
+	}
+
+	/**
+	* Loads the game by streaming it from the slot, blocking until complete.
+	* ReadData receives the archive of the slot and returns false if the data couldn't be read.
+	* Platforms that can't stream fall back to LoadGame() with a memory buffer.
+	*/
+	virtual bool LoadGameStreamed(bool bAttemptToUseUI, const bool bUseCustomPath, const bool bCompressFile, const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex, TFunctionRef<bool(FArchive&)> ReadData)
+	{
+		TArray<uint8> Data;
+		if (!LoadGame(bAttemptToUseUI, bUseCustomPath, bCompressFile, FilePath, FileName, UserIndex, Data)) return false;
+		FMemoryReader MemoryReader(Data, true);
+		return ReadData(MemoryReader);
+	}
+
+	/**
+	* Write into the journal of a slot, appending to it (bAppend) or starting a new one.
+	* Platforms that can't append return false, the journaled saves write the whole slot then.
+	*/
+	virtual bool WriteSaveGameJournal(const bool bAppend, const bool bUseCustomPath, const bool bCompressFile, const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex, TFunctionRef<bool(FArchive&)> WriteData)
+	{
+		return false;
+	}
+
+	/** Read the journal of a slot, false if it has none */
+	virtual bool LoadSaveGameJournal(const bool bUseCustomPath, const bool bCompressFile, const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex, TFunctionRef<bool(FArchive&)> ReadData)
+	{
+		return false;
+	}
+
+	/** Delete the journal of a slot */
+	virtual bool DeleteSaveGameJournal(const bool bUseCustomPath, const bool bCompressFile, const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex)
+	{
+		return false;
+	}
+
+	/**
+	* Write a versions file (see FCSWVersionStore) next to the slots of a directory. FileName is relative to the directory.
+	* Platforms that can't store it return false, the save games embed their versions then.
+	*/
+	virtual bool SaveGameVersions(const bool bUseCustomPath, const TCHAR* FilePath, const int32 UserIndex, const TCHAR* FileName, const TArray<uint8>& Data)
+	{
+		return false;
+	}
+
+	/** Read a versions file written by SaveGameVersions(), false if the directory doesn't have it */
+	virtual bool LoadGameVersions(const bool bUseCustomPath, const TCHAR* FilePath, const int32 UserIndex, const TCHAR* FileName, TArray<uint8>& OutData)
+	{
+		return false;
+	}
+
+	/**
+	* List the slots of a directory with their size and modification time.
+	* Platforms that don't keep an index of their slots return false, the directory is listed from disk then.
+	*/
+	virtual bool GetSaveGames(const bool bUseCustomPath, const bool bCompressFile, const TCHAR* FilePath, TArray<FString>& OutSlotNames, TArray<FFileStatData>& OutStatData)
+	{
+		return false;
+	}
+
+	/**
+	* Get the size and modification time of a slot.
+	* Platforms that don't keep an index of their slots return false, the file is checked on disk then.
+	*/
+	virtual bool GetSaveGameStatData(const bool bUseCustomPath, const bool bCompressFile, const TCHAR* FilePath, const TCHAR* FileName, FFileStatData& OutStatData)
+	{
+		return false;
+	}
+};
+
+
+/** A generic save game system that just uses IFileManager to save/load with normal files */
+class FGenericCSWSaveGameSystem : public ICSWSaveGameSystem
+{
+public:
+	virtual bool PlatformHasNativeUI() override
+	{
+		return false;
+	}
+
+	virtual ESaveExistsResult DoesSaveGameExistWithResult(const bool bUseCustomPath, const bool bCompressFile,  const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex) override
+	{
+		///Check if returns "null"
+		FString FullPath = GetSaveGamePath(bUseCustomPath, bCompressFile, FilePath, FileName);
+		if (FullPath == "null") return ESaveExistsResult::DoesNotExist;
+		///A plain stat, damaged slots are reported by CSWValidateSaveGame() and by the loads
+		if (IFileManager::Get().FileSize(*FullPath) >= 0)
+		{
+			return ESaveExistsResult::OK;
+		}
+		return ESaveExistsResult::DoesNotExist;
+	}
+
+	virtual bool DoesSaveGameExist(const bool bUseCustomPath, const bool bCompressFile,  const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex) override
+	{
+		return ESaveExistsResult::OK == DoesSaveGameExistWithResult(bUseCustomPath, bCompressFile, FilePath, FileName, UserIndex);
+	}
+
+	virtual bool SaveGame(bool bAttemptToUseUI, const bool bUseCustomPath, const bool bCompressFile,  const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex, const TArray<uint8>& Data) override
+	{
+		///Check if returns "null"
+		FString FullPath = GetSaveGamePath(bUseCustomPath, bCompressFile, FilePath, FileName);
+		if (FullPath == "null") return false;
+		///
+		if (bUseAtomicWrites)
+		{
+			return WriteSlotFile(FullPath, [&Data](FArchive& FileAr)
+			{
+				FileAr.Serialize(const_cast<uint8*>(Data.GetData()), Data.Num());
+				return !FileAr.IsError();
+			});
+		}
+		return FFileHelper::SaveArrayToFile(Data, *FullPath);
+	}
+
+	virtual bool SaveGameStreamed(bool bAttemptToUseUI, const bool bUseCustomPath, const bool bCompressFile, const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex, TFunctionRef<bool(FArchive&)> WriteData) override
+	{
+		///Check if returns "null"
+		FString FullPath = GetSaveGamePath(bUseCustomPath, bCompressFile, FilePath, FileName);
+		if (FullPath == "null") return false;
+		///
+		return WriteSlotFile(FullPath, WriteData);
+	}
+
+	virtual bool LoadGameStreamed(bool bAttemptToUseUI, const bool bUseCustomPath, const bool bCompressFile, const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex, TFunctionRef<bool(FArchive&)> ReadData) override
+	{
+		///Check if returns "null"
+		FString FullPath = GetSaveGamePath(bUseCustomPath, bCompressFile, FilePath, FileName);
+		if (FullPath == "null") return false;
+		///
+		RecoverInterruptedCommit(FullPath);
+		TUniquePtr<FArchive> FileReader(IFileManager::Get().CreateFileReader(*FullPath));
+		if (!FileReader.IsValid()) return false;
+		const bool bSuccess = ReadData(*FileReader) && !FileReader->IsError();
+		FileReader->Close();
+		return bSuccess;
+	}
+
+	virtual bool LoadGame(bool bAttemptToUseUI, const bool bUseCustomPath, const bool bCompressFile,  const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex, TArray<uint8>& Data) override
+	{
+		///Check if returns "null"
+		FString FullPath = GetSaveGamePath(bUseCustomPath, bCompressFile, FilePath, FileName);
+		if (FullPath == "null") return false;
+		///
+		RecoverInterruptedCommit(FullPath);
+		return FFileHelper::LoadFileToArray(Data, *FullPath);
+	}
+
+	virtual bool DeleteGame(bool bAttemptToUseUI, const bool bUseCustomPath, const bool bCompressFile,  const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex) override
+	{
+		///Check if returns "null"
+		FString FullPath = GetSaveGamePath(bUseCustomPath, bCompressFile, FilePath, FileName);
+		if (FullPath == "null") return false;
+		///Remove leftovers of an interrupted commit too
+		IFileManager::Get().Delete(*(FullPath + CSW_SLOT_TEMP_SUFFIX), false, false, true);
+		IFileManager::Get().Delete(*(FullPath + CSW_SLOT_BACKUP_SUFFIX), false, false, true);
+		IFileManager::Get().Delete(*(FullPath + CSW_SLOT_JOURNAL_SUFFIX), false, false, true);
+		///
+		return IFileManager::Get().Delete(*FullPath, true, false, !bAttemptToUseUI);
+	}
+
+	virtual bool WriteSaveGameJournal(const bool bAppend, const bool bUseCustomPath, const bool bCompressFile, const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex, TFunctionRef<bool(FArchive&)> WriteData) override
+	{
+		///Check if returns "null"
+		FString FullPath = GetSaveGamePath(bUseCustomPath, bCompressFile, FilePath, FileName);
+		if (FullPath == "null") return false;
+		///Entries are only ever appended, a crash can at most cut the last one
+		const FString JournalPath = FullPath + CSW_SLOT_JOURNAL_SUFFIX;
+		TUniquePtr<IFileHandle> FileHandle(FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*JournalPath, bAppend));
+		if (!FileHandle.IsValid())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("CSWError: Couldn't open \"%s\" for writing."), *JournalPath);
+			return false;
+		}
+		FCSWFileHandleWriter FileWriter(*FileHandle);
+		const bool bWritten = WriteData(FileWriter);
+		return FileWriter.Close() && bWritten;
+	}
+
+	virtual bool LoadSaveGameJournal(const bool bUseCustomPath, const bool bCompressFile, const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex, TFunctionRef<bool(FArchive&)> ReadData) override
+	{
+		///Check if returns "null"
+		FString FullPath = GetSaveGamePath(bUseCustomPath, bCompressFile, FilePath, FileName);
+		if (FullPath == "null") return false;
+		///
+		TUniquePtr<FArchive> FileReader(IFileManager::Get().CreateFileReader(*(FullPath + CSW_SLOT_JOURNAL_SUFFIX), FILEREAD_Silent));
+		if (!FileReader.IsValid()) return false;
+		const bool bSuccess = ReadData(*FileReader);
+		FileReader->Close();
+		return bSuccess;
+	}
+
+	virtual bool DeleteSaveGameJournal(const bool bUseCustomPath, const bool bCompressFile, const TCHAR* FilePath, const TCHAR* FileName, const int32 UserIndex) override
+	{
+		///Check if returns "null"
+		FString FullPath = GetSaveGamePath(bUseCustomPath, bCompressFile, FilePath, FileName);
+		if (FullPath == "null") return false;
+		///
+		return IFileManager::Get().Delete(*(FullPath + CSW_SLOT_JOURNAL_SUFFIX), false, false, true);
+	}
+
+	virtual bool SaveGameVersions(const bool bUseCustomPath, const TCHAR* FilePath, const int32 UserIndex, const TCHAR* FileName, const TArray<uint8>& Data) override
+	{
+		///Check if returns "null"
+		FString Directory = GetSaveGameDirectory(bUseCustomPath, FilePath);
+		if (Directory == "null") return false;
+		///Written aside and moved, so an interrupted write never leaves a truncated file with the name of the hash
+		const FString VersionsPath = Directory + FileName;
+		const FString TempPath = VersionsPath + CSW_SLOT_TEMP_SUFFIX;
+		if (!FFileHelper::SaveArrayToFile(Data, *TempPath) || !IFileManager::Get().Move(*VersionsPath, *TempPath, true, true))
+		{
+			IFileManager::Get().Delete(*TempPath, false, true, true);
+			return false;
+		}
+		return true;
+	}
+
+	virtual bool LoadGameVersions(const bool bUseCustomPath, const TCHAR* FilePath, const int32 UserIndex, const TCHAR* FileName, TArray<uint8>& OutData) override
+	{
+		///Check if returns "null"
+		FString Directory = GetSaveGameDirectory(bUseCustomPath, FilePath);
+		if (Directory == "null") return false;
+		///
+		return FFileHelper::LoadFileToArray(OutData, *(Directory + FileName), FILEREAD_Silent);
+	}
+
+	virtual void SetUseAtomicWrites(const bool bEnable) override
+	{
+		bUseAtomicWrites = bEnable;
+	}
+
+protected:
+
+	/** If true, SaveGame() writes to "<slot>.tmp", flushes it and renames it over the slot, keeping "<slot>.bak" until the rename succeeds */
+	bool bUseAtomicWrites = true;
+
+	/**
+	* Stream a slot as a single sequential write through a bounded buffer and flush it to disk.
+	* With atomic writes, the data goes into a temp file that is renamed over the previous slot. The previous generation is moved to "<slot>.bak"
+	* and only deleted once the new slot is in place, so a crash at any point leaves a loadable slot.
+	*/
+	bool WriteSlotFile(const FString& FullPath, TFunctionRef<bool(FArchive&)> WriteData)
+	{
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+		const FString TempPath = FullPath + CSW_SLOT_TEMP_SUFFIX;
+		const FString BackupPath = FullPath + CSW_SLOT_BACKUP_SUFFIX;
+		const FString& WritePath = bUseAtomicWrites ? TempPath : FullPath;
+		/// Write and flush the file. The handle is closed before renaming
+		{
+			PlatformFile.CreateDirectoryTree(*FPaths::GetPath(WritePath));
+			TUniquePtr<IFileHandle> FileHandle(PlatformFile.OpenWrite(*WritePath));
+			if (!FileHandle.IsValid())
+			{
+				UE_LOG(LogTemp, Warning, TEXT("CSWError: Couldn't open \"%s\" for writing."), *WritePath);
+				return false;
+			}
+			FCSWFileHandleWriter FileWriter(*FileHandle);
+			const bool bWritten = WriteData(FileWriter);
+			const bool bClosed = FileWriter.Close();
+			if (!bWritten || !bClosed)
+			{
+				FileHandle.Reset();
+				PlatformFile.DeleteFile(*WritePath);
+				UE_LOG(LogTemp, Warning, TEXT("CSWError: Couldn't write \"%s\"."), *WritePath);
+				return false;
+			}
+		}
+		return bUseAtomicWrites ? CommitTempSlotFile(FullPath, TempPath, BackupPath) : true;
+	}
+
+	/** Rename a fully written temp file over the slot, keeping the previous generation as a backup until the rename succeeds */
+	bool CommitTempSlotFile(const FString& FullPath, const FString& TempPath, const FString& BackupPath)
+	{
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+		/// Keep the previous generation aside
+		const bool bHadPreviousSlot = PlatformFile.FileExists(*FullPath);
+		if (bHadPreviousSlot)
+		{
+			PlatformFile.DeleteFile(*BackupPath);
+			if (!PlatformFile.MoveFile(*BackupPath, *FullPath))
+			{
+				PlatformFile.DeleteFile(*TempPath);
+				UE_LOG(LogTemp, Warning, TEXT("CSWError: Couldn't back up \"%s\"."), *FullPath);
+				return false;
+			}
+		}
+		/// Put the new generation in place, restore the previous one if it fails
+		if (!PlatformFile.MoveFile(*FullPath, *TempPath))
+		{
+			if (bHadPreviousSlot)
+			{
+				PlatformFile.MoveFile(*FullPath, *BackupPath);
+			}
+			PlatformFile.DeleteFile(*TempPath);
+			UE_LOG(LogTemp, Warning, TEXT("CSWError: Couldn't commit \"%s\"."), *FullPath);
+			return false;
+		}
+		/// The new generation is committed, the backup is no longer needed
+		PlatformFile.DeleteFile(*BackupPath);
+		return true;
+	}
+
+	/** If a crash happened between backing up the previous generation and renaming the new one, put the backup back in place */
+	void RecoverInterruptedCommit(const FString& FullPath)
+	{
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+		const FString BackupPath = FullPath + CSW_SLOT_BACKUP_SUFFIX;
+		if (!PlatformFile.FileExists(*FullPath) && PlatformFile.FileExists(*BackupPath))
+		{
+			PlatformFile.MoveFile(*FullPath, *BackupPath);
+		}
+	}
+
+	/** Get the directory of the save game files, "null" if the custom directory doesn't exist */
+	virtual FString GetSaveGameDirectory(const bool bUseCustomPath, const TCHAR* FilePath)
+	{
+		if (bUseCustomPath)
+		{
+			if (!FPaths::DirectoryExists(FilePath))
+			{
+				UE_LOG(LogTemp, Warning, TEXT("CSWError: Directory \"%s\" doesn't exists."), FilePath);
+				return "null";
+			}
+			return FilePath;
+		}
+		return FPaths::ProjectSavedDir() + TEXT("SaveGames/");
+	}
+
+	/** Get the path to save game file for the given name, a platform _may_ be able to simply override this and no other functions above */
+	virtual FString GetSaveGamePath(const bool bUseCustomPath, const bool bCompressFile,  const TCHAR* FilePath, const TCHAR* FileName)
+	{
+		/// Declare FString wether to use .sav or .csav (compressed)
+		FString extension;
+		if (bCompressFile)
+		{
+			extension = "csav";
+		}
+		else
+		{
+			extension = "sav";
+		}
+		/// Save in custom directory. note: If directory doesn't exist there will be an error message.
+		if (bUseCustomPath)
+		{
+			if (!FPaths::DirectoryExists(FilePath))
+			{
+				UE_LOG(LogTemp, Warning, TEXT("CSWError: Directory \"%s\" doesn't exists."), FilePath);
+				return "null";
+			}
+			/// Return FullPathName if everything was correct. Also, add a ".sav" string at the end
+			return FString::Printf(TEXT("%s%s.%s"), FilePath, FileName, *extension);
+		}
+		/// Save in default "Saved/SaveGames/" folder
+		else
+		{
+			return FString::Printf(TEXT("%sSaveGames/%s.%s"), *FPaths::ProjectSavedDir(), FileName, *extension);
+		}
+	}
+};
+
+class CSWAUTOSAVEANDLOADSYSTEM_API ICSWPlatformFeaturesModule : public IModuleInterface
+{
+public:
+
+	static ICSWPlatformFeaturesModule& Get()
+	{
+		static ICSWPlatformFeaturesModule* StaticModule = NULL;
+		// first time initialization
+		if (!StaticModule)
+		{
+			const TCHAR* PlatformModuleName = FPlatformMisc::GetPlatformFeaturesModuleName();
+			if (PlatformModuleName)
+			{
+				StaticModule = &FModuleManager::LoadModuleChecked<ICSWPlatformFeaturesModule>(PlatformModuleName);
+			}
+			else
+			{
+				// if the platform doesn't care about a platform features module, then use this generic almost empty implementation
+				StaticModule = new ICSWPlatformFeaturesModule;
+			}
+		}
+
+		return *StaticModule;
+	}
+
+	virtual class ICSWSaveGameSystem* GetSaveGameSystem();
+
+	/** Save game system used by the plugin: the override if there's one, the platform one otherwise */
+	ICSWSaveGameSystem* GetActiveSaveGameSystem()
+	{
+		ICSWSaveGameSystem* SaveGameSystemOverride = GetSaveGameSystemOverride();
+		return SaveGameSystemOverride ? SaveGameSystemOverride : GetSaveGameSystem();
+	}
+
+	/** Use SaveGameSystem instead of the platform save game system. Null goes back to the platform one. Not thread safe, call it while no save or load is running */
+	static void SetSaveGameSystemOverride(ICSWSaveGameSystem* SaveGameSystem)
+	{
+		GetSaveGameSystemOverride() = SaveGameSystem;
+	}
+
+private:
+	static ICSWSaveGameSystem*& GetSaveGameSystemOverride()
+	{
+		static ICSWSaveGameSystem* SaveGameSystemOverride = nullptr;
+		return SaveGameSystemOverride;
+	}
 };
\ No newline at end of file
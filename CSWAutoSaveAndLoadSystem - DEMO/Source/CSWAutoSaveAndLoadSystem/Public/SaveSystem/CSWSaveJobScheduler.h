@@ -0,0 +1,100 @@
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+/**
+* Scheduler of the background save jobs (async saves, autosave rings and journal compactions).
+* A single writer thread runs the jobs one at a time, highest priority first, so saves never fight over the disk.
+* Jobs with the same key (usually the slot) coalesce: a new job replaces the pending one, so bursts of saves of a slot only write the newest snapshot.
+* Completions are queued and executed on the game thread in one batch per frame.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/ThreadSafeBool.h"
+#include "Templates/Function.h"
+#include "Containers/Ticker.h"
+#include "Field/Enum/CSWAutoSaveEnum.h"
+
+class FEvent;
+class FRunnableThread;
+
+/** Jobs waiting for the writer, new jobs are refused once the queue is full (coalescing jobs are always accepted) */
+#define CSW_SAVE_JOB_MAX_QUEUED_JOBS 16
+
+class CSWAUTOSAVEANDLOADSYSTEM_API FCSWSaveJobScheduler : public FRunnable
+{
+public:
+	static FCSWSaveJobScheduler& Get();
+
+	/** Register the game thread dispatcher. Called when the module starts */
+	void Startup();
+
+	/** Run the queued jobs, stop the writer thread and unregister the dispatcher. Called when the module shuts down */
+	void Shutdown();
+
+	/**
+	* Queue a job, starting the writer thread the first time.
+	* If a job with the same Key is pending, it's replaced by Work and keeps its ID, OnCompleted of both get the result. Empty keys never coalesce.
+	* Work runs on the writer thread, OnCompleted on the game thread. Returns the ID of the job, INDEX_NONE if it was refused (OnCompleted gets false then).
+	*/
+	int32 Enqueue(const FString& Key, const ECSWSaveJobPriority Priority, TUniqueFunction<bool()>&& Work, TUniqueFunction<void(bool)>&& OnCompleted = nullptr);
+
+	/**
+	* Queue a job that runs after the pending job of AfterKey if there's one, like a load of a slot after its pending save.
+	* The job gets Priority, or the priority of that pending job if it's lower (jobs of the same priority run in the order they were queued)
+	*/
+	int32 EnqueueAfter(const FString& AfterKey, const FString& Key, const ECSWSaveJobPriority Priority, TUniqueFunction<bool()>&& Work, TUniqueFunction<void(bool)>&& OnCompleted = nullptr);
+
+	/** Cancel a pending job, its OnCompleted get false. Returns false if the job already started or doesn't exist */
+	bool Cancel(const int32 JobId);
+
+	/** Cancel the pending job of Key, like Cancel() */
+	bool CancelByKey(const FString& Key);
+
+	/** Execute Completion on the game thread with the next batch. Can be called from any thread */
+	void DispatchToGameThread(TUniqueFunction<void()>&& Completion);
+
+	/** FRunnable interface */
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+private:
+	struct FJob
+	{
+		int32 JobId = INDEX_NONE;
+		FString Key;
+		ECSWSaveJobPriority Priority = ECSWSaveJobPriority::Normal;
+		TUniqueFunction<bool()> Work;
+		TArray<TUniqueFunction<void(bool)>> OnCompleted;
+	};
+
+	FCSWSaveJobScheduler() = default;
+	virtual ~FCSWSaveJobScheduler();
+
+	/** Take the pending job with the highest priority (the oldest one among equals) */
+	bool DequeueJob(FJob& OutJob);
+
+	/** Queue the OnCompleted of a job for the game thread */
+	void CompleteJob(FJob& Job, const bool bSuccess);
+
+	/** Execute the completions queued since the last frame. Game thread */
+	bool DispatchCompletions(float DeltaTime);
+
+	FCriticalSection QueueLock;
+	TArray<FJob> Queue;
+	int32 NextJobId = 1;
+	/** Triggered when a job is queued or the writer has to stop */
+	FEvent* QueueEvent = nullptr;
+	FRunnableThread* Thread = nullptr;
+	FThreadSafeBool bStopping;
+
+	FCriticalSection CompletionsLock;
+	TArray<TUniqueFunction<void()>> Completions;
+	FDelegateHandle TickerHandle;
+};
@@ -0,0 +1,58 @@
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+/**
+* Cached catalog of the slots of a directory, used by the load menus.
+* Only the header (and its metadata) and the table of contents of each slot are read, the chunks are never touched.
+* A slot whose header or table of contents doesn't match its checksum is listed as not valid.
+* The catalog remembers the size and modification time of every slot it has read, refreshing a directory only reads the slots that changed.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "Field/Struct/CSWAutoSaveStruct.h"
+
+class CSWAUTOSAVEANDLOADSYSTEM_API FCSWSlotCatalog
+{
+public:
+	static FCSWSlotCatalog& Get();
+
+	/** List the slots of a directory with their metadata, newest first. Thread safe */
+	void GetSlots(TArray<FCSWSlotInfo>& OutSlots, const int32 UserIndex, const bool bFilesAreCompressed, const bool bUseCustomPath, const FString& Path);
+
+	/** Get the metadata of a single slot, from the cache if the file didn't change. Thread safe */
+	bool GetSlot(FCSWSlotInfo& OutSlot, const FString& SlotName, const int32 UserIndex, const bool bFileIsCompressed, const bool bUseCustomPath, const FString& Path);
+
+	/** Forget what is cached about a slot (it was saved or deleted) */
+	void InvalidateSlot(const FString& SlotName);
+
+	/** Forget every slot */
+	void Empty();
+
+	/** Read the metadata from the header and the table of contents at the start of FileAr. The file data (name, size) is left to the caller */
+	static bool ReadSlotInfo(FArchive& FileAr, const bool bFileIsCompressed, FCSWSlotInfo& OutSlot);
+
+private:
+	struct FCachedSlot
+	{
+		FDateTime ModificationTime;
+		int64 FileSize;
+		FCSWSlotInfo Slot;
+	};
+
+	/** Directory the slots are looked for in, as used by CSWGetSaveGames() */
+	static FString GetSlotsDirectory(const bool bUseCustomPath, const FString& Path);
+
+	/** Read a slot through the save system */
+	static FCSWSlotInfo ReadSlot(const FString& SlotName, const FFileStatData& StatData, const int32 UserIndex, const bool bFileIsCompressed, const bool bUseCustomPath, const FString& Path);
+
+	FCriticalSection CacheLock;
+	/** Slots by name, for each directory + extension */
+	TMap<FString, TMap<FString, FCachedSlot>> Directories;
+};
@@ -0,0 +1,122 @@
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+/**
+* Engine and custom versions of the save games, and where they are stored when the save games only have their hash.
+* The registered custom versions are hundreds of GUID/version pairs. With compact versions (disabled by default) the preamble of the slots and journal entries
+* only has the hash of the versions of the build that wrote them: they are stored once per build and directory next to the slots ("CSWVersions/<Hash>.cver"),
+* through the save game system that writes the slots (see ICSWSaveGameSystem::SaveGameVersions()), or in the preamble itself if they can't be stored there.
+* Loading a save game of the running build doesn't read any version, the ones of other builds are read from the directory of the slot once and kept.
+* The version files must be kept with the slots: a save game of another build whose versions file is missing can't be loaded.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/EngineVersion.h"
+#include "Serialization/CustomVersion.h"
+
+/** Folder of the versions files, inside the directory of the slots */
+#define CSW_VERSIONS_FOLDER TEXT("CSWVersions/")
+/** Extension of the versions files */
+#define CSW_VERSIONS_EXTENSION TEXT(".cver")
+
+/** Directory of the slots a save game is written to or read from, the versions of its build are stored next to them */
+struct FCSWVersionsLocation
+{
+	class ICSWSaveGameSystem* SaveSystem;
+	bool bUseCustomPath;
+	FString Path;
+	int32 UserIndex;
+
+	/** Unknown directory: only the versions of the running build are found */
+	FCSWVersionsLocation()
+		: SaveSystem(nullptr)
+		, bUseCustomPath(false)
+		, UserIndex(0)
+	{}
+
+	FCSWVersionsLocation(class ICSWSaveGameSystem* InSaveSystem, const bool bInUseCustomPath, const FString& InPath, const int32 InUserIndex)
+		: SaveSystem(InSaveSystem)
+		, bUseCustomPath(bInUseCustomPath)
+		, Path(InPath)
+		, UserIndex(InUserIndex)
+	{}
+};
+
+/**
+* Engine and custom versions read from the preamble of a save game (those of the running build by default).
+* They are applied to every archive that deserializes a part of the save game.
+*/
+struct FCSWSaveGameVersions
+{
+	int32 UE4Version = GPackageFileUE4Version;
+	FEngineVersion EngineVersion = FEngineVersion::Current();
+	FCustomVersionContainer CustomVersions = FCustomVersionContainer::GetRegistered();
+
+	void ApplyTo(FArchive& Ar) const
+	{
+		Ar.SetUE4Ver(UE4Version);
+		Ar.SetEngineVer(EngineVersion);
+		Ar.SetCustomVersions(CustomVersions);
+	}
+
+	/** UE4 version, engine version, custom versions format and custom versions, as the UE4 save game preamble has them */
+	void Serialize(FArchive& Ar)
+	{
+		Ar << UE4Version;
+		Ar << EngineVersion;
+		int32 CustomVersionFormat = static_cast<int32>(ECustomVersionSerializationFormat::Latest);
+		Ar << CustomVersionFormat;
+		if (Ar.IsLoading())
+		{
+			CustomVersions.Empty();
+		}
+		CustomVersions.Serialize(Ar, static_cast<ECustomVersionSerializationFormat::Type>(CustomVersionFormat));
+	}
+};
+
+class CSWAUTOSAVEANDLOADSYSTEM_API FCSWVersionStore
+{
+public:
+	static FCSWVersionStore& Get();
+
+	/** Write only the hash of the versions in the preambles */
+	void SetUseCompactVersions(const bool bEnable);
+	bool GetUseCompactVersions() const;
+
+	/** Hash of the versions of the running build (CRC32 of their serialized bytes) */
+	uint32 GetBuildHash();
+
+	/** Write the versions file of the running build next to the slots of Location if it isn't there yet. False if it couldn't be written. Thread safe */
+	bool StoreBuildVersions(const FCSWVersionsLocation& Location);
+
+	/**
+	* The versions with this hash: the ones of the running build, the ones already read, or the ones of the versions file next to the slots of Location
+	* (if it isn't null). False if there isn't one. Thread safe
+	*/
+	bool FindVersions(const uint32 Hash, const FCSWVersionsLocation* Location, FCSWSaveGameVersions& OutVersions);
+
+	/** Name of the versions file of a hash, relative to the directory of the slots */
+	static FString GetVersionsFileName(const uint32 Hash);
+
+private:
+	/** Serialize the versions of the running build and hash them, once */
+	void InitBuildVersions();
+
+	static FString GetLocationKey(const FCSWVersionsLocation& Location);
+
+	mutable FCriticalSection StoreLock;
+	bool bUseCompactVersions = false;
+	bool bBuildVersionsInitialized = false;
+	/** Directories where the versions file of the running build was found or written (see GetLocationKey()) */
+	TSet<FString> BuildVersionsLocations;
+	uint32 BuildHash = 0;
+	TArray<uint8> BuildVersionsBytes;
+	/** Versions of other builds read from their files */
+	TMap<uint32, FCSWSaveGameVersions> StoredVersions;
+};
@@ -0,0 +1,59 @@
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+/**
+* CRC32C (Castagnoli) checksums of the slots.
+* x64 CPUs with SSE4.2 compute it with the crc32 instruction, 8 bytes at a time. Other CPUs use a slicing-by-8 table, both give the same result.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Serialization/Archive.h"
+#include "Serialization/ArchiveProxy.h"
+
+/** Size of the buffer used to checksum a range of an archive */
+#define CSW_CHECKSUM_READ_BUFFER_SIZE (256 * 1024)
+
+struct CSWAUTOSAVEANDLOADSYSTEM_API FCSWChecksum
+{
+	/** CRC32C of Data. Pass the CRC of the previous data to continue it */
+	static uint32 Crc32C(const void* Data, const int64 Num, const uint32 Crc = 0);
+
+	/** CRC32C of the next Num bytes of Ar, read through a bounded buffer. Returns false if they couldn't be read */
+	static bool Crc32C(FArchive& Ar, const int64 Num, uint32& OutCrc);
+
+	/** True if the CPU computes the CRC32C in hardware */
+	static bool HasHardwareSupport();
+};
+
+/**
+* Archive that forwards everything serialized through it to (or from) an inner archive and keeps the CRC32C of the bytes.
+* The range starts where the inner archive is when the proxy is created. Saving, the data must be serialized sequentially.
+* Loading, it can be seeked: the bytes read again after a seek back are counted once and the bytes a seek forward skips are read,
+* so the CRC is the one of the range whatever the reads.
+*/
+class CSWAUTOSAVEANDLOADSYSTEM_API FCSWArchiveChecksumProxy : public FArchiveProxy
+{
+public:
+	FCSWArchiveChecksumProxy(FArchive& InInnerArchive);
+
+	virtual void Serialize(void* Data, int64 Num) override;
+	virtual void Seek(int64 InPos) override;
+	virtual int64 Tell() override { return Position; }
+
+	/** Loading: read the bytes left up to EndPos into the CRC. False if they couldn't be read */
+	bool ChecksumTo(const int64 EndPos);
+
+	uint32 GetCrc() const { return Crc; }
+
+private:
+	uint32 Crc;
+	/** Position of the inner archive */
+	int64 Position;
+	/** End of the bytes in the CRC */
+	int64 ChecksumEnd;
+};
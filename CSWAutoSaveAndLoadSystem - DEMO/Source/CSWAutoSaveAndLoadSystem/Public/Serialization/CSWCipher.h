@@ -0,0 +1,236 @@
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+/**
+* Authenticated encryption of the slots: AES-256-GCM applied to every chunk as it's streamed to (or from) the file.
+* x64 CPUs with AES-NI and PCLMULQDQ run the cipher and the hash in hardware, other CPUs use FAES for the blocks and a 4-bit table for the hash.
+* Both give the same result, a slot encrypted on one CPU loads on the other.
+*
+* Keys are registered by ID (FCSWCipherKeyRegistry), a slot only stores the ID of its key and a random nonce.
+* Each chunk is split into segments of CSW_CIPHER_SEGMENT_SIZE bytes, each its own GCM message stored with its tag right after it:
+* its nonce is the nonce of the slot with the chunk index and the segment index mixed in, the name of the chunk and whether it's the last segment
+* are authenticated with it. A segment is verified and decrypted from a bounded buffer in the read that decodes it, and a chunk can't be cut short.
+* The tag of the last segment is stored in the table of contents.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/AES.h"
+#include "Serialization/Archive.h"
+#include "Serialization/ArchiveProxy.h"
+#include "Templates/SharedPointer.h"
+#include "HAL/CriticalSection.h"
+
+/** AES-256 */
+#define CSW_CIPHER_KEY_SIZE 32
+#define CSW_CIPHER_BLOCK_SIZE 16
+#define CSW_CIPHER_NONCE_SIZE 12
+#define CSW_CIPHER_TAG_SIZE 16
+
+/** Bytes of the chunk in each segment, its tag is stored after them */
+#define CSW_CIPHER_SEGMENT_SIZE (64 * 1024)
+
+/**
+* A registered key with everything derived from it (round keys, hash key and its tables). Immutable, shared by every thread.
+*/
+class CSWAUTOSAVEANDLOADSYSTEM_API FCSWCipherKey
+{
+public:
+	/** Key has CSW_CIPHER_KEY_SIZE bytes. Without bAllowHardware the key always runs on the software path (to test it on any CPU) */
+	FCSWCipherKey(const uint32 InKeyId, const uint8* Key, const bool bAllowHardware = true);
+	~FCSWCipherKey();
+
+	uint32 GetKeyId() const { return KeyId; }
+
+	/** True if the key runs AES and GHASH in hardware */
+	bool UsesHardware() const { return bHardware; }
+
+private:
+	/** Encrypt one block */
+	void EncryptBlock(const uint8* In, uint8* Out) const;
+
+	/** Counter mode: Dst = Src ^ AES(Nonce || InOutCounter++) for NumBlocks blocks. Src and Dst can be the same buffer */
+	void EncryptBlocksCtr(const uint8* Nonce, uint32& InOutCounter, const uint8* Src, uint8* Dst, const int64 NumBlocks) const;
+
+	/** GHASH: InOutState = (InOutState ^ Block) * H for NumBlocks blocks */
+	void Ghash(uint8* InOutState, const uint8* Data, const int64 NumBlocks) const;
+
+	uint32 KeyId;
+	bool bHardware;
+	/** Key of the software path */
+	FAES::FAESKey EngineKey;
+	/** Expanded key of the hardware path */
+	uint8 RoundKeys[15 * CSW_CIPHER_BLOCK_SIZE];
+	/** H, the encryption of a zero block */
+	uint8 HashKey[CSW_CIPHER_BLOCK_SIZE];
+	/** Multiples of H by every 4-bit value, for the software GHASH */
+	uint64 HashTableHigh[16];
+	uint64 HashTableLow[16];
+
+	friend class FCSWAesGcm;
+};
+
+typedef TSharedPtr<const FCSWCipherKey, ESPMode::ThreadSafe> FCSWCipherKeyPtr;
+
+/**
+* One AES-256-GCM message, encrypted or decrypted in pieces of any size.
+* The authenticated data (AddAuthenticatedData()) must be added before the first byte of the message.
+*/
+class CSWAUTOSAVEANDLOADSYSTEM_API FCSWAesGcm
+{
+public:
+	/** Nonce has CSW_CIPHER_NONCE_SIZE bytes. The key must outlive the message */
+	FCSWAesGcm(const FCSWCipherKey& InKey, const uint8* InNonce);
+
+	/** Authenticate data that isn't part of the message */
+	void AddAuthenticatedData(const uint8* Data, const int64 Num);
+
+	/** Encrypt Num bytes of Src into Dst (can be the same buffer) and authenticate them */
+	void Encrypt(const uint8* Src, uint8* Dst, const int64 Num);
+
+	/** Authenticate Num bytes of Src and decrypt them into Dst (can be the same buffer) */
+	void Decrypt(const uint8* Src, uint8* Dst, const int64 Num);
+
+	/** Authenticate encrypted data without decrypting it, to check the tag of a message before anything of it is used */
+	void Authenticate(const uint8* Data, const int64 Num);
+
+	/** Tag of everything authenticated so far (CSW_CIPHER_TAG_SIZE bytes) */
+	void Finish(uint8* OutTag);
+
+	/** Compare the tag of everything authenticated so far with ExpectedTag, in constant time */
+	bool FinishAndVerify(const uint8* ExpectedTag);
+
+	/** True if the CPU runs AES and GHASH in hardware */
+	static bool HasHardwareSupport();
+
+	/** New random nonce for a slot. It's never reused with the same key in practice (96 random bits) */
+	static void GenerateNonce(uint8* OutNonce);
+
+	/** Nonce of a chunk of a slot: the slot nonce with the chunk index mixed in */
+	static void MakeChunkNonce(const uint8* SlotNonce, const uint32 ChunkIndex, uint8* OutNonce);
+
+	/** Nonce of a segment of a chunk: the chunk nonce with the segment index mixed in */
+	static void MakeSegmentNonce(const uint8* ChunkNonce, const uint32 SegmentIndex, uint8* OutNonce);
+
+private:
+	/** Xor Num bytes of Src with the keystream into Dst, without authenticating them */
+	void ApplyKeystream(const uint8* Src, uint8* Dst, int64 Num);
+
+	/** Feed GHASH, buffering the partial block */
+	void Hash(const uint8* Data, int64 Num);
+
+	/** Pad and hash the partial block */
+	void FlushHashBlock();
+
+	const FCSWCipherKey& Key;
+	uint8 Nonce[CSW_CIPHER_NONCE_SIZE];
+	/** Counter of the next keystream block */
+	uint32 Counter;
+	/** Keystream of a block the message stopped in the middle of, KeystreamUsed bytes of it are used */
+	uint8 Keystream[CSW_CIPHER_BLOCK_SIZE];
+	int32 KeystreamUsed;
+	uint8 HashState[CSW_CIPHER_BLOCK_SIZE];
+	uint8 HashBlock[CSW_CIPHER_BLOCK_SIZE];
+	int32 HashBlockSize;
+	int64 AuthenticatedDataSize;
+	int64 MessageSize;
+	bool bHashingMessage;
+};
+
+/**
+* Registry of the encryption keys, indexed by the key ID stored in the slots.
+*/
+class CSWAUTOSAVEANDLOADSYSTEM_API FCSWCipherKeyRegistry
+{
+public:
+	static FCSWCipherKeyRegistry& Get();
+
+	/**
+	* Register (or replace) the key KeyId. If bUseForSaving, slots are encrypted with it from now on.
+	* False if KeyId is 0 or the Key isn't CSW_CIPHER_KEY_SIZE bytes.
+	*/
+	bool RegisterKey(const uint32 KeyId, const TArray<uint8>& Key, const bool bUseForSaving = true);
+	void UnregisterKey(const uint32 KeyId);
+
+	/** Find a key, null if it isn't registered */
+	FCSWCipherKeyPtr FindKey(const uint32 KeyId) const;
+
+	/** Encrypt the slots saved from now on with KeyId, 0 saves them unencrypted. False if the key isn't registered */
+	bool SetSavingKey(const uint32 KeyId);
+
+	/** Key the slots are encrypted with, null if they are saved unencrypted */
+	FCSWCipherKeyPtr GetSavingKey() const;
+
+private:
+	mutable FCriticalSection KeysLock;
+	TMap<uint32, FCSWCipherKeyPtr> Keys;
+	uint32 SavingKeyId = 0;
+};
+
+/**
+* Archive that encrypts everything serialized into it as segments and forwards them to an inner archive.
+* The data is encrypted in a bounded buffer on its way to the inner archive, the serialized memory isn't modified.
+*/
+class CSWAUTOSAVEANDLOADSYSTEM_API FCSWArchiveEncryptProxy : public FArchiveProxy
+{
+public:
+	/** ChunkNonce has CSW_CIPHER_NONCE_SIZE bytes, ChunkName is authenticated with every segment. The key must outlive the archive */
+	FCSWArchiveEncryptProxy(FArchive& InInnerArchive, const FCSWCipherKey& InKey, const uint8* InChunkNonce, const FString& ChunkName);
+
+	virtual void Serialize(void* Data, int64 Num) override;
+
+	/** Write the last segment. OutTag is its tag (CSW_CIPHER_TAG_SIZE bytes) */
+	void Finish(uint8* OutTag);
+
+private:
+	/** Encrypt the buffered segment and write it with its tag */
+	void WriteSegment(const bool bLast, uint8* OutTag);
+
+	const FCSWCipherKey& Key;
+	uint8 ChunkNonce[CSW_CIPHER_NONCE_SIZE];
+	TArray<uint8> AuthenticatedData;
+	/** The segment being filled and room for its tag */
+	TArray<uint8> Segment;
+	int32 SegmentSize;
+	uint32 SegmentIndex;
+};
+
+/**
+* Archive that reads the segments of a chunk from an inner archive, verifying and decrypting each one in a bounded buffer before any byte of it is used.
+* A segment whose tag doesn't match puts the archive in error.
+* The chunk starts where the inner archive is when the proxy is created. Tell() and Seek() use the positions the chunk would have unencrypted.
+*/
+class CSWAUTOSAVEANDLOADSYSTEM_API FCSWArchiveDecryptProxy : public FArchiveProxy
+{
+public:
+	/** StoredSize is the size of the chunk in the inner archive, segments and tags included */
+	FCSWArchiveDecryptProxy(FArchive& InInnerArchive, const FCSWCipherKey& InKey, const uint8* InChunkNonce, const FString& ChunkName, const int64 InStoredSize);
+
+	virtual void Serialize(void* Data, int64 Num) override;
+	virtual void Seek(int64 InPos) override { Position = InPos - ChunkStart; }
+	virtual int64 Tell() override { return ChunkStart + Position; }
+
+	/** Check the tag of every segment without decrypting them. False if one doesn't match */
+	bool VerifySegments();
+
+private:
+	/** Read a segment into the buffer and check its tag, decrypting it in the same pass if bDecrypt */
+	bool ReadSegment(const int32 Index, const bool bDecrypt);
+
+	const FCSWCipherKey& Key;
+	uint8 ChunkNonce[CSW_CIPHER_NONCE_SIZE];
+	TArray<uint8> AuthenticatedData;
+	int64 ChunkStart;
+	int64 StoredSize;
+	int32 NumSegments;
+	/** The decrypted segment and its index, INDEX_NONE if there's none */
+	TArray<uint8> Segment;
+	int32 SegmentIndex;
+	int32 SegmentSize;
+	/** Position in the decrypted chunk */
+	int64 Position;
+};
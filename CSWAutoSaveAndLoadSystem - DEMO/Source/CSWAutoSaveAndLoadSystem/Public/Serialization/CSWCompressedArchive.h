@@ -0,0 +1,121 @@
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+/**
+* Streaming compression archives used by the save pipeline.
+* Unlike FArchiveSaveCompressedProxy/FArchiveLoadCompressedProxy, these archives never hold the whole payload:
+* data is cut into fixed-size blocks that are compressed and written to (or read from and decompressed out of) the inner archive one by one.
+*
+* Block stream layout: { int32 UncompressedSize, int32 CompressedSize, uint8[CompressedSize] }* followed by a { 0, 0 } terminator.
+* A block whose CompressedSize equals its UncompressedSize is stored raw.
+* The streams keep a few blocks in flight and compress (or decompress) them in parallel on the task graph.
+*
+* Block buffer layout (FCSWBlockCompression, used for arrays of bytes):
+* { int32 Magic, int32 Codec, [uint32 DictionaryId if Codec is ZlibDictionary], int32 BlockSize, int64 UncompressedSize, int32 NumBlocks, int32[NumBlocks] CompressedSizes, blocks }
+* The index of compressed sizes lets every block be decompressed in parallel.
+* Buffers with the first magic (CSW_BLOCK_BUFFER_MAGIC) have no Codec field and are always Zlib.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Serialization/Archive.h"
+#include "Serialization/CSWCompressionCodec.h"
+
+/** Default size of the uncompressed blocks of a compressed stream */
+#define CSW_COMPRESSED_STREAM_BLOCK_SIZE (256 * 1024)
+
+/** Max number of blocks compressed or decompressed at the same time by a stream (bounds its memory) */
+#define CSW_COMPRESSED_STREAM_MAX_BLOCKS_IN_FLIGHT 8
+
+/** Identifies buffers compressed by FCSWBlockCompression with Zlib ("CSWB") */
+#define CSW_BLOCK_BUFFER_MAGIC 0x42575343
+/** Identifies buffers compressed by FCSWBlockCompression that store their codec ("CSWC") */
+#define CSW_BLOCK_BUFFER_CODEC_MAGIC 0x43575343
+
+/**
+* Compression of whole buffers cut into fixed-size blocks, compressed and decompressed in parallel on the task graph.
+*/
+struct CSWAUTOSAVEANDLOADSYSTEM_API FCSWBlockCompression
+{
+	/** Compress Data into a block buffer with the codec CodecID (Zlib if it isn't registered) */
+	static bool CompressBlocks(const uint8* Data, const int64 DataSize, TArray<uint8>& OutCompressed, ECSWCompressionCodec CodecID, const int32 BlockSize = CSW_COMPRESSED_STREAM_BLOCK_SIZE);
+
+	/** Decompress a block buffer written by CompressBlocks(), the codec is read from the buffer */
+	static bool UncompressBlocks(const TArray<uint8>& Compressed, TArray<uint8>& OutData);
+
+	/** Does the Buffer start like a block buffer? */
+	static bool IsBlockBuffer(const TArray<uint8>& Buffer);
+
+	/** Number of blocks a stream keeps in flight, based on the number of task graph workers */
+	static int32 GetNumBlocksInFlight();
+};
+
+/**
+* Archive that compresses everything serialized into it and writes it to an inner archive in bounded-size blocks.
+* Close() must be called to write the last block and the terminator.
+*/
+class CSWAUTOSAVEANDLOADSYSTEM_API FCSWArchiveSaveCompressedStream : public FArchive
+{
+public:
+	FCSWArchiveSaveCompressedStream(FArchive& InInnerArchive, const FCSWCompressionCodecRef& InCodec, const int32 InBlockSize = CSW_COMPRESSED_STREAM_BLOCK_SIZE);
+	virtual ~FCSWArchiveSaveCompressedStream();
+
+	virtual void Serialize(void* Data, int64 Num) override;
+	virtual void Flush() override;
+	virtual bool Close() override;
+	virtual int64 Tell() override { return Position; }
+	virtual int64 TotalSize() override { return Position; }
+	virtual FString GetArchiveName() const override { return TEXT("FCSWArchiveSaveCompressedStream"); }
+
+private:
+	/** Compress the pending blocks in parallel and write them to the inner archive */
+	void WritePendingBlocks();
+
+	FArchive& InnerArchive;
+	FCSWCompressionCodecRef Codec;
+	int32 BlockSize;
+	int32 NumBlocksInFlight;
+	/** Uncompressed data waiting to be compressed (never bigger than BlockSize * NumBlocksInFlight) */
+	TArray<uint8> PendingData;
+	/** Scratch buffers reused for every batch of compressed blocks */
+	TArray<TArray<uint8>> CompressedBlocks;
+	int64 Position;
+	bool bClosed;
+};
+
+/**
+* Archive that reads a block stream written by FCSWArchiveSaveCompressedStream from an inner archive, decompressing one block at a time.
+*/
+class CSWAUTOSAVEANDLOADSYSTEM_API FCSWArchiveLoadCompressedStream : public FArchive
+{
+public:
+	FCSWArchiveLoadCompressedStream(FArchive& InInnerArchive, const FCSWCompressionCodecRef& InCodec);
+
+	virtual void Serialize(void* Data, int64 Num) override;
+	virtual int64 Tell() override { return Position; }
+	virtual FString GetArchiveName() const override { return TEXT("FCSWArchiveLoadCompressedStream"); }
+
+	/** Skip what is left of the stream so the inner archive points right after the terminator */
+	void SkipToEnd();
+
+private:
+	/** Read the next blocks and decompress them in parallel. Returns false at the end of the stream or on error */
+	bool ReadNextBlocks();
+
+	FArchive& InnerArchive;
+	FCSWCompressionCodecRef Codec;
+	int32 NumBlocksInFlight;
+	/** Decompressed blocks of the current batch, the block being read and the read offset inside it */
+	TArray<TArray<uint8>> Blocks;
+	int32 NumBlocks;
+	int32 BlockIndex;
+	int32 BlockOffset;
+	/** Scratch buffers reused for every batch of compressed blocks */
+	TArray<TArray<uint8>> CompressedBlocks;
+	int64 Position;
+	bool bEndOfStream;
+};
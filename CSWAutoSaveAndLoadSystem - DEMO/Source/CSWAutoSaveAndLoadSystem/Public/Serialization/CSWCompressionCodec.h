@@ -0,0 +1,121 @@
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+/**
+* Compression codecs used by the save pipeline.
+* Zlib, Gzip, ZlibFast and Custom are registered by default on top of FCompression.
+* ZlibDictionary is registered with RegisterDictionary() once a trained dictionary is loaded (see FCSWCompressionDictionary).
+* Other codecs (ex. LZ4) can be registered by the project, usually in the StartupModule() of a game module.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/Compression.h"
+#include "Templates/SharedPointer.h"
+#include "HAL/CriticalSection.h"
+#include "Field/Enum/CSWAutoSaveEnum.h"
+
+/**
+* A codec compresses and decompresses independent blocks of memory.
+* It's used from several threads at the same time, so it must be thread safe.
+*/
+class CSWAUTOSAVEANDLOADSYSTEM_API ICSWCompressionCodec
+{
+public:
+	virtual ~ICSWCompressionCodec() {}
+
+	/** Max size of the compressed data of a block of UncompressedSize bytes */
+	virtual int32 CompressMemoryBound(const int32 UncompressedSize) const = 0;
+
+	/** Compress Src into Dst. CompressedSize is the size of Dst on input and the size of the compressed data on output */
+	virtual bool CompressMemory(void* Dst, int32& CompressedSize, const void* Src, const int32 UncompressedSize) const = 0;
+
+	/** Decompress Src into Dst, which has exactly the uncompressed size */
+	virtual bool UncompressMemory(void* Dst, const int32 UncompressedSize, const void* Src, const int32 CompressedSize) const = 0;
+
+	/** ID of the dictionary the codec compresses with, 0 if it doesn't use one */
+	virtual uint32 GetDictionaryId() const { return 0; }
+};
+
+typedef TSharedRef<const ICSWCompressionCodec, ESPMode::ThreadSafe> FCSWCompressionCodecRef;
+typedef TSharedPtr<const ICSWCompressionCodec, ESPMode::ThreadSafe> FCSWCompressionCodecPtr;
+
+/**
+* Codec on top of FCompression and its ECompressionFlags.
+*/
+class CSWAUTOSAVEANDLOADSYSTEM_API FCSWEngineCompressionCodec : public ICSWCompressionCodec
+{
+public:
+	explicit FCSWEngineCompressionCodec(ECompressionFlags InCompressionFlags) : CompressionFlags(InCompressionFlags) {}
+
+	virtual int32 CompressMemoryBound(const int32 UncompressedSize) const override;
+	virtual bool CompressMemory(void* Dst, int32& CompressedSize, const void* Src, const int32 UncompressedSize) const override;
+	virtual bool UncompressMemory(void* Dst, const int32 UncompressedSize, const void* Src, const int32 CompressedSize) const override;
+
+private:
+	ECompressionFlags CompressionFlags;
+};
+
+/**
+* Zlib with a preset dictionary. Blocks that repeat the content of the dictionary (property tags, class paths...) compress much better,
+* small blocks in particular.
+*/
+class CSWAUTOSAVEANDLOADSYSTEM_API FCSWZlibDictionaryCodec : public ICSWCompressionCodec
+{
+public:
+	FCSWZlibDictionaryCodec(const TArray<uint8>& InDictionary, const uint32 InDictionaryId) : Dictionary(InDictionary), DictionaryId(InDictionaryId) {}
+
+	virtual int32 CompressMemoryBound(const int32 UncompressedSize) const override;
+	virtual bool CompressMemory(void* Dst, int32& CompressedSize, const void* Src, const int32 UncompressedSize) const override;
+	virtual bool UncompressMemory(void* Dst, const int32 UncompressedSize, const void* Src, const int32 CompressedSize) const override;
+	virtual uint32 GetDictionaryId() const override { return DictionaryId; }
+
+private:
+	const TArray<uint8> Dictionary;
+	const uint32 DictionaryId;
+};
+
+/**
+* Registry of the codecs, indexed by the codec ID stored in the save games.
+*/
+class CSWAUTOSAVEANDLOADSYSTEM_API FCSWCompressionCodecRegistry
+{
+public:
+	static FCSWCompressionCodecRegistry& Get();
+
+	/** Register (or replace) the codec used for CodecID */
+	void RegisterCodec(const ECSWCompressionCodec CodecID, const FCSWCompressionCodecRef& Codec);
+	void UnregisterCodec(const ECSWCompressionCodec CodecID);
+
+	/** Find the codec of CodecID, null for ECSWCompressionCodec::None or if no codec is registered for it */
+	FCSWCompressionCodecPtr FindCodec(const ECSWCompressionCodec CodecID) const;
+
+	/** Find the codec of InOutCodecID, falling back to Zlib (with a warning) if it isn't registered. InOutCodecID is the codec that will be used. Used when saving */
+	FCSWCompressionCodecPtr FindCodecOrDefault(ECSWCompressionCodec& InOutCodecID) const;
+
+	/**
+	* Register a trained dictionary, returns its ID (the one stored in the save games).
+	* If bUseForSaving, ECSWCompressionCodec::ZlibDictionary compresses with it from now on.
+	*/
+	uint32 RegisterDictionary(const TArray<uint8>& Dictionary, const bool bUseForSaving = true);
+
+	/** Find the ZlibDictionary codec of a dictionary, null if it isn't registered */
+	FCSWCompressionCodecPtr FindDictionaryCodec(const uint32 DictionaryId) const;
+
+	/** Find the codec that decompresses data written with CodecID (and DictionaryId for ECSWCompressionCodec::ZlibDictionary) */
+	FCSWCompressionCodecPtr FindCodecForLoading(const ECSWCompressionCodec CodecID, const uint32 DictionaryId) const;
+
+	/** Is CodecID a value this version of the plugin knows about? */
+	static bool IsKnownCodec(const uint8 CodecID) { return CodecID <= static_cast<uint8>(ECSWCompressionCodec::ZlibDictionary); }
+
+private:
+	FCSWCompressionCodecRegistry();
+
+	mutable FCriticalSection CodecsLock;
+	TMap<uint8, FCSWCompressionCodecRef> Codecs;
+	TMap<uint32, FCSWCompressionCodecRef> DictionaryCodecs;
+};
@@ -0,0 +1,38 @@
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+/**
+* Offline training of compression dictionaries for ECSWCompressionCodec::ZlibDictionary.
+* The samples are the serialized actor records of a corpus of save games: their property tags, class paths and layouts repeat a lot between actors,
+* a dictionary made of the most repeated segments lets zlib reference them from the first byte of every block.
+*
+* Dictionary file layout (.cswdict): { int32 Magic, uint32 DictionaryId, TArray<uint8> Dictionary }
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Identifies dictionary files ("CSWD") */
+#define CSW_DICTIONARY_FILE_MAGIC 0x44575343
+
+/** Zlib only looks back 32KB, bigger dictionaries are useless */
+#define CSW_DICTIONARY_MAX_SIZE (32 * 1024)
+
+struct CSWAUTOSAVEANDLOADSYSTEM_API FCSWCompressionDictionary
+{
+	/**
+	* Build a dictionary from Samples: the corpus is cut into one epoch per segment of the dictionary and the segment of each epoch
+	* whose 8-byte sequences appear in the most samples is kept. The best segments go at the end of the dictionary, where zlib finds them cheaper.
+	*/
+	static TArray<uint8> Train(const TArray<TArray<uint8>>& Samples, const int32 MaxDictionarySize = CSW_DICTIONARY_MAX_SIZE);
+
+	/** ID stored in the save games compressed with the Dictionary */
+	static uint32 GetDictionaryId(const TArray<uint8>& Dictionary);
+
+	static bool SaveToFile(const TArray<uint8>& Dictionary, const FString& FilePath);
+	static bool LoadFromFile(const FString& FilePath, TArray<uint8>& OutDictionary);
+};
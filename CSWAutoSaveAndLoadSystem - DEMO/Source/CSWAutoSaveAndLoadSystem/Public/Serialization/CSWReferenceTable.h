@@ -0,0 +1,116 @@
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+/**
+* Per save game tables of the names and objects referenced by the data of the actors and components.
+* FCSWSaveGameArchive writes every FName and UObject* as a string. With the tables, each name and object path is stored once in the save game
+* (UCSWAutoSaveObject::ReferenceTable) and the data only has its index (an uint32). Every object is resolved once per load instead of once per reference.
+*
+* Where the indices are in the data is listed after its values (FCSWReferenceList), so the data can move to another table without being decoded:
+* the table is rebuilt from the records each time the save game is saved (only what they still reference is kept), and the levels kept
+* by CSWLoadLevelsFromSlot() are moved to the table of the slot loaded.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+#include "Field/Struct/CSWAutoSaveStruct.h"
+#include "CSWReferenceTable.generated.h"
+
+/**
+* The names and object paths referenced by the data of a save game.
+*/
+USTRUCT()
+struct CSWAUTOSAVEANDLOADSYSTEM_API FCSWReferenceTable
+{
+	GENERATED_USTRUCT_BODY()
+
+	/**
+	* The names, by index
+	*/
+	UPROPERTY(SaveGame)
+		TArray<FName> Names;
+	/**
+	* The path names of the objects, by index
+	*/
+	UPROPERTY(SaveGame)
+		TArray<FString> ObjectPaths;
+
+	FCSWReferenceTable()
+	{
+
+	}
+
+	/** Index of a name, added if it isn't in the table */
+	uint32 AddName(const FName& Name);
+
+	/** Index of an object, added if it isn't in the table. Objects are indexed from 1, 0 is null */
+	uint32 AddObject(UObject* Object);
+
+	/** Index of an object by its path name, added if it isn't in the table */
+	uint32 AddObjectPath(const FString& ObjectPath);
+
+	/** NAME_None if the index isn't in the table */
+	FName GetName(const uint32 Index) const;
+
+	/** The object of an index, found (or loaded if bLoadIfFindFails) the first time and cached. Objects that aren't found are looked for again */
+	UObject* ResolveObject(const uint32 Index, const bool bLoadIfFindFails) const;
+
+	/** Forget the resolved objects. Called before loading the actors, so the objects are resolved once per load */
+	void ResetResolvedObjects() const;
+
+	/** Rebuild the indices and forget the resolved objects. Called once the tables were loaded */
+	void OnLoaded();
+
+private:
+	/** Rebuild the indices after the tables were loaded */
+	void BuildIndices();
+
+	TMap<FName, int32> NameIndices;
+	TMap<FString, int32> ObjectIndices;
+	/** Objects already added, so their path name is only built once */
+	TMap<TWeakObjectPtr<UObject>, int32> ObjectPointerIndices;
+	mutable TArray<TWeakObjectPtr<UObject>> ResolvedObjects;
+};
+
+/**
+* Where the indices of the names and objects are in data written with a FCSWReferenceTableArchive (offsets from the start of the data).
+* Stored as { int32 NumNames, offsets, int32 NumObjects, offsets }, each offset a varint of the distance from the previous one.
+*/
+struct CSWAUTOSAVEANDLOADSYSTEM_API FCSWReferenceList
+{
+	TArray<int32, TInlineAllocator<16>> NameOffsets;
+	TArray<int32, TInlineAllocator<16>> ObjectOffsets;
+
+	/**
+	* Move the indices of Data from the table From to the table To, adding the names and objects To doesn't have.
+	* Data keeps its size. Returns false if an offset is outside Data, the indices that aren't in From become NAME_None and null.
+	*/
+	bool Remap(TArray<uint8>& Data, const FCSWReferenceTable& From, FCSWReferenceTable& To) const;
+
+	friend CSWAUTOSAVEANDLOADSYSTEM_API FArchive& operator<<(FArchive& Ar, FCSWReferenceList& List);
+};
+
+/**
+* FCSWSaveGameArchive that writes names and objects as indices of a FCSWReferenceTable.
+* Saving adds to the table and to the reference list, loading resolves through the table.
+*/
+struct CSWAUTOSAVEANDLOADSYSTEM_API FCSWReferenceTableArchive : public FCSWSaveGameArchive
+{
+	/** Saving */
+	FCSWReferenceTableArchive(FArchive& InInnerArchive, FCSWReferenceTable& InTable, FCSWReferenceList& InReferences);
+	/** Loading */
+	FCSWReferenceTableArchive(FArchive& InInnerArchive, bool bInLoadIfFindFails, const FCSWReferenceTable& InTable);
+
+	virtual FArchive& operator<<(FName& N) override;
+	virtual FArchive& operator<<(UObject*& Obj) override;
+
+private:
+	const FCSWReferenceTable& Table;
+	FCSWReferenceTable* MutableTable;
+	FCSWReferenceList* References;
+};
@@ -0,0 +1,193 @@
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+/**
+* Compiled save plans: the SaveGame variables of a class flattened once into a list of offsets, sizes and serializers.
+* The data of actors and components is written with the plan of their class instead of as tagged properties: there are no names, types or sizes
+* per variable, and numeric variables that are next to each other in memory are copied as a single block.
+*
+* Planned data layout: { uint32 Magic, uint32 LayoutHash, uint8 Flags, [presence bits], values in the order of the plan }.
+* Numeric values are raw bytes and bools a byte. Anything else (names, strings, objects, structs, containers) is prefixed with its int32 size and
+* serialized by its property, like the tagged path does.
+* Delta data (ECSWSavePlanFlags::Delta) only has the variables that differ from the archetype of the object (its class default object, or the
+* template of a component): a bit per variable of the layout tells which ones are saved, the others get the value of the archetype when loaded.
+*
+* The layouts used by the records of a save game are stored in it (UCSWAutoSaveObject::ClassLayouts), so data saved before a class changed
+* is loaded variable by variable, matching them by name and type. Data without the magic is tagged (older saves) and loaded with UObject::Serialize().
+* With the reference tables enabled, the names and objects in the values are indices of the FCSWReferenceTable of the save game (ECSWSavePlanFlags::ReferenceTable).
+* The header of that data has an int32 offset more, where the values end and the FCSWReferenceList of the indices starts.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Class.h"
+#include "UObject/UnrealType.h"
+#include "UObject/WeakObjectPtr.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/SharedPointer.h"
+#include "Field/Struct/CSWAutoSaveStruct.h"
+
+/** Identifies the data written with a save plan ("CSWV"). Tagged data starts with the length of a property name and can't be mistaken for it */
+#define CSW_SAVE_PLAN_MAGIC 0x56575343
+/** Magic + layout hash + flags */
+#define CSW_SAVE_PLAN_HEADER_SIZE 9
+
+namespace ECSWSavePlanFlags
+{
+	enum Type : uint8
+	{
+		None = 0,
+		/** The names and objects are indices of the FCSWReferenceTable of the save game */
+		ReferenceTable = 1 << 0,
+		/** Only the variables that differ from the archetype are saved, after their presence bits */
+		Delta = 1 << 1,
+	};
+}
+
+/** What the start of planned data tells */
+struct FCSWSavePlanHeader
+{
+	uint32 LayoutHash = 0;
+	uint8 Flags = ECSWSavePlanFlags::None;
+	/** Where the values start */
+	int32 Size = CSW_SAVE_PLAN_HEADER_SIZE;
+	/** Where the FCSWReferenceList starts (ECSWSavePlanFlags::ReferenceTable), INDEX_NONE otherwise */
+	int32 ReferencesOffset = INDEX_NONE;
+};
+
+/** One step of a save plan */
+struct FCSWSavePlanStep
+{
+	enum class EKind : uint8
+	{
+		/** Size raw bytes at Offset (one or more numeric variables) */
+		Raw,
+		/** A bool (maybe a bitfield), saved as a byte */
+		Bool,
+		/** Any other variable, serialized by its property and prefixed with its size */
+		Item
+	};
+
+	EKind Kind = EKind::Raw;
+	int32 Offset = 0;
+	int32 Size = 0;
+	UProperty* Property = nullptr;
+};
+
+/**
+* The save plan of a class. Immutable once built, shared by every thread.
+*/
+class CSWAUTOSAVEANDLOADSYSTEM_API FCSWSavePlan
+{
+public:
+	explicit FCSWSavePlan(UClass* Class);
+
+	uint32 GetLayoutHash() const { return Layout.LayoutHash; }
+	const FCSWClassLayout& GetLayout() const { return Layout; }
+
+	/** Still the layout of Class. The variables of a blueprint recompiled in the editor are new properties */
+	bool IsValidFor(const UClass* Class) const;
+
+	/**
+	* Write the values of the variables of Object (without the header).
+	* If Defaults isn't null (see CanBeDefaultsOf()), only the presence bits and the variables that differ from it are written.
+	*/
+	void Save(UObject* Object, FArchive& Ar, const UObject* Defaults = nullptr) const;
+
+	/** Read values written by Save() with this same layout. bDelta if they were written with defaults, the missing ones are copied from Defaults then */
+	void Load(UObject* Object, FArchive& Ar, const bool bDelta = false, const UObject* Defaults = nullptr) const;
+
+	/** Read values written with another layout of the class: the variables are matched by name and type, the others are skipped */
+	void LoadFromLayout(UObject* Object, FArchive& Ar, const FCSWClassLayout& SavedLayout, const bool bDelta = false, const UObject* Defaults = nullptr) const;
+
+	/** Defaults has the variables of Object at the same offsets */
+	static bool CanBeDefaultsOf(const UObject* Defaults, const UObject* Object);
+
+private:
+	static void SaveStep(const FCSWSavePlanStep& Step, uint8* Base, FArchive& Ar);
+	static void LoadStep(const FCSWSavePlanStep& Step, uint8* Base, FArchive& Ar);
+	/** Copy the value of a variable from Defaults */
+	static void CopyDefault(const FCSWSavePlanStep& Step, UObject* Object, const UObject* Defaults);
+
+	TWeakObjectPtr<UClass> PlannedClass;
+	const UProperty* PropertyLink;
+	int32 PropertiesSize;
+	/** A step per variable, sorted by offset. Used to load other layouts */
+	TArray<FCSWSavePlanStep> PropertySteps;
+	/** The steps of the variables with the contiguous numeric ones merged. Used to save and to load the same layout */
+	TArray<FCSWSavePlanStep> Steps;
+	/** Index of each variable in PropertySteps by name */
+	TMap<FName, int32> PropertyIndices;
+	FCSWClassLayout Layout;
+};
+
+typedef TSharedPtr<const FCSWSavePlan, ESPMode::ThreadSafe> FCSWSavePlanPtr;
+
+struct FCSWReferenceTable;
+
+/**
+* The save plans of the classes, built on first use, and every layout known (the ones of the plans and the ones read from save games). Thread safe.
+*/
+class CSWAUTOSAVEANDLOADSYSTEM_API FCSWSavePlanCache
+{
+public:
+	static FCSWSavePlanCache& Get();
+
+	/** Save with the plans (enabled by default). When disabled, the data is tagged. Data saved with a plan can always be loaded */
+	void SetEnabled(const bool bEnable);
+	bool IsEnabled() const;
+
+	/** Write the names and objects of the planned data as indices of the reference table of the save game (disabled by default) */
+	void SetUseReferenceTables(const bool bEnable);
+	bool GetUseReferenceTables() const;
+
+	/** Only save the variables that differ from the archetype of the object (enabled by default) */
+	void SetUseDeltaFromDefaults(const bool bEnable);
+	bool GetUseDeltaFromDefaults() const;
+
+	/** Plan of a class, built if it isn't cached or the class changed */
+	FCSWSavePlanPtr FindOrBuild(UClass* Class);
+
+	/** Remember layouts read from a save game */
+	void RegisterLayouts(const TArray<FCSWClassLayout>& Layouts);
+	bool FindLayout(const uint32 LayoutHash, FCSWClassLayout& OutLayout) const;
+
+	/** The layouts used by the data of the records (actors and components), to be stored with them */
+	void CollectLayouts(const TArray<FCSWMapRecord>& LevelsRecord, TArray<FCSWClassLayout>& OutLayouts) const;
+
+	/** Serialize the SaveGame variables of Object into OutData, with the plan of its class if enabled. Table is the reference table of the save game, if there's one */
+	void SaveObject(UObject* Object, TArray<uint8>& OutData, FCSWReferenceTable* Table = nullptr);
+
+	/** Restore the SaveGame variables of Object from Data, planned or tagged. Table is the reference table of the save game the data comes from */
+	void LoadObject(UObject* Object, const TArray<uint8>& Data, const FCSWReferenceTable* Table = nullptr);
+
+	/**
+	* Hash of the values of the SaveGame variables of Object, to tell if they changed since it was saved. The values are written as the plan saves them
+	* into Scratch (names and objects by identity) and checksummed, starting from Crc
+	*/
+	uint32 HashObject(UObject* Object, TArray<uint8>& Scratch, const uint32 Crc = 0);
+
+	/** Header of planned data, false if the data is tagged */
+	static bool ReadHeader(const TArray<uint8>& Data, FCSWSavePlanHeader& OutHeader);
+
+	/**
+	* Move data written with the reference table From to the table To (see FCSWReferenceList::Remap()). Data without the table is left as it is.
+	* Returns false if the data is damaged.
+	*/
+	static bool RemapReferences(TArray<uint8>& Data, const FCSWReferenceTable& From, FCSWReferenceTable& To);
+
+	/** Move the data of the actor and component records of a level to the table To */
+	static void RemapReferences(FCSWMapRecord& MapRecord, const FCSWReferenceTable& From, FCSWReferenceTable& To);
+
+private:
+	mutable FCriticalSection CacheLock;
+	bool bEnabled = true;
+	bool bUseReferenceTables = false;
+	bool bUseDeltaFromDefaults = true;
+	TMap<const UClass*, FCSWSavePlanPtr> Plans;
+	TMap<uint32, FCSWClassLayout> Layouts;
+};
@@ -0,0 +1,56 @@
+/**
+* Copyright (c) 2018 Cronofear Softworks, Inc. All Rights Reserved.
+*
+* Developed by Kevin Yabar Garces
+*/
+
+/**
+* Compact actor records: the actor records are written to the slots with their transforms and velocities in a pose block apart from the tagged properties.
+* Only the fields of the components captured when they were saved are stored (FCSWActorComponentRecord::Fields), a presence byte per component tells which.
+* The records of the actors whose CSWAutoSaveComponent has a transform precision other than Full also have them quantized,
+* and decoded back into the records (full precision structs) when they are read:
+* - Actor locations: fixed point inside the bounds of the quantized locations of the level (FCSWMapRecord::Bounds), 24 (High) or 16 (Low) bits per axis.
+*   Locations outside of the bounds (or without bounds) are written as floats.
+* - Rotations: smallest three. The largest component of the quaternion is dropped, the other three have 15 (High) or 10 (Low) bits, plus 2 bits for its index.
+* - Velocities: half floats.
+* Full precision records have float locations, scales and velocities, quaternions for the actor rotations and rotators for the components.
+* Identity actor scales are omitted.
+*
+* Compact record layout: { uint32 Magic, uint8 Precision, native actor record and component records without their transform and fields
+* (FCSWActorRecord::SerializeRecord(), starting with the record magic and version), pose }.
+* Older compact records have { tagged actor record without its transform and components, int32 NumComponents, tagged component records without their fields }
+* instead of the native records. Records without the compact magic are tagged or native (FCSWActorRecord::Serialize()) and still loaded.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Field/Struct/CSWAutoSaveStruct.h"
+
+/** Identifies a compact actor record ("CSWT"). Tagged records start with the length of a property name and can't be mistaken for it */
+#define CSW_COMPACT_RECORD_MAGIC 0x54575343
+
+struct CSWAUTOSAVEANDLOADSYSTEM_API FCSWTransformCodec
+{
+	/** Bounds of the locations of the records of a level that are quantized */
+	static FBox ComputeBounds(const FCSWMapRecord& MapRecord);
+
+	/** True if the transforms of the record are quantized */
+	static bool IsQuantized(const FCSWActorRecord& ActorRecord) { return ActorRecord.Precision != ECSWTransformPrecision::Full; }
+
+	/** True if Data is a compact record */
+	static bool IsCompactData(const TArray<uint8>& Data);
+
+	/** Write a compact record. Ar converts the names and objects (FObjectAndNameAsStringProxyArchive) */
+	static void SaveCompactRecord(FArchive& Ar, FCSWActorRecord& ActorRecord, const FBox& Bounds);
+
+	/** Read a compact record into a default constructed ActorRecord. Bounds are the ones the level was written with */
+	static void LoadCompactRecord(FArchive& Ar, FCSWActorRecord& ActorRecord, const FBox& Bounds);
+
+private:
+	/** Bits per axis of the locations and per component of the rotations */
+	static void GetBits(const ECSWTransformPrecision Precision, int32& OutLocationBits, int32& OutRotationBits);
+
+	static void SavePose(FArchive& Ar, const FCSWActorRecord& ActorRecord, const FBox& Bounds);
+	static void LoadPose(FArchive& Ar, FCSWActorRecord& ActorRecord, const FBox& Bounds);
+};